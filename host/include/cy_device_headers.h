@@ -0,0 +1,103 @@
+/*******************************************************************************
+* File Name: cy_device_headers.h
+*
+* Description: Host stand-in of the device and CMSIS core definitions used by
+* the HTTPS client. Interrupts map to the host critical section.
+*
+* Related Document: See README.md
+********************************************************************************
+* Copyright 2024-2025, Cypress Semiconductor Corporation (an Infineon company) or
+* an affiliate of Cypress Semiconductor Corporation.  All rights reserved.
+*
+* This software, including source code, documentation and related
+* materials ("Software") is owned by Cypress Semiconductor Corporation
+* or one of its affiliates ("Cypress") and is protected by and subject to
+* worldwide patent protection (United States and foreign),
+* United States copyright laws and international treaty provisions.
+* Therefore, you may use this Software only as provided in the license
+* agreement accompanying the software package from which you
+* obtained this Software ("EULA").
+* If no EULA applies, Cypress hereby grants you a personal, non-exclusive,
+* non-transferable license to copy, modify, and compile the Software
+* source code solely for use in connection with Cypress's
+* integrated circuit products.  Any reproduction, modification, translation,
+* compilation, or representation of this Software except as specified
+* above is prohibited without the express written permission of Cypress.
+*
+* Disclaimer: THIS SOFTWARE IS PROVIDED AS-IS, WITH NO WARRANTY OF ANY KIND,
+* EXPRESS OR IMPLIED, INCLUDING, BUT NOT LIMITED TO, NONINFRINGEMENT, IMPLIED
+* WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE. Cypress
+* reserves the right to make changes to the Software without notice. Cypress
+* does not assume any liability arising out of the application or use of the
+* Software or any product or circuit described in the Software. Cypress does
+* not authorize its products for use in any products where a malfunction or
+* failure of the Cypress product may reasonably be expected to result in
+* significant property damage, injury or death ("High Risk Product"). By
+* including Cypress's product in a High Risk Product, the manufacturer
+* of such system or application assumes all risk of such use and in doing
+* so agrees to indemnify Cypress against all liability.
+*******************************************************************************/
+
+#ifndef CY_DEVICE_HEADERS_H_
+#define CY_DEVICE_HEADERS_H_
+
+/*******************************************************************************
+* Header Files
+*******************************************************************************/
+#include <stdint.h>
+
+/*******************************************************************************
+* Macros
+*******************************************************************************/
+#define __STATIC_INLINE                          static inline
+
+/* Memory barrier of the shared memory rings. */
+#define __DMB()                                  __sync_synchronize()
+
+/* The host has no data cache to maintain. */
+#define __DCACHE_PRESENT                         (0U)
+
+/* The cycle counter of the host counts nanoseconds of the monotonic clock.
+ * Reading DWT updates it.
+ */
+#define DWT                                      (host_dwt())
+#define CoreDebug                                (&host_core_debug)
+#define DWT_CTRL_CYCCNTENA_Msk                   (1UL)
+#define CoreDebug_DEMCR_TRCENA_Msk               (1UL << 24U)
+
+/*******************************************************************************
+* Data Types
+*******************************************************************************/
+typedef int32_t IRQn_Type;
+
+typedef struct
+{
+    volatile uint32_t CTRL;
+    volatile uint32_t CYCCNT;
+} DWT_Type;
+
+typedef struct
+{
+    volatile uint32_t DEMCR;
+} CoreDebug_Type;
+
+/*******************************************************************************
+* Global Variables
+*******************************************************************************/
+
+/* Core clock, at which the cycle counter of the host counts. */
+extern uint32_t SystemCoreClock;
+
+extern CoreDebug_Type host_core_debug;
+
+/*******************************************************************************
+* Function Prototypes
+*******************************************************************************/
+void __disable_irq(void);
+void __enable_irq(void);
+void NVIC_EnableIRQ(IRQn_Type irqn);
+DWT_Type *host_dwt(void);
+
+#endif /* CY_DEVICE_HEADERS_H_ */
+
+/* [] END OF FILE */
@@ -0,0 +1,167 @@
+/*******************************************************************************
+* File Name: cy_http_client_api.h
+*
+* Description: Host stand-in of the HTTP client library API, implemented on
+* the secure sockets stand-in. Requests are written and responses
+* read into the buffer of the request, as the library does.
+*
+* Related Document: See README.md
+********************************************************************************
+* Copyright 2024-2025, Cypress Semiconductor Corporation (an Infineon company) or
+* an affiliate of Cypress Semiconductor Corporation.  All rights reserved.
+*
+* This software, including source code, documentation and related
+* materials ("Software") is owned by Cypress Semiconductor Corporation
+* or one of its affiliates ("Cypress") and is protected by and subject to
+* worldwide patent protection (United States and foreign),
+* United States copyright laws and international treaty provisions.
+* Therefore, you may use this Software only as provided in the license
+* agreement accompanying the software package from which you
+* obtained this Software ("EULA").
+* If no EULA applies, Cypress hereby grants you a personal, non-exclusive,
+* non-transferable license to copy, modify, and compile the Software
+* source code solely for use in connection with Cypress's
+* integrated circuit products.  Any reproduction, modification, translation,
+* compilation, or representation of this Software except as specified
+* above is prohibited without the express written permission of Cypress.
+*
+* Disclaimer: THIS SOFTWARE IS PROVIDED AS-IS, WITH NO WARRANTY OF ANY KIND,
+* EXPRESS OR IMPLIED, INCLUDING, BUT NOT LIMITED TO, NONINFRINGEMENT, IMPLIED
+* WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE. Cypress
+* reserves the right to make changes to the Software without notice. Cypress
+* does not assume any liability arising out of the application or use of the
+* Software or any product or circuit described in the Software. Cypress does
+* not authorize its products for use in any products where a malfunction or
+* failure of the Cypress product may reasonably be expected to result in
+* significant property damage, injury or death ("High Risk Product"). By
+* including Cypress's product in a High Risk Product, the manufacturer
+* of such system or application assumes all risk of such use and in doing
+* so agrees to indemnify Cypress against all liability.
+*******************************************************************************/
+
+#ifndef CY_HTTP_CLIENT_API_H_
+#define CY_HTTP_CLIENT_API_H_
+
+/*******************************************************************************
+* Header Files
+*******************************************************************************/
+#include <stddef.h>
+#include <stdint.h>
+#include "cy_result.h"
+#include "cy_secure_sockets.h"
+
+/*******************************************************************************
+* Macros
+*******************************************************************************/
+#define CY_RSLT_MODULE_HTTP_CLIENT               (0x0211U)
+#define CY_RSLT_HTTP_CLIENT_ERR_BASE                                           \
+        CY_RSLT_CREATE(CY_RSLT_TYPE_ERROR, CY_RSLT_MODULE_HTTP_CLIENT, 0U)
+#define CY_RSLT_HTTP_CLIENT_ERROR_BADARG                                       \
+        (CY_RSLT_HTTP_CLIENT_ERR_BASE + 1U)
+#define CY_RSLT_HTTP_CLIENT_ERROR_NOMEM                                        \
+        (CY_RSLT_HTTP_CLIENT_ERR_BASE + 2U)
+#define CY_RSLT_HTTP_CLIENT_ERROR_NOT_CONNECTED                                \
+        (CY_RSLT_HTTP_CLIENT_ERR_BASE + 5U)
+#define CY_RSLT_HTTP_CLIENT_ERROR_PARSER                                       \
+        (CY_RSLT_HTTP_CLIENT_ERR_BASE + 9U)
+
+/*******************************************************************************
+* Data Types
+*******************************************************************************/
+typedef void *cy_http_client_t;
+
+typedef enum
+{
+    CY_HTTP_CLIENT_METHOD_GET = 0,
+    CY_HTTP_CLIENT_METHOD_PUT,
+    CY_HTTP_CLIENT_METHOD_POST,
+    CY_HTTP_CLIENT_METHOD_HEAD,
+    CY_HTTP_CLIENT_METHOD_DELETE,
+    CY_HTTP_CLIENT_METHOD_PATCH,
+    CY_HTTP_CLIENT_METHOD_CONNECT,
+    CY_HTTP_CLIENT_METHOD_OPTIONS,
+    CY_HTTP_CLIENT_METHOD_TRACE
+} cy_http_client_method_t;
+
+typedef enum
+{
+    CY_HTTP_CLIENT_DISCONN_TYPE_SERVER_INITIATED = 1,
+    CY_HTTP_CLIENT_DISCONN_TYPE_NETWORK_DOWN
+} cy_http_client_disconn_type_t;
+
+typedef void (*cy_http_disconnect_callback_t)(cy_http_client_t handle,
+        cy_http_client_disconn_type_t type, void *user_data);
+
+typedef struct
+{
+    const char *client_cert;
+    uint32_t client_cert_size;
+    const char *private_key;
+    uint32_t private_key_size;
+    const char *root_ca;
+    uint32_t root_ca_size;
+} cy_awsport_ssl_credentials_t;
+
+typedef struct
+{
+    const char *host_name;
+    uint16_t port;
+} cy_awsport_server_info_t;
+
+typedef struct
+{
+    cy_http_client_method_t method;
+    const char *resource_path;
+    uint8_t *buffer;
+    size_t buffer_len;
+    size_t headers_len;
+    int32_t range_start;
+    int32_t range_end;
+} cy_http_client_request_header_t;
+
+typedef struct
+{
+    char *field;
+    size_t field_len;
+    char *value;
+    size_t value_len;
+} cy_http_client_header_t;
+
+typedef struct
+{
+    uint16_t status_code;
+    uint8_t *buffer;
+    size_t buffer_len;
+    const uint8_t *header;
+    size_t headers_len;
+    size_t header_count;
+    const uint8_t *body;
+    size_t body_len;
+    size_t content_len;
+} cy_http_client_response_t;
+
+/*******************************************************************************
+* Function Prototypes
+*******************************************************************************/
+cy_rslt_t cy_http_client_init(void);
+cy_rslt_t cy_http_client_create(cy_awsport_ssl_credentials_t *security,
+                                cy_awsport_server_info_t *server_info,
+                                cy_http_disconnect_callback_t disconn_cb,
+                                void *user_data, cy_http_client_t *handle);
+cy_rslt_t cy_http_client_connect(cy_http_client_t handle,
+                                 uint32_t send_timeout_ms,
+                                 uint32_t receive_timeout_ms);
+cy_rslt_t cy_http_client_write_header(cy_http_client_t handle,
+                                      cy_http_client_request_header_t *request,
+                                      cy_http_client_header_t *header,
+                                      uint32_t num_header);
+cy_rslt_t cy_http_client_send(cy_http_client_t handle,
+                              cy_http_client_request_header_t *request,
+                              uint8_t *payload, uint32_t payload_len,
+                              cy_http_client_response_t *response);
+cy_rslt_t cy_http_client_disconnect(cy_http_client_t handle);
+cy_rslt_t cy_http_client_delete(cy_http_client_t handle);
+
+#endif /* CY_HTTP_CLIENT_API_H_ */
+
+/* [] END OF FILE */
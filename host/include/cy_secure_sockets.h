@@ -0,0 +1,158 @@
+/*******************************************************************************
+* File Name: cy_secure_sockets.h
+*
+* Description: Host stand-in of the secure sockets library, on POSIX sockets
+* and OpenSSL. Only the options used by the HTTPS client are
+* provided.
+*
+* Related Document: See README.md
+********************************************************************************
+* Copyright 2024-2025, Cypress Semiconductor Corporation (an Infineon company) or
+* an affiliate of Cypress Semiconductor Corporation.  All rights reserved.
+*
+* This software, including source code, documentation and related
+* materials ("Software") is owned by Cypress Semiconductor Corporation
+* or one of its affiliates ("Cypress") and is protected by and subject to
+* worldwide patent protection (United States and foreign),
+* United States copyright laws and international treaty provisions.
+* Therefore, you may use this Software only as provided in the license
+* agreement accompanying the software package from which you
+* obtained this Software ("EULA").
+* If no EULA applies, Cypress hereby grants you a personal, non-exclusive,
+* non-transferable license to copy, modify, and compile the Software
+* source code solely for use in connection with Cypress's
+* integrated circuit products.  Any reproduction, modification, translation,
+* compilation, or representation of this Software except as specified
+* above is prohibited without the express written permission of Cypress.
+*
+* Disclaimer: THIS SOFTWARE IS PROVIDED AS-IS, WITH NO WARRANTY OF ANY KIND,
+* EXPRESS OR IMPLIED, INCLUDING, BUT NOT LIMITED TO, NONINFRINGEMENT, IMPLIED
+* WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE. Cypress
+* reserves the right to make changes to the Software without notice. Cypress
+* does not assume any liability arising out of the application or use of the
+* Software or any product or circuit described in the Software. Cypress does
+* not authorize its products for use in any products where a malfunction or
+* failure of the Cypress product may reasonably be expected to result in
+* significant property damage, injury or death ("High Risk Product"). By
+* including Cypress's product in a High Risk Product, the manufacturer
+* of such system or application assumes all risk of such use and in doing
+* so agrees to indemnify Cypress against all liability.
+*******************************************************************************/
+
+#ifndef CY_SECURE_SOCKETS_H_
+#define CY_SECURE_SOCKETS_H_
+
+/*******************************************************************************
+* Header Files
+*******************************************************************************/
+#include <stdint.h>
+#include "cy_result.h"
+
+/*******************************************************************************
+* Macros
+*******************************************************************************/
+#define CY_SOCKET_DOMAIN_AF_INET                 (0U)
+#define CY_SOCKET_TYPE_STREAM                    (1U)
+#define CY_SOCKET_IPPROTO_TCP                    (1U)
+#define CY_SOCKET_IPPROTO_TLS                    (2U)
+
+#define CY_SOCKET_SOL_SOCKET                     (1U)
+#define CY_SOCKET_SOL_TCP                        (2U)
+#define CY_SOCKET_SOL_TLS                        (3U)
+
+#define CY_SOCKET_SO_RCVTIMEO                    (0U)
+#define CY_SOCKET_SO_SNDTIMEO                    (1U)
+#define CY_SOCKET_SO_RECEIVE_CALLBACK            (6U)
+#define CY_SOCKET_SO_DISCONNECT_CALLBACK         (7U)
+#define CY_SOCKET_SO_TLS_IDENTITY                (0U)
+#define CY_SOCKET_SO_TLS_AUTH_MODE               (1U)
+#define CY_SOCKET_SO_TRUSTED_ROOTCA_CERTIFICATE  (2U)
+
+#define CY_SOCKET_FLAGS_NONE                     (0U)
+#define CY_SOCKET_NEVER_TIMEOUT                  (0xFFFFFFFFU)
+
+#define CY_RSLT_MODULE_SECURE_SOCKETS            (0x0204U)
+#define CY_RSLT_SECURE_SOCKETS_ERR_BASE                                        \
+        CY_RSLT_CREATE(CY_RSLT_TYPE_ERROR, CY_RSLT_MODULE_SECURE_SOCKETS, 0U)
+#define CY_RSLT_MODULE_SECURE_SOCKETS_NOMEM                                    \
+        (CY_RSLT_SECURE_SOCKETS_ERR_BASE + 2U)
+#define CY_RSLT_MODULE_SECURE_SOCKETS_BADARG                                   \
+        (CY_RSLT_SECURE_SOCKETS_ERR_BASE + 3U)
+#define CY_RSLT_MODULE_SECURE_SOCKETS_TIMEOUT                                  \
+        (CY_RSLT_SECURE_SOCKETS_ERR_BASE + 4U)
+#define CY_RSLT_MODULE_SECURE_SOCKETS_NOT_CONNECTED                            \
+        (CY_RSLT_SECURE_SOCKETS_ERR_BASE + 9U)
+#define CY_RSLT_MODULE_SECURE_SOCKETS_CLOSED                                   \
+        (CY_RSLT_SECURE_SOCKETS_ERR_BASE + 14U)
+#define CY_RSLT_MODULE_SECURE_SOCKETS_HOST_NOT_FOUND                           \
+        (CY_RSLT_SECURE_SOCKETS_ERR_BASE + 15U)
+#define CY_RSLT_MODULE_SECURE_SOCKETS_TLS_ERROR                                \
+        (CY_RSLT_SECURE_SOCKETS_ERR_BASE + 26U)
+
+/*******************************************************************************
+* Data Types
+*******************************************************************************/
+typedef void *cy_socket_t;
+
+typedef enum
+{
+    CY_SOCKET_IP_VER_V4 = 4,
+    CY_SOCKET_IP_VER_V6 = 6
+} cy_socket_ip_version_t;
+
+typedef enum
+{
+    CY_SOCKET_TLS_VERIFY_NONE = 0,
+    CY_SOCKET_TLS_VERIFY_OPTIONAL,
+    CY_SOCKET_TLS_VERIFY_REQUIRED
+} cy_socket_tls_auth_mode_t;
+
+/* Addresses are in network byte order. */
+typedef struct
+{
+    cy_socket_ip_version_t version;
+    union
+    {
+        uint32_t v4;
+        uint32_t v6[4];
+    } ip;
+} cy_socket_ip_address_t;
+
+typedef struct
+{
+    uint16_t port;
+    cy_socket_ip_address_t ip_address;
+} cy_socket_sockaddr_t;
+
+typedef cy_rslt_t (*cy_socket_callback_t)(cy_socket_t socket, void *arg);
+
+typedef struct
+{
+    cy_socket_callback_t callback;
+    void *arg;
+} cy_socket_opt_callback_t;
+
+/*******************************************************************************
+* Function Prototypes
+*******************************************************************************/
+cy_rslt_t cy_socket_init(void);
+cy_rslt_t cy_socket_create(int domain, int type, int protocol,
+                           cy_socket_t *handle);
+cy_rslt_t cy_socket_setsockopt(cy_socket_t handle, int level, int optname,
+                               const void *optval, uint32_t optlen);
+cy_rslt_t cy_socket_gethostbyname(const char *hostname,
+                                  cy_socket_ip_version_t ip_ver,
+                                  cy_socket_ip_address_t *addr);
+cy_rslt_t cy_socket_connect(cy_socket_t handle,
+                            cy_socket_sockaddr_t *address,
+                            uint32_t address_length);
+cy_rslt_t cy_socket_send(cy_socket_t handle, const void *buffer,
+                         uint32_t length, int flags, uint32_t *bytes_sent);
+cy_rslt_t cy_socket_recv(cy_socket_t handle, void *buffer, uint32_t length,
+                         int flags, uint32_t *bytes_received);
+cy_rslt_t cy_socket_disconnect(cy_socket_t handle, uint32_t timeout);
+cy_rslt_t cy_socket_delete(cy_socket_t handle);
+
+#endif /* CY_SECURE_SOCKETS_H_ */
+
+/* [] END OF FILE */
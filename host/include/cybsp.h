@@ -0,0 +1,132 @@
+/*******************************************************************************
+* File Name: cybsp.h
+*
+* Description: Host stand-in of the board support package: the pins,
+* interrupts and power configuration of the kit, and the SD host
+* and interrupt drivers used by the HTTPS client.
+*
+* Related Document: See README.md
+********************************************************************************
+* Copyright 2024-2025, Cypress Semiconductor Corporation (an Infineon company) or
+* an affiliate of Cypress Semiconductor Corporation.  All rights reserved.
+*
+* This software, including source code, documentation and related
+* materials ("Software") is owned by Cypress Semiconductor Corporation
+* or one of its affiliates ("Cypress") and is protected by and subject to
+* worldwide patent protection (United States and foreign),
+* United States copyright laws and international treaty provisions.
+* Therefore, you may use this Software only as provided in the license
+* agreement accompanying the software package from which you
+* obtained this Software ("EULA").
+* If no EULA applies, Cypress hereby grants you a personal, non-exclusive,
+* non-transferable license to copy, modify, and compile the Software
+* source code solely for use in connection with Cypress's
+* integrated circuit products.  Any reproduction, modification, translation,
+* compilation, or representation of this Software except as specified
+* above is prohibited without the express written permission of Cypress.
+*
+* Disclaimer: THIS SOFTWARE IS PROVIDED AS-IS, WITH NO WARRANTY OF ANY KIND,
+* EXPRESS OR IMPLIED, INCLUDING, BUT NOT LIMITED TO, NONINFRINGEMENT, IMPLIED
+* WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE. Cypress
+* reserves the right to make changes to the Software without notice. Cypress
+* does not assume any liability arising out of the application or use of the
+* Software or any product or circuit described in the Software. Cypress does
+* not authorize its products for use in any products where a malfunction or
+* failure of the Cypress product may reasonably be expected to result in
+* significant property damage, injury or death ("High Risk Product"). By
+* including Cypress's product in a High Risk Product, the manufacturer
+* of such system or application assumes all risk of such use and in doing
+* so agrees to indemnify Cypress against all liability.
+*******************************************************************************/
+
+#ifndef CYBSP_H_
+#define CYBSP_H_
+
+/*******************************************************************************
+* Header Files
+*******************************************************************************/
+#include "cy_result.h"
+#include "cy_device_headers.h"
+#include "cy_syslib.h"
+#include "cy_utils.h"
+#include "mtb_hal.h"
+#include <stdbool.h>
+
+/*******************************************************************************
+* Macros
+*******************************************************************************/
+
+/* System idle mode of the device configurator. The host never enters deep
+ * sleep, so no deep sleep callbacks are registered.
+ */
+#define CY_CFG_PWR_MODE_ACTIVE                   (0x04UL)
+#define CY_CFG_PWR_MODE_SLEEP                    (0x08UL)
+#define CY_CFG_PWR_MODE_DEEPSLEEP                (0x10UL)
+#define CY_CFG_PWR_SYS_IDLE_MODE                 CY_CFG_PWR_MODE_SLEEP
+
+#define CYBSP_WIFI_SDIO_HW                       ((SDHC_Type *) NULL)
+#define CYBSP_WIFI_SDIO_IRQ                      ((IRQn_Type) 0)
+#define CYBSP_WIFI_HOST_WAKE_IRQ                 ((IRQn_Type) 1)
+#define CYBSP_WIFI_WL_REG_ON_PORT_NUM            (0U)
+#define CYBSP_WIFI_WL_REG_ON_PIN                 (0U)
+#define CYBSP_WIFI_HOST_WAKE_PORT_NUM            (0U)
+#define CYBSP_WIFI_HOST_WAKE_PIN                 (1U)
+#define CYBSP_DEBUG_UART_HW                      ((CySCB_Type *) NULL)
+
+#define CY_SD_HOST_BUS_WIDTH_4_BIT               (1U)
+
+/* IPC channel and interrupt structure free for the application. The host has
+ * no second core to notify.
+ */
+#define CY_IPC_CHAN_USER                         (8U)
+#define CY_IPC_INTR_USER                         (4U)
+
+/*******************************************************************************
+* Data Types
+*******************************************************************************/
+typedef struct SDHC_Type SDHC_Type;
+typedef struct CySCB_Type CySCB_Type;
+typedef struct IPC_STRUCT_Type IPC_STRUCT_Type;
+
+typedef enum
+{
+    CY_SYSINT_SUCCESS = 0,
+    CY_SYSINT_BAD_PARAM = 1
+} cy_en_sysint_status_t;
+
+typedef struct
+{
+    IRQn_Type intrSrc;
+    uint32_t intrPriority;
+} cy_stc_sysint_t;
+
+typedef void (*cy_israddress)(void);
+
+typedef struct
+{
+    uint32_t reserved;
+} cy_stc_sd_host_context_t;
+
+/*******************************************************************************
+* Global Variables
+*******************************************************************************/
+extern const mtb_hal_sdio_configurator_t CYBSP_WIFI_SDIO_sdio_hal_config;
+
+/*******************************************************************************
+* Function Prototypes
+*******************************************************************************/
+cy_rslt_t cybsp_init(void);
+cy_en_sysint_status_t Cy_SysInt_Init(const cy_stc_sysint_t *config,
+                                     cy_israddress userIsr);
+void Cy_SD_Host_Enable(SDHC_Type *base);
+uint32_t Cy_SD_Host_Init(SDHC_Type *base, const void *config,
+                         cy_stc_sd_host_context_t *context);
+void Cy_SD_Host_SetHostBusWidth(SDHC_Type *base, uint32_t width);
+uint32_t Cy_SCB_UART_Put(CySCB_Type *base, uint32_t data);
+bool Cy_SCB_UART_IsTxComplete(CySCB_Type const *base);
+IPC_STRUCT_Type *Cy_IPC_Drv_GetIpcBaseAddress(uint32_t ipcIndex);
+void Cy_IPC_Drv_AcquireNotify(IPC_STRUCT_Type *base, uint32_t notifyEventIntr);
+
+#endif /* CYBSP_H_ */
+
+/* [] END OF FILE */
@@ -0,0 +1,91 @@
+/*******************************************************************************
+* File Name: mtb_hal.h
+*
+* Description: Host stand-in of the hardware abstraction layer objects used to
+* set up the SDIO bus of the Wi-Fi device. There is no bus on the
+* host; the calls succeed without doing anything.
+*
+* Related Document: See README.md
+********************************************************************************
+* Copyright 2024-2025, Cypress Semiconductor Corporation (an Infineon company) or
+* an affiliate of Cypress Semiconductor Corporation.  All rights reserved.
+*
+* This software, including source code, documentation and related
+* materials ("Software") is owned by Cypress Semiconductor Corporation
+* or one of its affiliates ("Cypress") and is protected by and subject to
+* worldwide patent protection (United States and foreign),
+* United States copyright laws and international treaty provisions.
+* Therefore, you may use this Software only as provided in the license
+* agreement accompanying the software package from which you
+* obtained this Software ("EULA").
+* If no EULA applies, Cypress hereby grants you a personal, non-exclusive,
+* non-transferable license to copy, modify, and compile the Software
+* source code solely for use in connection with Cypress's
+* integrated circuit products.  Any reproduction, modification, translation,
+* compilation, or representation of this Software except as specified
+* above is prohibited without the express written permission of Cypress.
+*
+* Disclaimer: THIS SOFTWARE IS PROVIDED AS-IS, WITH NO WARRANTY OF ANY KIND,
+* EXPRESS OR IMPLIED, INCLUDING, BUT NOT LIMITED TO, NONINFRINGEMENT, IMPLIED
+* WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE. Cypress
+* reserves the right to make changes to the Software without notice. Cypress
+* does not assume any liability arising out of the application or use of the
+* Software or any product or circuit described in the Software. Cypress does
+* not authorize its products for use in any products where a malfunction or
+* failure of the Cypress product may reasonably be expected to result in
+* significant property damage, injury or death ("High Risk Product"). By
+* including Cypress's product in a High Risk Product, the manufacturer
+* of such system or application assumes all risk of such use and in doing
+* so agrees to indemnify Cypress against all liability.
+*******************************************************************************/
+
+#ifndef MTB_HAL_H_
+#define MTB_HAL_H_
+
+/*******************************************************************************
+* Header Files
+*******************************************************************************/
+#include <stdint.h>
+#include "cy_result.h"
+
+/*******************************************************************************
+* Data Types
+*******************************************************************************/
+typedef struct
+{
+    uint32_t port;
+    uint32_t pin;
+} mtb_hal_gpio_t;
+
+typedef struct
+{
+    uint32_t block_size;
+} mtb_hal_sdio_t;
+
+typedef struct
+{
+    uint32_t frequencyhal_hz;
+    uint16_t block_size;
+} mtb_hal_sdio_cfg_t;
+
+typedef struct
+{
+    const void *host_config;
+} mtb_hal_sdio_configurator_t;
+
+/*******************************************************************************
+* Function Prototypes
+*******************************************************************************/
+cy_rslt_t mtb_hal_sdio_setup(mtb_hal_sdio_t *obj,
+                             const mtb_hal_sdio_configurator_t *config,
+                             void *gpio_config, void *host_context);
+cy_rslt_t mtb_hal_sdio_configure(mtb_hal_sdio_t *obj,
+                                 const mtb_hal_sdio_cfg_t *config);
+void mtb_hal_sdio_process_interrupt(mtb_hal_sdio_t *obj);
+cy_rslt_t mtb_hal_gpio_setup(mtb_hal_gpio_t *obj, uint32_t port,
+                             uint32_t pin);
+void mtb_hal_gpio_process_interrupt(mtb_hal_gpio_t *obj);
+
+#endif /* MTB_HAL_H_ */
+
+/* [] END OF FILE */
@@ -0,0 +1,86 @@
+/*******************************************************************************
+* File Name: task.h
+*
+* Description: Host stand-in of the FreeRTOS task API. A task is a POSIX
+* thread with a notification count, and the critical section is
+* one recursive mutex shared by all threads.
+*
+* Related Document: See README.md
+********************************************************************************
+* Copyright 2024-2025, Cypress Semiconductor Corporation (an Infineon company) or
+* an affiliate of Cypress Semiconductor Corporation.  All rights reserved.
+*
+* This software, including source code, documentation and related
+* materials ("Software") is owned by Cypress Semiconductor Corporation
+* or one of its affiliates ("Cypress") and is protected by and subject to
+* worldwide patent protection (United States and foreign),
+* United States copyright laws and international treaty provisions.
+* Therefore, you may use this Software only as provided in the license
+* agreement accompanying the software package from which you
+* obtained this Software ("EULA").
+* If no EULA applies, Cypress hereby grants you a personal, non-exclusive,
+* non-transferable license to copy, modify, and compile the Software
+* source code solely for use in connection with Cypress's
+* integrated circuit products.  Any reproduction, modification, translation,
+* compilation, or representation of this Software except as specified
+* above is prohibited without the express written permission of Cypress.
+*
+* Disclaimer: THIS SOFTWARE IS PROVIDED AS-IS, WITH NO WARRANTY OF ANY KIND,
+* EXPRESS OR IMPLIED, INCLUDING, BUT NOT LIMITED TO, NONINFRINGEMENT, IMPLIED
+* WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE. Cypress
+* reserves the right to make changes to the Software without notice. Cypress
+* does not assume any liability arising out of the application or use of the
+* Software or any product or circuit described in the Software. Cypress does
+* not authorize its products for use in any products where a malfunction or
+* failure of the Cypress product may reasonably be expected to result in
+* significant property damage, injury or death ("High Risk Product"). By
+* including Cypress's product in a High Risk Product, the manufacturer
+* of such system or application assumes all risk of such use and in doing
+* so agrees to indemnify Cypress against all liability.
+*******************************************************************************/
+
+#ifndef INC_TASK_H
+#define INC_TASK_H
+
+/*******************************************************************************
+* Header Files
+*******************************************************************************/
+#include "FreeRTOS.h"
+
+/*******************************************************************************
+* Macros
+*******************************************************************************/
+#define taskENTER_CRITICAL()                     vTaskEnterCritical()
+#define taskEXIT_CRITICAL()                      vTaskExitCritical()
+
+#define taskSCHEDULER_NOT_STARTED                ((BaseType_t) 1)
+#define taskSCHEDULER_RUNNING                    ((BaseType_t) 2)
+
+/*******************************************************************************
+* Data Types
+*******************************************************************************/
+typedef struct tskTaskControlBlock *TaskHandle_t;
+typedef void (*TaskFunction_t)(void *);
+
+/*******************************************************************************
+* Function Prototypes
+*******************************************************************************/
+BaseType_t xTaskCreate(TaskFunction_t pxTaskCode, const char * const pcName,
+                       const uint32_t usStackDepth, void * const pvParameters,
+                       UBaseType_t uxPriority,
+                       TaskHandle_t * const pxCreatedTask);
+void vTaskStartScheduler(void);
+void vTaskDelay(const TickType_t xTicksToDelay);
+TickType_t xTaskGetTickCount(void);
+BaseType_t xTaskGetSchedulerState(void);
+TaskHandle_t xTaskGetCurrentTaskHandle(void);
+BaseType_t xTaskNotifyGive(TaskHandle_t xTaskToNotify);
+uint32_t ulTaskNotifyTake(BaseType_t xClearCountOnExit,
+                          TickType_t xTicksToWait);
+UBaseType_t uxTaskGetStackHighWaterMark(TaskHandle_t xTask);
+void vTaskEnterCritical(void);
+void vTaskExitCritical(void);
+
+#endif /* INC_TASK_H */
+
+/* [] END OF FILE */
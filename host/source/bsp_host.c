@@ -0,0 +1,300 @@
+/*******************************************************************************
+* File Name: bsp_host.c
+*
+* Description: This file contains the board support stand-in of the Linux
+* build. The SDIO bus, interrupts and GPIOs of the Wi-Fi device
+* do not exist on the host, so their setup succeeds without doing
+* anything, and the critical section of the system library is the
+* one of the FreeRTOS stand-in.
+*
+* Related Document: See README.md
+********************************************************************************
+* Copyright 2024-2025, Cypress Semiconductor Corporation (an Infineon company) or
+* an affiliate of Cypress Semiconductor Corporation.  All rights reserved.
+*
+* This software, including source code, documentation and related
+* materials ("Software") is owned by Cypress Semiconductor Corporation
+* or one of its affiliates ("Cypress") and is protected by and subject to
+* worldwide patent protection (United States and foreign),
+* United States copyright laws and international treaty provisions.
+* Therefore, you may use this Software only as provided in the license
+* agreement accompanying the software package from which you
+* obtained this Software ("EULA").
+* If no EULA applies, Cypress hereby grants you a personal, non-exclusive,
+* non-transferable license to copy, modify, and compile the Software
+* source code solely for use in connection with Cypress's
+* integrated circuit products.  Any reproduction, modification, translation,
+* compilation, or representation of this Software except as specified
+* above is prohibited without the express written permission of Cypress.
+*
+* Disclaimer: THIS SOFTWARE IS PROVIDED AS-IS, WITH NO WARRANTY OF ANY KIND,
+* EXPRESS OR IMPLIED, INCLUDING, BUT NOT LIMITED TO, NONINFRINGEMENT, IMPLIED
+* WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE. Cypress
+* reserves the right to make changes to the Software without notice. Cypress
+* does not assume any liability arising out of the application or use of the
+* Software or any product or circuit described in the Software. Cypress does
+* not authorize its products for use in any products where a malfunction or
+* failure of the Cypress product may reasonably be expected to result in
+* significant property damage, injury or death ("High Risk Product"). By
+* including Cypress's product in a High Risk Product, the manufacturer
+* of such system or application assumes all risk of such use and in doing
+* so agrees to indemnify Cypress against all liability.
+*******************************************************************************/
+
+/*******************************************************************************
+* Header Files
+*******************************************************************************/
+#include "cybsp.h"
+#include "mtb_hal.h"
+
+/* FreeRTOS header file */
+#include <FreeRTOS.h>
+#include <task.h>
+#include <stdio.h>
+#include <time.h>
+
+/*******************************************************************************
+* Macros
+*******************************************************************************/
+#define NS_PER_SECOND                            (1000000000UL)
+
+/*******************************************************************************
+* Global Variables
+*******************************************************************************/
+const mtb_hal_sdio_configurator_t CYBSP_WIFI_SDIO_sdio_hal_config =
+{
+    .host_config = NULL
+};
+
+uint32_t SystemCoreClock = NS_PER_SECOND;
+
+CoreDebug_Type host_core_debug;
+
+static DWT_Type host_dwt_regs;
+
+/*******************************************************************************
+* Function Definitions
+*******************************************************************************/
+
+/*******************************************************************************
+* Function Name: cybsp_init
+*******************************************************************************/
+cy_rslt_t cybsp_init(void)
+{
+    return CY_RSLT_SUCCESS;
+}
+
+/*******************************************************************************
+* Function Name: host_dwt
+********************************************************************************
+* Summary:
+*  Returns the DWT registers with the cycle counter set to the monotonic
+*  clock in nanoseconds, wrapping as the counter of the core does.
+*
+*******************************************************************************/
+DWT_Type *host_dwt(void)
+{
+    struct timespec now;
+
+    (void) clock_gettime(CLOCK_MONOTONIC, &now);
+    host_dwt_regs.CYCCNT = (uint32_t) (((uint64_t) now.tv_sec *
+                                        NS_PER_SECOND) +
+                                       (uint64_t) now.tv_nsec);
+
+    return &host_dwt_regs;
+}
+
+/*******************************************************************************
+* Function Name: __disable_irq
+********************************************************************************
+* Summary:
+*  Called by handle_app_error before it stops. The host has no interrupts
+*  to mask.
+*
+*******************************************************************************/
+void __disable_irq(void)
+{
+}
+
+/*******************************************************************************
+* Function Name: __enable_irq
+*******************************************************************************/
+void __enable_irq(void)
+{
+}
+
+/*******************************************************************************
+* Function Name: NVIC_EnableIRQ
+*******************************************************************************/
+void NVIC_EnableIRQ(IRQn_Type irqn)
+{
+    CY_UNUSED_PARAMETER(irqn);
+}
+
+/*******************************************************************************
+* Function Name: Cy_SysInt_Init
+*******************************************************************************/
+cy_en_sysint_status_t Cy_SysInt_Init(const cy_stc_sysint_t *config,
+                                     cy_israddress userIsr)
+{
+    CY_UNUSED_PARAMETER(config);
+    CY_UNUSED_PARAMETER(userIsr);
+
+    return CY_SYSINT_SUCCESS;
+}
+
+/*******************************************************************************
+* Function Name: Cy_IPC_Drv_GetIpcBaseAddress
+*******************************************************************************/
+IPC_STRUCT_Type *Cy_IPC_Drv_GetIpcBaseAddress(uint32_t ipcIndex)
+{
+    CY_UNUSED_PARAMETER(ipcIndex);
+
+    return NULL;
+}
+
+/*******************************************************************************
+* Function Name: Cy_IPC_Drv_AcquireNotify
+*******************************************************************************/
+void Cy_IPC_Drv_AcquireNotify(IPC_STRUCT_Type *base, uint32_t notifyEventIntr)
+{
+    CY_UNUSED_PARAMETER(base);
+    CY_UNUSED_PARAMETER(notifyEventIntr);
+}
+
+/*******************************************************************************
+* Function Name: Cy_SysLib_EnterCriticalSection
+*******************************************************************************/
+uint32_t Cy_SysLib_EnterCriticalSection(void)
+{
+    taskENTER_CRITICAL();
+
+    return 0U;
+}
+
+/*******************************************************************************
+* Function Name: Cy_SysLib_ExitCriticalSection
+*******************************************************************************/
+void Cy_SysLib_ExitCriticalSection(uint32_t savedIntrStatus)
+{
+    CY_UNUSED_PARAMETER(savedIntrStatus);
+
+    taskEXIT_CRITICAL();
+}
+
+/*******************************************************************************
+* Function Name: Cy_SD_Host_Enable
+*******************************************************************************/
+void Cy_SD_Host_Enable(SDHC_Type *base)
+{
+    CY_UNUSED_PARAMETER(base);
+}
+
+/*******************************************************************************
+* Function Name: Cy_SD_Host_Init
+*******************************************************************************/
+uint32_t Cy_SD_Host_Init(SDHC_Type *base, const void *config,
+                         cy_stc_sd_host_context_t *context)
+{
+    CY_UNUSED_PARAMETER(base);
+    CY_UNUSED_PARAMETER(config);
+    CY_UNUSED_PARAMETER(context);
+
+    return 0U;
+}
+
+/*******************************************************************************
+* Function Name: Cy_SD_Host_SetHostBusWidth
+*******************************************************************************/
+void Cy_SD_Host_SetHostBusWidth(SDHC_Type *base, uint32_t width)
+{
+    CY_UNUSED_PARAMETER(base);
+    CY_UNUSED_PARAMETER(width);
+}
+
+/*******************************************************************************
+* Function Name: Cy_SCB_UART_Put
+********************************************************************************
+* Summary:
+*  Writes a byte of the debug UART to stdout. The FIFO of the host is never
+*  full.
+*
+*******************************************************************************/
+uint32_t Cy_SCB_UART_Put(CySCB_Type *base, uint32_t data)
+{
+    (void) base;
+    (void) putchar((int) data);
+
+    return 1U;
+}
+
+/*******************************************************************************
+* Function Name: Cy_SCB_UART_IsTxComplete
+********************************************************************************
+* Summary:
+*  Sends the buffered stdout, as the UART sends its FIFO.
+*
+*******************************************************************************/
+bool Cy_SCB_UART_IsTxComplete(CySCB_Type const *base)
+{
+    (void) base;
+
+    return (0 == fflush(stdout));
+}
+
+/*******************************************************************************
+* Function Name: mtb_hal_sdio_setup
+*******************************************************************************/
+cy_rslt_t mtb_hal_sdio_setup(mtb_hal_sdio_t *obj,
+                             const mtb_hal_sdio_configurator_t *config,
+                             void *gpio_config, void *host_context)
+{
+    CY_UNUSED_PARAMETER(obj);
+    CY_UNUSED_PARAMETER(config);
+    CY_UNUSED_PARAMETER(gpio_config);
+    CY_UNUSED_PARAMETER(host_context);
+
+    return CY_RSLT_SUCCESS;
+}
+
+/*******************************************************************************
+* Function Name: mtb_hal_sdio_configure
+*******************************************************************************/
+cy_rslt_t mtb_hal_sdio_configure(mtb_hal_sdio_t *obj,
+                                 const mtb_hal_sdio_cfg_t *config)
+{
+    obj->block_size = config->block_size;
+
+    return CY_RSLT_SUCCESS;
+}
+
+/*******************************************************************************
+* Function Name: mtb_hal_sdio_process_interrupt
+*******************************************************************************/
+void mtb_hal_sdio_process_interrupt(mtb_hal_sdio_t *obj)
+{
+    CY_UNUSED_PARAMETER(obj);
+}
+
+/*******************************************************************************
+* Function Name: mtb_hal_gpio_setup
+*******************************************************************************/
+cy_rslt_t mtb_hal_gpio_setup(mtb_hal_gpio_t *obj, uint32_t port,
+                             uint32_t pin)
+{
+    obj->port = port;
+    obj->pin = pin;
+
+    return CY_RSLT_SUCCESS;
+}
+
+/*******************************************************************************
+* Function Name: mtb_hal_gpio_process_interrupt
+*******************************************************************************/
+void mtb_hal_gpio_process_interrupt(mtb_hal_gpio_t *obj)
+{
+    CY_UNUSED_PARAMETER(obj);
+}
+
+
+/* [] END OF FILE */
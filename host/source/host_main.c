@@ -0,0 +1,187 @@
+/*******************************************************************************
+* File Name: host_main.c
+*
+* Description: This file contains the entry function of the Linux build. It
+* starts the HTTPS Client task as main.c does on the board, with
+* the console on stdin and stdout.
+*
+* Related Document: See README.md
+********************************************************************************
+* Copyright 2024-2025, Cypress Semiconductor Corporation (an Infineon company) or
+* an affiliate of Cypress Semiconductor Corporation.  All rights reserved.
+*
+* This software, including source code, documentation and related
+* materials ("Software") is owned by Cypress Semiconductor Corporation
+* or one of its affiliates ("Cypress") and is protected by and subject to
+* worldwide patent protection (United States and foreign),
+* United States copyright laws and international treaty provisions.
+* Therefore, you may use this Software only as provided in the license
+* agreement accompanying the software package from which you
+* obtained this Software ("EULA").
+* If no EULA applies, Cypress hereby grants you a personal, non-exclusive,
+* non-transferable license to copy, modify, and compile the Software
+* source code solely for use in connection with Cypress's
+* integrated circuit products.  Any reproduction, modification, translation,
+* compilation, or representation of this Software except as specified
+* above is prohibited without the express written permission of Cypress.
+*
+* Disclaimer: THIS SOFTWARE IS PROVIDED AS-IS, WITH NO WARRANTY OF ANY KIND,
+* EXPRESS OR IMPLIED, INCLUDING, BUT NOT LIMITED TO, NONINFRINGEMENT, IMPLIED
+* WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE. Cypress
+* reserves the right to make changes to the Software without notice. Cypress
+* does not assume any liability arising out of the application or use of the
+* Software or any product or circuit described in the Software. Cypress does
+* not authorize its products for use in any products where a malfunction or
+* failure of the Cypress product may reasonably be expected to result in
+* significant property damage, injury or death ("High Risk Product"). By
+* including Cypress's product in a High Risk Product, the manufacturer
+* of such system or application assumes all risk of such use and in doing
+* so agrees to indemnify Cypress against all liability.
+*******************************************************************************/
+
+/*******************************************************************************
+* Header Files
+*******************************************************************************/
+#include "secure_http_client.h"
+#include "FreeRTOS.h"
+#include <task.h>
+#include "retarget_io_init.h"
+#include "boot_trace.h"
+#include "host_platform.h"
+#include <stdarg.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+/*******************************************************************************
+* Macros
+*******************************************************************************/
+
+/* RTOS related macros. */
+#define HTTPS_CLIENT_TASK_STACK_SIZE        (10U * 1024U)
+#define HTTPS_CLIENT_TASK_PRIORITY          (1U)
+
+/* Time given to the log task to send the output before exiting. */
+#define EXIT_LOG_FLUSH_TIMEOUT_MS           (1000U)
+
+/*******************************************************************************
+* Global Variables
+********************************************************************************/
+
+/* HTTPS client task handle. */
+TaskHandle_t https_client_task_handle;
+
+/*******************************************************************************
+* Function Prototypes
+********************************************************************************/
+int __wrap___isoc99_scanf(const char *format, ...);
+
+/*******************************************************************************
+* Function Definitions
+*******************************************************************************/
+
+/*******************************************************************************
+* Function Name: __wrap___isoc99_scanf
+********************************************************************************
+* Summary:
+*  Reads the console for the menu, in place of scanf, which glibc names
+*  __isoc99_scanf. The UART never ends, but stdin does, and the menu would
+*  then spin on the failed reads: the application exits when the input ends
+*  instead.
+*
+*******************************************************************************/
+int __wrap___isoc99_scanf(const char *format, ...)
+{
+    va_list args;
+    int result;
+
+    va_start(args, format);
+    result = vscanf(format, args);
+    va_end(args);
+
+    if (EOF == result)
+    {
+        app_log_flush(EXIT_LOG_FLUSH_TIMEOUT_MS);
+        exit(EXIT_SUCCESS);
+    }
+
+    return result;
+}
+
+/*******************************************************************************
+* Function Name: main
+********************************************************************************
+* Summary:
+*  Entry function for the Linux build. Takes the directory of the
+*  certificate files with --cert-dir, then starts the HTTPS Client task as
+*  on the board.
+*
+* Parameters:
+*  argc - Number of arguments
+*  argv - Arguments
+*
+* Return:
+*  int: Only returns on a wrong argument.
+*
+*******************************************************************************/
+int main(int argc, char *argv[])
+{
+    cy_rslt_t result;
+
+    for (int i = 1; i < argc; i++)
+    {
+        if ((0 == strcmp(argv[i], "--cert-dir")) && ((i + 1) < argc))
+        {
+            host_tls_set_cert_dir(argv[++i]);
+        }
+        else
+        {
+            fprintf(stderr, "Usage: %s [--cert-dir <directory>]\n", argv[0]);
+            return EXIT_FAILURE;
+        }
+    }
+
+    /* The log task writes the console a byte at a time, which stdout sends
+     * a line at a time.
+     */
+    (void) setvbuf(stdout, NULL, _IOLBF, BUFSIZ);
+
+    /* Start the cycle counter for the boot trace. */
+    boot_trace_init();
+
+    /* Initialize the Board Support Package (BSP) */
+    BOOT_TRACE_BEGIN_PHASE(BOOT_TRACE_CYBSP_INIT);
+    result = cybsp_init();
+    BOOT_TRACE_END_PHASE(BOOT_TRACE_CYBSP_INIT);
+
+    /* Board init failed. Stop program execution */
+    if (CY_RSLT_SUCCESS != result)
+    {
+        handle_app_error();
+    }
+
+    printf("===============================================================\n");
+    printf("PSOC Edge MCU: HTTPS Client (Linux host build)\n");
+    printf("===============================================================\n\n");
+
+    /* Starts the HTTPS Client in secure mode. */
+    result = xTaskCreate(https_client_task, "HTTPS Client",
+                HTTPS_CLIENT_TASK_STACK_SIZE, NULL,
+                HTTPS_CLIENT_TASK_PRIORITY, &https_client_task_handle);
+
+    /* Start the scheduler */
+    if (pdPASS == result)
+    {
+        /* The phase ends when the HTTPS Client task starts running. */
+        BOOT_TRACE_BEGIN_PHASE(BOOT_TRACE_SCHEDULER_START);
+        vTaskStartScheduler();
+    }
+
+    /* Should never get here. */
+    handle_app_error();
+
+    return EXIT_FAILURE;
+}
+
+
+/* [] END OF FILE */
@@ -0,0 +1,765 @@
+/*******************************************************************************
+* File Name: http_client_host.c
+*
+* Description: This file contains the HTTP client library stand-in of the
+* Linux build, on the secure sockets stand-in. Request headers
+* are formatted into the buffer of the request and the response
+* is read back into the same buffer, with Content-Length, chunked
+* and close-delimited bodies, as the library does. The response
+* headers are parsed by http_response_parser.c of the application.
+*
+* Related Document: See README.md
+********************************************************************************
+* Copyright 2024-2025, Cypress Semiconductor Corporation (an Infineon company) or
+* an affiliate of Cypress Semiconductor Corporation.  All rights reserved.
+*
+* This software, including source code, documentation and related
+* materials ("Software") is owned by Cypress Semiconductor Corporation
+* or one of its affiliates ("Cypress") and is protected by and subject to
+* worldwide patent protection (United States and foreign),
+* United States copyright laws and international treaty provisions.
+* Therefore, you may use this Software only as provided in the license
+* agreement accompanying the software package from which you
+* obtained this Software ("EULA").
+* If no EULA applies, Cypress hereby grants you a personal, non-exclusive,
+* non-transferable license to copy, modify, and compile the Software
+* source code solely for use in connection with Cypress's
+* integrated circuit products.  Any reproduction, modification, translation,
+* compilation, or representation of this Software except as specified
+* above is prohibited without the express written permission of Cypress.
+*
+* Disclaimer: THIS SOFTWARE IS PROVIDED AS-IS, WITH NO WARRANTY OF ANY KIND,
+* EXPRESS OR IMPLIED, INCLUDING, BUT NOT LIMITED TO, NONINFRINGEMENT, IMPLIED
+* WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE. Cypress
+* reserves the right to make changes to the Software without notice. Cypress
+* does not assume any liability arising out of the application or use of the
+* Software or any product or circuit described in the Software. Cypress does
+* not authorize its products for use in any products where a malfunction or
+* failure of the Cypress product may reasonably be expected to result in
+* significant property damage, injury or death ("High Risk Product"). By
+* including Cypress's product in a High Risk Product, the manufacturer
+* of such system or application assumes all risk of such use and in doing
+* so agrees to indemnify Cypress against all liability.
+*******************************************************************************/
+
+/*******************************************************************************
+* Header Files
+*******************************************************************************/
+#include "cy_http_client_api.h"
+#include "cy_secure_sockets.h"
+#include "cy_tls.h"
+#include "cy_utils.h"
+#include "http_response_parser.h"
+#include <stdbool.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+/*******************************************************************************
+* Macros
+*******************************************************************************/
+#define USER_AGENT                           "PSOC-Edge-HTTPS-Client-Host"
+#define DEFAULT_RANGE_START                  (0)
+#define DEFAULT_RANGE_END                    (-1)
+#define LINE_END                             "\r\n"
+#define LINE_END_LEN                         (2U)
+#define HEADER_LINE_LENGTH                   (64U)
+
+#define HTTP_STATUS_NO_CONTENT               (204U)
+#define HTTP_STATUS_NOT_MODIFIED             (304U)
+#define HTTP_STATUS_INFO_END                 (200U)
+
+/*******************************************************************************
+* Data Types
+*******************************************************************************/
+typedef struct
+{
+    cy_awsport_ssl_credentials_t security;
+    cy_awsport_server_info_t server;
+    cy_http_disconnect_callback_t disconn_cb;
+    void *user_data;
+    void *identity;
+    cy_socket_t socket;
+    volatile bool connected;
+} http_client_t;
+
+/* Progress of a chunked body decoded in place. */
+typedef enum
+{
+    CHUNKED_INCOMPLETE,
+    CHUNKED_DONE,
+    CHUNKED_ERROR
+} chunked_status_t;
+
+/*******************************************************************************
+* Global Variables
+*******************************************************************************/
+static const char * const method_names[] =
+{
+    "GET", "PUT", "POST", "HEAD", "DELETE", "PATCH", "CONNECT", "OPTIONS",
+    "TRACE"
+};
+
+/*******************************************************************************
+* Function Definitions
+*******************************************************************************/
+
+/*******************************************************************************
+* Function Name: cy_http_client_init
+*******************************************************************************/
+cy_rslt_t cy_http_client_init(void)
+{
+    return cy_socket_init();
+}
+
+/*******************************************************************************
+* Function Name: cy_http_client_create
+********************************************************************************
+* Summary:
+*  Creates a client for one server. The credentials and the server
+*  information are copied; the buffers they point to must stay valid.
+*
+*******************************************************************************/
+cy_rslt_t cy_http_client_create(cy_awsport_ssl_credentials_t *security,
+                                cy_awsport_server_info_t *server_info,
+                                cy_http_disconnect_callback_t disconn_cb,
+                                void *user_data, cy_http_client_t *handle)
+{
+    http_client_t *client;
+
+    if ((NULL == server_info) || (NULL == handle))
+    {
+        return CY_RSLT_HTTP_CLIENT_ERROR_BADARG;
+    }
+
+    client = calloc(1U, sizeof(*client));
+    if (NULL == client)
+    {
+        return CY_RSLT_HTTP_CLIENT_ERROR_NOMEM;
+    }
+
+    if (NULL != security)
+    {
+        client->security = *security;
+    }
+    client->server = *server_info;
+    client->disconn_cb = disconn_cb;
+    client->user_data = user_data;
+    *handle = client;
+
+    return CY_RSLT_SUCCESS;
+}
+
+/*******************************************************************************
+* Function Name: socket_disconnected
+********************************************************************************
+* Summary:
+*  Disconnect callback of the socket. Tells the application that the server
+*  closed the connection, once per connection.
+*
+*******************************************************************************/
+static cy_rslt_t socket_disconnected(cy_socket_t socket, void *arg)
+{
+    http_client_t *client = (http_client_t *) arg;
+
+    CY_UNUSED_PARAMETER(socket);
+
+    if (client->connected)
+    {
+        client->connected = false;
+        if (NULL != client->disconn_cb)
+        {
+            client->disconn_cb(client,
+                    CY_HTTP_CLIENT_DISCONN_TYPE_SERVER_INITIATED,
+                    client->user_data);
+        }
+    }
+
+    return CY_RSLT_SUCCESS;
+}
+
+/*******************************************************************************
+* Function Name: close_connection
+*******************************************************************************/
+static void close_connection(http_client_t *client)
+{
+    client->connected = false;
+
+    if (NULL != client->socket)
+    {
+        (void) cy_socket_disconnect(client->socket, 0U);
+        (void) cy_socket_delete(client->socket);
+        client->socket = NULL;
+    }
+
+    if (NULL != client->identity)
+    {
+        (void) cy_tls_delete_identity(client->identity);
+        client->identity = NULL;
+    }
+}
+
+/*******************************************************************************
+* Function Name: cy_http_client_connect
+********************************************************************************
+* Summary:
+*  Opens the TLS connection to the server. The TLS identity is created from
+*  the credentials on every connect, as the library does.
+*
+*******************************************************************************/
+cy_rslt_t cy_http_client_connect(cy_http_client_t handle,
+                                 uint32_t send_timeout_ms,
+                                 uint32_t receive_timeout_ms)
+{
+    http_client_t *client = (http_client_t *) handle;
+    cy_socket_sockaddr_t address = { .port = client->server.port };
+    cy_socket_tls_auth_mode_t auth_mode = CY_SOCKET_TLS_VERIFY_REQUIRED;
+    cy_socket_opt_callback_t disconnect_cb =
+    {
+        .callback = socket_disconnected,
+        .arg      = client
+    };
+    cy_rslt_t result;
+
+    if (client->connected)
+    {
+        return CY_RSLT_SUCCESS;
+    }
+
+    result = cy_tls_create_identity(client->security.client_cert,
+                                    client->security.client_cert_size,
+                                    client->security.private_key,
+                                    client->security.private_key_size,
+                                    &client->identity);
+
+    if (CY_RSLT_SUCCESS == result)
+    {
+        result = cy_socket_gethostbyname(client->server.host_name,
+                                         CY_SOCKET_IP_VER_V4,
+                                         &address.ip_address);
+    }
+
+    if (CY_RSLT_SUCCESS == result)
+    {
+        result = cy_socket_create(CY_SOCKET_DOMAIN_AF_INET,
+                                  CY_SOCKET_TYPE_STREAM,
+                                  CY_SOCKET_IPPROTO_TLS, &client->socket);
+    }
+
+    if (CY_RSLT_SUCCESS == result)
+    {
+        (void) cy_socket_setsockopt(client->socket, CY_SOCKET_SOL_TLS,
+                                    CY_SOCKET_SO_TLS_IDENTITY,
+                                    client->identity, 0U);
+        (void) cy_socket_setsockopt(client->socket, CY_SOCKET_SOL_TLS,
+                                    CY_SOCKET_SO_TLS_AUTH_MODE, &auth_mode,
+                                    sizeof(auth_mode));
+        (void) cy_socket_setsockopt(client->socket, CY_SOCKET_SOL_SOCKET,
+                                    CY_SOCKET_SO_SNDTIMEO, &send_timeout_ms,
+                                    sizeof(send_timeout_ms));
+        (void) cy_socket_setsockopt(client->socket, CY_SOCKET_SOL_SOCKET,
+                                    CY_SOCKET_SO_RCVTIMEO, &receive_timeout_ms,
+                                    sizeof(receive_timeout_ms));
+        (void) cy_socket_setsockopt(client->socket, CY_SOCKET_SOL_SOCKET,
+                                    CY_SOCKET_SO_DISCONNECT_CALLBACK,
+                                    &disconnect_cb, sizeof(disconnect_cb));
+        if (NULL != client->security.root_ca)
+        {
+            (void) cy_socket_setsockopt(client->socket, CY_SOCKET_SOL_TLS,
+                    CY_SOCKET_SO_TRUSTED_ROOTCA_CERTIFICATE,
+                    client->security.root_ca, client->security.root_ca_size);
+        }
+
+        result = cy_socket_connect(client->socket, &address, sizeof(address));
+    }
+
+    if (CY_RSLT_SUCCESS == result)
+    {
+        client->connected = true;
+    }
+    else
+    {
+        close_connection(client);
+    }
+
+    return result;
+}
+
+/*******************************************************************************
+* Function Name: add_line
+********************************************************************************
+* Summary:
+*  Appends text to the request buffer.
+*
+* Return:
+*  bool: false if the buffer is too small.
+*
+*******************************************************************************/
+static bool add_line(cy_http_client_request_header_t *request,
+                     const char *text, size_t len)
+{
+    if ((request->headers_len + len) > request->buffer_len)
+    {
+        return false;
+    }
+
+    (void) memcpy(&request->buffer[request->headers_len], text, len);
+    request->headers_len += len;
+
+    return true;
+}
+
+/*******************************************************************************
+* Function Name: cy_http_client_write_header
+********************************************************************************
+* Summary:
+*  Formats the request line, the headers the library adds, the headers of
+*  the application and a Range header into the request buffer. The headers
+*  end with the empty line.
+*
+*******************************************************************************/
+cy_rslt_t cy_http_client_write_header(cy_http_client_t handle,
+                                      cy_http_client_request_header_t *request,
+                                      cy_http_client_header_t *header,
+                                      uint32_t num_header)
+{
+    http_client_t *client = (http_client_t *) handle;
+    char line[HEADER_LINE_LENGTH];
+    int len;
+    bool fits;
+
+    if ((NULL == client) || (NULL == request) || (NULL == request->buffer) ||
+        ((uint32_t) request->method >=
+         (sizeof(method_names) / sizeof(method_names[0]))))
+    {
+        return CY_RSLT_HTTP_CLIENT_ERROR_BADARG;
+    }
+
+    request->headers_len = 0U;
+    fits = add_line(request, method_names[request->method],
+                    strlen(method_names[request->method])) &&
+           add_line(request, " ", 1U) &&
+           add_line(request, request->resource_path,
+                    strlen(request->resource_path)) &&
+           add_line(request, " HTTP/1.1" LINE_END "User-Agent: " USER_AGENT
+                    LINE_END "Host: ", sizeof(" HTTP/1.1" LINE_END
+                    "User-Agent: " USER_AGENT LINE_END "Host: ") - 1U) &&
+           add_line(request, client->server.host_name,
+                    strlen(client->server.host_name)) &&
+           add_line(request, LINE_END "Connection: keep-alive" LINE_END,
+                    sizeof(LINE_END "Connection: keep-alive" LINE_END) - 1U);
+
+    for (uint32_t i = 0U; fits && (i < num_header); i++)
+    {
+        fits = add_line(request, header[i].field, header[i].field_len) &&
+               add_line(request, ": ", 2U) &&
+               add_line(request, header[i].value, header[i].value_len) &&
+               add_line(request, LINE_END, LINE_END_LEN);
+    }
+
+    if (fits && ((DEFAULT_RANGE_START != request->range_start) ||
+                 (DEFAULT_RANGE_END != request->range_end)))
+    {
+        len = (DEFAULT_RANGE_END == request->range_end) ?
+              snprintf(line, sizeof(line), "Range: bytes=%ld-" LINE_END,
+                       (long) request->range_start) :
+              snprintf(line, sizeof(line), "Range: bytes=%ld-%ld" LINE_END,
+                       (long) request->range_start, (long) request->range_end);
+        fits = add_line(request, line, (size_t) len);
+    }
+
+    if (!(fits && add_line(request, LINE_END, LINE_END_LEN)))
+    {
+        return CY_RSLT_HTTP_CLIENT_ERROR_NOMEM;
+    }
+
+    return CY_RSLT_SUCCESS;
+}
+
+/*******************************************************************************
+* Function Name: add_content_length
+********************************************************************************
+* Summary:
+*  Inserts the Content-Length of the body before the empty line that ends
+*  the request headers.
+*
+*******************************************************************************/
+static bool add_content_length(cy_http_client_request_header_t *request,
+                               uint32_t payload_len)
+{
+    char line[HEADER_LINE_LENGTH];
+    int len = snprintf(line, sizeof(line), "Content-Length: %lu" LINE_END,
+                       (unsigned long) payload_len);
+
+    if ((request->headers_len < LINE_END_LEN) ||
+        ((request->headers_len + (size_t) len) > request->buffer_len))
+    {
+        return false;
+    }
+
+    request->headers_len -= LINE_END_LEN;
+
+    return add_line(request, line, (size_t) len) &&
+           add_line(request, LINE_END, LINE_END_LEN);
+}
+
+/*******************************************************************************
+* Function Name: send_all
+*******************************************************************************/
+static cy_rslt_t send_all(http_client_t *client, const uint8_t *data,
+                          uint32_t len)
+{
+    cy_rslt_t result = CY_RSLT_SUCCESS;
+    uint32_t sent;
+
+    while ((len > 0U) && (CY_RSLT_SUCCESS == result))
+    {
+        result = cy_socket_send(client->socket, data, len,
+                                CY_SOCKET_FLAGS_NONE, &sent);
+        data += sent;
+        len -= sent;
+    }
+
+    return result;
+}
+
+/*******************************************************************************
+* Function Name: receive_more
+********************************************************************************
+* Summary:
+*  Reads more of the response into the free part of the buffer.
+*
+*******************************************************************************/
+static cy_rslt_t receive_more(http_client_t *client, uint8_t *buffer,
+                              size_t size, size_t *received)
+{
+    cy_rslt_t result;
+    uint32_t count = 0U;
+
+    if (*received >= size)
+    {
+        return CY_RSLT_HTTP_CLIENT_ERROR_NOMEM;
+    }
+
+    result = cy_socket_recv(client->socket, &buffer[*received],
+                            (uint32_t) (size - *received),
+                            CY_SOCKET_FLAGS_NONE, &count);
+
+    if ((CY_RSLT_SUCCESS == result) && (0U == count))
+    {
+        result = CY_RSLT_MODULE_SECURE_SOCKETS_CLOSED;
+    }
+
+    *received += count;
+
+    return result;
+}
+
+/*******************************************************************************
+* Function Name: decode_chunked
+********************************************************************************
+* Summary:
+*  Checks whether a chunked body is complete and, once it is, moves the chunk
+*  data together at the start of the body. Trailers are skipped.
+*
+*******************************************************************************/
+static chunked_status_t decode_chunked(uint8_t *body, size_t len,
+                                       size_t *body_len)
+{
+    size_t pos = 0U;
+    size_t out = 0U;
+    bool done = false;
+
+    /* First pass: find the end without changing the buffer. */
+    while (!done)
+    {
+        char *end;
+        unsigned long size;
+        const uint8_t *eol = memchr(&body[pos], '\n', len - pos);
+
+        if (NULL == eol)
+        {
+            return CHUNKED_INCOMPLETE;
+        }
+
+        size = strtoul((const char *) &body[pos], &end, 16);
+        if (end == (const char *) &body[pos])
+        {
+            return CHUNKED_ERROR;
+        }
+
+        pos = (size_t) (eol - body) + 1U;
+        if (0U == size)
+        {
+            done = true;
+        }
+        else if ((pos + size + LINE_END_LEN) > len)
+        {
+            return CHUNKED_INCOMPLETE;
+        }
+        else
+        {
+            pos += size + LINE_END_LEN;
+        }
+    }
+
+    /* Trailer fields end with an empty line. */
+    while (true)
+    {
+        const uint8_t *eol = memchr(&body[pos], '\n', len - pos);
+
+        if (NULL == eol)
+        {
+            return CHUNKED_INCOMPLETE;
+        }
+
+        if (((size_t) (eol - body) - pos) <= 1U)
+        {
+            break;
+        }
+        pos = (size_t) (eol - body) + 1U;
+    }
+
+    /* Second pass: move the chunk data together. */
+    pos = 0U;
+    while (true)
+    {
+        char *end;
+        unsigned long size = strtoul((const char *) &body[pos], &end, 16);
+
+        pos = (size_t) ((const uint8_t *) memchr(&body[pos], '\n', len - pos) -
+                        body) + 1U;
+        if (0U == size)
+        {
+            break;
+        }
+        (void) memmove(&body[out], &body[pos], size);
+        out += size;
+        pos += size + LINE_END_LEN;
+    }
+
+    *body_len = out;
+
+    return CHUNKED_DONE;
+}
+
+/*******************************************************************************
+* Function Name: receive_response
+********************************************************************************
+* Summary:
+*  Reads a response into the buffer of the request and fills in the
+*  response. The whole response must fit in the buffer.
+*
+*******************************************************************************/
+static cy_rslt_t receive_response(http_client_t *client,
+                                  const cy_http_client_request_header_t *req,
+                                  cy_http_client_response_t *response)
+{
+    cy_rslt_t result = CY_RSLT_SUCCESS;
+    http_parser_t parser;
+    uint8_t *buffer = req->buffer;
+    size_t received = 0U;
+    size_t status_line_len;
+    uint32_t content_length = 0U;
+    bool has_length;
+    bool chunked = false;
+    bool has_body;
+    const char *value;
+    uint32_t value_len = 0U;
+
+    http_parser_init(&parser, true);
+
+    while ((CY_RSLT_SUCCESS == result) &&
+           (HTTP_PARSER_INCOMPLETE == http_parser_feed(&parser,
+                    (const char *) buffer, (uint32_t) received)))
+    {
+        result = receive_more(client, buffer, req->buffer_len, &received);
+    }
+
+    if ((CY_RSLT_SUCCESS == result) && (HTTP_PARSER_DONE != parser.status))
+    {
+        result = CY_RSLT_HTTP_CLIENT_ERROR_PARSER;
+    }
+
+    if (CY_RSLT_SUCCESS != result)
+    {
+        return result;
+    }
+
+    has_length = http_parser_value_uint(&parser, (const char *) buffer,
+            HTTP_HEADER_HASH_CONTENT_LENGTH, HTTP_HEADER_CONTENT_LENGTH,
+            &content_length);
+    value = http_parser_value(&parser, (const char *) buffer,
+            HTTP_HEADER_HASH_TRANSFER_ENCODING, HTTP_HEADER_TRANSFER_ENCODING,
+            &value_len);
+    chunked = (NULL != value) && (value_len >= (sizeof("chunked") - 1U)) &&
+              (0 == strncasecmp(&value[value_len - (sizeof("chunked") - 1U)],
+                                "chunked", sizeof("chunked") - 1U));
+    has_body = (CY_HTTP_CLIENT_METHOD_HEAD != req->method) &&
+               (parser.status_code >= HTTP_STATUS_INFO_END) &&
+               (HTTP_STATUS_NO_CONTENT != parser.status_code) &&
+               (HTTP_STATUS_NOT_MODIFIED != parser.status_code);
+
+    response->body_len = 0U;
+    if (has_body && chunked)
+    {
+        chunked_status_t status = CHUNKED_INCOMPLETE;
+
+        while ((CY_RSLT_SUCCESS == result) && (CHUNKED_INCOMPLETE ==
+               (status = decode_chunked(&buffer[parser.headers_len],
+                                        received - parser.headers_len,
+                                        &response->body_len))))
+        {
+            result = receive_more(client, buffer, req->buffer_len, &received);
+        }
+
+        if ((CY_RSLT_SUCCESS == result) && (CHUNKED_DONE != status))
+        {
+            result = CY_RSLT_HTTP_CLIENT_ERROR_PARSER;
+        }
+    }
+    else if (has_body && has_length)
+    {
+        if ((parser.headers_len + content_length) > req->buffer_len)
+        {
+            result = CY_RSLT_HTTP_CLIENT_ERROR_NOMEM;
+        }
+
+        while ((CY_RSLT_SUCCESS == result) &&
+               (received < (parser.headers_len + content_length)))
+        {
+            result = receive_more(client, buffer, req->buffer_len, &received);
+        }
+        response->body_len = content_length;
+    }
+    else if (has_body)
+    {
+        /* The body ends when the server closes the connection. */
+        while (CY_RSLT_SUCCESS == result)
+        {
+            result = receive_more(client, buffer, req->buffer_len, &received);
+        }
+
+        if (CY_RSLT_MODULE_SECURE_SOCKETS_CLOSED == result)
+        {
+            result = CY_RSLT_SUCCESS;
+        }
+        response->body_len = received - parser.headers_len;
+    }
+
+    if (CY_RSLT_SUCCESS != result)
+    {
+        return result;
+    }
+
+    /* The header block starts after the status line and leaves out the
+     * empty line, as with the library.
+     */
+    status_line_len = (size_t) ((const uint8_t *) memchr(buffer, '\n',
+                                parser.headers_len) - buffer) + 1U;
+    response->status_code = parser.status_code;
+    response->buffer = buffer;
+    response->buffer_len = req->buffer_len;
+    response->header = &buffer[status_line_len];
+    response->headers_len = parser.headers_len - status_line_len -
+                            LINE_END_LEN;
+    response->header_count = parser.header_count;
+    response->body = &buffer[parser.headers_len];
+    response->content_len = has_length ? content_length : 0U;
+
+    return CY_RSLT_SUCCESS;
+}
+
+/*******************************************************************************
+* Function Name: cy_http_client_send
+********************************************************************************
+* Summary:
+*  Sends a request written by cy_http_client_write_header with its body, and
+*  receives the response into the buffer of the request. A failure on the
+*  connection closes it, and the application is told through the disconnect
+*  callback.
+*
+*******************************************************************************/
+cy_rslt_t cy_http_client_send(cy_http_client_t handle,
+                              cy_http_client_request_header_t *request,
+                              uint8_t *payload, uint32_t payload_len,
+                              cy_http_client_response_t *response)
+{
+    http_client_t *client = (http_client_t *) handle;
+    cy_rslt_t result;
+
+    if ((NULL == client) || (NULL == request) || (NULL == response))
+    {
+        return CY_RSLT_HTTP_CLIENT_ERROR_BADARG;
+    }
+
+    if (!client->connected)
+    {
+        return CY_RSLT_HTTP_CLIENT_ERROR_NOT_CONNECTED;
+    }
+
+    (void) memset(response, 0, sizeof(*response));
+
+    if ((0U != payload_len) && !add_content_length(request, payload_len))
+    {
+        return CY_RSLT_HTTP_CLIENT_ERROR_NOMEM;
+    }
+
+    result = send_all(client, request->buffer, (uint32_t) request->headers_len);
+
+    if ((CY_RSLT_SUCCESS == result) && (0U != payload_len))
+    {
+        result = send_all(client, payload, payload_len);
+    }
+
+    if (CY_RSLT_SUCCESS == result)
+    {
+        result = receive_response(client, request, response);
+    }
+
+    if ((CY_RSLT_MODULE_SECURE_SOCKETS_CLOSED == result) ||
+        (CY_RSLT_MODULE_SECURE_SOCKETS_TIMEOUT == result))
+    {
+        (void) socket_disconnected(client->socket, client);
+    }
+
+    return result;
+}
+
+/*******************************************************************************
+* Function Name: cy_http_client_disconnect
+*******************************************************************************/
+cy_rslt_t cy_http_client_disconnect(cy_http_client_t handle)
+{
+    http_client_t *client = (http_client_t *) handle;
+
+    if (NULL == client)
+    {
+        return CY_RSLT_HTTP_CLIENT_ERROR_BADARG;
+    }
+
+    close_connection(client);
+
+    return CY_RSLT_SUCCESS;
+}
+
+/*******************************************************************************
+* Function Name: cy_http_client_delete
+*******************************************************************************/
+cy_rslt_t cy_http_client_delete(cy_http_client_t handle)
+{
+    http_client_t *client = (http_client_t *) handle;
+
+    if (NULL == client)
+    {
+        return CY_RSLT_HTTP_CLIENT_ERROR_BADARG;
+    }
+
+    close_connection(client);
+    free(client);
+
+    return CY_RSLT_SUCCESS;
+}
+
+
+/* [] END OF FILE */
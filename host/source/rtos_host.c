@@ -0,0 +1,562 @@
+/*******************************************************************************
+* File Name: rtos_host.c
+*
+* Description: This file contains the FreeRTOS stand-in of the Linux build.
+* Tasks are POSIX threads that run at once, task notifications
+* and semaphores are counters guarded by a mutex and a condition
+* variable, and the tick count is read from the monotonic clock.
+*
+* Related Document: See README.md
+********************************************************************************
+* Copyright 2024-2025, Cypress Semiconductor Corporation (an Infineon company) or
+* an affiliate of Cypress Semiconductor Corporation.  All rights reserved.
+*
+* This software, including source code, documentation and related
+* materials ("Software") is owned by Cypress Semiconductor Corporation
+* or one of its affiliates ("Cypress") and is protected by and subject to
+* worldwide patent protection (United States and foreign),
+* United States copyright laws and international treaty provisions.
+* Therefore, you may use this Software only as provided in the license
+* agreement accompanying the software package from which you
+* obtained this Software ("EULA").
+* If no EULA applies, Cypress hereby grants you a personal, non-exclusive,
+* non-transferable license to copy, modify, and compile the Software
+* source code solely for use in connection with Cypress's
+* integrated circuit products.  Any reproduction, modification, translation,
+* compilation, or representation of this Software except as specified
+* above is prohibited without the express written permission of Cypress.
+*
+* Disclaimer: THIS SOFTWARE IS PROVIDED AS-IS, WITH NO WARRANTY OF ANY KIND,
+* EXPRESS OR IMPLIED, INCLUDING, BUT NOT LIMITED TO, NONINFRINGEMENT, IMPLIED
+* WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE. Cypress
+* reserves the right to make changes to the Software without notice. Cypress
+* does not assume any liability arising out of the application or use of the
+* Software or any product or circuit described in the Software. Cypress does
+* not authorize its products for use in any products where a malfunction or
+* failure of the Cypress product may reasonably be expected to result in
+* significant property damage, injury or death ("High Risk Product"). By
+* including Cypress's product in a High Risk Product, the manufacturer
+* of such system or application assumes all risk of such use and in doing
+* so agrees to indemnify Cypress against all liability.
+*******************************************************************************/
+
+/*******************************************************************************
+* Header Files
+*******************************************************************************/
+#include <FreeRTOS.h>
+#include <task.h>
+#include <semphr.h>
+#include <errno.h>
+#include <pthread.h>
+#include <stdbool.h>
+#include <stdlib.h>
+#include <time.h>
+#include <unistd.h>
+
+/*******************************************************************************
+* Macros
+*******************************************************************************/
+#define MS_PER_SECOND                                (1000U)
+#define NS_PER_MS                                    (1000000L)
+#define NS_PER_SECOND                                (1000000000L)
+
+/* Count of a semaphore created by xSemaphoreCreateMutex. */
+#define MUTEX_MAX_COUNT                              (1U)
+
+/*******************************************************************************
+* Data Types
+*******************************************************************************/
+
+/* A task, or a thread of the host that uses the task API, such as the
+ * thread that reports socket events.
+ */
+struct tskTaskControlBlock
+{
+    pthread_t thread;
+    TaskFunction_t function;
+    void *parameters;
+    pthread_mutex_t lock;
+    pthread_cond_t notified;
+    uint32_t notify_count;
+    uint32_t stack_depth;
+};
+
+struct QueueDefinition
+{
+    pthread_mutex_t lock;
+    pthread_cond_t given;
+    UBaseType_t count;
+    UBaseType_t max_count;
+};
+
+/*******************************************************************************
+* Global Variables
+*******************************************************************************/
+static pthread_once_t rtos_once = PTHREAD_ONCE_INIT;
+
+/* Critical section of all tasks. It nests like the one of the kernel. */
+static pthread_mutex_t critical_lock;
+
+static struct timespec start_time;
+
+/* Tasks created before vTaskStartScheduler wait for it, as on the kit. */
+static pthread_mutex_t scheduler_lock;
+static pthread_cond_t scheduler_started;
+static bool scheduler_running = false;
+
+static __thread TaskHandle_t current_task;
+
+/*******************************************************************************
+* Function Prototypes
+*******************************************************************************/
+static void init_wait(pthread_mutex_t *lock, pthread_cond_t *cond);
+
+/*******************************************************************************
+* Function Definitions
+*******************************************************************************/
+
+/*******************************************************************************
+* Function Name: rtos_init
+********************************************************************************
+* Summary:
+*  Creates the critical section and starts the tick count, once.
+*
+*******************************************************************************/
+static void rtos_init(void)
+{
+    pthread_mutexattr_t attr;
+
+    (void) pthread_mutexattr_init(&attr);
+    (void) pthread_mutexattr_settype(&attr, PTHREAD_MUTEX_RECURSIVE);
+    (void) pthread_mutex_init(&critical_lock, &attr);
+    (void) pthread_mutexattr_destroy(&attr);
+    (void) clock_gettime(CLOCK_MONOTONIC, &start_time);
+    init_wait(&scheduler_lock, &scheduler_started);
+}
+
+/*******************************************************************************
+* Function Name: init_wait
+********************************************************************************
+* Summary:
+*  Creates a condition variable that waits on the monotonic clock.
+*
+*******************************************************************************/
+static void init_wait(pthread_mutex_t *lock, pthread_cond_t *cond)
+{
+    pthread_condattr_t attr;
+
+    (void) pthread_mutex_init(lock, NULL);
+    (void) pthread_condattr_init(&attr);
+    (void) pthread_condattr_setclock(&attr, CLOCK_MONOTONIC);
+    (void) pthread_cond_init(cond, &attr);
+    (void) pthread_condattr_destroy(&attr);
+}
+
+/*******************************************************************************
+* Function Name: wait_until
+********************************************************************************
+* Summary:
+*  Waits on a condition variable for at most a number of ticks, or without a
+*  limit for portMAX_DELAY.
+*
+* Return:
+*  bool: false if the time is up.
+*
+*******************************************************************************/
+static bool wait_until(pthread_cond_t *cond, pthread_mutex_t *lock,
+                       const struct timespec *deadline, TickType_t ticks)
+{
+    if (portMAX_DELAY == ticks)
+    {
+        return (0 == pthread_cond_wait(cond, lock));
+    }
+
+    return (ETIMEDOUT != pthread_cond_timedwait(cond, lock, deadline));
+}
+
+/*******************************************************************************
+* Function Name: deadline_after
+********************************************************************************
+* Summary:
+*  Returns the monotonic time a number of ticks from now.
+*
+*******************************************************************************/
+static struct timespec deadline_after(TickType_t ticks)
+{
+    struct timespec deadline;
+
+    (void) clock_gettime(CLOCK_MONOTONIC, &deadline);
+    deadline.tv_sec += (time_t) (ticks / MS_PER_SECOND);
+    deadline.tv_nsec += (long) (ticks % MS_PER_SECOND) * NS_PER_MS;
+    if (deadline.tv_nsec >= NS_PER_SECOND)
+    {
+        deadline.tv_sec++;
+        deadline.tv_nsec -= NS_PER_SECOND;
+    }
+
+    return deadline;
+}
+
+/*******************************************************************************
+* Function Name: new_task
+********************************************************************************
+* Summary:
+*  Allocates the control block of a task.
+*
+*******************************************************************************/
+static TaskHandle_t new_task(TaskFunction_t function, void *parameters)
+{
+    TaskHandle_t task = calloc(1U, sizeof(*task));
+
+    if (NULL != task)
+    {
+        task->function = function;
+        task->parameters = parameters;
+        init_wait(&task->lock, &task->notified);
+    }
+
+    return task;
+}
+
+/*******************************************************************************
+* Function Name: task_entry
+********************************************************************************
+* Summary:
+*  Thread function of a task. The task runs once the scheduler is started.
+*  A task function that returns ends the thread, where the kernel would
+*  report an error.
+*
+*******************************************************************************/
+static void *task_entry(void *arg)
+{
+    TaskHandle_t task = (TaskHandle_t) arg;
+
+    (void) pthread_mutex_lock(&scheduler_lock);
+    while (!scheduler_running)
+    {
+        (void) pthread_cond_wait(&scheduler_started, &scheduler_lock);
+    }
+    (void) pthread_mutex_unlock(&scheduler_lock);
+
+    current_task = task;
+    task->function(task->parameters);
+
+    return NULL;
+}
+
+/*******************************************************************************
+* Function Name: xTaskCreate
+********************************************************************************
+* Summary:
+*  Starts a task on a thread of its own. The stack size and priority are
+*  those of the kit; the host keeps the size and schedules the threads.
+*
+*******************************************************************************/
+BaseType_t xTaskCreate(TaskFunction_t pxTaskCode, const char * const pcName,
+                       const uint32_t usStackDepth, void * const pvParameters,
+                       UBaseType_t uxPriority,
+                       TaskHandle_t * const pxCreatedTask)
+{
+    TaskHandle_t task;
+
+    (void) pcName;
+    (void) uxPriority;
+    (void) pthread_once(&rtos_once, rtos_init);
+
+    task = new_task(pxTaskCode, pvParameters);
+    if (NULL == task)
+    {
+        return pdFAIL;
+    }
+    task->stack_depth = usStackDepth;
+
+    /* The handle is valid before the task runs, as with the kernel. */
+    if (NULL != pxCreatedTask)
+    {
+        *pxCreatedTask = task;
+    }
+
+    if (0 != pthread_create(&task->thread, NULL, task_entry, task))
+    {
+        return pdFAIL;
+    }
+    (void) pthread_detach(task->thread);
+
+    return pdPASS;
+}
+
+/*******************************************************************************
+* Function Name: vTaskStartScheduler
+********************************************************************************
+* Summary:
+*  Lets the tasks run, then waits for the program to end.
+*
+*******************************************************************************/
+void vTaskStartScheduler(void)
+{
+    (void) pthread_once(&rtos_once, rtos_init);
+
+    (void) pthread_mutex_lock(&scheduler_lock);
+    scheduler_running = true;
+    (void) pthread_cond_broadcast(&scheduler_started);
+    (void) pthread_mutex_unlock(&scheduler_lock);
+
+    while (true)
+    {
+        (void) pause();
+    }
+}
+
+/*******************************************************************************
+* Function Name: vTaskDelay
+*******************************************************************************/
+void vTaskDelay(const TickType_t xTicksToDelay)
+{
+    struct timespec delay =
+    {
+        .tv_sec = (time_t) (xTicksToDelay / MS_PER_SECOND),
+        .tv_nsec = (long) (xTicksToDelay % MS_PER_SECOND) * NS_PER_MS
+    };
+
+    if (0U == xTicksToDelay)
+    {
+        (void) sched_yield();
+        return;
+    }
+
+    while ((0 != nanosleep(&delay, &delay)) && (EINTR == errno))
+    {
+    }
+}
+
+/*******************************************************************************
+* Function Name: xTaskGetTickCount
+********************************************************************************
+* Summary:
+*  Milliseconds since the first use of the task API. The count wraps after
+*  2^32 ticks like the one of the kernel.
+*
+*******************************************************************************/
+TickType_t xTaskGetTickCount(void)
+{
+    struct timespec now;
+
+    (void) pthread_once(&rtos_once, rtos_init);
+    (void) clock_gettime(CLOCK_MONOTONIC, &now);
+
+    return (TickType_t) (((int64_t) (now.tv_sec - start_time.tv_sec) *
+                          MS_PER_SECOND) +
+                         ((now.tv_nsec - start_time.tv_nsec) / NS_PER_MS));
+}
+
+/*******************************************************************************
+* Function Name: xTaskGetCurrentTaskHandle
+********************************************************************************
+* Summary:
+*  Returns the task of the calling thread. A thread not started by
+*  xTaskCreate is given a control block on first use, so that it can wait
+*  for notifications.
+*
+*******************************************************************************/
+TaskHandle_t xTaskGetCurrentTaskHandle(void)
+{
+    if (NULL == current_task)
+    {
+        current_task = new_task(NULL, NULL);
+        if (NULL != current_task)
+        {
+            current_task->thread = pthread_self();
+        }
+    }
+
+    return current_task;
+}
+
+/*******************************************************************************
+* Function Name: xTaskNotifyGive
+*******************************************************************************/
+BaseType_t xTaskNotifyGive(TaskHandle_t xTaskToNotify)
+{
+    (void) pthread_mutex_lock(&xTaskToNotify->lock);
+    xTaskToNotify->notify_count++;
+    (void) pthread_cond_signal(&xTaskToNotify->notified);
+    (void) pthread_mutex_unlock(&xTaskToNotify->lock);
+
+    return pdPASS;
+}
+
+/*******************************************************************************
+* Function Name: ulTaskNotifyTake
+********************************************************************************
+* Summary:
+*  Waits for the notification count of the calling task to be non-zero, then
+*  clears or decrements it.
+*
+* Return:
+*  uint32_t: The count before it was cleared or decremented, 0 on a timeout.
+*
+*******************************************************************************/
+uint32_t ulTaskNotifyTake(BaseType_t xClearCountOnExit,
+                          TickType_t xTicksToWait)
+{
+    TaskHandle_t task = xTaskGetCurrentTaskHandle();
+    struct timespec deadline = deadline_after(xTicksToWait);
+    uint32_t count;
+
+    (void) pthread_mutex_lock(&task->lock);
+    while ((0U == task->notify_count) && (0U != xTicksToWait) &&
+           wait_until(&task->notified, &task->lock, &deadline, xTicksToWait))
+    {
+    }
+
+    count = task->notify_count;
+    if (0U != count)
+    {
+        task->notify_count = (pdFALSE != xClearCountOnExit) ? 0U : (count - 1U);
+    }
+    (void) pthread_mutex_unlock(&task->lock);
+
+    return count;
+}
+
+/*******************************************************************************
+* Function Name: xTaskGetSchedulerState
+********************************************************************************
+* Summary:
+*  Reports whether vTaskStartScheduler has been called.
+*
+*******************************************************************************/
+BaseType_t xTaskGetSchedulerState(void)
+{
+    bool running;
+
+    (void) pthread_once(&rtos_once, rtos_init);
+
+    (void) pthread_mutex_lock(&scheduler_lock);
+    running = scheduler_running;
+    (void) pthread_mutex_unlock(&scheduler_lock);
+
+    return running ? taskSCHEDULER_RUNNING : taskSCHEDULER_NOT_STARTED;
+}
+
+/*******************************************************************************
+* Function Name: uxTaskGetStackHighWaterMark
+********************************************************************************
+* Summary:
+*  Returns the whole stack of the task as free. The host threads run on stacks
+*  of their own size, so only the kit measures the stack use.
+*
+*******************************************************************************/
+UBaseType_t uxTaskGetStackHighWaterMark(TaskHandle_t xTask)
+{
+    return (UBaseType_t) xTask->stack_depth;
+}
+
+/*******************************************************************************
+* Function Name: vTaskEnterCritical
+*******************************************************************************/
+void vTaskEnterCritical(void)
+{
+    (void) pthread_once(&rtos_once, rtos_init);
+    (void) pthread_mutex_lock(&critical_lock);
+}
+
+/*******************************************************************************
+* Function Name: vTaskExitCritical
+*******************************************************************************/
+void vTaskExitCritical(void)
+{
+    (void) pthread_mutex_unlock(&critical_lock);
+}
+
+/*******************************************************************************
+* Function Name: new_semaphore
+********************************************************************************
+* Summary:
+*  Allocates a semaphore with a maximum and an initial count.
+*
+*******************************************************************************/
+static SemaphoreHandle_t new_semaphore(UBaseType_t max_count,
+                                       UBaseType_t count)
+{
+    SemaphoreHandle_t semaphore = calloc(1U, sizeof(*semaphore));
+
+    if (NULL != semaphore)
+    {
+        init_wait(&semaphore->lock, &semaphore->given);
+        semaphore->max_count = max_count;
+        semaphore->count = count;
+    }
+
+    return semaphore;
+}
+
+/*******************************************************************************
+* Function Name: xSemaphoreCreateMutex
+********************************************************************************
+* Summary:
+*  Creates a mutex, a semaphore that is available at first. Priority
+*  inheritance is left to the host scheduler.
+*
+*******************************************************************************/
+SemaphoreHandle_t xSemaphoreCreateMutex(void)
+{
+    return new_semaphore(MUTEX_MAX_COUNT, MUTEX_MAX_COUNT);
+}
+
+/*******************************************************************************
+* Function Name: xSemaphoreCreateCounting
+*******************************************************************************/
+SemaphoreHandle_t xSemaphoreCreateCounting(UBaseType_t uxMaxCount,
+                                           UBaseType_t uxInitialCount)
+{
+    return new_semaphore(uxMaxCount, uxInitialCount);
+}
+
+/*******************************************************************************
+* Function Name: xSemaphoreTake
+*******************************************************************************/
+BaseType_t xSemaphoreTake(SemaphoreHandle_t xSemaphore,
+                          TickType_t xBlockTime)
+{
+    struct timespec deadline = deadline_after(xBlockTime);
+    BaseType_t taken = pdFALSE;
+
+    (void) pthread_mutex_lock(&xSemaphore->lock);
+    while ((0U == xSemaphore->count) && (0U != xBlockTime) &&
+           wait_until(&xSemaphore->given, &xSemaphore->lock, &deadline,
+                      xBlockTime))
+    {
+    }
+
+    if (0U != xSemaphore->count)
+    {
+        xSemaphore->count--;
+        taken = pdTRUE;
+    }
+    (void) pthread_mutex_unlock(&xSemaphore->lock);
+
+    return taken;
+}
+
+/*******************************************************************************
+* Function Name: xSemaphoreGive
+*******************************************************************************/
+BaseType_t xSemaphoreGive(SemaphoreHandle_t xSemaphore)
+{
+    BaseType_t given = pdFALSE;
+
+    (void) pthread_mutex_lock(&xSemaphore->lock);
+    if (xSemaphore->count < xSemaphore->max_count)
+    {
+        xSemaphore->count++;
+        given = pdTRUE;
+        (void) pthread_cond_signal(&xSemaphore->given);
+    }
+    (void) pthread_mutex_unlock(&xSemaphore->lock);
+
+    return given;
+}
+
+
+/* [] END OF FILE */
@@ -0,0 +1,882 @@
+/*******************************************************************************
+* File Name: secure_sockets_host.c
+*
+* Description: This file contains the secure sockets stand-in of the Linux
+* build, on POSIX sockets and OpenSSL. TLS sockets verify the
+* server against the trusted root CA and present the TLS
+* identity, as on the kit. A thread per socket with a receive or
+* disconnect callback polls the socket and calls the callbacks,
+* like the socket worker of the library.
+*
+* Related Document: See README.md
+********************************************************************************
+* Copyright 2024-2025, Cypress Semiconductor Corporation (an Infineon company) or
+* an affiliate of Cypress Semiconductor Corporation.  All rights reserved.
+*
+* This software, including source code, documentation and related
+* materials ("Software") is owned by Cypress Semiconductor Corporation
+* or one of its affiliates ("Cypress") and is protected by and subject to
+* worldwide patent protection (United States and foreign),
+* United States copyright laws and international treaty provisions.
+* Therefore, you may use this Software only as provided in the license
+* agreement accompanying the software package from which you
+* obtained this Software ("EULA").
+* If no EULA applies, Cypress hereby grants you a personal, non-exclusive,
+* non-transferable license to copy, modify, and compile the Software
+* source code solely for use in connection with Cypress's
+* integrated circuit products.  Any reproduction, modification, translation,
+* compilation, or representation of this Software except as specified
+* above is prohibited without the express written permission of Cypress.
+*
+* Disclaimer: THIS SOFTWARE IS PROVIDED AS-IS, WITH NO WARRANTY OF ANY KIND,
+* EXPRESS OR IMPLIED, INCLUDING, BUT NOT LIMITED TO, NONINFRINGEMENT, IMPLIED
+* WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE. Cypress
+* reserves the right to make changes to the Software without notice. Cypress
+* does not assume any liability arising out of the application or use of the
+* Software or any product or circuit described in the Software. Cypress does
+* not authorize its products for use in any products where a malfunction or
+* failure of the Cypress product may reasonably be expected to result in
+* significant property damage, injury or death ("High Risk Product"). By
+* including Cypress's product in a High Risk Product, the manufacturer
+* of such system or application assumes all risk of such use and in doing
+* so agrees to indemnify Cypress against all liability.
+*******************************************************************************/
+
+/*******************************************************************************
+* Header Files
+*******************************************************************************/
+/* POLLRDHUP is a GNU extension of poll.h. */
+#define _GNU_SOURCE
+
+#include "cy_secure_sockets.h"
+#include "cy_tls.h"
+#include "cy_utils.h"
+#include "host_platform.h"
+#include <errno.h>
+#include <limits.h>
+#include <netdb.h>
+#include <poll.h>
+#include <pthread.h>
+#include <signal.h>
+#include <stdbool.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <unistd.h>
+#include <arpa/inet.h>
+#include <netinet/in.h>
+#include <netinet/tcp.h>
+#include <sys/socket.h>
+#include <openssl/err.h>
+#include <openssl/pem.h>
+#include <openssl/ssl.h>
+#include <openssl/x509.h>
+
+/*******************************************************************************
+* Macros
+*******************************************************************************/
+#define DEFAULT_TIMEOUT_MS                           (10000U)
+#define MS_PER_SECOND                                (1000U)
+#define US_PER_MS                                    (1000U)
+
+/* Poll period of the callback thread, and the time it leaves the owner of
+ * the socket to read after a receive callback.
+ */
+#define WATCH_POLL_MS                                (20)
+#define WATCH_IDLE_MS                                (5U)
+
+#define PEM_BEGIN                                    "-----BEGIN"
+
+/* Files made by generate_ssl_certs.sh, read instead of the compiled-in
+ * credentials when a certificate directory is set.
+ */
+#define CLIENT_CERT_FILE                             "mysecurehttpclient.crt"
+#define CLIENT_KEY_FILE                              "mysecurehttpclient.key"
+#define ROOT_CA_FILE                                 "root_ca.crt"
+
+/*******************************************************************************
+* Data Types
+*******************************************************************************/
+typedef struct
+{
+    X509 *certificate;
+    EVP_PKEY *private_key;
+} tls_identity_t;
+
+typedef struct
+{
+    int fd;
+    bool tls;
+    SSL_CTX *ctx;
+    SSL *ssl;
+    const tls_identity_t *identity;
+    const char *root_ca;
+    uint32_t root_ca_len;
+    cy_socket_tls_auth_mode_t auth_mode;
+    uint32_t recv_timeout_ms;
+    uint32_t send_timeout_ms;
+    cy_socket_opt_callback_t receive_cb;
+    cy_socket_opt_callback_t disconnect_cb;
+
+    /* Held while the owner reads or writes the TLS session, which the
+     * callback thread must not touch at the same time.
+     */
+    pthread_mutex_t io_lock;
+
+    pthread_t watcher;
+    bool watching;
+    volatile bool stop;
+
+    /* Reads by the owner, so the callback thread sees the data consumed. */
+    volatile uint32_t reads;
+} host_socket_t;
+
+/*******************************************************************************
+* Global Variables
+*******************************************************************************/
+static const char *cert_dir;
+
+/*******************************************************************************
+* Function Definitions
+*******************************************************************************/
+
+/*******************************************************************************
+* Function Name: host_tls_set_cert_dir
+********************************************************************************
+* Summary:
+*  Reads the TLS identity and the root CA from the files made by
+*  generate_ssl_certs.sh in a directory, instead of from the buffers given
+*  by the application. Lets the host build run without filling in
+*  secure_keys.h.
+*
+*******************************************************************************/
+void host_tls_set_cert_dir(const char *dir)
+{
+    cert_dir = dir;
+}
+
+/*******************************************************************************
+* Function Name: open_credential
+********************************************************************************
+* Summary:
+*  Returns a BIO over a credential: the file of the certificate directory if
+*  one is set, otherwise the buffer. A buffer that ends with a NUL is PEM,
+*  any other is DER, as with Mbed TLS.
+*
+*******************************************************************************/
+static BIO *open_credential(const char *data, uint32_t len,
+                            const char *file_name, bool *pem)
+{
+    char path[PATH_MAX];
+
+    if (NULL != cert_dir)
+    {
+        (void) snprintf(path, sizeof(path), "%s/%s", cert_dir, file_name);
+        *pem = true;
+        return BIO_new_file(path, "r");
+    }
+
+    if ((NULL == data) || (0U == len))
+    {
+        return NULL;
+    }
+
+    *pem = ('\0' == data[len - 1U]);
+
+    return BIO_new_mem_buf(data, (int) (*pem ? (len - 1U) : len));
+}
+
+/*******************************************************************************
+* Function Name: cy_tls_create_identity
+*******************************************************************************/
+cy_rslt_t cy_tls_create_identity(const char *certificate_data,
+                                 const uint32_t certificate_len,
+                                 const char *private_key,
+                                 uint32_t private_key_len,
+                                 void **tls_identity)
+{
+    tls_identity_t *identity = calloc(1U, sizeof(*identity));
+    BIO *bio;
+    bool pem = false;
+
+    if (NULL == identity)
+    {
+        return CY_RSLT_MODULE_SECURE_SOCKETS_NOMEM;
+    }
+
+    bio = open_credential(certificate_data, certificate_len, CLIENT_CERT_FILE,
+                          &pem);
+    if (NULL != bio)
+    {
+        identity->certificate = pem ?
+                PEM_read_bio_X509(bio, NULL, NULL, NULL) :
+                d2i_X509_bio(bio, NULL);
+        BIO_free(bio);
+    }
+
+    bio = open_credential(private_key, private_key_len, CLIENT_KEY_FILE, &pem);
+    if (NULL != bio)
+    {
+        identity->private_key = pem ?
+                PEM_read_bio_PrivateKey(bio, NULL, NULL, NULL) :
+                d2i_PrivateKey_bio(bio, NULL);
+        BIO_free(bio);
+    }
+
+    if ((NULL == identity->certificate) || (NULL == identity->private_key))
+    {
+        ERR_print_errors_fp(stderr);
+        (void) cy_tls_delete_identity(identity);
+        return CY_RSLT_MODULE_SECURE_SOCKETS_TLS_ERROR;
+    }
+
+    *tls_identity = identity;
+
+    return CY_RSLT_SUCCESS;
+}
+
+/*******************************************************************************
+* Function Name: cy_tls_delete_identity
+*******************************************************************************/
+cy_rslt_t cy_tls_delete_identity(void *tls_identity)
+{
+    tls_identity_t *identity = (tls_identity_t *) tls_identity;
+
+    if (NULL != identity)
+    {
+        X509_free(identity->certificate);
+        EVP_PKEY_free(identity->private_key);
+        free(identity);
+    }
+
+    return CY_RSLT_SUCCESS;
+}
+
+/*******************************************************************************
+* Function Name: load_root_ca
+********************************************************************************
+* Summary:
+*  Adds every certificate of the trusted root CA to the store of the TLS
+*  context. The certificates of generate_ssl_certs.sh share one subject, so
+*  a trusted certificate may also end the chain where it is.
+*
+*******************************************************************************/
+static bool load_root_ca(SSL_CTX *ctx, const char *data, uint32_t len)
+{
+    X509_STORE *store = SSL_CTX_get_cert_store(ctx);
+    bool pem = false;
+    BIO *bio = open_credential(data, len, ROOT_CA_FILE, &pem);
+    X509 *cert;
+    uint32_t count = 0U;
+
+    if (NULL == bio)
+    {
+        return false;
+    }
+
+    while (NULL != (cert = pem ? PEM_read_bio_X509(bio, NULL, NULL, NULL) :
+                                 d2i_X509_bio(bio, NULL)))
+    {
+        if (1 == X509_STORE_add_cert(store, cert))
+        {
+            count++;
+        }
+        X509_free(cert);
+
+        if (!pem)
+        {
+            break;
+        }
+    }
+
+    /* The end of the PEM data is reported as an error. */
+    ERR_clear_error();
+    BIO_free(bio);
+    (void) X509_STORE_set_flags(store, X509_V_FLAG_PARTIAL_CHAIN);
+
+    return (count > 0U);
+}
+
+/*******************************************************************************
+* Function Name: cy_socket_init
+********************************************************************************
+* Summary:
+*  A write to a socket the server has closed must return an error rather
+*  than end the program.
+*
+*******************************************************************************/
+cy_rslt_t cy_socket_init(void)
+{
+    (void) signal(SIGPIPE, SIG_IGN);
+
+    return CY_RSLT_SUCCESS;
+}
+
+/*******************************************************************************
+* Function Name: cy_socket_create
+*******************************************************************************/
+cy_rslt_t cy_socket_create(int domain, int type, int protocol,
+                           cy_socket_t *handle)
+{
+    host_socket_t *s;
+
+    if ((CY_SOCKET_DOMAIN_AF_INET != domain) ||
+        (CY_SOCKET_TYPE_STREAM != type) || (NULL == handle))
+    {
+        return CY_RSLT_MODULE_SECURE_SOCKETS_BADARG;
+    }
+
+    s = calloc(1U, sizeof(*s));
+    if (NULL == s)
+    {
+        return CY_RSLT_MODULE_SECURE_SOCKETS_NOMEM;
+    }
+
+    s->fd = -1;
+    s->tls = (CY_SOCKET_IPPROTO_TLS == protocol);
+    s->auth_mode = CY_SOCKET_TLS_VERIFY_REQUIRED;
+    s->recv_timeout_ms = DEFAULT_TIMEOUT_MS;
+    s->send_timeout_ms = DEFAULT_TIMEOUT_MS;
+    (void) pthread_mutex_init(&s->io_lock, NULL);
+    *handle = s;
+
+    return CY_RSLT_SUCCESS;
+}
+
+/*******************************************************************************
+* Function Name: set_fd_timeout
+*******************************************************************************/
+static void set_fd_timeout(int fd, int option, uint32_t timeout_ms)
+{
+    struct timeval tv = { 0 };
+
+    if (CY_SOCKET_NEVER_TIMEOUT != timeout_ms)
+    {
+        tv.tv_sec = (time_t) (timeout_ms / MS_PER_SECOND);
+        tv.tv_usec = (suseconds_t) ((timeout_ms % MS_PER_SECOND) * US_PER_MS);
+    }
+
+    (void) setsockopt(fd, SOL_SOCKET, option, &tv, sizeof(tv));
+}
+
+/*******************************************************************************
+* Function Name: watch_socket
+********************************************************************************
+* Summary:
+*  Thread that reports received data and a close of the connection through
+*  the callbacks of the socket. After a receive callback it waits for the
+*  owner to read before it reports the same data again.
+*
+*******************************************************************************/
+static void *watch_socket(void *arg)
+{
+    host_socket_t *s = (host_socket_t *) arg;
+
+    while (!s->stop)
+    {
+        struct pollfd pfd = { .fd = s->fd, .events = POLLIN | POLLRDHUP };
+        bool pending = false;
+        uint32_t reads = s->reads;
+
+        if (0 == pthread_mutex_trylock(&s->io_lock))
+        {
+            pending = (NULL != s->ssl) && (SSL_pending(s->ssl) > 0);
+            (void) pthread_mutex_unlock(&s->io_lock);
+        }
+
+        if (!pending && (poll(&pfd, 1U, WATCH_POLL_MS) <= 0))
+        {
+            continue;
+        }
+
+        if (s->stop)
+        {
+            break;
+        }
+
+        if ((pending || (0 != (pfd.revents & POLLIN))) &&
+            (NULL != s->receive_cb.callback))
+        {
+            (void) s->receive_cb.callback(s, s->receive_cb.arg);
+        }
+
+        if (0 != (pfd.revents & (POLLRDHUP | POLLHUP | POLLERR)))
+        {
+            if (NULL != s->disconnect_cb.callback)
+            {
+                (void) s->disconnect_cb.callback(s, s->disconnect_cb.arg);
+            }
+            break;
+        }
+
+        for (uint32_t i = 0U; (i < WATCH_IDLE_MS) && (reads == s->reads) &&
+                              !s->stop; i++)
+        {
+            (void) usleep(US_PER_MS);
+        }
+    }
+
+    return NULL;
+}
+
+/*******************************************************************************
+* Function Name: start_watching
+********************************************************************************
+* Summary:
+*  Starts the callback thread of a connected socket once it has a callback.
+*
+*******************************************************************************/
+static void start_watching(host_socket_t *s)
+{
+    if (!s->watching && (s->fd >= 0) &&
+        ((NULL != s->receive_cb.callback) ||
+         (NULL != s->disconnect_cb.callback)))
+    {
+        s->stop = false;
+        s->watching = (0 == pthread_create(&s->watcher, NULL, watch_socket,
+                                           s));
+    }
+}
+
+/*******************************************************************************
+* Function Name: stop_watching
+********************************************************************************
+* Summary:
+*  Stops the callback thread. A callback that closes its own socket cannot
+*  wait for its thread, which then ends by itself.
+*
+*******************************************************************************/
+static void stop_watching(host_socket_t *s)
+{
+    if (s->watching)
+    {
+        s->stop = true;
+        if (pthread_equal(pthread_self(), s->watcher))
+        {
+            (void) pthread_detach(s->watcher);
+        }
+        else
+        {
+            (void) pthread_join(s->watcher, NULL);
+        }
+        s->watching = false;
+    }
+}
+
+/*******************************************************************************
+* Function Name: cy_socket_setsockopt
+*******************************************************************************/
+cy_rslt_t cy_socket_setsockopt(cy_socket_t handle, int level, int optname,
+                               const void *optval, uint32_t optlen)
+{
+    host_socket_t *s = (host_socket_t *) handle;
+
+    if ((NULL == s) || (NULL == optval))
+    {
+        return CY_RSLT_MODULE_SECURE_SOCKETS_BADARG;
+    }
+
+    if (CY_SOCKET_SOL_TLS == level)
+    {
+        switch (optname)
+        {
+            case CY_SOCKET_SO_TLS_IDENTITY:
+                s->identity = (const tls_identity_t *) optval;
+                return CY_RSLT_SUCCESS;
+            case CY_SOCKET_SO_TLS_AUTH_MODE:
+                s->auth_mode = *(const cy_socket_tls_auth_mode_t *) optval;
+                return CY_RSLT_SUCCESS;
+            case CY_SOCKET_SO_TRUSTED_ROOTCA_CERTIFICATE:
+                s->root_ca = (const char *) optval;
+                s->root_ca_len = optlen;
+                return CY_RSLT_SUCCESS;
+            default:
+                return CY_RSLT_MODULE_SECURE_SOCKETS_BADARG;
+        }
+    }
+
+    if (CY_SOCKET_SOL_SOCKET == level)
+    {
+        switch (optname)
+        {
+            case CY_SOCKET_SO_RCVTIMEO:
+                s->recv_timeout_ms = *(const uint32_t *) optval;
+                if (s->fd >= 0)
+                {
+                    set_fd_timeout(s->fd, SO_RCVTIMEO, s->recv_timeout_ms);
+                }
+                return CY_RSLT_SUCCESS;
+            case CY_SOCKET_SO_SNDTIMEO:
+                s->send_timeout_ms = *(const uint32_t *) optval;
+                if (s->fd >= 0)
+                {
+                    set_fd_timeout(s->fd, SO_SNDTIMEO, s->send_timeout_ms);
+                }
+                return CY_RSLT_SUCCESS;
+            case CY_SOCKET_SO_RECEIVE_CALLBACK:
+                s->receive_cb = *(const cy_socket_opt_callback_t *) optval;
+                start_watching(s);
+                return CY_RSLT_SUCCESS;
+            case CY_SOCKET_SO_DISCONNECT_CALLBACK:
+                s->disconnect_cb = *(const cy_socket_opt_callback_t *) optval;
+                start_watching(s);
+                return CY_RSLT_SUCCESS;
+            default:
+                return CY_RSLT_MODULE_SECURE_SOCKETS_BADARG;
+        }
+    }
+
+    return CY_RSLT_MODULE_SECURE_SOCKETS_BADARG;
+}
+
+/*******************************************************************************
+* Function Name: cy_socket_gethostbyname
+*******************************************************************************/
+cy_rslt_t cy_socket_gethostbyname(const char *hostname,
+                                  cy_socket_ip_version_t ip_ver,
+                                  cy_socket_ip_address_t *addr)
+{
+    struct addrinfo hints = { .ai_family = AF_INET,
+                              .ai_socktype = SOCK_STREAM };
+    struct addrinfo *list = NULL;
+
+    if ((CY_SOCKET_IP_VER_V4 != ip_ver) || (NULL == addr))
+    {
+        return CY_RSLT_MODULE_SECURE_SOCKETS_BADARG;
+    }
+
+    if ((0 != getaddrinfo(hostname, NULL, &hints, &list)) || (NULL == list))
+    {
+        return CY_RSLT_MODULE_SECURE_SOCKETS_HOST_NOT_FOUND;
+    }
+
+    addr->version = CY_SOCKET_IP_VER_V4;
+    addr->ip.v4 = ((struct sockaddr_in *) list->ai_addr)->sin_addr.s_addr;
+    freeaddrinfo(list);
+
+    return CY_RSLT_SUCCESS;
+}
+
+/*******************************************************************************
+* Function Name: verify_server
+********************************************************************************
+* Summary:
+*  Certificate verify callback. generate_ssl_certs.sh gives the server
+*  certificate the subject of its root CA, so OpenSSL takes it for a
+*  self-signed certificate. It is accepted, as Mbed TLS does, if a trusted
+*  root CA signed it.
+*
+*******************************************************************************/
+static int verify_server(int preverify_ok, X509_STORE_CTX *store_ctx)
+{
+    STACK_OF(X509_OBJECT) *objects;
+    X509 *cert;
+
+    if ((0 != preverify_ok) ||
+        (X509_V_ERR_DEPTH_ZERO_SELF_SIGNED_CERT !=
+         X509_STORE_CTX_get_error(store_ctx)))
+    {
+        return preverify_ok;
+    }
+
+    cert = X509_STORE_CTX_get_current_cert(store_ctx);
+    objects = X509_STORE_get0_objects(X509_STORE_CTX_get0_store(store_ctx));
+
+    for (int i = 0; i < sk_X509_OBJECT_num(objects); i++)
+    {
+        X509 *ca = X509_OBJECT_get0_X509(sk_X509_OBJECT_value(objects, i));
+
+        if ((NULL != ca) && (1 == X509_verify(cert, X509_get0_pubkey(ca))))
+        {
+            X509_STORE_CTX_set_error(store_ctx, X509_V_OK);
+            return 1;
+        }
+    }
+
+    return 0;
+}
+
+/*******************************************************************************
+* Function Name: start_tls
+********************************************************************************
+* Summary:
+*  Runs the TLS handshake on a connected socket with the identity and the
+*  trusted root CA set on it.
+*
+*******************************************************************************/
+static cy_rslt_t start_tls(host_socket_t *s)
+{
+    s->ctx = SSL_CTX_new(TLS_client_method());
+    if (NULL == s->ctx)
+    {
+        return CY_RSLT_MODULE_SECURE_SOCKETS_NOMEM;
+    }
+
+    if ((NULL != s->identity) &&
+        ((1 != SSL_CTX_use_certificate(s->ctx, s->identity->certificate)) ||
+         (1 != SSL_CTX_use_PrivateKey(s->ctx, s->identity->private_key))))
+    {
+        ERR_print_errors_fp(stderr);
+        return CY_RSLT_MODULE_SECURE_SOCKETS_TLS_ERROR;
+    }
+
+    if (CY_SOCKET_TLS_VERIFY_NONE != s->auth_mode)
+    {
+        if (!load_root_ca(s->ctx, s->root_ca, s->root_ca_len))
+        {
+            (void) fprintf(stderr, "No trusted root CA could be read\n");
+            return CY_RSLT_MODULE_SECURE_SOCKETS_TLS_ERROR;
+        }
+        SSL_CTX_set_verify(s->ctx, (CY_SOCKET_TLS_VERIFY_REQUIRED ==
+                                    s->auth_mode) ? SSL_VERIFY_PEER :
+                                    SSL_VERIFY_NONE, verify_server);
+    }
+
+    s->ssl = SSL_new(s->ctx);
+    if ((NULL == s->ssl) || (1 != SSL_set_fd(s->ssl, s->fd)) ||
+        (1 != SSL_connect(s->ssl)))
+    {
+        ERR_print_errors_fp(stderr);
+        return CY_RSLT_MODULE_SECURE_SOCKETS_TLS_ERROR;
+    }
+
+    return CY_RSLT_SUCCESS;
+}
+
+/*******************************************************************************
+* Function Name: close_socket
+********************************************************************************
+* Summary:
+*  Ends the TLS session and closes the connection of a socket.
+*
+*******************************************************************************/
+static void close_socket(host_socket_t *s)
+{
+    stop_watching(s);
+
+    (void) pthread_mutex_lock(&s->io_lock);
+    if (NULL != s->ssl)
+    {
+        (void) SSL_shutdown(s->ssl);
+        SSL_free(s->ssl);
+        s->ssl = NULL;
+    }
+    if (NULL != s->ctx)
+    {
+        SSL_CTX_free(s->ctx);
+        s->ctx = NULL;
+    }
+    if (s->fd >= 0)
+    {
+        (void) close(s->fd);
+        s->fd = -1;
+    }
+    (void) pthread_mutex_unlock(&s->io_lock);
+}
+
+/*******************************************************************************
+* Function Name: cy_socket_connect
+*******************************************************************************/
+cy_rslt_t cy_socket_connect(cy_socket_t handle,
+                            cy_socket_sockaddr_t *address,
+                            uint32_t address_length)
+{
+    host_socket_t *s = (host_socket_t *) handle;
+    struct sockaddr_in peer = { .sin_family = AF_INET };
+    cy_rslt_t result = CY_RSLT_SUCCESS;
+
+    CY_UNUSED_PARAMETER(address_length);
+
+    if ((NULL == s) || (NULL == address) ||
+        (CY_SOCKET_IP_VER_V4 != address->ip_address.version))
+    {
+        return CY_RSLT_MODULE_SECURE_SOCKETS_BADARG;
+    }
+
+    peer.sin_port = htons(address->port);
+    peer.sin_addr.s_addr = address->ip_address.ip.v4;
+
+    s->fd = socket(AF_INET, SOCK_STREAM, 0);
+    if (s->fd < 0)
+    {
+        return CY_RSLT_MODULE_SECURE_SOCKETS_NOMEM;
+    }
+
+    set_fd_timeout(s->fd, SO_RCVTIMEO, s->recv_timeout_ms);
+    set_fd_timeout(s->fd, SO_SNDTIMEO, s->send_timeout_ms);
+
+    /* The HTTP client sends the headers and the body of a request in two
+     * writes. With Nagle's algorithm, the body would wait for the delayed
+     * ACK of the PC, about 40 ms, and the benchmark would measure that.
+     */
+    (void) setsockopt(s->fd, IPPROTO_TCP, TCP_NODELAY, &(int) { 1 },
+                      sizeof(int));
+
+    if (0 != connect(s->fd, (struct sockaddr *) &peer, sizeof(peer)))
+    {
+        result = (EAGAIN == errno) ?
+                 CY_RSLT_MODULE_SECURE_SOCKETS_TIMEOUT :
+                 CY_RSLT_MODULE_SECURE_SOCKETS_NOT_CONNECTED;
+    }
+    else if (s->tls)
+    {
+        result = start_tls(s);
+    }
+
+    if (CY_RSLT_SUCCESS == result)
+    {
+        start_watching(s);
+    }
+    else
+    {
+        close_socket(s);
+    }
+
+    return result;
+}
+
+/*******************************************************************************
+* Function Name: io_result
+********************************************************************************
+* Summary:
+*  Maps the outcome of a failed read or write to a secure sockets result.
+*
+*******************************************************************************/
+static cy_rslt_t io_result(host_socket_t *s, int ret)
+{
+    int error = (NULL != s->ssl) ? SSL_get_error(s->ssl, ret) :
+                                   SSL_ERROR_SYSCALL;
+
+    if ((SSL_ERROR_WANT_READ == error) || (SSL_ERROR_WANT_WRITE == error) ||
+        (((EAGAIN == errno) || (EWOULDBLOCK == errno)) &&
+         (SSL_ERROR_SYSCALL == error) && (ret < 0)))
+    {
+        return CY_RSLT_MODULE_SECURE_SOCKETS_TIMEOUT;
+    }
+
+    ERR_clear_error();
+
+    return CY_RSLT_MODULE_SECURE_SOCKETS_CLOSED;
+}
+
+/*******************************************************************************
+* Function Name: cy_socket_send
+*******************************************************************************/
+cy_rslt_t cy_socket_send(cy_socket_t handle, const void *buffer,
+                         uint32_t length, int flags, uint32_t *bytes_sent)
+{
+    host_socket_t *s = (host_socket_t *) handle;
+    cy_rslt_t result = CY_RSLT_SUCCESS;
+    int ret;
+
+    CY_UNUSED_PARAMETER(flags);
+
+    *bytes_sent = 0U;
+    if ((NULL == s) || (s->fd < 0))
+    {
+        return CY_RSLT_MODULE_SECURE_SOCKETS_NOT_CONNECTED;
+    }
+
+    if (0U == length)
+    {
+        return CY_RSLT_SUCCESS;
+    }
+
+    (void) pthread_mutex_lock(&s->io_lock);
+    errno = 0;
+    ret = (NULL != s->ssl) ? SSL_write(s->ssl, buffer, (int) length) :
+                             (int) send(s->fd, buffer, length, MSG_NOSIGNAL);
+    if (ret > 0)
+    {
+        *bytes_sent = (uint32_t) ret;
+    }
+    else
+    {
+        result = io_result(s, ret);
+    }
+    (void) pthread_mutex_unlock(&s->io_lock);
+
+    return result;
+}
+
+/*******************************************************************************
+* Function Name: cy_socket_recv
+********************************************************************************
+* Summary:
+*  Receives the bytes available, up to length, waiting at most the receive
+*  timeout for the first one.
+*
+*******************************************************************************/
+cy_rslt_t cy_socket_recv(cy_socket_t handle, void *buffer, uint32_t length,
+                         int flags, uint32_t *bytes_received)
+{
+    host_socket_t *s = (host_socket_t *) handle;
+    cy_rslt_t result = CY_RSLT_SUCCESS;
+    int ret;
+
+    CY_UNUSED_PARAMETER(flags);
+
+    *bytes_received = 0U;
+    if ((NULL == s) || (s->fd < 0))
+    {
+        return CY_RSLT_MODULE_SECURE_SOCKETS_NOT_CONNECTED;
+    }
+
+    (void) pthread_mutex_lock(&s->io_lock);
+    errno = 0;
+    ret = (NULL != s->ssl) ? SSL_read(s->ssl, buffer, (int) length) :
+                             (int) recv(s->fd, buffer, length, 0);
+    if (ret > 0)
+    {
+        *bytes_received = (uint32_t) ret;
+    }
+    else
+    {
+        result = io_result(s, ret);
+    }
+    s->reads++;
+    (void) pthread_mutex_unlock(&s->io_lock);
+
+    return result;
+}
+
+/*******************************************************************************
+* Function Name: cy_socket_disconnect
+*******************************************************************************/
+cy_rslt_t cy_socket_disconnect(cy_socket_t handle, uint32_t timeout)
+{
+    host_socket_t *s = (host_socket_t *) handle;
+
+    CY_UNUSED_PARAMETER(timeout);
+
+    if (NULL == s)
+    {
+        return CY_RSLT_MODULE_SECURE_SOCKETS_BADARG;
+    }
+
+    close_socket(s);
+
+    return CY_RSLT_SUCCESS;
+}
+
+/*******************************************************************************
+* Function Name: cy_socket_delete
+*******************************************************************************/
+cy_rslt_t cy_socket_delete(cy_socket_t handle)
+{
+    host_socket_t *s = (host_socket_t *) handle;
+
+    if (NULL == s)
+    {
+        return CY_RSLT_MODULE_SECURE_SOCKETS_BADARG;
+    }
+
+    close_socket(s);
+    (void) pthread_mutex_destroy(&s->io_lock);
+    free(s);
+
+    return CY_RSLT_SUCCESS;
+}
+
+
+/* [] END OF FILE */
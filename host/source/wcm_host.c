@@ -0,0 +1,254 @@
+/*******************************************************************************
+* File Name: wcm_host.c
+*
+* Description: This file contains the Wi-Fi Connection Manager stand-in of the
+* Linux build. The host is already on a network: joining an
+* access point takes no time and reports the first IPv4 address
+* of the host, and the associated access point is a fixed one.
+*
+* Related Document: See README.md
+********************************************************************************
+* Copyright 2024-2025, Cypress Semiconductor Corporation (an Infineon company) or
+* an affiliate of Cypress Semiconductor Corporation.  All rights reserved.
+*
+* This software, including source code, documentation and related
+* materials ("Software") is owned by Cypress Semiconductor Corporation
+* or one of its affiliates ("Cypress") and is protected by and subject to
+* worldwide patent protection (United States and foreign),
+* United States copyright laws and international treaty provisions.
+* Therefore, you may use this Software only as provided in the license
+* agreement accompanying the software package from which you
+* obtained this Software ("EULA").
+* If no EULA applies, Cypress hereby grants you a personal, non-exclusive,
+* non-transferable license to copy, modify, and compile the Software
+* source code solely for use in connection with Cypress's
+* integrated circuit products.  Any reproduction, modification, translation,
+* compilation, or representation of this Software except as specified
+* above is prohibited without the express written permission of Cypress.
+*
+* Disclaimer: THIS SOFTWARE IS PROVIDED AS-IS, WITH NO WARRANTY OF ANY KIND,
+* EXPRESS OR IMPLIED, INCLUDING, BUT NOT LIMITED TO, NONINFRINGEMENT, IMPLIED
+* WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE. Cypress
+* reserves the right to make changes to the Software without notice. Cypress
+* does not assume any liability arising out of the application or use of the
+* Software or any product or circuit described in the Software. Cypress does
+* not authorize its products for use in any products where a malfunction or
+* failure of the Cypress product may reasonably be expected to result in
+* significant property damage, injury or death ("High Risk Product"). By
+* including Cypress's product in a High Risk Product, the manufacturer
+* of such system or application assumes all risk of such use and in doing
+* so agrees to indemnify Cypress against all liability.
+*******************************************************************************/
+
+/*******************************************************************************
+* Header Files
+*******************************************************************************/
+#include "cy_wcm.h"
+#include "cy_wcm_error.h"
+#include "cy_utils.h"
+#include "lwip/ip_addr.h"
+#include <arpa/inet.h>
+#include <ifaddrs.h>
+#include <net/if.h>
+#include <netinet/in.h>
+#include <stdbool.h>
+#include <string.h>
+
+/*******************************************************************************
+* Macros
+*******************************************************************************/
+#define HOST_AP_CHANNEL                              (6U)
+#define LOOPBACK_ADDRESS                             (0x7F000001UL)
+
+/*******************************************************************************
+* Global Variables
+*******************************************************************************/
+static bool wcm_initialized;
+static cy_wcm_ssid_t joined_ssid;
+static cy_wcm_ip_address_t host_netmask;
+
+/* Locally administered addresses of the station and the access point. */
+static const cy_wcm_mac_t host_mac = { 0x02U, 0x00U, 0x00U, 0x00U, 0x00U,
+                                       0x01U };
+static const cy_wcm_mac_t host_bssid = { 0x02U, 0x00U, 0x00U, 0x00U, 0x00U,
+                                         0xA0U };
+
+static char ntoa_buffer[INET6_ADDRSTRLEN];
+
+/*******************************************************************************
+* Function Definitions
+*******************************************************************************/
+
+/*******************************************************************************
+* Function Name: find_host_address
+********************************************************************************
+* Summary:
+*  Finds the first IPv4 address of an interface that is up and not the
+*  loopback, with its netmask. The loopback address is used if there is none.
+*
+*******************************************************************************/
+static void find_host_address(cy_wcm_ip_address_t *ip_addr,
+                              cy_wcm_ip_address_t *netmask)
+{
+    struct ifaddrs *list = NULL;
+
+    ip_addr->version = CY_WCM_IP_VER_V4;
+    ip_addr->ip.v4 = htonl(LOOPBACK_ADDRESS);
+    netmask->version = CY_WCM_IP_VER_V4;
+    netmask->ip.v4 = htonl(0xFF000000UL);
+
+    if (0 != getifaddrs(&list))
+    {
+        return;
+    }
+
+    for (struct ifaddrs *entry = list; NULL != entry; entry = entry->ifa_next)
+    {
+        if ((NULL != entry->ifa_addr) && (NULL != entry->ifa_netmask) &&
+            (AF_INET == entry->ifa_addr->sa_family) &&
+            (0U != (entry->ifa_flags & IFF_UP)) &&
+            (0U == (entry->ifa_flags & IFF_LOOPBACK)))
+        {
+            ip_addr->ip.v4 = ((struct sockaddr_in *)
+                              entry->ifa_addr)->sin_addr.s_addr;
+            netmask->ip.v4 = ((struct sockaddr_in *)
+                              entry->ifa_netmask)->sin_addr.s_addr;
+            break;
+        }
+    }
+
+    freeifaddrs(list);
+}
+
+/*******************************************************************************
+* Function Name: cy_wcm_init
+*******************************************************************************/
+cy_rslt_t cy_wcm_init(cy_wcm_config_t *config)
+{
+    if ((NULL == config) || (CY_WCM_INTERFACE_TYPE_STA != config->interface))
+    {
+        return CY_RSLT_WCM_BAD_ARG;
+    }
+
+    wcm_initialized = true;
+
+    return CY_RSLT_SUCCESS;
+}
+
+/*******************************************************************************
+* Function Name: cy_wcm_connect_ap
+********************************************************************************
+* Summary:
+*  Joins the access point. The host is already connected, so only the SSID
+*  is kept for cy_wcm_get_associated_ap_info. Static IP settings are not
+*  applied; the address of the host is reported.
+*
+*******************************************************************************/
+cy_rslt_t cy_wcm_connect_ap(cy_wcm_connect_params_t *connect_params,
+                            cy_wcm_ip_address_t *ip_addr)
+{
+    if (!wcm_initialized)
+    {
+        return CY_RSLT_WCM_NOT_INITIALIZED;
+    }
+
+    if ((NULL == connect_params) || (NULL == ip_addr))
+    {
+        return CY_RSLT_WCM_BAD_ARG;
+    }
+
+    (void) memcpy(joined_ssid, connect_params->ap_credentials.SSID,
+                  sizeof(joined_ssid));
+    joined_ssid[CY_WCM_MAX_SSID_LEN] = 0U;
+    find_host_address(ip_addr, &host_netmask);
+
+    return CY_RSLT_SUCCESS;
+}
+
+/*******************************************************************************
+* Function Name: cy_wcm_get_mac_addr
+*******************************************************************************/
+cy_rslt_t cy_wcm_get_mac_addr(cy_wcm_interface_t interface_type,
+                              cy_wcm_mac_t *mac_addr)
+{
+    CY_UNUSED_PARAMETER(interface_type);
+
+    (void) memcpy(mac_addr, host_mac, sizeof(*mac_addr));
+
+    return CY_RSLT_SUCCESS;
+}
+
+/*******************************************************************************
+* Function Name: cy_wcm_get_associated_ap_info
+*******************************************************************************/
+cy_rslt_t cy_wcm_get_associated_ap_info(cy_wcm_associated_ap_info_t *ap_info)
+{
+    if (0U == joined_ssid[0])
+    {
+        return CY_RSLT_WCM_NOT_INITIALIZED;
+    }
+
+    (void) memset(ap_info, 0, sizeof(*ap_info));
+    (void) memcpy(ap_info->SSID, joined_ssid, sizeof(ap_info->SSID));
+    (void) memcpy(ap_info->BSSID, host_bssid, sizeof(ap_info->BSSID));
+    ap_info->channel = HOST_AP_CHANNEL;
+    ap_info->security = CY_WCM_SECURITY_WPA2_AES_PSK;
+
+    return CY_RSLT_SUCCESS;
+}
+
+/*******************************************************************************
+* Function Name: cy_wcm_get_ip_netmask
+*******************************************************************************/
+cy_rslt_t cy_wcm_get_ip_netmask(cy_wcm_interface_t interface_type,
+                                cy_wcm_ip_address_t *net_mask_addr)
+{
+    CY_UNUSED_PARAMETER(interface_type);
+
+    if (0U == joined_ssid[0])
+    {
+        return CY_RSLT_WCM_NOT_INITIALIZED;
+    }
+
+    *net_mask_addr = host_netmask;
+
+    return CY_RSLT_SUCCESS;
+}
+
+/*******************************************************************************
+* Function Name: cy_wcm_get_gateway_ip_address
+********************************************************************************
+* Summary:
+*  The gateway of the host is not looked up, so the join cache keeps no IP
+*  settings on the host.
+*
+*******************************************************************************/
+cy_rslt_t cy_wcm_get_gateway_ip_address(cy_wcm_interface_t interface_type,
+                                        cy_wcm_ip_address_t *gateway_addr)
+{
+    CY_UNUSED_PARAMETER(interface_type);
+    CY_UNUSED_PARAMETER(gateway_addr);
+
+    return CY_RSLT_WCM_NOT_INITIALIZED;
+}
+
+/*******************************************************************************
+* Function Name: ip4addr_ntoa
+*******************************************************************************/
+char *ip4addr_ntoa(const ip4_addr_t *addr)
+{
+    return (char *) inet_ntop(AF_INET, &addr->addr, ntoa_buffer,
+                              sizeof(ntoa_buffer));
+}
+
+/*******************************************************************************
+* Function Name: ip6addr_ntoa
+*******************************************************************************/
+char *ip6addr_ntoa(const ip6_addr_t *addr)
+{
+    return (char *) inet_ntop(AF_INET6, addr->addr, ntoa_buffer,
+                              sizeof(ntoa_buffer));
+}
+
+
+/* [] END OF FILE */
@@ -0,0 +1,411 @@
+/*******************************************************************************
+* File Name: app_log.c
+*
+* Description: This file implements the deferred console log. Text is copied
+* into a ring buffer by the caller and written to the debug UART by a
+* low-priority task, so printing does not stall the network tasks.
+*
+* Related Document: See README.md
+********************************************************************************
+* Copyright 2024-2025, Cypress Semiconductor Corporation (an Infineon company) or
+* an affiliate of Cypress Semiconductor Corporation.  All rights reserved.
+*
+* This software, including source code, documentation and related
+* materials ("Software") is owned by Cypress Semiconductor Corporation
+* or one of its affiliates ("Cypress") and is protected by and subject to
+* worldwide patent protection (United States and foreign),
+* United States copyright laws and international treaty provisions.
+* Therefore, you may use this Software only as provided in the license
+* agreement accompanying the software package from which you
+* obtained this Software ("EULA").
+* If no EULA applies, Cypress hereby grants you a personal, non-exclusive,
+* non-transferable license to copy, modify, and compile the Software
+* source code solely for use in connection with Cypress's
+* integrated circuit products.  Any reproduction, modification, translation,
+* compilation, or representation of this Software except as specified
+* above is prohibited without the express written permission of Cypress.
+*
+* Disclaimer: THIS SOFTWARE IS PROVIDED AS-IS, WITH NO WARRANTY OF ANY KIND,
+* EXPRESS OR IMPLIED, INCLUDING, BUT NOT LIMITED TO, NONINFRINGEMENT, IMPLIED
+* WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE. Cypress
+* reserves the right to make changes to the Software without notice. Cypress
+* does not assume any liability arising out of the application or use of the
+* Software or any product or circuit described in the Software. Cypress does
+* not authorize its products for use in any products where a malfunction or
+* failure of the Cypress product may reasonably be expected to result in
+* significant property damage, injury or death ("High Risk Product"). By
+* including Cypress's product in a High Risk Product, the manufacturer
+* of such system or application assumes all risk of such use and in doing
+* so agrees to indemnify Cypress against all liability.
+*******************************************************************************/
+
+/*******************************************************************************
+* Header Files
+*******************************************************************************/
+#include "app_log.h"
+#include <stdio.h>
+#include <stdarg.h>
+#include <string.h>
+
+#include "cybsp.h"
+
+/* FreeRTOS header file */
+#include <FreeRTOS.h>
+#include <task.h>
+
+/*******************************************************************************
+* Macros
+*******************************************************************************/
+#define RING_MASK                                    (APP_LOG_BUFFER_SIZE - 1U)
+
+/* Delay of the drain task while the UART FIFO is full, and of a caller
+ * while the ring buffer is full.
+ */
+#define DRAIN_DELAY_TICKS                            (1U)
+
+#define DROPPED_NOTE_LENGTH                          (48U)
+
+/* Orders the ring buffer copies against the index updates that publish
+ * them to the other side.
+ */
+#define LOG_BARRIER()                                __DMB()
+
+/*******************************************************************************
+* Global Variables
+********************************************************************************/
+static uint8_t log_ring[APP_LOG_BUFFER_SIZE];
+
+/* Bytes reserved by the callers since start, bytes published to the drain
+ * task, and bytes sent to the UART. The callers move log_reserved and
+ * log_head inside a critical section, but copy their text outside it;
+ * log_head catches up with log_reserved when the last copy in progress
+ * ends. Only the drain task moves log_tail, without a lock.
+ */
+static volatile uint32_t log_reserved;
+static volatile uint32_t log_head;
+static volatile uint32_t log_tail;
+
+/* Callers copying into the ring buffer. */
+static uint32_t log_writers;
+
+static volatile uint32_t log_dropped;
+static TaskHandle_t log_task_handle;
+
+/* The carriage return of a line feed was sent but not the line feed. */
+static bool cr_pending;
+
+/*******************************************************************************
+* Function Definitions
+*******************************************************************************/
+
+/*******************************************************************************
+* Function Name: uart_put
+********************************************************************************
+* Summary:
+*  Moves bytes into the UART transmit FIFO until it is full, turning a line
+*  feed into CR LF like retarget-io does.
+*
+* Return:
+*  uint32_t: Bytes consumed from data.
+*
+*******************************************************************************/
+static uint32_t uart_put(const uint8_t *data, uint32_t len)
+{
+    uint32_t consumed = 0U;
+
+    while (consumed < len)
+    {
+#if defined(CY_RETARGET_IO_CONVERT_LF_TO_CRLF)
+        if (('\n' == data[consumed]) && !cr_pending)
+        {
+            if (0U == Cy_SCB_UART_Put(CYBSP_DEBUG_UART_HW, '\r'))
+            {
+                break;
+            }
+            cr_pending = true;
+        }
+#endif /* defined(CY_RETARGET_IO_CONVERT_LF_TO_CRLF) */
+
+        if (0U == Cy_SCB_UART_Put(CYBSP_DEBUG_UART_HW, data[consumed]))
+        {
+            break;
+        }
+        cr_pending = false;
+        consumed++;
+    }
+
+    return consumed;
+}
+
+/*******************************************************************************
+* Function Name: uart_put_all
+********************************************************************************
+* Summary:
+*  Sends a short text from the drain task, waiting while the FIFO is full.
+*
+*******************************************************************************/
+static void uart_put_all(const uint8_t *data, uint32_t len)
+{
+    uint32_t sent = 0U;
+
+    while (sent < len)
+    {
+        sent += uart_put(&data[sent], len - sent);
+
+        if (sent < len)
+        {
+            vTaskDelay(DRAIN_DELAY_TICKS);
+        }
+    }
+}
+
+/*******************************************************************************
+* Function Name: log_task
+********************************************************************************
+* Summary:
+*  Drains the ring buffer to the UART. It sleeps until a caller notifies it
+*  and gives up the CPU whenever the FIFO is full, so the UART sets the
+*  pace without holding back other tasks. The retarget-io deep sleep
+*  callback keeps the device awake until the FIFO has been sent.
+*
+*******************************************************************************/
+static void log_task(void *arg)
+{
+    uint32_t reported = 0U;
+    char note[DROPPED_NOTE_LENGTH];
+
+    (void) arg;
+
+    for (;;)
+    {
+        uint32_t tail = log_tail;
+        uint32_t pending = log_head - tail;
+        uint32_t chunk;
+        uint32_t sent;
+
+        LOG_BARRIER();
+
+        if (0U == pending)
+        {
+            if (reported != log_dropped)
+            {
+                reported = log_dropped;
+                uart_put_all((const uint8_t *) note, (uint32_t) snprintf(note,
+                        sizeof(note), "\n[log: %lu bytes dropped]\n",
+                        (unsigned long) reported));
+            }
+
+            (void) ulTaskNotifyTake(pdTRUE, portMAX_DELAY);
+            continue;
+        }
+
+        chunk = APP_LOG_BUFFER_SIZE - (tail & RING_MASK);
+        if (chunk > pending)
+        {
+            chunk = pending;
+        }
+
+        sent = uart_put(&log_ring[tail & RING_MASK], chunk);
+        LOG_BARRIER();
+        log_tail = tail + sent;
+
+        if (sent < chunk)
+        {
+            vTaskDelay(DRAIN_DELAY_TICKS);
+        }
+    }
+}
+
+/*******************************************************************************
+* Function Name: app_log_init
+********************************************************************************
+* Summary:
+*  Starts the drain task. Text logged before this is written directly.
+*
+* Parameters:
+*  void
+*
+* Return:
+*  cy_rslt_t: CY_RSLT_SUCCESS if the task was created.
+*
+*******************************************************************************/
+cy_rslt_t app_log_init(void)
+{
+    log_reserved = 0U;
+    log_head = 0U;
+    log_tail = 0U;
+    log_writers = 0U;
+    log_dropped = 0U;
+
+    if (pdPASS != xTaskCreate(log_task, "Log", APP_LOG_TASK_STACK_SIZE, NULL,
+                              APP_LOG_TASK_PRIORITY, &log_task_handle))
+    {
+        log_task_handle = NULL;
+        return CY_RSLT_TYPE_ERROR;
+    }
+
+    return CY_RSLT_SUCCESS;
+}
+
+/*******************************************************************************
+* Function Name: app_log_write
+********************************************************************************
+* Summary:
+*  Copies text into the ring buffer and wakes the drain task. When the
+*  buffer is full, the caller waits up to APP_LOG_FULL_WAIT_MS for room and
+*  then drops what does not fit. Must not be called from an interrupt.
+*
+* Parameters:
+*  data - Text to log
+*  len  - Length of the text
+*
+* Return:
+*  void
+*
+*******************************************************************************/
+void app_log_write(const void *data, uint32_t len)
+{
+    const uint8_t *bytes = (const uint8_t *) data;
+    TickType_t start = xTaskGetTickCount();
+
+    if (NULL == log_task_handle)
+    {
+        (void) fwrite(data, 1U, len, stdout);
+        return;
+    }
+
+    while (len > 0U)
+    {
+        uint32_t piece = (len < APP_LOG_BUFFER_SIZE) ? len :
+                                                     APP_LOG_BUFFER_SIZE;
+        uint32_t start_index = 0U;
+        uint32_t first;
+        bool fits;
+
+        /* A piece is reserved only once it fits whole, so text from two
+         * callers never interleaves inside a line. The copy is made outside
+         * the critical section.
+         */
+        taskENTER_CRITICAL();
+        fits = ((APP_LOG_BUFFER_SIZE - (log_reserved - log_tail)) >= piece);
+        if (fits)
+        {
+            start_index = log_reserved;
+            log_reserved = start_index + piece;
+            log_writers++;
+        }
+        taskEXIT_CRITICAL();
+
+        if (fits)
+        {
+            first = APP_LOG_BUFFER_SIZE - (start_index & RING_MASK);
+            if (first > piece)
+            {
+                first = piece;
+            }
+
+            (void) memcpy(&log_ring[start_index & RING_MASK], bytes, first);
+            (void) memcpy(log_ring, &bytes[first], piece - first);
+            LOG_BARRIER();
+
+            /* The last caller to finish its copy publishes the text of all,
+             * as the earlier reservations are complete by then.
+             */
+            taskENTER_CRITICAL();
+            log_writers--;
+            if (0U == log_writers)
+            {
+                log_head = log_reserved;
+            }
+            taskEXIT_CRITICAL();
+
+            (void) xTaskNotifyGive(log_task_handle);
+            bytes += piece;
+            len -= piece;
+        }
+        else if ((xTaskGetTickCount() - start) >=
+                 pdMS_TO_TICKS(APP_LOG_FULL_WAIT_MS))
+        {
+            taskENTER_CRITICAL();
+            log_dropped += len;
+            taskEXIT_CRITICAL();
+            (void) xTaskNotifyGive(log_task_handle);
+            break;
+        }
+        else
+        {
+            vTaskDelay(DRAIN_DELAY_TICKS);
+        }
+    }
+}
+
+/*******************************************************************************
+* Function Name: app_log_printf
+********************************************************************************
+* Summary:
+*  Formats text of up to APP_LOG_LINE_MAX - 1 characters on the caller's
+*  stack and logs it with app_log_write.
+*
+*******************************************************************************/
+void app_log_printf(const char *format, ...)
+{
+    char line[APP_LOG_LINE_MAX];
+    va_list args;
+    int length;
+
+    va_start(args, format);
+    length = vsnprintf(line, sizeof(line), format, args);
+    va_end(args);
+
+    if (length > 0)
+    {
+        app_log_write(line, ((uint32_t) length < sizeof(line)) ?
+                      (uint32_t) length : (uint32_t) (sizeof(line) - 1U));
+    }
+}
+
+/*******************************************************************************
+* Function Name: app_log_flush
+********************************************************************************
+* Summary:
+*  Waits until everything logged so far has left the UART, or the timeout
+*  expires. Called before the console is read, since reading the UART keeps
+*  the CPU busy and would starve the drain task.
+*
+*******************************************************************************/
+void app_log_flush(uint32_t timeout_ms)
+{
+    TickType_t start = xTaskGetTickCount();
+
+    if (NULL == log_task_handle)
+    {
+        (void) fflush(stdout);
+        return;
+    }
+
+    while ((log_tail != log_reserved) ||
+           !Cy_SCB_UART_IsTxComplete(CYBSP_DEBUG_UART_HW))
+    {
+        if ((xTaskGetTickCount() - start) >= pdMS_TO_TICKS(timeout_ms))
+        {
+            break;
+        }
+
+        vTaskDelay(DRAIN_DELAY_TICKS);
+    }
+}
+
+/*******************************************************************************
+* Function Name: app_log_dropped
+********************************************************************************
+* Summary:
+*  Returns the number of bytes dropped because the ring buffer was full.
+*
+*******************************************************************************/
+uint32_t app_log_dropped(void)
+{
+    return log_dropped;
+}
+
+
+/* [] END OF FILE */
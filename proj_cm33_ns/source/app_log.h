@@ -0,0 +1,92 @@
+/*******************************************************************************
+* File Name: app_log.h
+*
+* Description: This file contains the constants and function prototypes of the
+* deferred console log.
+*
+* Related Document: See README.md
+********************************************************************************
+* Copyright 2024-2025, Cypress Semiconductor Corporation (an Infineon company) or
+* an affiliate of Cypress Semiconductor Corporation.  All rights reserved.
+*
+* This software, including source code, documentation and related
+* materials ("Software") is owned by Cypress Semiconductor Corporation
+* or one of its affiliates ("Cypress") and is protected by and subject to
+* worldwide patent protection (United States and foreign),
+* United States copyright laws and international treaty provisions.
+* Therefore, you may use this Software only as provided in the license
+* agreement accompanying the software package from which you
+* obtained this Software ("EULA").
+* If no EULA applies, Cypress hereby grants you a personal, non-exclusive,
+* non-transferable license to copy, modify, and compile the Software
+* source code solely for use in connection with Cypress's
+* integrated circuit products.  Any reproduction, modification, translation,
+* compilation, or representation of this Software except as specified
+* above is prohibited without the express written permission of Cypress.
+*
+* Disclaimer: THIS SOFTWARE IS PROVIDED AS-IS, WITH NO WARRANTY OF ANY KIND,
+* EXPRESS OR IMPLIED, INCLUDING, BUT NOT LIMITED TO, NONINFRINGEMENT, IMPLIED
+* WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE. Cypress
+* reserves the right to make changes to the Software without notice. Cypress
+* does not assume any liability arising out of the application or use of the
+* Software or any product or circuit described in the Software. Cypress does
+* not authorize its products for use in any products where a malfunction or
+* failure of the Cypress product may reasonably be expected to result in
+* significant property damage, injury or death ("High Risk Product"). By
+* including Cypress's product in a High Risk Product, the manufacturer
+* of such system or application assumes all risk of such use and in doing
+* so agrees to indemnify Cypress against all liability.
+*******************************************************************************/
+
+/*******************************************************************************
+* Include guard
+*******************************************************************************/
+#ifndef APP_LOG_H_
+#define APP_LOG_H_
+
+/*******************************************************************************
+* Header Files
+*******************************************************************************/
+#include <stdint.h>
+#include <stdbool.h>
+#include "cy_result.h"
+
+/*******************************************************************************
+* Macros
+*******************************************************************************/
+
+/* Size of the ring buffer, a power of two. At 115200 baud it holds about
+ * 0.7 s of output.
+ */
+#define APP_LOG_BUFFER_SIZE                      (8192U)
+
+/* Longest text app_log_printf formats; longer text is cut. Raw blocks such
+ * as headers and bodies are passed to app_log_write instead.
+ */
+#define APP_LOG_LINE_MAX                         (256U)
+
+/* Time a caller waits for room in a full ring buffer before the text that
+ * does not fit is dropped.
+ */
+#define APP_LOG_FULL_WAIT_MS                     (200U)
+
+/* Time app_log_flush waits at most for the ring buffer to drain. */
+#define APP_LOG_FLUSH_TIMEOUT_MS                 (2000U)
+
+/* The drain task runs at the idle priority, after every other task. */
+#define APP_LOG_TASK_PRIORITY                    (0U)
+#define APP_LOG_TASK_STACK_SIZE                  (2U * 1024U)
+
+/*******************************************************************************
+* Function Prototypes
+*******************************************************************************/
+cy_rslt_t app_log_init(void);
+void app_log_write(const void *data, uint32_t len);
+void app_log_printf(const char *format, ...);
+void app_log_flush(uint32_t timeout_ms);
+uint32_t app_log_dropped(void);
+
+#endif /* APP_LOG_H_ */
+
+
+/* [] END OF FILE */
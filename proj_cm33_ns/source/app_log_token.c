@@ -0,0 +1,277 @@
+/*******************************************************************************
+* File Name: app_log_token.c
+*
+* Description: This file encodes the arguments of a tokenized log message and
+* queues the message on the deferred console log.
+*
+* Related Document: See README.md
+********************************************************************************
+* Copyright 2024-2025, Cypress Semiconductor Corporation (an Infineon company) or
+* an affiliate of Cypress Semiconductor Corporation.  All rights reserved.
+*
+* This software, including source code, documentation and related
+* materials ("Software") is owned by Cypress Semiconductor Corporation
+* or one of its affiliates ("Cypress") and is protected by and subject to
+* worldwide patent protection (United States and foreign),
+* United States copyright laws and international treaty provisions.
+* Therefore, you may use this Software only as provided in the license
+* agreement accompanying the software package from which you
+* obtained this Software ("EULA").
+* If no EULA applies, Cypress hereby grants you a personal, non-exclusive,
+* non-transferable license to copy, modify, and compile the Software
+* source code solely for use in connection with Cypress's
+* integrated circuit products.  Any reproduction, modification, translation,
+* compilation, or representation of this Software except as specified
+* above is prohibited without the express written permission of Cypress.
+*
+* Disclaimer: THIS SOFTWARE IS PROVIDED AS-IS, WITH NO WARRANTY OF ANY KIND,
+* EXPRESS OR IMPLIED, INCLUDING, BUT NOT LIMITED TO, NONINFRINGEMENT, IMPLIED
+* WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE. Cypress
+* reserves the right to make changes to the Software without notice. Cypress
+* does not assume any liability arising out of the application or use of the
+* Software or any product or circuit described in the Software. Cypress does
+* not authorize its products for use in any products where a malfunction or
+* failure of the Cypress product may reasonably be expected to result in
+* significant property damage, injury or death ("High Risk Product"). By
+* including Cypress's product in a High Risk Product, the manufacturer
+* of such system or application assumes all risk of such use and in doing
+* so agrees to indemnify Cypress against all liability.
+*******************************************************************************/
+
+/*******************************************************************************
+* Header Files
+*******************************************************************************/
+#include "app_log_token.h"
+#include "app_log.h"
+#include "mbedtls/base64.h"
+#include <string.h>
+
+/*******************************************************************************
+* Macros
+*******************************************************************************/
+#define TOKEN_SIZE                               (4U)
+#define VARINT_MAX_BYTES                         (10U)
+#define VARINT_CONTINUE                          (0x80U)
+#define VARINT_PAYLOAD_MASK                      (0x7FU)
+#define VARINT_PAYLOAD_BITS                      (7U)
+#define FLOAT_SIZE                               (4U)
+#define BYTE_MASK                                (0xFFU)
+#define BITS_PER_BYTE                            (8U)
+
+/* A message is sent as '$', the base64 text of the record and a line feed,
+ * so it passes through the text console and the decoder can find it.
+ */
+#define TOKEN_PREFIX                             '$'
+#define BASE64_LENGTH(n)                         ((((n) + 2U) / 3U) * 4U)
+#define TOKEN_LINE_MAX                                                      \
+    (1U + BASE64_LENGTH(APP_LOG_TOKEN_RECORD_MAX) + 2U)
+
+/*******************************************************************************
+* Function Definitions
+*******************************************************************************/
+
+/*******************************************************************************
+* Function Name: put_varint
+********************************************************************************
+* Summary:
+*  Appends a signed value as a zigzag varint, so small negative values take
+*  as few bytes as small positive ones.
+*
+* Return:
+*  uint32_t: New length of the record, or 0 if the value did not fit.
+*
+*******************************************************************************/
+static uint32_t put_varint(uint8_t *record, uint32_t length, uint32_t size,
+                           int64_t value)
+{
+    uint64_t zigzag = ((uint64_t) value << 1U) ^ (uint64_t) (value >> 63);
+    uint8_t bytes[VARINT_MAX_BYTES];
+    uint32_t count = 0U;
+
+    do
+    {
+        bytes[count] = (uint8_t) (zigzag & VARINT_PAYLOAD_MASK);
+        zigzag >>= VARINT_PAYLOAD_BITS;
+        if (0U != zigzag)
+        {
+            bytes[count] |= VARINT_CONTINUE;
+        }
+        count++;
+    } while (0U != zigzag);
+
+    if ((size - length) < count)
+    {
+        return 0U;
+    }
+
+    (void) memcpy(&record[length], bytes, count);
+    return length + count;
+}
+
+/*******************************************************************************
+* Function Name: put_string
+********************************************************************************
+* Summary:
+*  Appends a string as a length byte and its characters. A string longer
+*  than APP_LOG_TOKEN_STRING_MAX, or than the room left, is cut and its
+*  length byte is marked.
+*
+* Return:
+*  uint32_t: New length of the record, or 0 if nothing fit.
+*
+*******************************************************************************/
+static uint32_t put_string(uint8_t *record, uint32_t length, uint32_t size,
+                           const char *string)
+{
+    uint32_t room = size - length;
+    uint32_t count = 0U;
+    uint8_t cut = 0U;
+
+    if (NULL == string)
+    {
+        string = "NULL";
+    }
+
+    if (0U == room)
+    {
+        return 0U;
+    }
+
+    if ((room - 1U) < APP_LOG_TOKEN_STRING_MAX)
+    {
+        room = room - 1U;
+    }
+    else
+    {
+        room = APP_LOG_TOKEN_STRING_MAX;
+    }
+
+    while (('\0' != string[count]) && (count < room))
+    {
+        count++;
+    }
+
+    if ('\0' != string[count])
+    {
+        cut = APP_LOG_TOKEN_STRING_CUT;
+    }
+
+    record[length] = (uint8_t) (count | cut);
+    (void) memcpy(&record[length + 1U], string, count);
+    return length + 1U + count;
+}
+
+/*******************************************************************************
+* Function Name: app_log_token_encode
+********************************************************************************
+* Summary:
+*  Encodes a message as its token, little endian, followed by its arguments
+*  in the order of the format string. Arguments that do not fit are left
+*  out; the decoder shows them as missing.
+*
+* Parameters:
+*  record     - Buffer for the encoded message
+*  size       - Size of the buffer, at least the size of a token
+*  token      - Hash of the format string
+*  descriptor - Argument count and types, from APP_LOG_ARG_DESCRIPTOR
+*  args       - The arguments
+*
+* Return:
+*  uint32_t: Length of the encoded message.
+*
+*******************************************************************************/
+uint32_t app_log_token_encode(uint8_t *record, uint32_t size, uint32_t token,
+                              uint32_t descriptor, va_list args)
+{
+    uint32_t count = descriptor & ((1U << APP_LOG_ARG_COUNT_BITS) - 1U);
+    uint32_t types = descriptor >> APP_LOG_ARG_COUNT_BITS;
+    uint32_t length = 0U;
+    uint32_t next;
+    float value;
+
+    for (; length < TOKEN_SIZE; length++)
+    {
+        record[length] = (uint8_t) ((token >> (length * BITS_PER_BYTE)) &
+                                    BYTE_MASK);
+    }
+
+    for (uint32_t i = 0U; (i < count) && (i < APP_LOG_ARG_MAX); i++)
+    {
+        switch ((types >> (i * APP_LOG_ARG_TYPE_BITS)) & APP_LOG_ARG_TYPE_MASK)
+        {
+            case APP_LOG_ARG_INT64:
+                next = put_varint(record, length, size,
+                                  (int64_t) va_arg(args, long long));
+                break;
+
+            case APP_LOG_ARG_DOUBLE:
+                value = (float) va_arg(args, double);
+                next = 0U;
+                if ((size - length) >= FLOAT_SIZE)
+                {
+                    (void) memcpy(&record[length], &value, FLOAT_SIZE);
+                    next = length + FLOAT_SIZE;
+                }
+                break;
+
+            case APP_LOG_ARG_STRING:
+                next = put_string(record, length, size,
+                                  va_arg(args, const char *));
+                break;
+
+            default:
+                next = put_varint(record, length, size,
+                                  (int64_t) va_arg(args, int));
+                break;
+        }
+
+        if (0U == next)
+        {
+            break;
+        }
+        length = next;
+    }
+
+    return length;
+}
+
+/*******************************************************************************
+* Function Name: app_log_token_write
+********************************************************************************
+* Summary:
+*  Encodes a message and queues it on the deferred console log as a '$'
+*  followed by the base64 text of the record. Called by APP_LOG_TOKENIZED.
+*
+* Parameters:
+*  token      - Hash of the format string
+*  descriptor - Argument count and types, from APP_LOG_ARG_DESCRIPTOR
+*  ...        - The arguments
+*
+* Return:
+*  void
+*
+*******************************************************************************/
+void app_log_token_write(uint32_t token, uint32_t descriptor, ...)
+{
+    uint8_t record[APP_LOG_TOKEN_RECORD_MAX];
+    unsigned char line[TOKEN_LINE_MAX];
+    uint32_t length;
+    size_t encoded = 0U;
+    va_list args;
+
+    va_start(args, descriptor);
+    length = app_log_token_encode(record, sizeof(record), token, descriptor,
+                                  args);
+    va_end(args);
+
+    line[0] = TOKEN_PREFIX;
+    if (0 == mbedtls_base64_encode(&line[1], sizeof(line) - 2U, &encoded,
+                                   record, length))
+    {
+        line[1U + encoded] = '\n';
+        app_log_write(line, (uint32_t) (encoded + 2U));
+    }
+}
+
+
+/* [] END OF FILE */
@@ -0,0 +1,280 @@
+/*******************************************************************************
+* File Name: app_log_token.h
+*
+* Description: This file contains the macros of the tokenized log. A message is
+* sent as the hash of its format string followed by its encoded arguments.
+*
+* Related Document: See README.md
+********************************************************************************
+* Copyright 2024-2025, Cypress Semiconductor Corporation (an Infineon company) or
+* an affiliate of Cypress Semiconductor Corporation.  All rights reserved.
+*
+* This software, including source code, documentation and related
+* materials ("Software") is owned by Cypress Semiconductor Corporation
+* or one of its affiliates ("Cypress") and is protected by and subject to
+* worldwide patent protection (United States and foreign),
+* United States copyright laws and international treaty provisions.
+* Therefore, you may use this Software only as provided in the license
+* agreement accompanying the software package from which you
+* obtained this Software ("EULA").
+* If no EULA applies, Cypress hereby grants you a personal, non-exclusive,
+* non-transferable license to copy, modify, and compile the Software
+* source code solely for use in connection with Cypress's
+* integrated circuit products.  Any reproduction, modification, translation,
+* compilation, or representation of this Software except as specified
+* above is prohibited without the express written permission of Cypress.
+*
+* Disclaimer: THIS SOFTWARE IS PROVIDED AS-IS, WITH NO WARRANTY OF ANY KIND,
+* EXPRESS OR IMPLIED, INCLUDING, BUT NOT LIMITED TO, NONINFRINGEMENT, IMPLIED
+* WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE. Cypress
+* reserves the right to make changes to the Software without notice. Cypress
+* does not assume any liability arising out of the application or use of the
+* Software or any product or circuit described in the Software. Cypress does
+* not authorize its products for use in any products where a malfunction or
+* failure of the Cypress product may reasonably be expected to result in
+* significant property damage, injury or death ("High Risk Product"). By
+* including Cypress's product in a High Risk Product, the manufacturer
+* of such system or application assumes all risk of such use and in doing
+* so agrees to indemnify Cypress against all liability.
+*******************************************************************************/
+
+/*******************************************************************************
+* Include guard
+*******************************************************************************/
+#ifndef APP_LOG_TOKEN_H_
+#define APP_LOG_TOKEN_H_
+
+/*******************************************************************************
+* Header Files
+*******************************************************************************/
+#include <stdint.h>
+#include <stdarg.h>
+
+/*******************************************************************************
+* Macros
+*******************************************************************************/
+
+/* Set to 1 to send APP_INFO, ERR_INFO and TEST_INFO messages as tokens.
+ * script/decode_log.py turns them back into text with the ELF file.
+ */
+#ifndef APP_LOG_TOKENIZE
+#define APP_LOG_TOKENIZE                         (0)
+#endif /* APP_LOG_TOKENIZE */
+
+/* Longest encoded message, token included, and longest string argument. A
+ * longer string is cut and marked; arguments past the end are left out.
+ */
+#define APP_LOG_TOKEN_RECORD_MAX                 (96U)
+#define APP_LOG_TOKEN_STRING_MAX                 (48U)
+#define APP_LOG_TOKEN_STRING_CUT                 (0x80U)
+
+/* Argument count and a 2-bit type per argument, packed by
+ * APP_LOG_ARG_DESCRIPTOR.
+ */
+#define APP_LOG_ARG_MAX                          (8U)
+#define APP_LOG_ARG_COUNT_BITS                   (4U)
+#define APP_LOG_ARG_TYPE_BITS                    (2U)
+#define APP_LOG_ARG_TYPE_MASK                    (0x3U)
+
+/* Format strings are stored in a section that is not loaded, so they take
+ * no flash. The linker keeps it in the ELF file for the decoder.
+ */
+#define APP_LOG_TOKEN_SECTION                    ".app_log_tokens"
+
+/* The token is the 65599 hash of the first 96 characters of the format
+ * string and its length. Generated with script/decode_log.py --hash-macro,
+ * which computes the same hash on the host.
+ */
+#define APP_LOG_TOKEN_CHAR(str, i)                                          \
+    ((uint32_t) (((i) < (sizeof(str) - 1U)) ? (uint8_t) (str)[i] : 0U))
+
+#define APP_LOG_TOKEN_HASH(str)                                             \
+    ((uint32_t) ((uint32_t) (sizeof(str) - 1U) +                            \
+    0x0001003fU * APP_LOG_TOKEN_CHAR(str, 0U) +                             \
+    0x007e0f81U * APP_LOG_TOKEN_CHAR(str, 1U) +                             \
+    0x2e86d0bfU * APP_LOG_TOKEN_CHAR(str, 2U) +                             \
+    0x43ec5f01U * APP_LOG_TOKEN_CHAR(str, 3U) +                             \
+    0x162c613fU * APP_LOG_TOKEN_CHAR(str, 4U) +                             \
+    0xd62aee81U * APP_LOG_TOKEN_CHAR(str, 5U) +                             \
+    0xa311b1bfU * APP_LOG_TOKEN_CHAR(str, 6U) +                             \
+    0xd319be01U * APP_LOG_TOKEN_CHAR(str, 7U) +                             \
+    0xb156c23fU * APP_LOG_TOKEN_CHAR(str, 8U) +                             \
+    0x6698cd81U * APP_LOG_TOKEN_CHAR(str, 9U) +                             \
+    0x0d1b92bfU * APP_LOG_TOKEN_CHAR(str, 10U) +                            \
+    0xcc881d01U * APP_LOG_TOKEN_CHAR(str, 11U) +                            \
+    0x7280233fU * APP_LOG_TOKEN_CHAR(str, 12U) +                            \
+    0x50c7ac81U * APP_LOG_TOKEN_CHAR(str, 13U) +                            \
+    0x8da473bfU * APP_LOG_TOKEN_CHAR(str, 14U) +                            \
+    0x4f377c01U * APP_LOG_TOKEN_CHAR(str, 15U) +                            \
+    0xfaa8843fU * APP_LOG_TOKEN_CHAR(str, 16U) +                            \
+    0x33b78b81U * APP_LOG_TOKEN_CHAR(str, 17U) +                            \
+    0x45ac54bfU * APP_LOG_TOKEN_CHAR(str, 18U) +                            \
+    0x7a27db01U * APP_LOG_TOKEN_CHAR(str, 19U) +                            \
+    0xeacfe53fU * APP_LOG_TOKEN_CHAR(str, 20U) +                            \
+    0xae686a81U * APP_LOG_TOKEN_CHAR(str, 21U) +                            \
+    0x563335bfU * APP_LOG_TOKEN_CHAR(str, 22U) +                            \
+    0x6c593a01U * APP_LOG_TOKEN_CHAR(str, 23U) +                            \
+    0xe3f6463fU * APP_LOG_TOKEN_CHAR(str, 24U) +                            \
+    0x5fda4981U * APP_LOG_TOKEN_CHAR(str, 25U) +                            \
+    0xe03916bfU * APP_LOG_TOKEN_CHAR(str, 26U) +                            \
+    0x44cb9901U * APP_LOG_TOKEN_CHAR(str, 27U) +                            \
+    0x871ba73fU * APP_LOG_TOKEN_CHAR(str, 28U) +                            \
+    0xe70d2881U * APP_LOG_TOKEN_CHAR(str, 29U) +                            \
+    0x04bdf7bfU * APP_LOG_TOKEN_CHAR(str, 30U) +                            \
+    0x227ef801U * APP_LOG_TOKEN_CHAR(str, 31U) +                            \
+    0x7540083fU * APP_LOG_TOKEN_CHAR(str, 32U) +                            \
+    0xe3010781U * APP_LOG_TOKEN_CHAR(str, 33U) +                            \
+    0xe4c1d8bfU * APP_LOG_TOKEN_CHAR(str, 34U) +                            \
+    0x24735701U * APP_LOG_TOKEN_CHAR(str, 35U) +                            \
+    0x4f63693fU * APP_LOG_TOKEN_CHAR(str, 36U) +                            \
+    0xf2b5e681U * APP_LOG_TOKEN_CHAR(str, 37U) +                            \
+    0xa144b9bfU * APP_LOG_TOKEN_CHAR(str, 38U) +                            \
+    0x69a8b601U * APP_LOG_TOKEN_CHAR(str, 39U) +                            \
+    0xb685ca3fU * APP_LOG_TOKEN_CHAR(str, 40U) +                            \
+    0xb52bc581U * APP_LOG_TOKEN_CHAR(str, 41U) +                            \
+    0x5b469abfU * APP_LOG_TOKEN_CHAR(str, 42U) +                            \
+    0x111f1501U * APP_LOG_TOKEN_CHAR(str, 43U) +                            \
+    0x4ba72b3fU * APP_LOG_TOKEN_CHAR(str, 44U) +                            \
+    0xc962a481U * APP_LOG_TOKEN_CHAR(str, 45U) +                            \
+    0x33c77bbfU * APP_LOG_TOKEN_CHAR(str, 46U) +                            \
+    0x39d67401U * APP_LOG_TOKEN_CHAR(str, 47U) +                            \
+    0xafc78c3fU * APP_LOG_TOKEN_CHAR(str, 48U) +                            \
+    0xce5a8381U * APP_LOG_TOKEN_CHAR(str, 49U) +                            \
+    0x4bc75cbfU * APP_LOG_TOKEN_CHAR(str, 50U) +                            \
+    0x02ced301U * APP_LOG_TOKEN_CHAR(str, 51U) +                            \
+    0x83e6ed3fU * APP_LOG_TOKEN_CHAR(str, 52U) +                            \
+    0x63136281U * APP_LOG_TOKEN_CHAR(str, 53U) +                            \
+    0xc4463dbfU * APP_LOG_TOKEN_CHAR(str, 54U) +                            \
+    0x8b083201U * APP_LOG_TOKEN_CHAR(str, 55U) +                            \
+    0x69054e3fU * APP_LOG_TOKEN_CHAR(str, 56U) +                            \
+    0x268d4181U * APP_LOG_TOKEN_CHAR(str, 57U) +                            \
+    0xbe441ebfU * APP_LOG_TOKEN_CHAR(str, 58U) +                            \
+    0xf1829101U * APP_LOG_TOKEN_CHAR(str, 59U) +                            \
+    0x0022af3fU * APP_LOG_TOKEN_CHAR(str, 60U) +                            \
+    0xb7c82081U * APP_LOG_TOKEN_CHAR(str, 61U) +                            \
+    0x5ac0ffbfU * APP_LOG_TOKEN_CHAR(str, 62U) +                            \
+    0x553df001U * APP_LOG_TOKEN_CHAR(str, 63U) +                            \
+    0xea3f103fU * APP_LOG_TOKEN_CHAR(str, 64U) +                            \
+    0xb5c3ff81U * APP_LOG_TOKEN_CHAR(str, 65U) +                            \
+    0xbabce0bfU * APP_LOG_TOKEN_CHAR(str, 66U) +                            \
+    0xd53a4f01U * APP_LOG_TOKEN_CHAR(str, 67U) +                            \
+    0xc85a713fU * APP_LOG_TOKEN_CHAR(str, 68U) +                            \
+    0xbf80de81U * APP_LOG_TOKEN_CHAR(str, 69U) +                            \
+    0xff37c1bfU * APP_LOG_TOKEN_CHAR(str, 70U) +                            \
+    0x9077ae01U * APP_LOG_TOKEN_CHAR(str, 71U) +                            \
+    0x3b74d23fU * APP_LOG_TOKEN_CHAR(str, 72U) +                            \
+    0x73febd81U * APP_LOG_TOKEN_CHAR(str, 73U) +                            \
+    0x4931a2bfU * APP_LOG_TOKEN_CHAR(str, 74U) +                            \
+    0xa5f60d01U * APP_LOG_TOKEN_CHAR(str, 75U) +                            \
+    0xe48e333fU * APP_LOG_TOKEN_CHAR(str, 76U) +                            \
+    0x723d9c81U * APP_LOG_TOKEN_CHAR(str, 77U) +                            \
+    0xb9aa83bfU * APP_LOG_TOKEN_CHAR(str, 78U) +                            \
+    0x34b56c01U * APP_LOG_TOKEN_CHAR(str, 79U) +                            \
+    0x64a6943fU * APP_LOG_TOKEN_CHAR(str, 80U) +                            \
+    0x593d7b81U * APP_LOG_TOKEN_CHAR(str, 81U) +                            \
+    0x71a264bfU * APP_LOG_TOKEN_CHAR(str, 82U) +                            \
+    0x5bb5cb01U * APP_LOG_TOKEN_CHAR(str, 83U) +                            \
+    0x5cbdf53fU * APP_LOG_TOKEN_CHAR(str, 84U) +                            \
+    0xc7fe5a81U * APP_LOG_TOKEN_CHAR(str, 85U) +                            \
+    0x921945bfU * APP_LOG_TOKEN_CHAR(str, 86U) +                            \
+    0x39f72a01U * APP_LOG_TOKEN_CHAR(str, 87U) +                            \
+    0x6dd4563fU * APP_LOG_TOKEN_CHAR(str, 88U) +                            \
+    0x5d803981U * APP_LOG_TOKEN_CHAR(str, 89U) +                            \
+    0x3c0f26bfU * APP_LOG_TOKEN_CHAR(str, 90U) +                            \
+    0xee798901U * APP_LOG_TOKEN_CHAR(str, 91U) +                            \
+    0x38e9b73fU * APP_LOG_TOKEN_CHAR(str, 92U) +                            \
+    0xb8c31881U * APP_LOG_TOKEN_CHAR(str, 93U) +                            \
+    0x908407bfU * APP_LOG_TOKEN_CHAR(str, 94U) +                            \
+    0x983ce801U * APP_LOG_TOKEN_CHAR(str, 95U)))
+
+/* Type of an argument, from its C type. Integers and pointers up to 32 bits
+ * are sent as a zigzag varint, wider ones as a 64-bit zigzag varint.
+ */
+#define APP_LOG_ARG_TYPE(arg)                                               \
+    _Generic((arg),                                                         \
+             char *: APP_LOG_ARG_STRING,                                    \
+             const char *: APP_LOG_ARG_STRING,                              \
+             signed char *: APP_LOG_ARG_STRING,                             \
+             const signed char *: APP_LOG_ARG_STRING,                       \
+             unsigned char *: APP_LOG_ARG_STRING,                           \
+             const unsigned char *: APP_LOG_ARG_STRING,                     \
+             float: APP_LOG_ARG_DOUBLE,                                     \
+             double: APP_LOG_ARG_DOUBLE,                                    \
+             default: ((sizeof(arg) > sizeof(uint32_t)) ?                   \
+                       APP_LOG_ARG_INT64 : APP_LOG_ARG_INT))
+
+#define APP_LOG_ARG_COUNT(...)                                              \
+    APP_LOG_ARG_COUNT_(, ##__VA_ARGS__, 8, 7, 6, 5, 4, 3, 2, 1, 0)
+#define APP_LOG_ARG_COUNT_(_0, _1, _2, _3, _4, _5, _6, _7, _8, n, ...)  n
+
+#define APP_LOG_ARG_TYPES_0()                    (0U)
+#define APP_LOG_ARG_TYPES_1(a)                                              \
+    ((uint32_t) APP_LOG_ARG_TYPE(a))
+#define APP_LOG_ARG_TYPES_2(a, ...)                                         \
+    (APP_LOG_ARG_TYPES_1(a) | (APP_LOG_ARG_TYPES_1(__VA_ARGS__) << 2U))
+#define APP_LOG_ARG_TYPES_3(a, ...)                                         \
+    (APP_LOG_ARG_TYPES_1(a) | (APP_LOG_ARG_TYPES_2(__VA_ARGS__) << 2U))
+#define APP_LOG_ARG_TYPES_4(a, ...)                                         \
+    (APP_LOG_ARG_TYPES_1(a) | (APP_LOG_ARG_TYPES_3(__VA_ARGS__) << 2U))
+#define APP_LOG_ARG_TYPES_5(a, ...)                                         \
+    (APP_LOG_ARG_TYPES_1(a) | (APP_LOG_ARG_TYPES_4(__VA_ARGS__) << 2U))
+#define APP_LOG_ARG_TYPES_6(a, ...)                                         \
+    (APP_LOG_ARG_TYPES_1(a) | (APP_LOG_ARG_TYPES_5(__VA_ARGS__) << 2U))
+#define APP_LOG_ARG_TYPES_7(a, ...)                                         \
+    (APP_LOG_ARG_TYPES_1(a) | (APP_LOG_ARG_TYPES_6(__VA_ARGS__) << 2U))
+#define APP_LOG_ARG_TYPES_8(a, ...)                                         \
+    (APP_LOG_ARG_TYPES_1(a) | (APP_LOG_ARG_TYPES_7(__VA_ARGS__) << 2U))
+#define APP_LOG_ARG_TYPES(n, ...)                                           \
+    APP_LOG_ARG_TYPES_(n, __VA_ARGS__)
+#define APP_LOG_ARG_TYPES_(n, ...)                                          \
+    APP_LOG_ARG_TYPES_##n(__VA_ARGS__)
+
+#define APP_LOG_ARG_DESCRIPTOR(...)                                         \
+    ((uint32_t) APP_LOG_ARG_COUNT(__VA_ARGS__) |                            \
+     (APP_LOG_ARG_TYPES(APP_LOG_ARG_COUNT(__VA_ARGS__), ##__VA_ARGS__) <<   \
+      APP_LOG_ARG_COUNT_BITS))
+
+/* Stores the format string in the token section. The string is emitted as
+ * written in the source, so adjacent literals are joined by the assembler.
+ */
+#define APP_LOG_TOKEN_ENTRY(fmt)                                            \
+    __asm__(".pushsection " APP_LOG_TOKEN_SECTION ",\"\",%progbits\n\t"     \
+            ".ascii " #fmt "\n\t"                                           \
+            ".byte 0\n\t"                                                   \
+            ".popsection")
+
+/* Logs a message whose format string is a literal. The token is computed
+ * by the compiler and the string itself never reaches the device.
+ */
+#define APP_LOG_TOKENIZED(fmt, ...)                                         \
+    do                                                                      \
+    {                                                                       \
+        static const uint32_t app_log_token = APP_LOG_TOKEN_HASH(fmt);      \
+        APP_LOG_TOKEN_ENTRY(fmt);                                           \
+        app_log_token_write(app_log_token,                                  \
+                            APP_LOG_ARG_DESCRIPTOR(__VA_ARGS__),            \
+                            ##__VA_ARGS__);                                 \
+    } while (0)
+
+/*******************************************************************************
+* Enumerations
+*******************************************************************************/
+typedef enum
+{
+    APP_LOG_ARG_INT = 0,
+    APP_LOG_ARG_INT64,
+    APP_LOG_ARG_DOUBLE,
+    APP_LOG_ARG_STRING
+} app_log_arg_type_t;
+
+/*******************************************************************************
+* Function Prototypes
+*******************************************************************************/
+void app_log_token_write(uint32_t token, uint32_t descriptor, ...);
+uint32_t app_log_token_encode(uint8_t *record, uint32_t size, uint32_t token,
+                              uint32_t descriptor, va_list args);
+
+#endif /* APP_LOG_TOKEN_H_ */
+
+
+/* [] END OF FILE */
@@ -0,0 +1,223 @@
+/*******************************************************************************
+* File Name: body_offload.c
+*
+* Description: This file contains the CM33 side of the response body
+* pipeline. The bytes of a response body are passed to the CM55 through the
+* offload rings (see crypto_offload.c), which checks them as they
+* arrive and returns a summary when the body ends. A gzip or deflate coded
+* body is passed as received and inflated on the CM55. When the CM55 worker
+* is not running or all of its body sessions are busy, a body the CM33 has
+* decoded is checked locally.
+* The functions are meant to be called from one task.
+*
+* Related Document: See README.md
+********************************************************************************
+* Copyright 2024-2025, Cypress Semiconductor Corporation (an Infineon company) or
+* an affiliate of Cypress Semiconductor Corporation.  All rights reserved.
+*
+* This software, including source code, documentation and related
+* materials ("Software") is owned by Cypress Semiconductor Corporation
+* or one of its affiliates ("Cypress") and is protected by and subject to
+* worldwide patent protection (United States and foreign),
+* United States copyright laws and international treaty provisions.
+* Therefore, you may use this Software only as provided in the license
+* agreement accompanying the software package from which you
+* obtained this Software ("EULA").
+* If no EULA applies, Cypress hereby grants you a personal, non-exclusive,
+* non-transferable license to copy, modify, and compile the Software
+* source code solely for use in connection with Cypress's
+* integrated circuit products.  Any reproduction, modification, translation,
+* compilation, or representation of this Software except as specified
+* above is prohibited without the express written permission of Cypress.
+*
+* Disclaimer: THIS SOFTWARE IS PROVIDED AS-IS, WITH NO WARRANTY OF ANY KIND,
+* EXPRESS OR IMPLIED, INCLUDING, BUT NOT LIMITED TO, NONINFRINGEMENT, IMPLIED
+* WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE. Cypress
+* reserves the right to make changes to the Software without notice. Cypress
+* does not assume any liability arising out of the application or use of the
+* Software or any product or circuit described in the Software. Cypress does
+* not authorize its products for use in any products where a malfunction or
+* failure of the Cypress product may reasonably be expected to result in
+* significant property damage, injury or death ("High Risk Product"). By
+* including Cypress's product in a High Risk Product, the manufacturer
+* of such system or application assumes all risk of such use and in doing
+* so agrees to indemnify Cypress against all liability.
+*******************************************************************************/
+
+/*******************************************************************************
+* Header Files
+*******************************************************************************/
+#include "body_offload.h"
+#include "crypto_offload.h"
+
+/*******************************************************************************
+* Global Variables
+********************************************************************************/
+/* Bit i is set while body session i of the CM55 is in use. */
+static uint32_t body_sessions_in_use;
+
+/*******************************************************************************
+* Function Definitions
+*******************************************************************************/
+
+/*******************************************************************************
+* Function Name: body_offload_begin
+********************************************************************************
+* Summary:
+*  Starts processing a response body. A gzip or deflate coded body is only
+*  processed on the CM55, which inflates it; the local scanner takes bodies
+*  the CM33 has already decoded.
+*
+* Parameters:
+*  ctx   - Body context
+*  flags - CRYPTO_OFFLOAD_BODY_FLAG_* options
+*
+* Return:
+*  cy_rslt_t: CY_RSLT_SUCCESS, or CY_RSLT_TYPE_ERROR if the body is coded
+*  and no CM55 body session is free.
+*
+*******************************************************************************/
+cy_rslt_t body_offload_begin(body_offload_t *ctx, uint32_t flags)
+{
+    ctx->offloaded = false;
+    ctx->flags = flags;
+    ctx->decoded_len = 0U;
+    json_scan_init(&ctx->local);
+
+    if (crypto_offload_available())
+    {
+        for (uint32_t i = 0U; i < CRYPTO_OFFLOAD_BODY_SESSIONS; i++)
+        {
+            if (0U == (body_sessions_in_use & (1UL << i)))
+            {
+                ctx->session = i;
+                ctx->offloaded = (CY_RSLT_SUCCESS ==
+                        crypto_offload_queue_job(CRYPTO_OFFLOAD_OP_BODY_BEGIN,
+                                                 i, flags, NULL, 0U, NULL));
+                break;
+            }
+        }
+    }
+
+    if (ctx->offloaded)
+    {
+        body_sessions_in_use |= (1UL << ctx->session);
+    }
+    else if (0U != (flags & (CRYPTO_OFFLOAD_BODY_FLAG_GZIP |
+                             CRYPTO_OFFLOAD_BODY_FLAG_DEFLATE)))
+    {
+        return CY_RSLT_TYPE_ERROR;
+    }
+    else
+    {
+        /* Processed by the local scanner. */
+    }
+
+    return CY_RSLT_SUCCESS;
+}
+
+/*******************************************************************************
+* Function Name: body_offload_feed
+********************************************************************************
+* Summary:
+*  Passes the next piece of the body. The data is copied, so the buffer can
+*  be reused as soon as the function returns.
+*
+* Return:
+*  cy_rslt_t: CY_RSLT_SUCCESS if the data was accepted.
+*
+*******************************************************************************/
+cy_rslt_t body_offload_feed(body_offload_t *ctx, const uint8_t *data,
+                            uint32_t len)
+{
+    cy_rslt_t result = CY_RSLT_SUCCESS;
+    uint32_t piece;
+
+    if (ctx->offloaded)
+    {
+        while ((len > 0U) && (CY_RSLT_SUCCESS == result))
+        {
+            piece = (len < CRYPTO_OFFLOAD_JOB_DATA_LENGTH) ? len :
+                    CRYPTO_OFFLOAD_JOB_DATA_LENGTH;
+            result = crypto_offload_queue_job(CRYPTO_OFFLOAD_OP_BODY_DATA,
+                                              ctx->session, 0U, data, piece,
+                                              NULL);
+            data += piece;
+            len -= piece;
+        }
+    }
+    else
+    {
+        ctx->decoded_len += len;
+
+        if (0U != (ctx->flags & CRYPTO_OFFLOAD_BODY_FLAG_JSON))
+        {
+            (void) json_scan_feed(&ctx->local, data, len);
+        }
+    }
+
+    return result;
+}
+
+/*******************************************************************************
+* Function Name: body_offload_end
+********************************************************************************
+* Summary:
+*  Ends the body and returns its summary. For an offloaded body, waits until
+*  the CM55 has processed all the queued data. ctx->decoded_len is then the
+*  length of the body after inflating.
+*
+* Parameters:
+*  ctx     - Body context
+*  summary - Receives the summary. Its status is JSON_SCAN_MORE if the body
+*            was not checked as JSON.
+*
+* Return:
+*  cy_rslt_t: CY_RSLT_SUCCESS if the summary is valid, or CY_RSLT_TYPE_ERROR
+*  if the CM55 could not process the body, such as a coded body that did not
+*  inflate.
+*
+*******************************************************************************/
+cy_rslt_t body_offload_end(body_offload_t *ctx, json_scan_summary_t *summary)
+{
+    cy_rslt_t result = CY_RSLT_SUCCESS;
+    crypto_offload_result_t reply;
+    uint32_t sequence;
+
+    if (ctx->offloaded)
+    {
+        result = crypto_offload_queue_job(CRYPTO_OFFLOAD_OP_BODY_END,
+                                          ctx->session, 0U, NULL, 0U,
+                                          &sequence);
+
+        if (CY_RSLT_SUCCESS == result)
+        {
+            result = crypto_offload_wait_result(sequence, &reply);
+        }
+
+        if ((CY_RSLT_SUCCESS == result) && (0U != reply.status))
+        {
+            result = CY_RSLT_TYPE_ERROR;
+        }
+
+        if (CY_RSLT_SUCCESS == result)
+        {
+            *summary = reply.json;
+            ctx->decoded_len = reply.decoded_len;
+        }
+
+        body_sessions_in_use &= ~(1UL << ctx->session);
+    }
+    else
+    {
+        if (0U != (ctx->flags & CRYPTO_OFFLOAD_BODY_FLAG_JSON))
+        {
+            (void) json_scan_finish(&ctx->local);
+        }
+        *summary = ctx->local.summary;
+    }
+
+    return result;
+}
+
+/* [] END OF FILE */
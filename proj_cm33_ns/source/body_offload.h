@@ -0,0 +1,82 @@
+/*******************************************************************************
+* File Name: body_offload.h
+*
+* Description: This file is the public interface of body_offload.c.
+*
+* Related Document: See README.md
+********************************************************************************
+* Copyright 2024-2025, Cypress Semiconductor Corporation (an Infineon company) or
+* an affiliate of Cypress Semiconductor Corporation.  All rights reserved.
+*
+* This software, including source code, documentation and related
+* materials ("Software") is owned by Cypress Semiconductor Corporation
+* or one of its affiliates ("Cypress") and is protected by and subject to
+* worldwide patent protection (United States and foreign),
+* United States copyright laws and international treaty provisions.
+* Therefore, you may use this Software only as provided in the license
+* agreement accompanying the software package from which you
+* obtained this Software ("EULA").
+* If no EULA applies, Cypress hereby grants you a personal, non-exclusive,
+* non-transferable license to copy, modify, and compile the Software
+* source code solely for use in connection with Cypress's
+* integrated circuit products.  Any reproduction, modification, translation,
+* compilation, or representation of this Software except as specified
+* above is prohibited without the express written permission of Cypress.
+*
+* Disclaimer: THIS SOFTWARE IS PROVIDED AS-IS, WITH NO WARRANTY OF ANY KIND,
+* EXPRESS OR IMPLIED, INCLUDING, BUT NOT LIMITED TO, NONINFRINGEMENT, IMPLIED
+* WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE. Cypress
+* reserves the right to make changes to the Software without notice. Cypress
+* does not assume any liability arising out of the application or use of the
+* Software or any product or circuit described in the Software. Cypress does
+* not authorize its products for use in any products where a malfunction or
+* failure of the Cypress product may reasonably be expected to result in
+* significant property damage, injury or death ("High Risk Product"). By
+* including Cypress's product in a High Risk Product, the manufacturer
+* of such system or application assumes all risk of such use and in doing
+* so agrees to indemnify Cypress against all liability.
+*******************************************************************************/
+
+/*******************************************************************************
+* Include guard
+*******************************************************************************/
+#ifndef BODY_OFFLOAD_H_
+#define BODY_OFFLOAD_H_
+
+/*******************************************************************************
+* Header Files
+*******************************************************************************/
+#include <stdint.h>
+#include <stdbool.h>
+#include "cy_result.h"
+#include "json_scan.h"
+
+/*******************************************************************************
+* Data Types
+*******************************************************************************/
+
+/* Response body being processed, on the CM55 when offloaded and with the
+ * local scanner otherwise. decoded_len is the length of the body after any
+ * inflating, valid once body_offload_end returns.
+ */
+typedef struct
+{
+    bool offloaded;
+    uint32_t session;
+    uint32_t flags;
+    uint32_t decoded_len;
+    json_scan_t local;
+} body_offload_t;
+
+/*******************************************************************************
+* Function Prototypes
+*******************************************************************************/
+cy_rslt_t body_offload_begin(body_offload_t *ctx, uint32_t flags);
+cy_rslt_t body_offload_feed(body_offload_t *ctx, const uint8_t *data,
+                            uint32_t len);
+cy_rslt_t body_offload_end(body_offload_t *ctx, json_scan_summary_t *summary);
+
+#endif /* BODY_OFFLOAD_H_ */
+
+
+/* [] END OF FILE */
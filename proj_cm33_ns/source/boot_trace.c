@@ -0,0 +1,400 @@
+/*******************************************************************************
+* File Name: boot_trace.c
+*
+* Description: This file records timestamped begin and end events of the
+* startup phases in a small binary ring buffer, from reset to the first
+* connection to the server, and prints them on request.
+*
+* Related Document: See README.md
+********************************************************************************
+* Copyright 2024-2025, Cypress Semiconductor Corporation (an Infineon company) or
+* an affiliate of Cypress Semiconductor Corporation.  All rights reserved.
+*
+* This software, including source code, documentation and related
+* materials ("Software") is owned by Cypress Semiconductor Corporation
+* or one of its affiliates ("Cypress") and is protected by and subject to
+* worldwide patent protection (United States and foreign),
+* United States copyright laws and international treaty provisions.
+* Therefore, you may use this Software only as provided in the license
+* agreement accompanying the software package from which you
+* obtained this Software ("EULA").
+* If no EULA applies, Cypress hereby grants you a personal, non-exclusive,
+* non-transferable license to copy, modify, and compile the Software
+* source code solely for use in connection with Cypress's
+* integrated circuit products.  Any reproduction, modification, translation,
+* compilation, or representation of this Software except as specified
+* above is prohibited without the express written permission of Cypress.
+*
+* Disclaimer: THIS SOFTWARE IS PROVIDED AS-IS, WITH NO WARRANTY OF ANY KIND,
+* EXPRESS OR IMPLIED, INCLUDING, BUT NOT LIMITED TO, NONINFRINGEMENT, IMPLIED
+* WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE. Cypress
+* reserves the right to make changes to the Software without notice. Cypress
+* does not assume any liability arising out of the application or use of the
+* Software or any product or circuit described in the Software. Cypress does
+* not authorize its products for use in any products where a malfunction or
+* failure of the Cypress product may reasonably be expected to result in
+* significant property damage, injury or death ("High Risk Product"). By
+* including Cypress's product in a High Risk Product, the manufacturer
+* of such system or application assumes all risk of such use and in doing
+* so agrees to indemnify Cypress against all liability.
+*******************************************************************************/
+
+/*******************************************************************************
+* Header Files
+*******************************************************************************/
+#include "boot_trace.h"
+#include "app_log.h"
+#include <stdio.h>
+#include <string.h>
+#include "cybsp.h"
+
+/* FreeRTOS header file */
+#include <FreeRTOS.h>
+#include <task.h>
+
+/*******************************************************************************
+* Macros
+*******************************************************************************/
+#define US_PER_SECOND                                (1000000U)
+#define US_PER_TICK                                                            \
+        (US_PER_SECOND / (uint32_t) configTICK_RATE_HZ)
+
+/* Bytes of the binary dump printed per line. */
+#define HEX_BYTES_PER_LINE                           (32U)
+
+/*******************************************************************************
+* Global Variables
+********************************************************************************/
+static boot_trace_entry_t trace_ring[BOOT_TRACE_ENTRIES];
+
+/* Events recorded since boot_trace_init, including overwritten ones. */
+static uint32_t trace_total;
+
+static volatile bool trace_stopped;
+
+/* Copy of the ring in order, made by boot_trace_read and boot_trace_print. */
+static uint8_t trace_dump[sizeof(boot_trace_header_t) +
+                          (BOOT_TRACE_ENTRIES * sizeof(boot_trace_entry_t))];
+
+static const char * const phase_names[BOOT_TRACE_PHASE_COUNT] =
+{
+    "cybsp_init",
+    "setup_clib_support",
+    "setup_tickless_idle_timer",
+    "init_retarget_io",
+    "Cy_SysEnableCM55",
+    "vTaskStartScheduler",
+    "app_sdio_init",
+    "cy_wcm_init",
+    "cy_wcm_connect_ap",
+    "cy_http_client_create",
+    "cy_http_client_connect",
+    "ready for first request"
+};
+
+/*******************************************************************************
+* Function Definitions
+*******************************************************************************/
+
+/*******************************************************************************
+* Function Name: boot_trace_timestamp
+********************************************************************************
+* Summary:
+*  Reads the free-running counter the events are stamped with. Other modules
+*  use it to time short operations; it wraps after 2^32 counts.
+*
+*******************************************************************************/
+uint32_t boot_trace_timestamp(void)
+{
+    return DWT->CYCCNT;
+}
+
+/*******************************************************************************
+* Function Name: boot_trace_cycles_per_us
+********************************************************************************
+* Summary:
+*  Rate of the counter. On the target it is the core clock set up by
+*  cybsp_init; the events recorded before that are counted at the boot
+*  clock, so the duration of cybsp_init itself is approximate.
+*
+*******************************************************************************/
+uint32_t boot_trace_cycles_per_us(void)
+{
+    uint32_t rate = SystemCoreClock / US_PER_SECOND;
+
+    return (0U != rate) ? rate : 1U;
+}
+
+/*******************************************************************************
+* Function Name: boot_trace_init
+********************************************************************************
+* Summary:
+*  Starts the cycle counter and empties the ring buffer. Called first thing
+*  in main, before cybsp_init.
+*
+*******************************************************************************/
+void boot_trace_init(void)
+{
+    CoreDebug->DEMCR |= CoreDebug_DEMCR_TRCENA_Msk;
+    DWT->CYCCNT = 0U;
+    DWT->CTRL |= DWT_CTRL_CYCCNTENA_Msk;
+
+    trace_total = 0U;
+    trace_stopped = false;
+}
+
+/*******************************************************************************
+* Function Name: boot_trace_record
+********************************************************************************
+* Summary:
+*  Appends an event to the ring buffer, overwriting the oldest one when it
+*  is full. Events after boot_trace_stop are ignored, so reconnects later
+*  on do not push the startup out of the buffer. Safe to call before the
+*  scheduler starts and from any task.
+*
+* Parameters:
+*  phase - Startup phase
+*  kind  - Begin, end or mark
+*  arg   - Value kept with the event, such as the attempt number
+*
+* Return:
+*  void
+*
+*******************************************************************************/
+void boot_trace_record(boot_trace_phase_t phase, boot_trace_kind_t kind,
+                       uint16_t arg)
+{
+    uint32_t interrupt_state = Cy_SysLib_EnterCriticalSection();
+
+    if (!trace_stopped)
+    {
+        boot_trace_entry_t *entry =
+                &trace_ring[trace_total % BOOT_TRACE_ENTRIES];
+
+        entry->timestamp = boot_trace_timestamp();
+        entry->ticks = (taskSCHEDULER_NOT_STARTED == xTaskGetSchedulerState())
+                       ? BOOT_TRACE_NO_TICKS : (uint32_t) xTaskGetTickCount();
+        entry->phase = (uint8_t) phase;
+        entry->kind = (uint8_t) kind;
+        entry->arg = arg;
+        trace_total++;
+    }
+
+    Cy_SysLib_ExitCriticalSection(interrupt_state);
+}
+
+/*******************************************************************************
+* Function Name: boot_trace_stop
+********************************************************************************
+* Summary:
+*  Marks the device as ready for its first request and freezes the trace.
+*
+*******************************************************************************/
+void boot_trace_stop(void)
+{
+    boot_trace_record(BOOT_TRACE_READY, BOOT_TRACE_MARK, 0U);
+    trace_stopped = true;
+}
+
+/*******************************************************************************
+* Function Name: boot_trace_read
+********************************************************************************
+* Summary:
+*  Copies the trace in its binary form: a boot_trace_header_t followed by
+*  the events, oldest first. Events that do not fit in the buffer are left
+*  out.
+*
+* Parameters:
+*  buffer - Destination
+*  size   - Size of the destination in bytes
+*
+* Return:
+*  uint32_t: Bytes copied, 0 if the buffer cannot hold the header.
+*
+*******************************************************************************/
+uint32_t boot_trace_read(uint8_t *buffer, uint32_t size)
+{
+    boot_trace_header_t header;
+    uint32_t total;
+    uint32_t first;
+    uint32_t count;
+    uint32_t length = sizeof(header);
+
+    if (size < sizeof(header))
+    {
+        return 0U;
+    }
+
+    uint32_t interrupt_state = Cy_SysLib_EnterCriticalSection();
+
+    total = trace_total;
+    count = (total < BOOT_TRACE_ENTRIES) ? total : BOOT_TRACE_ENTRIES;
+    first = total - count;
+
+    if (count > ((size - length) / sizeof(boot_trace_entry_t)))
+    {
+        count = (size - length) / sizeof(boot_trace_entry_t);
+    }
+
+    for (uint32_t i = 0U; i < count; i++)
+    {
+        (void) memcpy(&buffer[length],
+                      &trace_ring[(first + i) % BOOT_TRACE_ENTRIES],
+                      sizeof(boot_trace_entry_t));
+        length += sizeof(boot_trace_entry_t);
+    }
+
+    Cy_SysLib_ExitCriticalSection(interrupt_state);
+
+    header.magic = BOOT_TRACE_MAGIC;
+    header.cycles_per_us = boot_trace_cycles_per_us();
+    header.ticks_per_second = (uint32_t) configTICK_RATE_HZ;
+    header.count = (uint16_t) count;
+    header.dropped = (uint16_t) (total - count);
+    (void) memcpy(buffer, &header, sizeof(header));
+
+    return length;
+}
+
+/*******************************************************************************
+* Function Name: event_distance
+********************************************************************************
+* Summary:
+*  Returns the cycles between two neighbouring events. The difference of the
+*  cycle counters is exact while the core runs, even across a wrap. When both
+*  events carry a tick stamp and the ticks show more than one tick beyond
+*  that, the core slept in between or the counter wrapped more than once, so
+*  the tick difference is used.
+*
+* Parameters:
+*  earlier       - Older event
+*  later         - Newer event
+*  cycles_per_us - Rate of the cycle counter
+*
+* Return:
+*  uint64_t: Cycles between the events
+*
+*******************************************************************************/
+static uint64_t event_distance(const boot_trace_entry_t *earlier,
+                               const boot_trace_entry_t *later,
+                               uint32_t cycles_per_us)
+{
+    uint64_t cycles = (uint32_t) (later->timestamp - earlier->timestamp);
+    uint64_t tick_cycles;
+
+    if ((BOOT_TRACE_NO_TICKS == earlier->ticks) ||
+        (BOOT_TRACE_NO_TICKS == later->ticks))
+    {
+        return cycles;
+    }
+
+    tick_cycles = (uint64_t) (uint32_t) (later->ticks - earlier->ticks) *
+                  US_PER_TICK * cycles_per_us;
+
+    return (tick_cycles > (cycles + ((uint64_t) US_PER_TICK * cycles_per_us)))
+           ? tick_cycles : cycles;
+}
+
+/*******************************************************************************
+* Function Name: boot_trace_print
+********************************************************************************
+* Summary:
+*  Prints each phase with its start time from the first event and its
+*  duration, and the total time to the first request.
+*
+*******************************************************************************/
+void boot_trace_print(void)
+{
+    boot_trace_header_t header;
+    const boot_trace_entry_t *entries =
+            (const boot_trace_entry_t *) &trace_dump[sizeof(header)];
+    uint64_t offsets[BOOT_TRACE_ENTRIES];
+
+    (void) boot_trace_read(trace_dump, sizeof(trace_dump));
+    (void) memcpy(&header, trace_dump, sizeof(header));
+
+    app_log_printf(" Boot trace events:[%u] dropped:[%u] cycles/us:[%lu]"
+           " ticks/s:[%lu]\n",
+           (unsigned int) header.count, (unsigned int) header.dropped,
+           (unsigned long) header.cycles_per_us,
+           (unsigned long) header.ticks_per_second);
+
+    for (uint32_t i = 0U; i < header.count; i++)
+    {
+        offsets[i] = (0U == i) ? 0U :
+                     (offsets[i - 1U] +
+                      event_distance(&entries[i - 1U], &entries[i],
+                                     header.cycles_per_us));
+    }
+
+    for (uint32_t i = 0U; i < header.count; i++)
+    {
+        const char *name = (entries[i].phase < BOOT_TRACE_PHASE_COUNT) ?
+                           phase_names[entries[i].phase] : "?";
+
+        if (BOOT_TRACE_MARK == entries[i].kind)
+        {
+            app_log_printf("  %-26s start:[%lu us]\n", name,
+                   (unsigned long) (offsets[i] / header.cycles_per_us));
+        }
+        else if (BOOT_TRACE_BEGIN == entries[i].kind)
+        {
+            uint32_t end = i + 1U;
+
+            while ((end < header.count) &&
+                   ((entries[end].phase != entries[i].phase) ||
+                    (BOOT_TRACE_END != entries[end].kind)))
+            {
+                end++;
+            }
+
+            if (end < header.count)
+            {
+                app_log_printf("  %-26s start:[%lu us] duration:[%lu us]"
+                       " arg:[%u]\n",
+                       name,
+                       (unsigned long) (offsets[i] / header.cycles_per_us),
+                       (unsigned long) ((offsets[end] - offsets[i]) /
+                                        header.cycles_per_us),
+                       (unsigned int) entries[i].arg);
+            }
+            else
+            {
+                app_log_printf("  %-26s start:[%lu us] not finished\n", name,
+                       (unsigned long) (offsets[i] / header.cycles_per_us));
+            }
+        }
+        else
+        {
+            /* The end events are printed with their begin event. */
+        }
+    }
+}
+
+/*******************************************************************************
+* Function Name: boot_trace_print_binary
+********************************************************************************
+* Summary:
+*  Prints the binary trace as lines of hex prefixed with "BT:", to be cut
+*  from the terminal log and decoded on the host.
+*
+*******************************************************************************/
+void boot_trace_print_binary(void)
+{
+    uint32_t length = boot_trace_read(trace_dump, sizeof(trace_dump));
+
+    for (uint32_t i = 0U; i < length; i++)
+    {
+        if (0U == (i % HEX_BYTES_PER_LINE))
+        {
+            app_log_printf("%sBT:", (0U == i) ? "" : "\n");
+        }
+
+        app_log_printf("%02X", (unsigned int) trace_dump[i]);
+    }
+
+    app_log_printf("\n");
+}
+
+
+/* [] END OF FILE */
@@ -0,0 +1,151 @@
+/*******************************************************************************
+* File Name: boot_trace.h
+*
+* Description: This file contains the structures, constants and function
+* prototypes of the boot latency trace.
+*
+* Related Document: See README.md
+********************************************************************************
+* Copyright 2024-2025, Cypress Semiconductor Corporation (an Infineon company) or
+* an affiliate of Cypress Semiconductor Corporation.  All rights reserved.
+*
+* This software, including source code, documentation and related
+* materials ("Software") is owned by Cypress Semiconductor Corporation
+* or one of its affiliates ("Cypress") and is protected by and subject to
+* worldwide patent protection (United States and foreign),
+* United States copyright laws and international treaty provisions.
+* Therefore, you may use this Software only as provided in the license
+* agreement accompanying the software package from which you
+* obtained this Software ("EULA").
+* If no EULA applies, Cypress hereby grants you a personal, non-exclusive,
+* non-transferable license to copy, modify, and compile the Software
+* source code solely for use in connection with Cypress's
+* integrated circuit products.  Any reproduction, modification, translation,
+* compilation, or representation of this Software except as specified
+* above is prohibited without the express written permission of Cypress.
+*
+* Disclaimer: THIS SOFTWARE IS PROVIDED AS-IS, WITH NO WARRANTY OF ANY KIND,
+* EXPRESS OR IMPLIED, INCLUDING, BUT NOT LIMITED TO, NONINFRINGEMENT, IMPLIED
+* WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE. Cypress
+* reserves the right to make changes to the Software without notice. Cypress
+* does not assume any liability arising out of the application or use of the
+* Software or any product or circuit described in the Software. Cypress does
+* not authorize its products for use in any products where a malfunction or
+* failure of the Cypress product may reasonably be expected to result in
+* significant property damage, injury or death ("High Risk Product"). By
+* including Cypress's product in a High Risk Product, the manufacturer
+* of such system or application assumes all risk of such use and in doing
+* so agrees to indemnify Cypress against all liability.
+*******************************************************************************/
+
+/*******************************************************************************
+* Include guard
+*******************************************************************************/
+#ifndef BOOT_TRACE_H_
+#define BOOT_TRACE_H_
+
+/*******************************************************************************
+* Header Files
+*******************************************************************************/
+#include <stdint.h>
+#include <stdbool.h>
+
+/*******************************************************************************
+* Macros
+*******************************************************************************/
+
+/* Events kept in the ring buffer. A boot records about 30, so the oldest
+ * events are only overwritten when the Wi-Fi join is retried many times.
+ */
+#define BOOT_TRACE_ENTRIES                       (64U)
+
+/* First word of the binary dump returned by boot_trace_read. */
+#define BOOT_TRACE_MAGIC                         (0x32524342U)
+
+/* Tick stamp of the events recorded before the scheduler starts. */
+#define BOOT_TRACE_NO_TICKS                      (0xFFFFFFFFU)
+
+/*******************************************************************************
+* Enumerations
+*******************************************************************************/
+
+/* Startup phases. Each phase records a begin and an end event, except
+ * BOOT_TRACE_READY, which marks the end of the trace.
+ */
+typedef enum
+{
+    BOOT_TRACE_CYBSP_INIT,
+    BOOT_TRACE_CLIB_SUPPORT,
+    BOOT_TRACE_LPTIMER_SETUP,
+    BOOT_TRACE_RETARGET_IO,
+    BOOT_TRACE_CM55_ENABLE,
+    BOOT_TRACE_SCHEDULER_START,
+    BOOT_TRACE_SDIO_INIT,
+    BOOT_TRACE_WCM_INIT,
+    BOOT_TRACE_WCM_CONNECT_AP,
+    BOOT_TRACE_HTTP_CLIENT_CREATE,
+    BOOT_TRACE_HTTP_CLIENT_CONNECT,
+    BOOT_TRACE_READY,
+    BOOT_TRACE_PHASE_COUNT
+} boot_trace_phase_t;
+
+/* Kinds of event. */
+typedef enum
+{
+    BOOT_TRACE_BEGIN,
+    BOOT_TRACE_END,
+    BOOT_TRACE_MARK
+} boot_trace_kind_t;
+
+/*******************************************************************************
+* Data Types
+*******************************************************************************/
+
+/* One event as stored in the ring buffer and in the binary dump. The
+ * timestamp is the raw cycle counter, which wraps after 2^32 cycles and
+ * stops while tickless idle sleeps. Once the scheduler runs, ticks holds the
+ * tick count too, which the kernel corrects after each sleep; before that it
+ * is BOOT_TRACE_NO_TICKS.
+ */
+typedef struct
+{
+    uint32_t timestamp;
+    uint32_t ticks;
+    uint8_t phase;
+    uint8_t kind;
+    uint16_t arg;
+} boot_trace_entry_t;
+
+/* Header of the binary dump, followed by count entries, oldest first. */
+typedef struct
+{
+    uint32_t magic;
+    uint32_t cycles_per_us;
+    uint32_t ticks_per_second;
+    uint16_t count;
+    uint16_t dropped;
+} boot_trace_header_t;
+
+/*******************************************************************************
+* Function Prototypes
+*******************************************************************************/
+void boot_trace_init(void);
+uint32_t boot_trace_timestamp(void);
+uint32_t boot_trace_cycles_per_us(void);
+void boot_trace_record(boot_trace_phase_t phase, boot_trace_kind_t kind,
+                       uint16_t arg);
+void boot_trace_stop(void);
+uint32_t boot_trace_read(uint8_t *buffer, uint32_t size);
+void boot_trace_print(void);
+void boot_trace_print_binary(void);
+
+/* Shorthands for the instrumented call sites. */
+#define BOOT_TRACE_BEGIN_PHASE(phase)                                          \
+        boot_trace_record((phase), BOOT_TRACE_BEGIN, 0U)
+#define BOOT_TRACE_END_PHASE(phase)                                            \
+        boot_trace_record((phase), BOOT_TRACE_END, 0U)
+
+#endif /* BOOT_TRACE_H_ */
+
+
+/* [] END OF FILE */
@@ -0,0 +1,277 @@
+/*******************************************************************************
+* File Name: crypto_offload.c
+*
+* Description: This file contains the CM33 side of the offload service of
+* the CM55. Jobs are copied into a ring in shared memory and run by the worker
+* task of the CM55 (see proj_cm55/crypto_worker.c), which returns their
+* results in a second ring. The functions are meant to be called from one
+* task.
+*
+* Related Document: See README.md
+********************************************************************************
+* Copyright 2024-2025, Cypress Semiconductor Corporation (an Infineon company) or
+* an affiliate of Cypress Semiconductor Corporation.  All rights reserved.
+*
+* This software, including source code, documentation and related
+* materials ("Software") is owned by Cypress Semiconductor Corporation
+* or one of its affiliates ("Cypress") and is protected by and subject to
+* worldwide patent protection (United States and foreign),
+* United States copyright laws and international treaty provisions.
+* Therefore, you may use this Software only as provided in the license
+* agreement accompanying the software package from which you
+* obtained this Software ("EULA").
+* If no EULA applies, Cypress hereby grants you a personal, non-exclusive,
+* non-transferable license to copy, modify, and compile the Software
+* source code solely for use in connection with Cypress's
+* integrated circuit products.  Any reproduction, modification, translation,
+* compilation, or representation of this Software except as specified
+* above is prohibited without the express written permission of Cypress.
+*
+* Disclaimer: THIS SOFTWARE IS PROVIDED AS-IS, WITH NO WARRANTY OF ANY KIND,
+* EXPRESS OR IMPLIED, INCLUDING, BUT NOT LIMITED TO, NONINFRINGEMENT, IMPLIED
+* WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE. Cypress
+* reserves the right to make changes to the Software without notice. Cypress
+* does not assume any liability arising out of the application or use of the
+* Software or any product or circuit described in the Software. Cypress does
+* not authorize its products for use in any products where a malfunction or
+* failure of the Cypress product may reasonably be expected to result in
+* significant property damage, injury or death ("High Risk Product"). By
+* including Cypress's product in a High Risk Product, the manufacturer
+* of such system or application assumes all risk of such use and in doing
+* so agrees to indemnify Cypress against all liability.
+*******************************************************************************/
+
+/*******************************************************************************
+* Header Files
+*******************************************************************************/
+#include "crypto_offload.h"
+#include "cybsp.h"
+
+/* Standard C header files */
+#include <string.h>
+
+/* FreeRTOS header file */
+#include <FreeRTOS.h>
+#include <task.h>
+
+/*******************************************************************************
+* Macros
+*******************************************************************************/
+#define CRYPTO_OFFLOAD_POLL_MS                       (1U)
+
+/*******************************************************************************
+* Global Variables
+********************************************************************************/
+/* Shared with the CM55, see crypto_offload_ipc.h. */
+CY_SECTION_SHAREDMEM CY_ALIGN(IPC_RING_CACHE_LINE)
+static crypto_offload_shm_t crypto_offload_shm;
+
+/* Sequence number of the next job. */
+static uint32_t next_sequence;
+
+static crypto_offload_stats_t offload_stats;
+
+/*******************************************************************************
+* Function Definitions
+*******************************************************************************/
+
+/*******************************************************************************
+* Function Name: notify_worker
+********************************************************************************
+* Summary:
+*  Sends the IPC notify event that wakes the CM55 worker.
+*
+*******************************************************************************/
+static void notify_worker(void)
+{
+    Cy_IPC_Drv_AcquireNotify(
+            Cy_IPC_Drv_GetIpcBaseAddress(CRYPTO_OFFLOAD_IPC_CHANNEL),
+            (1UL << CRYPTO_OFFLOAD_IPC_INTR));
+}
+
+/*******************************************************************************
+* Function Name: crypto_offload_init
+********************************************************************************
+* Summary:
+*  Initializes the shared memory block and announces it to the CM55.
+*
+*******************************************************************************/
+void crypto_offload_init(void)
+{
+    crypto_offload_shm.host_magic = 0U;
+    crypto_offload_shm.worker_magic = 0U;
+    IPC_RING_CACHE_CLEAN(&crypto_offload_shm, sizeof(crypto_offload_shm));
+
+    ipc_ring_init(&crypto_offload_shm.job_ring, CRYPTO_OFFLOAD_JOB_SLOTS);
+    ipc_ring_init(&crypto_offload_shm.result_ring,
+                  CRYPTO_OFFLOAD_RESULT_SLOTS);
+
+    __DMB();
+    crypto_offload_shm.host_version = CRYPTO_OFFLOAD_VERSION;
+    crypto_offload_shm.host_magic = CRYPTO_OFFLOAD_MAGIC;
+    IPC_RING_CACHE_CLEAN(&crypto_offload_shm.host_magic, IPC_RING_CACHE_LINE);
+    notify_worker();
+}
+
+/*******************************************************************************
+* Function Name: crypto_offload_available
+********************************************************************************
+* Summary:
+*  Checks whether the CM55 worker serves jobs.
+*
+*******************************************************************************/
+bool crypto_offload_available(void)
+{
+    IPC_RING_CACHE_INVALIDATE(&crypto_offload_shm.worker_magic,
+                              IPC_RING_CACHE_LINE);
+
+    return ((CRYPTO_OFFLOAD_MAGIC == crypto_offload_shm.worker_magic) &&
+            (CRYPTO_OFFLOAD_VERSION == crypto_offload_shm.worker_version));
+}
+
+/*******************************************************************************
+* Function Name: crypto_offload_queue_job
+********************************************************************************
+* Summary:
+*  Queues one job for the CM55, waiting while the job ring is full, and wakes
+*  the worker. The data is copied into the job.
+*
+* Parameters:
+*  op       - Operation, crypto_offload_op_t
+*  session  - Session of the operation
+*  flags    - Options of the operation
+*  data     - Data of the job, may be NULL if len is 0
+*  len      - At most CRYPTO_OFFLOAD_JOB_DATA_LENGTH bytes
+*  sequence - Returns the sequence number of the job, may be NULL
+*
+* Return:
+*  cy_rslt_t: CY_RSLT_SUCCESS if the job was queued.
+*
+*******************************************************************************/
+cy_rslt_t crypto_offload_queue_job(uint32_t op, uint32_t session,
+                                   uint32_t flags, const uint8_t *data,
+                                   uint32_t len, uint32_t *sequence)
+{
+    crypto_offload_job_t *job;
+    TickType_t start = xTaskGetTickCount();
+    cy_rslt_t result = CY_RSLT_SUCCESS;
+
+    while (NULL == (job = ipc_ring_reserve(&crypto_offload_shm.job_ring,
+                                           crypto_offload_shm.jobs,
+                                           sizeof(*job))))
+    {
+        if ((xTaskGetTickCount() - start) >=
+            pdMS_TO_TICKS(CRYPTO_OFFLOAD_TIMEOUT_MS))
+        {
+            result = CY_RSLT_TYPE_ERROR;
+            break;
+        }
+        offload_stats.queue_full_waits++;
+        vTaskDelay(pdMS_TO_TICKS(CRYPTO_OFFLOAD_POLL_MS));
+    }
+
+    if (CY_RSLT_SUCCESS == result)
+    {
+        job->op = op;
+        job->session = session;
+        job->flags = flags;
+        job->len = len;
+        job->sequence = next_sequence++;
+
+        if (NULL != sequence)
+        {
+            *sequence = job->sequence;
+        }
+
+        if (len > 0U)
+        {
+            (void) memcpy(job->data, data, len);
+        }
+
+        ipc_ring_commit(&crypto_offload_shm.job_ring, job, sizeof(*job));
+        notify_worker();
+        offload_stats.jobs++;
+        offload_stats.bytes_offloaded += len;
+    }
+
+    return result;
+}
+
+/*******************************************************************************
+* Function Name: crypto_offload_wait_result
+********************************************************************************
+* Summary:
+*  Waits for the result of a job. Results come back in the order their jobs
+*  were queued. A result of an earlier job, left behind by a wait that timed
+*  out, is dropped, so a late result is never taken for the expected one.
+*
+* Parameters:
+*  sequence - Sequence number of the job that produces the result
+*  reply    - Receives a copy of the result
+*
+* Return:
+*  cy_rslt_t: CY_RSLT_SUCCESS if the expected result arrived and succeeded.
+*
+*******************************************************************************/
+cy_rslt_t crypto_offload_wait_result(uint32_t sequence,
+                                     crypto_offload_result_t *reply)
+{
+    cy_rslt_t result = CY_RSLT_TYPE_ERROR;
+    crypto_offload_result_t *slot;
+    TickType_t start = xTaskGetTickCount();
+
+    for (;;)
+    {
+        slot = ipc_ring_peek(&crypto_offload_shm.result_ring,
+                             crypto_offload_shm.results, sizeof(*slot));
+
+        if (NULL == slot)
+        {
+            if ((xTaskGetTickCount() - start) >=
+                pdMS_TO_TICKS(CRYPTO_OFFLOAD_TIMEOUT_MS))
+            {
+                break;
+            }
+            vTaskDelay(pdMS_TO_TICKS(CRYPTO_OFFLOAD_POLL_MS));
+        }
+        else if ((int32_t)(slot->sequence - sequence) < 0)
+        {
+            ipc_ring_release(&crypto_offload_shm.result_ring);
+            offload_stats.stale_results++;
+        }
+        else
+        {
+            /* A later job's result means the expected one was lost; leave
+             * it for its own waiter.
+             */
+            if (slot->sequence == sequence)
+            {
+                *reply = *slot;
+                ipc_ring_release(&crypto_offload_shm.result_ring);
+
+                if (0U == reply->status)
+                {
+                    result = CY_RSLT_SUCCESS;
+                }
+            }
+            break;
+        }
+    }
+
+    return result;
+}
+
+/*******************************************************************************
+* Function Name: crypto_offload_get_stats
+********************************************************************************
+* Summary:
+*  Returns a copy of the offload counters.
+*
+*******************************************************************************/
+void crypto_offload_get_stats(crypto_offload_stats_t *stats)
+{
+    *stats = offload_stats;
+}
+
+
+/* [] END OF FILE */
@@ -0,0 +1,89 @@
+/*******************************************************************************
+* File Name: crypto_offload.h
+*
+* Description: This file is the public interface of crypto_offload.c.
+*
+* Related Document: See README.md
+********************************************************************************
+* Copyright 2024-2025, Cypress Semiconductor Corporation (an Infineon company) or
+* an affiliate of Cypress Semiconductor Corporation.  All rights reserved.
+*
+* This software, including source code, documentation and related
+* materials ("Software") is owned by Cypress Semiconductor Corporation
+* or one of its affiliates ("Cypress") and is protected by and subject to
+* worldwide patent protection (United States and foreign),
+* United States copyright laws and international treaty provisions.
+* Therefore, you may use this Software only as provided in the license
+* agreement accompanying the software package from which you
+* obtained this Software ("EULA").
+* If no EULA applies, Cypress hereby grants you a personal, non-exclusive,
+* non-transferable license to copy, modify, and compile the Software
+* source code solely for use in connection with Cypress's
+* integrated circuit products.  Any reproduction, modification, translation,
+* compilation, or representation of this Software except as specified
+* above is prohibited without the express written permission of Cypress.
+*
+* Disclaimer: THIS SOFTWARE IS PROVIDED AS-IS, WITH NO WARRANTY OF ANY KIND,
+* EXPRESS OR IMPLIED, INCLUDING, BUT NOT LIMITED TO, NONINFRINGEMENT, IMPLIED
+* WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE. Cypress
+* reserves the right to make changes to the Software without notice. Cypress
+* does not assume any liability arising out of the application or use of the
+* Software or any product or circuit described in the Software. Cypress does
+* not authorize its products for use in any products where a malfunction or
+* failure of the Cypress product may reasonably be expected to result in
+* significant property damage, injury or death ("High Risk Product"). By
+* including Cypress's product in a High Risk Product, the manufacturer
+* of such system or application assumes all risk of such use and in doing
+* so agrees to indemnify Cypress against all liability.
+*******************************************************************************/
+
+/*******************************************************************************
+* Include guard
+*******************************************************************************/
+#ifndef CRYPTO_OFFLOAD_H_
+#define CRYPTO_OFFLOAD_H_
+
+/*******************************************************************************
+* Header Files
+*******************************************************************************/
+#include <stdint.h>
+#include <stdbool.h>
+#include "cy_result.h"
+#include "crypto_offload_ipc.h"
+
+/*******************************************************************************
+* Macros
+*******************************************************************************/
+
+/* Longest time to wait for a free job slot or for a result from the CM55. */
+#define CRYPTO_OFFLOAD_TIMEOUT_MS                (1000U)
+
+/*******************************************************************************
+* Data Types
+*******************************************************************************/
+
+/* Offload counters. */
+typedef struct
+{
+    uint32_t jobs;
+    uint32_t bytes_offloaded;
+    uint32_t queue_full_waits;
+    uint32_t stale_results;
+} crypto_offload_stats_t;
+
+/*******************************************************************************
+* Function Prototypes
+*******************************************************************************/
+void crypto_offload_init(void);
+bool crypto_offload_available(void);
+cy_rslt_t crypto_offload_queue_job(uint32_t op, uint32_t session,
+                                   uint32_t flags, const uint8_t *data,
+                                   uint32_t len, uint32_t *sequence);
+cy_rslt_t crypto_offload_wait_result(uint32_t sequence,
+                                     crypto_offload_result_t *reply);
+void crypto_offload_get_stats(crypto_offload_stats_t *stats);
+
+#endif /* CRYPTO_OFFLOAD_H_ */
+
+
+/* [] END OF FILE */
@@ -0,0 +1,504 @@
+/*******************************************************************************
+* File Name: http_response_parser.c
+*
+* Description: This file contains an incremental HTTP/1.1 response header
+* parser. It is fed the response as it arrives, resumes where the previous
+* call stopped, and indexes every header field by offset and length in the
+* caller's buffer together with a hash of its lower case name. Header values
+* are then looked up without rescanning the header text and without any
+* allocation.
+*
+* Related Document: See README.md
+********************************************************************************
+* Copyright 2024-2025, Cypress Semiconductor Corporation (an Infineon company) or
+* an affiliate of Cypress Semiconductor Corporation.  All rights reserved.
+*
+* This software, including source code, documentation and related
+* materials ("Software") is owned by Cypress Semiconductor Corporation
+* or one of its affiliates ("Cypress") and is protected by and subject to
+* worldwide patent protection (United States and foreign),
+* United States copyright laws and international treaty provisions.
+* Therefore, you may use this Software only as provided in the license
+* agreement accompanying the software package from which you
+* obtained this Software ("EULA").
+* If no EULA applies, Cypress hereby grants you a personal, non-exclusive,
+* non-transferable license to copy, modify, and compile the Software
+* source code solely for use in connection with Cypress's
+* integrated circuit products.  Any reproduction, modification, translation,
+* compilation, or representation of this Software except as specified
+* above is prohibited without the express written permission of Cypress.
+*
+* Disclaimer: THIS SOFTWARE IS PROVIDED AS-IS, WITH NO WARRANTY OF ANY KIND,
+* EXPRESS OR IMPLIED, INCLUDING, BUT NOT LIMITED TO, NONINFRINGEMENT, IMPLIED
+* WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE. Cypress
+* reserves the right to make changes to the Software without notice. Cypress
+* does not assume any liability arising out of the application or use of the
+* Software or any product or circuit described in the Software. Cypress does
+* not authorize its products for use in any products where a malfunction or
+* failure of the Cypress product may reasonably be expected to result in
+* significant property damage, injury or death ("High Risk Product"). By
+* including Cypress's product in a High Risk Product, the manufacturer
+* of such system or application assumes all risk of such use and in doing
+* so agrees to indemnify Cypress against all liability.
+*******************************************************************************/
+
+/*******************************************************************************
+* Header Files
+*******************************************************************************/
+#include "http_response_parser.h"
+
+/* Standard C header files */
+#include <string.h>
+
+/*******************************************************************************
+* Macros
+*******************************************************************************/
+#define FNV_OFFSET_BASIS                             (0x811C9DC5U)
+#define FNV_PRIME                                    (0x01000193U)
+
+#define STATUS_LINE_MIN_LEN                          (12U)
+#define STATUS_CODE_OFFSET                           (9U)
+#define STATUS_CODE_DIGITS                           (3U)
+#define MINOR_VERSION_OFFSET                         (7U)
+#define DECIMAL_BASE                                 (10U)
+
+/*******************************************************************************
+* Function Definitions
+*******************************************************************************/
+
+/*******************************************************************************
+* Function Name: to_lower
+********************************************************************************
+* Summary:
+*  Returns the lower case of an ASCII character.
+*
+*******************************************************************************/
+static char to_lower(char c)
+{
+    return ((c >= 'A') && (c <= 'Z')) ? (char)(c - 'A' + 'a') : c;
+}
+
+/*******************************************************************************
+* Function Name: is_space
+********************************************************************************
+* Summary:
+*  Checks for optional white space (SP or HTAB) around header values.
+*
+*******************************************************************************/
+static bool is_space(char c)
+{
+    return ((' ' == c) || ('\t' == c));
+}
+
+/*******************************************************************************
+* Function Name: http_header_hash
+********************************************************************************
+* Summary:
+*  Computes the FNV-1a hash of a header name in lower case. The
+*  HTTP_HEADER_HASH_* macros hold the result for the common names.
+*
+* Parameters:
+*  name - Header name, in any case
+*  len  - Length of the name
+*
+* Return:
+*  uint32_t: Hash of the lower case name.
+*
+*******************************************************************************/
+uint32_t http_header_hash(const char *name, uint32_t len)
+{
+    uint32_t hash = FNV_OFFSET_BASIS;
+
+    for (uint32_t i = 0U; i < len; i++)
+    {
+        hash ^= (uint8_t) to_lower(name[i]);
+        hash *= FNV_PRIME;
+    }
+
+    return hash;
+}
+
+/*******************************************************************************
+* Function Name: parse_status_line
+********************************************************************************
+* Summary:
+*  Parses "HTTP/1.x SSS reason".
+*
+*******************************************************************************/
+static http_parser_status_t parse_status_line(http_parser_t *parser,
+                                              const char *line, uint32_t len)
+{
+    uint32_t status = 0U;
+
+    if ((len < STATUS_LINE_MIN_LEN) ||
+        (0 != memcmp(line, "HTTP/1.", sizeof("HTTP/1.") - 1U)) ||
+        (line[MINOR_VERSION_OFFSET] < '0') ||
+        (line[MINOR_VERSION_OFFSET] > '9'))
+    {
+        return HTTP_PARSER_ERROR;
+    }
+
+    for (uint32_t i = 0U; i < STATUS_CODE_DIGITS; i++)
+    {
+        char c = line[STATUS_CODE_OFFSET + i];
+
+        if ((c < '0') || (c > '9'))
+        {
+            return HTTP_PARSER_ERROR;
+        }
+        status = (status * DECIMAL_BASE) + (uint32_t)(c - '0');
+    }
+
+    parser->status_code = (uint16_t) status;
+    parser->minor_version = (uint8_t)(line[MINOR_VERSION_OFFSET] - '0');
+
+    return HTTP_PARSER_INCOMPLETE;
+}
+
+/*******************************************************************************
+* Function Name: parse_header_line
+********************************************************************************
+* Summary:
+*  Indexes one "name: value" line. Folded continuation lines extend the
+*  value of the previous field.
+*
+* Parameters:
+*  parser - Parser state
+*  buf    - Start of the response
+*  start  - Offset of the line in buf
+*  end    - Offset of the line end, without CR LF
+*
+*******************************************************************************/
+static http_parser_status_t parse_header_line(http_parser_t *parser,
+                                              const char *buf, uint32_t start,
+                                              uint32_t end)
+{
+    http_header_field_t *field;
+    const char *colon;
+    uint32_t value_start;
+    uint32_t value_end = end;
+
+    while ((value_end > start) && is_space(buf[value_end - 1U]))
+    {
+        value_end--;
+    }
+
+    if (is_space(buf[start]))
+    {
+        /* Obsolete line folding: the value continues on this line. */
+        if ((parser->header_count > 0U) && (0U == parser->headers_skipped))
+        {
+            field = &parser->headers[parser->header_count - 1U];
+            field->value_len = (uint16_t)(value_end - field->value_offset);
+        }
+        return HTTP_PARSER_INCOMPLETE;
+    }
+
+    colon = memchr(&buf[start], ':', end - start);
+
+    /* A field name is not empty and has no white space before the colon. */
+    if ((NULL == colon) || (colon == &buf[start]) || is_space(colon[-1]))
+    {
+        return HTTP_PARSER_ERROR;
+    }
+
+    if (parser->header_count >= HTTP_PARSER_MAX_HEADERS)
+    {
+        parser->headers_skipped++;
+        return HTTP_PARSER_INCOMPLETE;
+    }
+
+    value_start = (uint32_t)(colon - buf) + 1U;
+
+    while ((value_start < value_end) && is_space(buf[value_start]))
+    {
+        value_start++;
+    }
+
+    field = &parser->headers[parser->header_count++];
+    field->name_offset = (uint16_t) start;
+    field->name_len = (uint16_t)((uint32_t)(colon - buf) - start);
+    field->value_offset = (uint16_t) value_start;
+    field->value_len = (uint16_t)(value_end - value_start);
+    field->hash = http_header_hash(&buf[start], field->name_len);
+
+    return HTTP_PARSER_INCOMPLETE;
+}
+
+/*******************************************************************************
+* Function Name: parse_line
+********************************************************************************
+* Summary:
+*  Handles one complete line of the header block.
+*
+*******************************************************************************/
+static http_parser_status_t parse_line(http_parser_t *parser, const char *buf,
+                                       uint32_t start, uint32_t end)
+{
+    http_parser_status_t status;
+
+    if ((end > start) && ('\r' == buf[end - 1U]))
+    {
+        end--;
+    }
+
+    if (parser->in_status_line)
+    {
+        parser->in_status_line = false;
+        status = parse_status_line(parser, &buf[start], end - start);
+    }
+    else if (end == start)
+    {
+        status = HTTP_PARSER_DONE;
+    }
+    else
+    {
+        status = parse_header_line(parser, buf, start, end);
+    }
+
+    return status;
+}
+
+/*******************************************************************************
+* Function Name: http_parser_init
+********************************************************************************
+* Summary:
+*  Prepares the parser for a new response.
+*
+* Parameters:
+*  parser      - Parser to initialize
+*  status_line - true if the buffer starts with the status line, false if it
+*                starts with the first header field
+*
+*******************************************************************************/
+void http_parser_init(http_parser_t *parser, bool status_line)
+{
+    parser->status = HTTP_PARSER_INCOMPLETE;
+    parser->in_status_line = status_line;
+    parser->scanned = 0U;
+    parser->line_start = 0U;
+    parser->status_code = 0U;
+    parser->minor_version = 0U;
+    parser->headers_len = 0U;
+    parser->header_count = 0U;
+    parser->headers_skipped = 0U;
+}
+
+/*******************************************************************************
+* Function Name: http_parser_feed
+********************************************************************************
+* Summary:
+*  Parses the bytes of buf that arrived since the previous call. The buffer
+*  must hold the response from its first byte on every call; only the new
+*  bytes are scanned.
+*
+* Parameters:
+*  parser - Parser state
+*  buf    - Start of the response
+*  len    - Number of bytes received so far
+*
+* Return:
+*  http_parser_status_t: HTTP_PARSER_DONE once the empty line after the
+*  headers was seen, headers_len then gives the offset of the body.
+*
+*******************************************************************************/
+http_parser_status_t http_parser_feed(http_parser_t *parser, const char *buf,
+                                      uint32_t len)
+{
+    const char *eol;
+
+    if (len > HTTP_PARSER_MAX_HEADERS_LENGTH)
+    {
+        len = HTTP_PARSER_MAX_HEADERS_LENGTH;
+    }
+
+    while ((HTTP_PARSER_INCOMPLETE == parser->status) &&
+           (parser->scanned < len))
+    {
+        eol = memchr(&buf[parser->scanned], '\n', len - parser->scanned);
+
+        if (NULL == eol)
+        {
+            parser->scanned = len;
+        }
+        else
+        {
+            parser->scanned = (uint32_t)(eol - buf) + 1U;
+            parser->status = parse_line(parser, buf, parser->line_start,
+                                        parser->scanned - 1U);
+            parser->line_start = parser->scanned;
+        }
+    }
+
+    if (HTTP_PARSER_DONE == parser->status)
+    {
+        parser->headers_len = parser->scanned;
+    }
+    else if ((HTTP_PARSER_INCOMPLETE == parser->status) &&
+             (parser->scanned >= HTTP_PARSER_MAX_HEADERS_LENGTH))
+    {
+        parser->status = HTTP_PARSER_ERROR;
+    }
+
+    return parser->status;
+}
+
+/*******************************************************************************
+* Function Name: http_parser_index
+********************************************************************************
+* Summary:
+*  Indexes a complete header block that starts with the first header field,
+*  such as the header and headers_len of cy_http_client_response_t. The
+*  block does not need to end with an empty line.
+*
+* Parameters:
+*  parser - Parser to fill
+*  buf    - Start of the header fields
+*  len    - Length of the header block
+*
+* Return:
+*  http_parser_status_t: HTTP_PARSER_DONE, or HTTP_PARSER_ERROR if a field
+*  is malformed.
+*
+*******************************************************************************/
+http_parser_status_t http_parser_index(http_parser_t *parser, const char *buf,
+                                       uint32_t len)
+{
+    http_parser_init(parser, false);
+
+    if ((HTTP_PARSER_INCOMPLETE == http_parser_feed(parser, buf, len)) &&
+        (parser->line_start < len))
+    {
+        parser->status = parse_line(parser, buf, parser->line_start, len);
+    }
+
+    if (HTTP_PARSER_INCOMPLETE == parser->status)
+    {
+        parser->status = HTTP_PARSER_DONE;
+        parser->headers_len = len;
+    }
+
+    return parser->status;
+}
+
+/*******************************************************************************
+* Function Name: http_parser_find
+********************************************************************************
+* Summary:
+*  Looks up the first field with the given name. The hash selects the
+*  candidates and the name is compared only for those.
+*
+* Parameters:
+*  parser     - Parser that indexed buf
+*  buf        - Buffer given to the parser
+*  hash       - http_header_hash of the name, or a HTTP_HEADER_HASH_* macro
+*  lower_name - Lower case name of the field
+*
+* Return:
+*  const http_header_field_t *: The field, or NULL if it is not present.
+*
+*******************************************************************************/
+const http_header_field_t *http_parser_find(const http_parser_t *parser,
+                                            const char *buf, uint32_t hash,
+                                            const char *lower_name)
+{
+    const http_header_field_t *field;
+    uint32_t name_len = (uint32_t) strlen(lower_name);
+
+    for (uint32_t i = 0U; i < parser->header_count; i++)
+    {
+        field = &parser->headers[i];
+
+        if ((field->hash == hash) && (field->name_len == name_len))
+        {
+            uint32_t j = 0U;
+
+            while ((j < name_len) &&
+                   (to_lower(buf[field->name_offset + j]) == lower_name[j]))
+            {
+                j++;
+            }
+
+            if (j == name_len)
+            {
+                return field;
+            }
+        }
+    }
+
+    return NULL;
+}
+
+/*******************************************************************************
+* Function Name: http_parser_value
+********************************************************************************
+* Summary:
+*  Returns the value of a header field, without surrounding white space.
+*
+* Return:
+*  const char *: Start of the value in buf, or NULL if the field is not
+*  present. The value is not NUL terminated; its length is in value_len.
+*
+*******************************************************************************/
+const char *http_parser_value(const http_parser_t *parser, const char *buf,
+                              uint32_t hash, const char *lower_name,
+                              uint32_t *value_len)
+{
+    const http_header_field_t *field = http_parser_find(parser, buf, hash,
+                                                        lower_name);
+    const char *value = NULL;
+
+    if (NULL != field)
+    {
+        value = &buf[field->value_offset];
+        *value_len = field->value_len;
+    }
+
+    return value;
+}
+
+/*******************************************************************************
+* Function Name: http_parser_value_uint
+********************************************************************************
+* Summary:
+*  Returns the value of a header field that holds a decimal number, such as
+*  Content-Length or the delay-seconds form of Retry-After.
+*
+* Return:
+*  bool: true if the field is present and is a number that fits in 32 bits.
+*
+*******************************************************************************/
+bool http_parser_value_uint(const http_parser_t *parser, const char *buf,
+                            uint32_t hash, const char *lower_name,
+                            uint32_t *value)
+{
+    uint32_t len = 0U;
+    const char *text = http_parser_value(parser, buf, hash, lower_name, &len);
+    uint32_t number = 0U;
+    bool valid = ((NULL != text) && (len > 0U));
+
+    for (uint32_t i = 0U; valid && (i < len); i++)
+    {
+        uint32_t digit = (uint32_t)(text[i] - '0');
+
+        if ((text[i] < '0') || (text[i] > '9') ||
+            (number > ((UINT32_MAX - digit) / DECIMAL_BASE)))
+        {
+            valid = false;
+        }
+        else
+        {
+            number = (number * DECIMAL_BASE) + digit;
+        }
+    }
+
+    if (valid)
+    {
+        *value = number;
+    }
+
+    return valid;
+}
+
+
+/* [] END OF FILE */
@@ -0,0 +1,152 @@
+/*******************************************************************************
+* File Name: http_response_parser.h
+*
+* Description: This file is the public interface of http_response_parser.c.
+*
+* Related Document: See README.md
+********************************************************************************
+* Copyright 2024-2025, Cypress Semiconductor Corporation (an Infineon company) or
+* an affiliate of Cypress Semiconductor Corporation.  All rights reserved.
+*
+* This software, including source code, documentation and related
+* materials ("Software") is owned by Cypress Semiconductor Corporation
+* or one of its affiliates ("Cypress") and is protected by and subject to
+* worldwide patent protection (United States and foreign),
+* United States copyright laws and international treaty provisions.
+* Therefore, you may use this Software only as provided in the license
+* agreement accompanying the software package from which you
+* obtained this Software ("EULA").
+* If no EULA applies, Cypress hereby grants you a personal, non-exclusive,
+* non-transferable license to copy, modify, and compile the Software
+* source code solely for use in connection with Cypress's
+* integrated circuit products.  Any reproduction, modification, translation,
+* compilation, or representation of this Software except as specified
+* above is prohibited without the express written permission of Cypress.
+*
+* Disclaimer: THIS SOFTWARE IS PROVIDED AS-IS, WITH NO WARRANTY OF ANY KIND,
+* EXPRESS OR IMPLIED, INCLUDING, BUT NOT LIMITED TO, NONINFRINGEMENT, IMPLIED
+* WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE. Cypress
+* reserves the right to make changes to the Software without notice. Cypress
+* does not assume any liability arising out of the application or use of the
+* Software or any product or circuit described in the Software. Cypress does
+* not authorize its products for use in any products where a malfunction or
+* failure of the Cypress product may reasonably be expected to result in
+* significant property damage, injury or death ("High Risk Product"). By
+* including Cypress's product in a High Risk Product, the manufacturer
+* of such system or application assumes all risk of such use and in doing
+* so agrees to indemnify Cypress against all liability.
+*******************************************************************************/
+
+/*******************************************************************************
+* Include guard
+*******************************************************************************/
+#ifndef HTTP_RESPONSE_PARSER_H_
+#define HTTP_RESPONSE_PARSER_H_
+
+/*******************************************************************************
+* Header Files
+*******************************************************************************/
+#include <stdint.h>
+#include <stdbool.h>
+
+/*******************************************************************************
+* Macros
+*******************************************************************************/
+
+/* Maximum number of header fields indexed per response. Further fields are
+ * skipped and cannot be looked up.
+ */
+#define HTTP_PARSER_MAX_HEADERS                  (24U)
+
+/* Largest header block the parser accepts. Offsets are stored in 16 bits. */
+#define HTTP_PARSER_MAX_HEADERS_LENGTH           (0xFFFFU)
+
+/* Lower case names of the headers used by the application, with their
+ * precomputed hashes (FNV-1a, see http_header_hash).
+ */
+#define HTTP_HEADER_CONTENT_LENGTH               "content-length"
+#define HTTP_HEADER_HASH_CONTENT_LENGTH          (0x4DF9451DU)
+#define HTTP_HEADER_TRANSFER_ENCODING            "transfer-encoding"
+#define HTTP_HEADER_HASH_TRANSFER_ENCODING       (0xDDB4744CU)
+#define HTTP_HEADER_CONNECTION                   "connection"
+#define HTTP_HEADER_HASH_CONNECTION              (0x38B99ED9U)
+#define HTTP_HEADER_ETAG                         "etag"
+#define HTTP_HEADER_HASH_ETAG                    (0x06C857C0U)
+#define HTTP_HEADER_LAST_MODIFIED                "last-modified"
+#define HTTP_HEADER_HASH_LAST_MODIFIED           (0xC0575A6BU)
+#define HTTP_HEADER_RETRY_AFTER                  "retry-after"
+#define HTTP_HEADER_HASH_RETRY_AFTER             (0xC6DA1376U)
+#define HTTP_HEADER_CONTENT_ENCODING             "content-encoding"
+#define HTTP_HEADER_HASH_CONTENT_ENCODING        (0x03E2ED88U)
+#define HTTP_HEADER_CONTENT_RANGE                "content-range"
+#define HTTP_HEADER_HASH_CONTENT_RANGE           (0xD3ECFA4AU)
+
+/*******************************************************************************
+* Data Types
+*******************************************************************************/
+
+/* Result of feeding bytes to the parser. */
+typedef enum
+{
+    HTTP_PARSER_INCOMPLETE,
+    HTTP_PARSER_DONE,
+    HTTP_PARSER_ERROR,
+} http_parser_status_t;
+
+/* Position of one header field in the caller's buffer. */
+typedef struct
+{
+    uint32_t hash;
+    uint16_t name_offset;
+    uint16_t name_len;
+    uint16_t value_offset;
+    uint16_t value_len;
+} http_header_field_t;
+
+/* Incremental response header parser. The parser never copies the headers:
+ * it records offsets into the caller's buffer, which must hold the response
+ * from its first byte and may grow between calls to http_parser_feed.
+ */
+typedef struct
+{
+    http_parser_status_t status;
+    bool in_status_line;
+
+    /* Bytes of the buffer already scanned, and start of the current line. */
+    uint32_t scanned;
+    uint32_t line_start;
+
+    uint16_t status_code;
+    uint8_t minor_version;
+
+    /* Length of the status line and headers including the empty line. */
+    uint32_t headers_len;
+
+    uint32_t header_count;
+    uint32_t headers_skipped;
+    http_header_field_t headers[HTTP_PARSER_MAX_HEADERS];
+} http_parser_t;
+
+/*******************************************************************************
+* Function Prototypes
+*******************************************************************************/
+uint32_t http_header_hash(const char *name, uint32_t len);
+void http_parser_init(http_parser_t *parser, bool status_line);
+http_parser_status_t http_parser_feed(http_parser_t *parser, const char *buf,
+                                      uint32_t len);
+http_parser_status_t http_parser_index(http_parser_t *parser, const char *buf,
+                                       uint32_t len);
+const http_header_field_t *http_parser_find(const http_parser_t *parser,
+                                            const char *buf, uint32_t hash,
+                                            const char *lower_name);
+const char *http_parser_value(const http_parser_t *parser, const char *buf,
+                              uint32_t hash, const char *lower_name,
+                              uint32_t *value_len);
+bool http_parser_value_uint(const http_parser_t *parser, const char *buf,
+                            uint32_t hash, const char *lower_name,
+                            uint32_t *value);
+
+#endif /* HTTP_RESPONSE_PARSER_H_ */
+
+
+/* [] END OF FILE */
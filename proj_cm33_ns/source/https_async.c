@@ -0,0 +1,1010 @@
+/*******************************************************************************
+* File Name: https_async.c
+*
+* Description: This file contains an asynchronous HTTPS request API. Requests
+* are submitted from any task and return a handle at once. One event loop task
+* sends them pipelined on streaming connections and receives the responses when
+* the secure sockets receive callback reports data, then completes each request
+* through a callback or a task notification. Many requests can be outstanding
+* without a task, or a stack, per request.
+*
+* Related Document: See README.md
+********************************************************************************
+* Copyright 2024-2025, Cypress Semiconductor Corporation (an Infineon company) or
+* an affiliate of Cypress Semiconductor Corporation.  All rights reserved.
+*
+* This software, including source code, documentation and related
+* materials ("Software") is owned by Cypress Semiconductor Corporation
+* or one of its affiliates ("Cypress") and is protected by and subject to
+* worldwide patent protection (United States and foreign),
+* United States copyright laws and international treaty provisions.
+* Therefore, you may use this Software only as provided in the license
+* agreement accompanying the software package from which you
+* obtained this Software ("EULA").
+* If no EULA applies, Cypress hereby grants you a personal, non-exclusive,
+* non-transferable license to copy, modify, and compile the Software
+* source code solely for use in connection with Cypress's
+* integrated circuit products.  Any reproduction, modification, translation,
+* compilation, or representation of this Software except as specified
+* above is prohibited without the express written permission of Cypress.
+*
+* Disclaimer: THIS SOFTWARE IS PROVIDED AS-IS, WITH NO WARRANTY OF ANY KIND,
+* EXPRESS OR IMPLIED, INCLUDING, BUT NOT LIMITED TO, NONINFRINGEMENT, IMPLIED
+* WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE. Cypress
+* reserves the right to make changes to the Software without notice. Cypress
+* does not assume any liability arising out of the application or use of the
+* Software or any product or circuit described in the Software. Cypress does
+* not authorize its products for use in any products where a malfunction or
+* failure of the Cypress product may reasonably be expected to result in
+* significant property damage, injury or death ("High Risk Product"). By
+* including Cypress's product in a High Risk Product, the manufacturer
+* of such system or application assumes all risk of such use and in doing
+* so agrees to indemnify Cypress against all liability.
+*******************************************************************************/
+
+/*******************************************************************************
+* Header Files
+*******************************************************************************/
+#include "https_async.h"
+#include "app_log.h"
+#include "https_reconnect.h"
+#include "secure_http_client.h"
+#include <stdio.h>
+#include <string.h>
+
+/* FreeRTOS header files */
+#include <FreeRTOS.h>
+#include <task.h>
+#include <semphr.h>
+
+/*******************************************************************************
+* Macros
+*******************************************************************************/
+/* A handle holds the slot index plus one in its low bits and the slot
+ * generation above them, so a stale handle never matches a reused slot.
+ */
+#define HANDLE_INDEX_BITS                            (8U)
+#define HANDLE_INDEX_MASK                            ((1U << HANDLE_INDEX_BITS) - 1U)
+
+/* Socket reads made for one connection before the loop looks at the others. */
+#define SERVICE_BUDGET                               (8U)
+
+/*******************************************************************************
+* Enumerations
+*******************************************************************************/
+typedef enum
+{
+    SLOT_FREE,
+    SLOT_QUEUED,
+    SLOT_SENT,
+    SLOT_DONE,
+} slot_state_t;
+
+/*******************************************************************************
+* Data Types
+*******************************************************************************/
+
+/* One submitted request. */
+typedef struct
+{
+    slot_state_t state;
+    uint32_t generation;
+    uint32_t sequence;
+    https_stream_request_t request;
+    https_async_done_cb_t done_cb;
+    void *arg;
+    TaskHandle_t notify_task;
+    bool detached;
+    bool resent;
+    cy_rslt_t result;
+    https_stream_response_t response;
+} async_slot_t;
+
+/* One connection of the event loop and the requests in flight on it, oldest
+ * first.
+ */
+typedef struct
+{
+    https_stream_conn_t conn;
+    volatile bool readable;
+    bool reading;
+    TickType_t last_progress;
+    uint32_t in_flight[HTTPS_ASYNC_PIPELINE_DEPTH];
+    uint32_t head;
+    uint32_t count;
+    https_link_t link;
+} async_conn_t;
+
+/*******************************************************************************
+* Global Variables
+********************************************************************************/
+static async_slot_t slots[HTTPS_ASYNC_MAX_REQUESTS];
+static async_conn_t conns[HTTPS_ASYNC_CONNECTIONS];
+static uint32_t next_sequence;
+static uint32_t sent_count;
+static https_async_stats_t async_stats;
+
+/* Protects the slot states and the counters. */
+static SemaphoreHandle_t async_mutex;
+
+static TaskHandle_t loop_task;
+
+/* Longest sleep of the next loop iteration, shortened while a connection
+ * waits for its next reconnect attempt.
+ */
+static TickType_t loop_wait;
+static const char *server_host;
+static uint16_t server_port;
+
+/*******************************************************************************
+* Function Definitions
+*******************************************************************************/
+
+/*******************************************************************************
+* Function Name: make_handle
+********************************************************************************
+* Summary:
+*  Returns the handle of a slot in its current generation.
+*
+*******************************************************************************/
+static https_async_handle_t make_handle(uint32_t index)
+{
+    return (slots[index].generation << HANDLE_INDEX_BITS) | (index + 1U);
+}
+
+/*******************************************************************************
+* Function Name: find_slot
+********************************************************************************
+* Summary:
+*  Returns the slot identified by a handle, or NULL if the handle is stale or
+*  invalid. Called with the mutex held.
+*
+*******************************************************************************/
+static async_slot_t *find_slot(https_async_handle_t handle)
+{
+    uint32_t index = (handle & HANDLE_INDEX_MASK);
+
+    if ((0U == index) || (index > HTTPS_ASYNC_MAX_REQUESTS) ||
+        (make_handle(index - 1U) != handle))
+    {
+        return NULL;
+    }
+
+    return &slots[index - 1U];
+}
+
+/*******************************************************************************
+* Function Name: receive_handler
+********************************************************************************
+* Summary:
+*  Receive and disconnect callback of the event loop sockets, called by the
+*  secure sockets library when data or a close arrives. Wakes the loop to read
+*  the connection.
+*
+*******************************************************************************/
+static cy_rslt_t receive_handler(cy_socket_t socket, void *arg)
+{
+    async_conn_t *c = (async_conn_t *) arg;
+
+    CY_UNUSED_PARAMETER(socket);
+
+    c->readable = true;
+    (void) xTaskNotifyGive(loop_task);
+
+    return CY_RSLT_SUCCESS;
+}
+
+/*******************************************************************************
+* Function Name: complete_request
+********************************************************************************
+* Summary:
+*  Completes a request: calls its completion callback and frees the slot, or
+*  keeps the result for https_async_result and notifies the submitting task.
+*  The slot of a detached request is freed at once.
+*
+* Parameters:
+*  index  - Slot of the request
+*  result - Result of the request
+*
+* Return:
+*  void
+*
+*******************************************************************************/
+static void complete_request(uint32_t index, cy_rslt_t result)
+{
+    async_slot_t *slot = &slots[index];
+    bool detached;
+
+    (void) xSemaphoreTake(async_mutex, portMAX_DELAY);
+    if (CY_RSLT_SUCCESS == result)
+    {
+        async_stats.completed++;
+    }
+    else
+    {
+        async_stats.failed++;
+    }
+    sent_count--;
+    slot->result = result;
+    detached = slot->detached;
+    slot->state = detached ? SLOT_FREE : SLOT_DONE;
+    (void) xSemaphoreGive(async_mutex);
+
+    if (detached)
+    {
+        /* Nobody collects the result. */
+    }
+    else if (NULL != slot->done_cb)
+    {
+        slot->done_cb(make_handle(index), result, &slot->response, slot->arg);
+
+        (void) xSemaphoreTake(async_mutex, portMAX_DELAY);
+        slot->state = SLOT_FREE;
+        (void) xSemaphoreGive(async_mutex);
+    }
+    else if (NULL != slot->notify_task)
+    {
+        (void) xTaskNotifyGive(slot->notify_task);
+    }
+    else
+    {
+        /* The submitter polls https_async_result. */
+    }
+}
+
+/*******************************************************************************
+* Function Name: pop_request
+********************************************************************************
+* Summary:
+*  Removes the oldest request in flight on a connection and returns its slot.
+*
+*******************************************************************************/
+static uint32_t pop_request(async_conn_t *c)
+{
+    uint32_t index = c->in_flight[c->head];
+
+    c->head = (c->head + 1U) % HTTPS_ASYNC_PIPELINE_DEPTH;
+    c->count--;
+    c->reading = false;
+
+    return index;
+}
+
+/*******************************************************************************
+* Function Name: abort_connection
+********************************************************************************
+* Summary:
+*  Closes a connection that failed and deals with the requests in flight on
+*  it. The oldest one is failed if fail_head is set. The others were not
+*  answered and are queued again to be sent once more on a new connection,
+*  like the requests of a pipelined batch. A request that was already resent
+*  is failed instead, and so is a POST, which the server may have processed
+*  before the connection failed, and one whose body came from a producer,
+*  which cannot be replayed.
+*
+* Parameters:
+*  c         - Failed connection
+*  result    - Error that ended the connection
+*  fail_head - Fail the oldest request instead of resending it
+*
+* Return:
+*  void
+*
+*******************************************************************************/
+static void abort_connection(async_conn_t *c, cy_rslt_t result,
+                             bool fail_head)
+{
+    bool fail = fail_head;
+    uint32_t index;
+
+    https_stream_disconnect(&c->conn);
+    https_link_down(&c->link);
+
+    while (c->count > 0U)
+    {
+        index = pop_request(c);
+
+        if (fail || slots[index].resent ||
+            (CY_HTTP_CLIENT_METHOD_POST == slots[index].request.method) ||
+            (NULL != slots[index].request.body_producer))
+        {
+            complete_request(index, result);
+        }
+        else
+        {
+            (void) xSemaphoreTake(async_mutex, portMAX_DELAY);
+            slots[index].resent = true;
+            slots[index].state = SLOT_QUEUED;
+            sent_count--;
+            async_stats.resent++;
+            (void) xSemaphoreGive(async_mutex);
+        }
+
+        fail = false;
+    }
+}
+
+/*******************************************************************************
+* Function Name: response_started
+********************************************************************************
+* Summary:
+*  Checks whether the response of the oldest request in flight has started
+*  to arrive. Such a request cannot be resent, since part of its body may
+*  already have been delivered.
+*
+*******************************************************************************/
+static bool response_started(const async_conn_t *c)
+{
+    return c->reading && c->conn.headers_done;
+}
+
+/*******************************************************************************
+* Function Name: connect_conn
+********************************************************************************
+* Summary:
+*  Opens a connection of the event loop. Its socket reports received data
+*  and closes through receive_handler, and reads on it wait at most
+*  HTTPS_ASYNC_RECV_TIMEOUT_MS. The result feeds the reconnect backoff.
+*
+*******************************************************************************/
+static cy_rslt_t connect_conn(async_conn_t *c)
+{
+    cy_rslt_t result;
+    uint32_t timeout = HTTPS_ASYNC_RECV_TIMEOUT_MS;
+    cy_socket_opt_callback_t callback =
+    {
+        .callback = receive_handler,
+        .arg      = c
+    };
+
+    result = https_stream_connect(&c->conn, server_host, server_port);
+
+    if (CY_RSLT_SUCCESS == result)
+    {
+        async_stats.connects++;
+        result = cy_socket_setsockopt(c->conn.socket, CY_SOCKET_SOL_SOCKET,
+                                      CY_SOCKET_SO_RECEIVE_CALLBACK, &callback,
+                                      sizeof(callback));
+    }
+
+    if (CY_RSLT_SUCCESS == result)
+    {
+        result = cy_socket_setsockopt(c->conn.socket, CY_SOCKET_SOL_SOCKET,
+                                      CY_SOCKET_SO_DISCONNECT_CALLBACK,
+                                      &callback, sizeof(callback));
+    }
+
+    if (CY_RSLT_SUCCESS == result)
+    {
+        result = cy_socket_setsockopt(c->conn.socket, CY_SOCKET_SOL_SOCKET,
+                                      CY_SOCKET_SO_RCVTIMEO, &timeout,
+                                      sizeof(timeout));
+    }
+
+    if (CY_RSLT_SUCCESS != result)
+    {
+        https_stream_disconnect(&c->conn);
+    }
+
+    https_link_connected(&c->link, result);
+    c->readable = false;
+    c->reading = false;
+
+    return result;
+}
+
+/*******************************************************************************
+* Function Name: oldest_queued
+********************************************************************************
+* Summary:
+*  Returns the queued request submitted first, or HTTPS_ASYNC_MAX_REQUESTS if
+*  none is queued. Called with the mutex held.
+*
+*******************************************************************************/
+static uint32_t oldest_queued(void)
+{
+    uint32_t oldest = HTTPS_ASYNC_MAX_REQUESTS;
+
+    for (uint32_t i = 0U; i < HTTPS_ASYNC_MAX_REQUESTS; i++)
+    {
+        if ((SLOT_QUEUED == slots[i].state) &&
+            ((HTTPS_ASYNC_MAX_REQUESTS == oldest) ||
+             ((int32_t)(slots[i].sequence - slots[oldest].sequence) < 0)))
+        {
+            oldest = i;
+        }
+    }
+
+    return oldest;
+}
+
+/*******************************************************************************
+* Function Name: pick_conn
+********************************************************************************
+* Summary:
+*  Returns the connection to send the next request on: the open connection
+*  with the fewest requests in flight, or a closed one if every open
+*  connection is full. Returns NULL if all connections are full.
+*
+*******************************************************************************/
+static async_conn_t *pick_conn(void)
+{
+    async_conn_t *best = NULL;
+    async_conn_t *closed = NULL;
+
+    for (uint32_t i = 0U; i < HTTPS_ASYNC_CONNECTIONS; i++)
+    {
+        async_conn_t *c = &conns[i];
+
+        if (!c->conn.connected)
+        {
+            if ((NULL == closed) && (0U == c->count))
+            {
+                closed = c;
+            }
+        }
+        else if ((c->count < HTTPS_ASYNC_PIPELINE_DEPTH) &&
+                 ((NULL == best) || (c->count < best->count)))
+        {
+            best = c;
+        }
+        else
+        {
+            /* Full. */
+        }
+    }
+
+    return (NULL != best) ? best : closed;
+}
+
+/*******************************************************************************
+* Function Name: fail_queued
+********************************************************************************
+* Summary:
+*  Fails every queued request, used when the server cannot be reached.
+*
+*******************************************************************************/
+static void fail_queued(cy_rslt_t result)
+{
+    uint32_t index;
+
+    for (;;)
+    {
+        (void) xSemaphoreTake(async_mutex, portMAX_DELAY);
+        index = oldest_queued();
+        if (HTTPS_ASYNC_MAX_REQUESTS != index)
+        {
+            slots[index].state = SLOT_SENT;
+            sent_count++;
+        }
+        (void) xSemaphoreGive(async_mutex);
+
+        if (HTTPS_ASYNC_MAX_REQUESTS == index)
+        {
+            break;
+        }
+
+        (void) memset(&slots[index].response, 0,
+                      sizeof(slots[index].response));
+        complete_request(index, result);
+    }
+}
+
+/*******************************************************************************
+* Function Name: dispatch_requests
+********************************************************************************
+* Summary:
+*  Moves the queued requests, oldest first, onto connections with room in
+*  their pipeline, then sends what was staged on each connection. Requests
+*  staged together share TLS records. A lost connection is reopened with
+*  backoff, and the queued requests fail once HTTPS_RECONNECT_MAX_ATTEMPTS
+*  attempts in a row have failed.
+*
+*******************************************************************************/
+static void dispatch_requests(void)
+{
+    cy_rslt_t result;
+    async_conn_t *c;
+    uint32_t index;
+    TickType_t wait;
+    bool staged[HTTPS_ASYNC_CONNECTIONS] = { false };
+
+    for (;;)
+    {
+        c = pick_conn();
+        if (NULL == c)
+        {
+            break;
+        }
+
+        (void) xSemaphoreTake(async_mutex, portMAX_DELAY);
+        index = oldest_queued();
+        (void) xSemaphoreGive(async_mutex);
+
+        if (HTTPS_ASYNC_MAX_REQUESTS == index)
+        {
+            break;
+        }
+
+        if (!c->conn.connected)
+        {
+            if (!https_link_begin(&c->link, &wait))
+            {
+                /* Backing off; wake up for the next attempt. */
+                if (wait < loop_wait)
+                {
+                    loop_wait = wait;
+                }
+                break;
+            }
+
+            result = connect_conn(c);
+            if (CY_RSLT_SUCCESS != result)
+            {
+                ERR_INFO(("Async connection to the server failed.\n"));
+                if (c->link.attempts >= HTTPS_RECONNECT_MAX_ATTEMPTS)
+                {
+                    fail_queued(result);
+                }
+                break;
+            }
+        }
+
+        /* The slot belongs to the loop once it is no longer queued. */
+        (void) xSemaphoreTake(async_mutex, portMAX_DELAY);
+        slots[index].state = SLOT_SENT;
+        sent_count++;
+        if (sent_count > async_stats.max_in_flight)
+        {
+            async_stats.max_in_flight = sent_count;
+        }
+        (void) xSemaphoreGive(async_mutex);
+
+        c->in_flight[(c->head + c->count) % HTTPS_ASYNC_PIPELINE_DEPTH] =
+                index;
+        c->count++;
+        c->last_progress = xTaskGetTickCount();
+        staged[c - conns] = true;
+
+        result = https_stream_queue(&c->conn, &slots[index].request);
+        if (CY_RSLT_SUCCESS != result)
+        {
+            abort_connection(c, result, response_started(c));
+            staged[c - conns] = false;
+        }
+    }
+
+    for (uint32_t i = 0U; i < HTTPS_ASYNC_CONNECTIONS; i++)
+    {
+        if (staged[i])
+        {
+            result = https_stream_flush(&conns[i].conn);
+            if (CY_RSLT_SUCCESS != result)
+            {
+                abort_connection(&conns[i], result,
+                                 response_started(&conns[i]));
+            }
+        }
+    }
+}
+
+/*******************************************************************************
+* Function Name: service_connection
+********************************************************************************
+* Summary:
+*  Receives the responses of the requests in flight on a connection, for as
+*  long as bytes keep arriving. A response is read only after the receive
+*  callback fired or while bytes are left in the receive buffer, so the loop
+*  never waits on a silent socket. TLS may hold decrypted bytes that do not
+*  raise another callback, so reading continues after every read that made
+*  progress until one times out.
+*
+* Parameters:
+*  c - Connection to service
+*
+* Return:
+*  void
+*
+*******************************************************************************/
+static void service_connection(async_conn_t *c)
+{
+    cy_rslt_t result;
+    bool done;
+    uint32_t index;
+
+    for (uint32_t budget = 0U; budget < SERVICE_BUDGET; budget++)
+    {
+        if ((0U == c->count) || !c->conn.connected)
+        {
+            return;
+        }
+
+        index = c->in_flight[c->head];
+
+        if (!c->reading)
+        {
+            https_stream_read_begin(&c->conn, slots[index].request.method,
+                                    slots[index].request.headers_cb,
+                                    slots[index].request.body_cb,
+                                    slots[index].request.arg,
+                                    &slots[index].response);
+            c->reading = true;
+        }
+
+        if (!c->readable && (c->conn.rx_start == c->conn.rx_end))
+        {
+            return;
+        }
+
+        c->readable = false;
+        result = https_stream_read_poll(&c->conn, &done);
+
+        if (done)
+        {
+            /* A connection that is not kept alive is closed by the stream
+             * after the response.
+             */
+            (void) pop_request(c);
+            complete_request(index, result);
+            c->last_progress = xTaskGetTickCount();
+
+            if (!c->conn.connected)
+            {
+                abort_connection(c, (CY_RSLT_SUCCESS == result) ?
+                        CY_RSLT_MODULE_SECURE_SOCKETS_CLOSED : result, false);
+                return;
+            }
+            c->readable = true;
+        }
+        else if (CY_RSLT_MODULE_SECURE_SOCKETS_TIMEOUT == result)
+        {
+            return;
+        }
+        else
+        {
+            c->last_progress = xTaskGetTickCount();
+            c->readable = true;
+        }
+    }
+
+    /* Budget used up with bytes still arriving; come back without sleeping. */
+    (void) xTaskNotifyGive(loop_task);
+}
+
+/*******************************************************************************
+* Function Name: check_timeout
+********************************************************************************
+* Summary:
+*  Fails the oldest request in flight on a connection when the server has not
+*  sent anything for HTTPS_ASYNC_REQUEST_TIMEOUT_MS, and closes the
+*  connection.
+*
+*******************************************************************************/
+static void check_timeout(async_conn_t *c)
+{
+    if ((c->count > 0U) &&
+        ((xTaskGetTickCount() - c->last_progress) >
+         pdMS_TO_TICKS(HTTPS_ASYNC_REQUEST_TIMEOUT_MS)))
+    {
+        (void) xSemaphoreTake(async_mutex, portMAX_DELAY);
+        async_stats.timeouts++;
+        (void) xSemaphoreGive(async_mutex);
+
+        abort_connection(c, CY_RSLT_MODULE_SECURE_SOCKETS_TIMEOUT, true);
+    }
+}
+
+/*******************************************************************************
+* Function Name: async_loop_task
+********************************************************************************
+* Summary:
+*  Event loop. Sleeps until a request is submitted or a socket reports data,
+*  then sends the queued requests and receives the responses that arrived.
+*
+*******************************************************************************/
+static void async_loop_task(void *arg)
+{
+    CY_UNUSED_PARAMETER(arg);
+
+    for (;;)
+    {
+        (void) ulTaskNotifyTake(pdTRUE, loop_wait);
+        loop_wait = pdMS_TO_TICKS(HTTPS_ASYNC_IDLE_WAIT_MS);
+
+        dispatch_requests();
+
+        for (uint32_t i = 0U; i < HTTPS_ASYNC_CONNECTIONS; i++)
+        {
+            service_connection(&conns[i]);
+            check_timeout(&conns[i]);
+        }
+
+        /* Completed requests may have made room for queued ones. */
+        dispatch_requests();
+    }
+}
+
+/*******************************************************************************
+* Function Name: https_async_init
+********************************************************************************
+* Summary:
+*  Starts the event loop task. The streaming connections must have been
+*  initialized with https_stream_init. Connections to the server are opened
+*  when the first requests are submitted.
+*
+* Parameters:
+*  host_name - Server host name or IP address, must stay valid
+*  port      - Server port
+*
+* Return:
+*  cy_rslt_t: CY_RSLT_SUCCESS if the event loop was started.
+*
+*******************************************************************************/
+cy_rslt_t https_async_init(const char *host_name, uint16_t port)
+{
+    (void) memset(slots, 0, sizeof(slots));
+    (void) memset(conns, 0, sizeof(conns));
+    (void) memset(&async_stats, 0, sizeof(async_stats));
+    next_sequence = 0U;
+    sent_count = 0U;
+    loop_wait = pdMS_TO_TICKS(HTTPS_ASYNC_IDLE_WAIT_MS);
+    server_host = host_name;
+    server_port = port;
+
+    async_mutex = xSemaphoreCreateMutex();
+
+    if ((NULL == async_mutex) ||
+        (pdPASS != xTaskCreate(async_loop_task, "HTTPS Async",
+                               HTTPS_ASYNC_TASK_STACK_SIZE, NULL,
+                               HTTPS_ASYNC_TASK_PRIORITY, &loop_task)))
+    {
+        return CY_RSLT_TYPE_ERROR;
+    }
+
+    return CY_RSLT_SUCCESS;
+}
+
+/*******************************************************************************
+* Function Name: submit
+********************************************************************************
+* Summary:
+*  Queues a request in a free slot and wakes the event loop.
+*
+*******************************************************************************/
+static cy_rslt_t submit(const https_stream_request_t *request,
+                        https_async_done_cb_t done_cb, void *arg,
+                        TaskHandle_t notify_task,
+                        https_async_handle_t *handle)
+{
+    cy_rslt_t result = CY_RSLT_TYPE_ERROR;
+
+    *handle = HTTPS_ASYNC_INVALID_HANDLE;
+
+    if ((NULL == request) || (NULL == loop_task))
+    {
+        return result;
+    }
+
+    (void) xSemaphoreTake(async_mutex, portMAX_DELAY);
+
+    for (uint32_t i = 0U; i < HTTPS_ASYNC_MAX_REQUESTS; i++)
+    {
+        async_slot_t *slot = &slots[i];
+
+        if (SLOT_FREE == slot->state)
+        {
+            slot->generation++;
+            slot->sequence = next_sequence++;
+            slot->request = *request;
+            slot->done_cb = done_cb;
+            slot->arg = arg;
+            slot->notify_task = notify_task;
+            slot->detached = false;
+            slot->resent = false;
+            slot->result = CY_RSLT_SUCCESS;
+            slot->state = SLOT_QUEUED;
+            async_stats.submitted++;
+            *handle = make_handle(i);
+            result = CY_RSLT_SUCCESS;
+            break;
+        }
+    }
+
+    (void) xSemaphoreGive(async_mutex);
+
+    if (CY_RSLT_SUCCESS == result)
+    {
+        (void) xTaskNotifyGive(loop_task);
+    }
+
+    return result;
+}
+
+/*******************************************************************************
+* Function Name: https_async_submit
+********************************************************************************
+* Summary:
+*  Submits a request and returns at once. The event loop sends it and calls
+*  done_cb on its own task when the response has been received or the
+*  request failed. The body callback of the request is also called on the
+*  event loop task. The path and body of the request must stay valid until
+*  the request completes, since an unanswered request may be sent again.
+*
+* Parameters:
+*  request - Request to send
+*  done_cb - Called when the request completes, may be NULL
+*  arg     - Argument passed to done_cb
+*  handle  - Returns the handle of the request
+*
+* Return:
+*  cy_rslt_t: CY_RSLT_SUCCESS if the request was queued, or
+*  CY_RSLT_TYPE_ERROR if HTTPS_ASYNC_MAX_REQUESTS are outstanding.
+*
+*******************************************************************************/
+cy_rslt_t https_async_submit(const https_stream_request_t *request,
+                             https_async_done_cb_t done_cb, void *arg,
+                             https_async_handle_t *handle)
+{
+    return submit(request, done_cb, arg, NULL, handle);
+}
+
+/*******************************************************************************
+* Function Name: https_async_submit_notify
+********************************************************************************
+* Summary:
+*  Submits a request and returns at once. When the request completes, the
+*  event loop gives a task notification to task (one count per request, as
+*  xTaskNotifyGive) and keeps the result until https_async_result collects
+*  it. The path and body of the request must stay valid until then.
+*
+* Parameters:
+*  request - Request to send
+*  task    - Task to notify, may be NULL to poll https_async_result
+*  handle  - Returns the handle of the request
+*
+* Return:
+*  cy_rslt_t: CY_RSLT_SUCCESS if the request was queued, or
+*  CY_RSLT_TYPE_ERROR if HTTPS_ASYNC_MAX_REQUESTS are outstanding.
+*
+*******************************************************************************/
+cy_rslt_t https_async_submit_notify(const https_stream_request_t *request,
+                                    TaskHandle_t task,
+                                    https_async_handle_t *handle)
+{
+    return submit(request, NULL, NULL, task, handle);
+}
+
+/*******************************************************************************
+* Function Name: https_async_result
+********************************************************************************
+* Summary:
+*  Collects the result of a request submitted with https_async_submit_notify
+*  and frees its slot, if the request has completed.
+*
+* Parameters:
+*  handle   - Handle of the request
+*  result   - Returns the result of the request
+*  response - Returns the response status, may be NULL
+*
+* Return:
+*  bool: true if the request had completed and its result was collected.
+*
+*******************************************************************************/
+bool https_async_result(https_async_handle_t handle, cy_rslt_t *result,
+                        https_stream_response_t *response)
+{
+    async_slot_t *slot;
+    bool completed = false;
+
+    (void) xSemaphoreTake(async_mutex, portMAX_DELAY);
+
+    slot = find_slot(handle);
+
+    if ((NULL != slot) && (SLOT_DONE == slot->state) &&
+        (NULL == slot->done_cb))
+    {
+        *result = slot->result;
+        if (NULL != response)
+        {
+            *response = slot->response;
+        }
+        slot->state = SLOT_FREE;
+        completed = true;
+    }
+
+    (void) xSemaphoreGive(async_mutex);
+
+    return completed;
+}
+
+/*******************************************************************************
+* Function Name: https_async_detach
+********************************************************************************
+* Summary:
+*  Gives up on a request submitted with https_async_submit_notify whose result
+*  will not be collected, for example after the submitter stopped waiting.
+*  A completed request is freed at once. One still queued or in flight runs
+*  to its end on the event loop, which then frees its slot without notifying
+*  the submitter, so its path and body must stay valid until then.
+*
+* Parameters:
+*  handle - Handle of the request
+*
+* Return:
+*  void
+*
+*******************************************************************************/
+void https_async_detach(https_async_handle_t handle)
+{
+    async_slot_t *slot;
+
+    (void) xSemaphoreTake(async_mutex, portMAX_DELAY);
+
+    slot = find_slot(handle);
+
+    if ((NULL != slot) && (SLOT_FREE != slot->state) &&
+        (NULL == slot->done_cb))
+    {
+        if (SLOT_DONE == slot->state)
+        {
+            slot->state = SLOT_FREE;
+        }
+        else
+        {
+            slot->detached = true;
+            slot->notify_task = NULL;
+        }
+    }
+
+    (void) xSemaphoreGive(async_mutex);
+}
+
+/*******************************************************************************
+* Function Name: https_async_get_stats
+********************************************************************************
+* Summary:
+*  Returns a copy of the event loop counters.
+*
+*******************************************************************************/
+void https_async_get_stats(https_async_stats_t *stats)
+{
+    (void) xSemaphoreTake(async_mutex, portMAX_DELAY);
+    *stats = async_stats;
+    (void) xSemaphoreGive(async_mutex);
+
+    stats->stack_used = 0U;
+    if (NULL != loop_task)
+    {
+        stats->stack_used = HTTPS_ASYNC_TASK_STACK_SIZE -
+            (uint32_t) uxTaskGetStackHighWaterMark(loop_task);
+    }
+}
+
+/*******************************************************************************
+* Function Name: https_async_print_stats
+********************************************************************************
+* Summary:
+*  Prints the event loop counters.
+*
+*******************************************************************************/
+void https_async_print_stats(void)
+{
+    https_async_stats_t stats;
+
+    https_async_get_stats(&stats);
+
+    app_log_printf(" Async requests submitted:[%lu] completed:[%lu]"
+           " failed:[%lu] resent:[%lu] timeouts:[%lu]\n",
+           (unsigned long) stats.submitted, (unsigned long) stats.completed,
+           (unsigned long) stats.failed, (unsigned long) stats.resent,
+           (unsigned long) stats.timeouts);
+    app_log_printf(" Async connects:[%lu] max in flight:[%lu]\n",
+           (unsigned long) stats.connects,
+           (unsigned long) stats.max_in_flight);
+    app_log_printf(" Async stack used:[%lu] of [%lu] words\n",
+           (unsigned long) stats.stack_used,
+           (unsigned long) HTTPS_ASYNC_TASK_STACK_SIZE);
+}
+
+
+/* [] END OF FILE */
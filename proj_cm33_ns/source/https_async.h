@@ -0,0 +1,151 @@
+/*******************************************************************************
+* File Name: https_async.h
+*
+* Description: This file contains the structures, constants and function
+* prototypes of the asynchronous HTTPS request API.
+*
+* Related Document: See README.md
+********************************************************************************
+* Copyright 2024-2025, Cypress Semiconductor Corporation (an Infineon company) or
+* an affiliate of Cypress Semiconductor Corporation.  All rights reserved.
+*
+* This software, including source code, documentation and related
+* materials ("Software") is owned by Cypress Semiconductor Corporation
+* or one of its affiliates ("Cypress") and is protected by and subject to
+* worldwide patent protection (United States and foreign),
+* United States copyright laws and international treaty provisions.
+* Therefore, you may use this Software only as provided in the license
+* agreement accompanying the software package from which you
+* obtained this Software ("EULA").
+* If no EULA applies, Cypress hereby grants you a personal, non-exclusive,
+* non-transferable license to copy, modify, and compile the Software
+* source code solely for use in connection with Cypress's
+* integrated circuit products.  Any reproduction, modification, translation,
+* compilation, or representation of this Software except as specified
+* above is prohibited without the express written permission of Cypress.
+*
+* Disclaimer: THIS SOFTWARE IS PROVIDED AS-IS, WITH NO WARRANTY OF ANY KIND,
+* EXPRESS OR IMPLIED, INCLUDING, BUT NOT LIMITED TO, NONINFRINGEMENT, IMPLIED
+* WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE. Cypress
+* reserves the right to make changes to the Software without notice. Cypress
+* does not assume any liability arising out of the application or use of the
+* Software or any product or circuit described in the Software. Cypress does
+* not authorize its products for use in any products where a malfunction or
+* failure of the Cypress product may reasonably be expected to result in
+* significant property damage, injury or death ("High Risk Product"). By
+* including Cypress's product in a High Risk Product, the manufacturer
+* of such system or application assumes all risk of such use and in doing
+* so agrees to indemnify Cypress against all liability.
+*******************************************************************************/
+
+/*******************************************************************************
+* Include guard
+*******************************************************************************/
+#ifndef HTTPS_ASYNC_H_
+#define HTTPS_ASYNC_H_
+
+/*******************************************************************************
+* Header Files
+*******************************************************************************/
+#include <stdint.h>
+#include <stdbool.h>
+#include "FreeRTOS.h"
+#include <task.h>
+#include "cy_result.h"
+#include "https_stream.h"
+
+/*******************************************************************************
+* Macros
+*******************************************************************************/
+
+/* Number of requests that can be outstanding at once, queued or in flight. */
+#define HTTPS_ASYNC_MAX_REQUESTS                 (8U)
+
+/* Number of streaming connections the event loop spreads the requests over.
+ * Each connection holds its buffers here and a TLS context on the heap.
+ */
+#define HTTPS_ASYNC_CONNECTIONS                  (1U)
+
+/* Each connection and the HTTPS client task may decode a coded body at once. */
+#if ((HTTPS_ASYNC_CONNECTIONS + 1U) > HTTPS_STREAM_INFLATERS)
+#error "HTTPS_STREAM_INFLATERS is too small for HTTPS_ASYNC_CONNECTIONS"
+#endif
+
+/* Requests pipelined on one connection before its responses are received.
+ * At most HTTPS_STREAM_PIPELINE_MAX.
+ */
+#define HTTPS_ASYNC_PIPELINE_DEPTH               (4U)
+
+/* Receive timeout of the event loop connections. The loop only reads a
+ * connection after its receive callback fired, so this only bounds the wait
+ * for the rest of a TLS record.
+ */
+#define HTTPS_ASYNC_RECV_TIMEOUT_MS              (10U)
+
+/* Time a sent request may wait for the end of its response. */
+#define HTTPS_ASYNC_REQUEST_TIMEOUT_MS           (5000U)
+
+/* Longest time the event loop sleeps without an event, to check for
+ * requests that timed out.
+ */
+#define HTTPS_ASYNC_IDLE_WAIT_MS                 (500U)
+
+/* Event loop task, in words. The stack covers the TLS handshake of a
+ * reconnect, where mbedTLS keeps its large buffers on the heap, and the done
+ * callbacks, which print through the log. The event loop counters print the
+ * words the loop has used; keep about a quarter of the stack free over that.
+ */
+#define HTTPS_ASYNC_TASK_STACK_SIZE              (3U * 1024U)
+#define HTTPS_ASYNC_TASK_PRIORITY                (1U)
+
+/* Handle value that never identifies a request. */
+#define HTTPS_ASYNC_INVALID_HANDLE               (0U)
+
+/*******************************************************************************
+* Data Types
+*******************************************************************************/
+
+/* Identifies a submitted request until its result is collected. */
+typedef uint32_t https_async_handle_t;
+
+/* Called on the event loop task when a request completes. The response is
+ * only valid during the call.
+ */
+typedef void (*https_async_done_cb_t)(https_async_handle_t handle,
+                                      cy_rslt_t result,
+                                      const https_stream_response_t *response,
+                                      void *arg);
+
+/* Event loop counters. */
+typedef struct
+{
+    uint32_t submitted;
+    uint32_t completed;
+    uint32_t failed;
+    uint32_t resent;
+    uint32_t timeouts;
+    uint32_t connects;
+    uint32_t max_in_flight;
+    uint32_t stack_used;        /* Most words of the loop stack in use. */
+} https_async_stats_t;
+
+/*******************************************************************************
+* Function Prototypes
+*******************************************************************************/
+cy_rslt_t https_async_init(const char *host_name, uint16_t port);
+cy_rslt_t https_async_submit(const https_stream_request_t *request,
+                             https_async_done_cb_t done_cb, void *arg,
+                             https_async_handle_t *handle);
+cy_rslt_t https_async_submit_notify(const https_stream_request_t *request,
+                                    TaskHandle_t task,
+                                    https_async_handle_t *handle);
+bool https_async_result(https_async_handle_t handle, cy_rslt_t *result,
+                        https_stream_response_t *response);
+void https_async_detach(https_async_handle_t handle);
+void https_async_get_stats(https_async_stats_t *stats);
+void https_async_print_stats(void);
+
+#endif /* HTTPS_ASYNC_H_ */
+
+
+/* [] END OF FILE */
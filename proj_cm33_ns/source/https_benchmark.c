@@ -0,0 +1,233 @@
+/*******************************************************************************
+* File Name: https_benchmark.c
+*
+* Description: This file contains the HTTPS load benchmark. It issues a
+* number of requests back to back and reports the request rate, the latency
+* percentiles and the number of bytes copied per request.
+*
+* Related Document: See README.md
+********************************************************************************
+* Copyright 2024-2025, Cypress Semiconductor Corporation (an Infineon company) or
+* an affiliate of Cypress Semiconductor Corporation.  All rights reserved.
+*
+* This software, including source code, documentation and related
+* materials ("Software") is owned by Cypress Semiconductor Corporation
+* or one of its affiliates ("Cypress") and is protected by and subject to
+* worldwide patent protection (United States and foreign),
+* United States copyright laws and international treaty provisions.
+* Therefore, you may use this Software only as provided in the license
+* agreement accompanying the software package from which you
+* obtained this Software ("EULA").
+* If no EULA applies, Cypress hereby grants you a personal, non-exclusive,
+* non-transferable license to copy, modify, and compile the Software
+* source code solely for use in connection with Cypress's
+* integrated circuit products.  Any reproduction, modification, translation,
+* compilation, or representation of this Software except as specified
+* above is prohibited without the express written permission of Cypress.
+*
+* Disclaimer: THIS SOFTWARE IS PROVIDED AS-IS, WITH NO WARRANTY OF ANY KIND,
+* EXPRESS OR IMPLIED, INCLUDING, BUT NOT LIMITED TO, NONINFRINGEMENT, IMPLIED
+* WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE. Cypress
+* reserves the right to make changes to the Software without notice. Cypress
+* does not assume any liability arising out of the application or use of the
+* Software or any product or circuit described in the Software. Cypress does
+* not authorize its products for use in any products where a malfunction or
+* failure of the Cypress product may reasonably be expected to result in
+* significant property damage, injury or death ("High Risk Product"). By
+* including Cypress's product in a High Risk Product, the manufacturer
+* of such system or application assumes all risk of such use and in doing
+* so agrees to indemnify Cypress against all liability.
+*******************************************************************************/
+
+/*******************************************************************************
+* Header Files
+*******************************************************************************/
+#include "https_benchmark.h"
+#include "app_log.h"
+#include <stdio.h>
+#include <string.h>
+
+/* FreeRTOS header file */
+#include <FreeRTOS.h>
+#include <task.h>
+
+/*******************************************************************************
+* Macros
+*******************************************************************************/
+#define MS_PER_SEC                                   (1000U)
+#define PERCENT_SCALE                                (100U)
+
+/*******************************************************************************
+* Global Variables
+********************************************************************************/
+/* Latency of each request of the current run in milliseconds. */
+static uint32_t latency_samples[HTTPS_BENCHMARK_ITERATIONS];
+
+/*******************************************************************************
+* Function Definitions
+*******************************************************************************/
+
+/*******************************************************************************
+* Function Name: sort_samples
+********************************************************************************
+* Summary:
+*  Sorts the latency samples in ascending order. Insertion sort is used as the
+*  number of samples is small and no extra memory is needed.
+*
+* Parameters:
+*  samples - Array of latency samples
+*  count   - Number of samples in the array
+*
+* Return:
+*  void
+*
+*******************************************************************************/
+static void sort_samples(uint32_t *samples, uint32_t count)
+{
+    for (uint32_t i = 1U; i < count; i++)
+    {
+        uint32_t key = samples[i];
+        uint32_t j = i;
+
+        while ((j > 0U) && (samples[j - 1U] > key))
+        {
+            samples[j] = samples[j - 1U];
+            j--;
+        }
+        samples[j] = key;
+    }
+}
+
+/*******************************************************************************
+* Function Name: percentile
+********************************************************************************
+* Summary:
+*  Returns the given percentile of a sorted sample array using the
+*  nearest-rank method.
+*
+*******************************************************************************/
+static uint32_t percentile(const uint32_t *sorted, uint32_t count,
+                           uint32_t pct)
+{
+    uint32_t rank = ((pct * count) + (PERCENT_SCALE - 1U)) / PERCENT_SCALE;
+
+    if (0U == rank)
+    {
+        rank = 1U;
+    }
+
+    return sorted[rank - 1U];
+}
+
+/*******************************************************************************
+* Function Name: https_benchmark_run
+********************************************************************************
+* Summary:
+*  Calls the request function the given number of times back to back and
+*  collects the latency of each successful request.
+*
+* Parameters:
+*  iterations - Number of requests to issue, at most HTTPS_BENCHMARK_ITERATIONS
+*  request    - Function that issues one request
+*  arg        - Argument passed to the request function
+*  result     - Filled with the aggregate result of the run
+*
+* Return:
+*  cy_rslt_t: Returns CY_RSLT_SUCCESS if at least one request succeeded,
+*  CY_RSLT_TYPE_ERROR otherwise.
+*
+*******************************************************************************/
+cy_rslt_t https_benchmark_run(uint32_t iterations,
+                              https_benchmark_request_t request,
+                              void *arg, https_benchmark_result_t *result)
+{
+    uint32_t bytes_copied_total = 0U;
+    uint32_t samples = 0U;
+    TickType_t run_start;
+
+    if ((NULL == request) || (NULL == result))
+    {
+        return CY_RSLT_TYPE_ERROR;
+    }
+
+    if (iterations > HTTPS_BENCHMARK_ITERATIONS)
+    {
+        iterations = HTTPS_BENCHMARK_ITERATIONS;
+    }
+
+    (void) memset(result, 0, sizeof(*result));
+    run_start = xTaskGetTickCount();
+
+    for (uint32_t i = 0U; i < iterations; i++)
+    {
+        uint32_t bytes_copied = 0U;
+        TickType_t start = xTaskGetTickCount();
+        cy_rslt_t status = request(arg, &bytes_copied);
+        TickType_t end = xTaskGetTickCount();
+
+        result->requests++;
+
+        if (CY_RSLT_SUCCESS != status)
+        {
+            result->failures++;
+            continue;
+        }
+
+        latency_samples[samples++] = (uint32_t) pdTICKS_TO_MS(end - start);
+        bytes_copied_total += bytes_copied;
+    }
+
+    result->elapsed_ms = (uint32_t) pdTICKS_TO_MS(xTaskGetTickCount() -
+                                                  run_start);
+
+    if (0U == samples)
+    {
+        return CY_RSLT_TYPE_ERROR;
+    }
+
+    sort_samples(latency_samples, samples);
+
+    result->latency_min_ms = latency_samples[0];
+    result->latency_p50_ms = percentile(latency_samples, samples,
+                                        HTTPS_BENCHMARK_P50);
+    result->latency_p99_ms = percentile(latency_samples, samples,
+                                        HTTPS_BENCHMARK_P99);
+    result->latency_max_ms = latency_samples[samples - 1U];
+    result->bytes_copied_per_request = bytes_copied_total / samples;
+
+    if (0U != result->elapsed_ms)
+    {
+        result->requests_per_sec_x100 = (uint32_t)(((uint64_t) samples *
+                MS_PER_SEC * PERCENT_SCALE) / result->elapsed_ms);
+    }
+
+    return CY_RSLT_SUCCESS;
+}
+
+/*******************************************************************************
+* Function Name: https_benchmark_print
+********************************************************************************
+* Summary:
+*  Prints the result of a benchmark run on the debug UART.
+*
+*******************************************************************************/
+void https_benchmark_print(const https_benchmark_result_t *result)
+{
+    app_log_printf("\n Benchmark: %lu requests, %lu failed, %lu ms\n",
+            (unsigned long) result->requests,
+            (unsigned long) result->failures,
+            (unsigned long) result->elapsed_ms);
+    app_log_printf(" Requests/sec    : %lu.%02lu\n",
+            (unsigned long) (result->requests_per_sec_x100 / PERCENT_SCALE),
+            (unsigned long) (result->requests_per_sec_x100 % PERCENT_SCALE));
+    app_log_printf(" Latency (ms)    : min %lu p50 %lu p99 %lu max %lu\n",
+            (unsigned long) result->latency_min_ms,
+            (unsigned long) result->latency_p50_ms,
+            (unsigned long) result->latency_p99_ms,
+            (unsigned long) result->latency_max_ms);
+    app_log_printf(" Bytes copied/req: %lu\n",
+            (unsigned long) result->bytes_copied_per_request);
+}
+
+
+/* [] END OF FILE */
@@ -0,0 +1,102 @@
+/*******************************************************************************
+* File Name: https_benchmark.h
+*
+* Description: This file is the public interface of https_benchmark.c and
+* contains the configuration parameters of the HTTPS load benchmark.
+*
+* Related Document: See README.md
+********************************************************************************
+* Copyright 2024-2025, Cypress Semiconductor Corporation (an Infineon company) or
+* an affiliate of Cypress Semiconductor Corporation.  All rights reserved.
+*
+* This software, including source code, documentation and related
+* materials ("Software") is owned by Cypress Semiconductor Corporation
+* or one of its affiliates ("Cypress") and is protected by and subject to
+* worldwide patent protection (United States and foreign),
+* United States copyright laws and international treaty provisions.
+* Therefore, you may use this Software only as provided in the license
+* agreement accompanying the software package from which you
+* obtained this Software ("EULA").
+* If no EULA applies, Cypress hereby grants you a personal, non-exclusive,
+* non-transferable license to copy, modify, and compile the Software
+* source code solely for use in connection with Cypress's
+* integrated circuit products.  Any reproduction, modification, translation,
+* compilation, or representation of this Software except as specified
+* above is prohibited without the express written permission of Cypress.
+*
+* Disclaimer: THIS SOFTWARE IS PROVIDED AS-IS, WITH NO WARRANTY OF ANY KIND,
+* EXPRESS OR IMPLIED, INCLUDING, BUT NOT LIMITED TO, NONINFRINGEMENT, IMPLIED
+* WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE. Cypress
+* reserves the right to make changes to the Software without notice. Cypress
+* does not assume any liability arising out of the application or use of the
+* Software or any product or circuit described in the Software. Cypress does
+* not authorize its products for use in any products where a malfunction or
+* failure of the Cypress product may reasonably be expected to result in
+* significant property damage, injury or death ("High Risk Product"). By
+* including Cypress's product in a High Risk Product, the manufacturer
+* of such system or application assumes all risk of such use and in doing
+* so agrees to indemnify Cypress against all liability.
+*******************************************************************************/
+
+/*******************************************************************************
+* Include guard
+*******************************************************************************/
+#ifndef HTTPS_BENCHMARK_H_
+#define HTTPS_BENCHMARK_H_
+
+/*******************************************************************************
+* Header Files
+*******************************************************************************/
+#include <stdint.h>
+#include "cy_result.h"
+
+/*******************************************************************************
+* Macros
+*******************************************************************************/
+
+/* Number of requests issued back to back by one benchmark run. Each request
+ * latency is kept in RAM so the percentiles can be computed at the end.
+ */
+#define HTTPS_BENCHMARK_ITERATIONS               (100U)
+
+/* Percentiles reported by the benchmark. */
+#define HTTPS_BENCHMARK_P50                      (50U)
+#define HTTPS_BENCHMARK_P99                      (99U)
+
+/*******************************************************************************
+* Data Types
+*******************************************************************************/
+
+/* Issues one request. bytes_copied returns the number of bytes the request
+ * moved through application buffers (request headers, request body and
+ * response).
+ */
+typedef cy_rslt_t (*https_benchmark_request_t)(void *arg,
+                                               uint32_t *bytes_copied);
+
+/* Aggregate result of one benchmark run. */
+typedef struct
+{
+    uint32_t requests;
+    uint32_t failures;
+    uint32_t elapsed_ms;
+    uint32_t requests_per_sec_x100;
+    uint32_t latency_min_ms;
+    uint32_t latency_p50_ms;
+    uint32_t latency_p99_ms;
+    uint32_t latency_max_ms;
+    uint32_t bytes_copied_per_request;
+} https_benchmark_result_t;
+
+/*******************************************************************************
+* Function Prototypes
+*******************************************************************************/
+cy_rslt_t https_benchmark_run(uint32_t iterations,
+                              https_benchmark_request_t request,
+                              void *arg, https_benchmark_result_t *result);
+void https_benchmark_print(const https_benchmark_result_t *result);
+
+#endif /* HTTPS_BENCHMARK_H_ */
+
+
+/* [] END OF FILE */
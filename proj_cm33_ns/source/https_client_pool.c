@@ -0,0 +1,531 @@
+/*******************************************************************************
+* File Name: https_client_pool.c
+*
+* Description: This file contains a pool of persistent HTTPS client
+* connections. Tasks borrow a connected client for a request and return it
+* afterwards, so the TCP connect and TLS handshake are paid once per
+* connection instead of once per request. Idle connections are closed after a
+* timeout and the number of open connections is bounded by a heap budget.
+*
+* Related Document: See README.md
+********************************************************************************
+* Copyright 2024-2025, Cypress Semiconductor Corporation (an Infineon company) or
+* an affiliate of Cypress Semiconductor Corporation.  All rights reserved.
+*
+* This software, including source code, documentation and related
+* materials ("Software") is owned by Cypress Semiconductor Corporation
+* or one of its affiliates ("Cypress") and is protected by and subject to
+* worldwide patent protection (United States and foreign),
+* United States copyright laws and international treaty provisions.
+* Therefore, you may use this Software only as provided in the license
+* agreement accompanying the software package from which you
+* obtained this Software ("EULA").
+* If no EULA applies, Cypress hereby grants you a personal, non-exclusive,
+* non-transferable license to copy, modify, and compile the Software
+* source code solely for use in connection with Cypress's
+* integrated circuit products.  Any reproduction, modification, translation,
+* compilation, or representation of this Software except as specified
+* above is prohibited without the express written permission of Cypress.
+*
+* Disclaimer: THIS SOFTWARE IS PROVIDED AS-IS, WITH NO WARRANTY OF ANY KIND,
+* EXPRESS OR IMPLIED, INCLUDING, BUT NOT LIMITED TO, NONINFRINGEMENT, IMPLIED
+* WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE. Cypress
+* reserves the right to make changes to the Software without notice. Cypress
+* does not assume any liability arising out of the application or use of the
+* Software or any product or circuit described in the Software. Cypress does
+* not authorize its products for use in any products where a malfunction or
+* failure of the Cypress product may reasonably be expected to result in
+* significant property damage, injury or death ("High Risk Product"). By
+* including Cypress's product in a High Risk Product, the manufacturer
+* of such system or application assumes all risk of such use and in doing
+* so agrees to indemnify Cypress against all liability.
+*******************************************************************************/
+
+/*******************************************************************************
+* Header Files
+*******************************************************************************/
+#include "https_client_pool.h"
+#include "https_reconnect.h"
+#include "boot_trace.h"
+#include "https_metrics.h"
+#include <string.h>
+
+/* FreeRTOS header files */
+#include <FreeRTOS.h>
+#include <task.h>
+#include <semphr.h>
+
+/*******************************************************************************
+* Macros
+*******************************************************************************/
+#define CONNECT_TIMEOUT_MS                           (5000U)
+
+/*******************************************************************************
+* Data Types
+*******************************************************************************/
+
+/* One pooled HTTP client. */
+typedef struct
+{
+    cy_http_client_t handle;
+    cy_awsport_server_info_t server;
+    bool created;
+    volatile bool connected;
+    bool in_use;
+    TickType_t last_used;
+    https_link_t link;
+} pool_entry_t;
+
+/*******************************************************************************
+* Global Variables
+********************************************************************************/
+static pool_entry_t pool[HTTPS_POOL_SIZE];
+
+/* Protects the pool table and the counters. */
+static SemaphoreHandle_t pool_mutex;
+
+/* Counts the connections that are not borrowed. */
+static SemaphoreHandle_t pool_free_slots;
+
+static cy_awsport_ssl_credentials_t *pool_credentials;
+static cy_http_disconnect_callback_t app_disconnect_cb;
+static https_client_pool_stats_t pool_stats;
+
+/*******************************************************************************
+* Function Definitions
+*******************************************************************************/
+
+/*******************************************************************************
+* Function Name: pool_disconnect_handler
+********************************************************************************
+* Summary:
+*  Disconnect callback of the pooled clients. Marks the connection as lost
+*  so the next borrower reconnects it, then notifies the application.
+*
+*******************************************************************************/
+static void pool_disconnect_handler(cy_http_client_t handle,
+        cy_http_client_disconn_type_t type, void *args)
+{
+    pool_entry_t *entry = (pool_entry_t *) args;
+
+    entry->connected = false;
+    https_link_down(&entry->link);
+
+    if (NULL != app_disconnect_cb)
+    {
+        app_disconnect_cb(handle, type, NULL);
+    }
+}
+
+/*******************************************************************************
+* Function Name: same_server
+********************************************************************************
+* Summary:
+*  Checks whether a pooled client talks to the given server.
+*
+*******************************************************************************/
+static bool same_server(const pool_entry_t *entry,
+                        const cy_awsport_server_info_t *server)
+{
+    return (entry->server.port == server->port) &&
+           (0 == strcmp(entry->server.host_name, server->host_name));
+}
+
+/*******************************************************************************
+* Function Name: find_entry
+********************************************************************************
+* Summary:
+*  Returns the pool entry that owns the given client handle. Called with the
+*  pool mutex held.
+*
+*******************************************************************************/
+static pool_entry_t *find_entry(cy_http_client_t handle)
+{
+    for (uint32_t i = 0U; i < HTTPS_POOL_SIZE; i++)
+    {
+        if (pool[i].created && (pool[i].handle == handle))
+        {
+            return &pool[i];
+        }
+    }
+
+    return NULL;
+}
+
+/*******************************************************************************
+* Function Name: close_entry
+********************************************************************************
+* Summary:
+*  Disconnects and deletes a pooled client, freeing its heap.
+*
+*******************************************************************************/
+static void close_entry(pool_entry_t *entry)
+{
+    if (entry->connected)
+    {
+        (void) cy_http_client_disconnect(entry->handle);
+        entry->connected = false;
+    }
+
+    if (entry->created)
+    {
+        (void) cy_http_client_delete(entry->handle);
+        entry->created = false;
+        pool_stats.open--;
+    }
+
+    /* Closed on purpose, so the next connect is not a recovery. */
+    https_link_init(&entry->link);
+}
+
+/*******************************************************************************
+* Function Name: connect_entry
+********************************************************************************
+* Summary:
+*  Connects a borrowed client. A connection that was lost is reopened at
+*  once the first time, then only after the backoff delay of its last failed
+*  attempt, which is waited for if it ends within timeout_ms. The entry
+*  belongs to the borrower, so the mutex is only taken for the counters.
+*
+*******************************************************************************/
+static cy_rslt_t connect_entry(pool_entry_t *entry, uint32_t timeout_ms)
+{
+    cy_rslt_t result;
+    TickType_t wait = 0U;
+    https_metrics_stamp_t start;
+
+    if (!https_link_begin(&entry->link, &wait))
+    {
+        if (wait > pdMS_TO_TICKS(timeout_ms))
+        {
+            return CY_RSLT_TYPE_ERROR;
+        }
+
+        vTaskDelay(wait);
+        (void) https_link_begin(&entry->link, NULL);
+    }
+
+    BOOT_TRACE_BEGIN_PHASE(BOOT_TRACE_HTTP_CLIENT_CONNECT);
+    https_metrics_stamp(&start);
+    result = cy_http_client_connect(entry->handle, CONNECT_TIMEOUT_MS,
+                                    CONNECT_TIMEOUT_MS);
+    BOOT_TRACE_END_PHASE(BOOT_TRACE_HTTP_CLIENT_CONNECT);
+
+    if (CY_RSLT_SUCCESS == result)
+    {
+        https_metrics_record(HTTPS_METRIC_CONNECT, &start);
+    }
+    entry->connected = (CY_RSLT_SUCCESS == result);
+    https_link_connected(&entry->link, result);
+
+    (void) xSemaphoreTake(pool_mutex, portMAX_DELAY);
+    pool_stats.connects++;
+    (void) xSemaphoreGive(pool_mutex);
+
+    return result;
+}
+
+/*******************************************************************************
+* Function Name: select_entry
+********************************************************************************
+* Summary:
+*  Picks the entry to lend, called with the pool mutex held. A connected
+*  client of the same server is preferred, then an unused slot, then an idle
+*  client of another server, which is closed to make room.
+*
+*******************************************************************************/
+static pool_entry_t *select_entry(const cy_awsport_server_info_t *server)
+{
+    pool_entry_t *free_slot = NULL;
+    pool_entry_t *same = NULL;
+    pool_entry_t *other = NULL;
+
+    for (uint32_t i = 0U; i < HTTPS_POOL_SIZE; i++)
+    {
+        pool_entry_t *entry = &pool[i];
+
+        if (entry->in_use)
+        {
+            continue;
+        }
+
+        if (!entry->created)
+        {
+            free_slot = (NULL == free_slot) ? entry : free_slot;
+        }
+        else if (same_server(entry, server))
+        {
+            if ((NULL == same) || entry->connected)
+            {
+                same = entry;
+            }
+        }
+        else if ((NULL == other) || (entry->last_used < other->last_used))
+        {
+            other = entry;
+        }
+    }
+
+    if (NULL != same)
+    {
+        return same;
+    }
+
+    if ((NULL == free_slot) && (NULL != other))
+    {
+        close_entry(other);
+        pool_stats.evictions++;
+        free_slot = other;
+    }
+
+    return free_slot;
+}
+
+/*******************************************************************************
+* Function Name: https_client_pool_init
+********************************************************************************
+* Summary:
+*  Initializes the pool of HTTPS_POOL_SIZE clients. Clients are created and
+*  connected on first use.
+*
+* Parameters:
+*  credentials   - Security configuration used by every client. Must remain
+*                  valid while the pool is in use.
+*  disconnect_cb - Application disconnect callback, may be NULL
+*
+* Return:
+*  cy_rslt_t: CY_RSLT_SUCCESS if the pool was initialized.
+*
+*******************************************************************************/
+cy_rslt_t https_client_pool_init(cy_awsport_ssl_credentials_t *credentials,
+                                 cy_http_disconnect_callback_t disconnect_cb)
+{
+    (void) memset(pool, 0, sizeof(pool));
+    (void) memset(&pool_stats, 0, sizeof(pool_stats));
+    pool_stats.capacity = HTTPS_POOL_SIZE;
+    pool_credentials = credentials;
+    app_disconnect_cb = disconnect_cb;
+
+    pool_mutex = xSemaphoreCreateMutex();
+    pool_free_slots = xSemaphoreCreateCounting(HTTPS_POOL_SIZE, HTTPS_POOL_SIZE);
+
+    if ((NULL == pool_mutex) || (NULL == pool_free_slots))
+    {
+        return CY_RSLT_TYPE_ERROR;
+    }
+
+    return CY_RSLT_SUCCESS;
+}
+
+/*******************************************************************************
+* Function Name: https_client_pool_borrow
+********************************************************************************
+* Summary:
+*  Lends a connected client for the given server, waiting for one to be
+*  returned if all are borrowed. The client is created and connected if the
+*  pool has no live connection to the server.
+*
+* Parameters:
+*  server     - Server to connect to. Must remain valid while the pool is in
+*               use.
+*  timeout_ms - Maximum time to wait for a free client
+*  handle     - Returns the borrowed client
+*
+* Return:
+*  cy_rslt_t: CY_RSLT_SUCCESS if a connected client is returned.
+*
+*******************************************************************************/
+cy_rslt_t https_client_pool_borrow(cy_awsport_server_info_t *server,
+                                   uint32_t timeout_ms,
+                                   cy_http_client_t *handle)
+{
+    cy_rslt_t result = CY_RSLT_SUCCESS;
+    pool_entry_t *entry;
+
+    https_client_pool_evict_idle();
+
+    if (pdTRUE != xSemaphoreTake(pool_free_slots, pdMS_TO_TICKS(timeout_ms)))
+    {
+        (void) xSemaphoreTake(pool_mutex, portMAX_DELAY);
+        pool_stats.timeouts++;
+        (void) xSemaphoreGive(pool_mutex);
+        return CY_RSLT_TYPE_ERROR;
+    }
+
+    (void) xSemaphoreTake(pool_mutex, portMAX_DELAY);
+    entry = select_entry(server);
+    entry->in_use = true;
+    pool_stats.in_use++;
+    pool_stats.borrows++;
+    (void) xSemaphoreGive(pool_mutex);
+
+    if (!entry->created)
+    {
+        entry->server = *server;
+        BOOT_TRACE_BEGIN_PHASE(BOOT_TRACE_HTTP_CLIENT_CREATE);
+        result = cy_http_client_create(pool_credentials, &entry->server,
+                                       pool_disconnect_handler, entry,
+                                       &entry->handle);
+        BOOT_TRACE_END_PHASE(BOOT_TRACE_HTTP_CLIENT_CREATE);
+
+        if (CY_RSLT_SUCCESS == result)
+        {
+            (void) xSemaphoreTake(pool_mutex, portMAX_DELAY);
+            entry->created = true;
+            pool_stats.open++;
+            (void) xSemaphoreGive(pool_mutex);
+        }
+    }
+
+    if ((CY_RSLT_SUCCESS == result) && !entry->connected)
+    {
+        result = connect_entry(entry, timeout_ms);
+    }
+    else if (CY_RSLT_SUCCESS == result)
+    {
+        (void) xSemaphoreTake(pool_mutex, portMAX_DELAY);
+        pool_stats.reuses++;
+        (void) xSemaphoreGive(pool_mutex);
+    }
+
+    if (CY_RSLT_SUCCESS == result)
+    {
+        *handle = entry->handle;
+    }
+    else
+    {
+        (void) xSemaphoreTake(pool_mutex, portMAX_DELAY);
+        entry->in_use = false;
+        entry->last_used = xTaskGetTickCount();
+        pool_stats.in_use--;
+        (void) xSemaphoreGive(pool_mutex);
+        (void) xSemaphoreGive(pool_free_slots);
+    }
+
+    return result;
+}
+
+/*******************************************************************************
+* Function Name: https_client_pool_return
+********************************************************************************
+* Summary:
+*  Gives a borrowed client back to the pool.
+*
+* Parameters:
+*  handle   - Borrowed client
+*  reusable - False if the connection is in an unknown state, for example
+*             after a failed request. It is then disconnected and the next
+*             borrower reconnects it.
+*
+*******************************************************************************/
+void https_client_pool_return(cy_http_client_t handle, bool reusable)
+{
+    pool_entry_t *entry;
+
+    (void) xSemaphoreTake(pool_mutex, portMAX_DELAY);
+    entry = find_entry(handle);
+
+    if ((NULL != entry) && entry->in_use)
+    {
+        if (!reusable && entry->connected)
+        {
+            (void) cy_http_client_disconnect(entry->handle);
+            entry->connected = false;
+            https_link_down(&entry->link);
+        }
+
+        entry->in_use = false;
+        entry->last_used = xTaskGetTickCount();
+        pool_stats.in_use--;
+        (void) xSemaphoreGive(pool_free_slots);
+    }
+
+    (void) xSemaphoreGive(pool_mutex);
+}
+
+/*******************************************************************************
+* Function Name: https_client_pool_reconnect
+********************************************************************************
+* Summary:
+*  Re-establishes the connection of a borrowed client, after the backoff
+*  delay if the last attempt failed. The old connection is closed with the
+*  pool mutex held, like the clients closed by select_entry; the new one is
+*  opened without it, since the borrower owns the entry.
+*
+*******************************************************************************/
+cy_rslt_t https_client_pool_reconnect(cy_http_client_t handle)
+{
+    pool_entry_t *entry;
+
+    (void) xSemaphoreTake(pool_mutex, portMAX_DELAY);
+    entry = find_entry(handle);
+
+    if ((NULL != entry) && entry->in_use)
+    {
+        if (entry->connected)
+        {
+            (void) cy_http_client_disconnect(entry->handle);
+            entry->connected = false;
+        }
+
+        https_link_down(&entry->link);
+    }
+    else
+    {
+        entry = NULL;
+    }
+    (void) xSemaphoreGive(pool_mutex);
+
+    if (NULL == entry)
+    {
+        return CY_RSLT_TYPE_ERROR;
+    }
+
+    return connect_entry(entry, HTTPS_RECONNECT_MAX_DELAY_MS);
+}
+
+/*******************************************************************************
+* Function Name: https_client_pool_evict_idle
+********************************************************************************
+* Summary:
+*  Closes the clients that were not borrowed for HTTPS_POOL_IDLE_TIMEOUT_MS.
+*
+*******************************************************************************/
+void https_client_pool_evict_idle(void)
+{
+    TickType_t now = xTaskGetTickCount();
+
+    (void) xSemaphoreTake(pool_mutex, portMAX_DELAY);
+
+    for (uint32_t i = 0U; i < HTTPS_POOL_SIZE; i++)
+    {
+        pool_entry_t *entry = &pool[i];
+
+        if (entry->created && !entry->in_use &&
+            ((now - entry->last_used) >
+             pdMS_TO_TICKS(HTTPS_POOL_IDLE_TIMEOUT_MS)))
+        {
+            close_entry(entry);
+            pool_stats.evictions++;
+        }
+    }
+
+    (void) xSemaphoreGive(pool_mutex);
+}
+
+/*******************************************************************************
+* Function Name: https_client_pool_get_stats
+********************************************************************************
+* Summary:
+*  Returns a copy of the pool counters.
+*
+*******************************************************************************/
+void https_client_pool_get_stats(https_client_pool_stats_t *stats)
+{
+    (void) xSemaphoreTake(pool_mutex, portMAX_DELAY);
+    *stats = pool_stats;
+    (void) xSemaphoreGive(pool_mutex);
+}
+
+
+/* [] END OF FILE */
@@ -0,0 +1,105 @@
+/*******************************************************************************
+* File Name: https_client_pool.h
+*
+* Description: This file is the public interface of https_client_pool.c and
+* contains the configuration parameters of the HTTPS connection pool.
+*
+* Related Document: See README.md
+********************************************************************************
+* Copyright 2024-2025, Cypress Semiconductor Corporation (an Infineon company) or
+* an affiliate of Cypress Semiconductor Corporation.  All rights reserved.
+*
+* This software, including source code, documentation and related
+* materials ("Software") is owned by Cypress Semiconductor Corporation
+* or one of its affiliates ("Cypress") and is protected by and subject to
+* worldwide patent protection (United States and foreign),
+* United States copyright laws and international treaty provisions.
+* Therefore, you may use this Software only as provided in the license
+* agreement accompanying the software package from which you
+* obtained this Software ("EULA").
+* If no EULA applies, Cypress hereby grants you a personal, non-exclusive,
+* non-transferable license to copy, modify, and compile the Software
+* source code solely for use in connection with Cypress's
+* integrated circuit products.  Any reproduction, modification, translation,
+* compilation, or representation of this Software except as specified
+* above is prohibited without the express written permission of Cypress.
+*
+* Disclaimer: THIS SOFTWARE IS PROVIDED AS-IS, WITH NO WARRANTY OF ANY KIND,
+* EXPRESS OR IMPLIED, INCLUDING, BUT NOT LIMITED TO, NONINFRINGEMENT, IMPLIED
+* WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE. Cypress
+* reserves the right to make changes to the Software without notice. Cypress
+* does not assume any liability arising out of the application or use of the
+* Software or any product or circuit described in the Software. Cypress does
+* not authorize its products for use in any products where a malfunction or
+* failure of the Cypress product may reasonably be expected to result in
+* significant property damage, injury or death ("High Risk Product"). By
+* including Cypress's product in a High Risk Product, the manufacturer
+* of such system or application assumes all risk of such use and in doing
+* so agrees to indemnify Cypress against all liability.
+*******************************************************************************/
+
+/*******************************************************************************
+* Include guard
+*******************************************************************************/
+#ifndef HTTPS_CLIENT_POOL_H_
+#define HTTPS_CLIENT_POOL_H_
+
+/*******************************************************************************
+* Header Files
+*******************************************************************************/
+#include <stdint.h>
+#include <stdbool.h>
+#include "FreeRTOS.h"
+#include "cy_http_client_api.h"
+
+/*******************************************************************************
+* Macros
+*******************************************************************************/
+
+/* Maximum number of HTTP client instances in the pool. Each connected
+ * client holds two TLS record buffers from the Mbed TLS memory pools, so
+ * raising it needs HTTPS_MEM_POOL_RECORD_BLOCKS in https_mem_pool.h raised
+ * by two per client.
+ */
+#define HTTPS_POOL_SIZE                          (2U)
+
+/* Connections idle for longer than this are closed to give their heap back. */
+#define HTTPS_POOL_IDLE_TIMEOUT_MS               (30000U)
+
+/* Time to wait for a free connection when all of them are borrowed. */
+#define HTTPS_POOL_BORROW_TIMEOUT_MS             (5000U)
+
+/*******************************************************************************
+* Data Types
+*******************************************************************************/
+
+/* Pool usage counters. */
+typedef struct
+{
+    uint32_t capacity;
+    uint32_t open;
+    uint32_t in_use;
+    uint32_t borrows;
+    uint32_t reuses;
+    uint32_t connects;
+    uint32_t evictions;
+    uint32_t timeouts;
+} https_client_pool_stats_t;
+
+/*******************************************************************************
+* Function Prototypes
+*******************************************************************************/
+cy_rslt_t https_client_pool_init(cy_awsport_ssl_credentials_t *credentials,
+                                 cy_http_disconnect_callback_t disconnect_cb);
+cy_rslt_t https_client_pool_borrow(cy_awsport_server_info_t *server,
+                                   uint32_t timeout_ms,
+                                   cy_http_client_t *handle);
+void https_client_pool_return(cy_http_client_t handle, bool reusable);
+cy_rslt_t https_client_pool_reconnect(cy_http_client_t handle);
+void https_client_pool_evict_idle(void);
+void https_client_pool_get_stats(https_client_pool_stats_t *stats);
+
+#endif /* HTTPS_CLIENT_POOL_H_ */
+
+
+/* [] END OF FILE */
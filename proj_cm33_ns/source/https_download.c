@@ -0,0 +1,593 @@
+/*******************************************************************************
+* File Name: https_download.c
+*
+* Description: This file downloads a resource in byte ranges over the
+* asynchronous HTTPS connections and resumes interrupted ranges.
+*
+* Related Document: See README.md
+********************************************************************************
+* Copyright 2024-2025, Cypress Semiconductor Corporation (an Infineon company) or
+* an affiliate of Cypress Semiconductor Corporation.  All rights reserved.
+*
+* This software, including source code, documentation and related
+* materials ("Software") is owned by Cypress Semiconductor Corporation
+* or one of its affiliates ("Cypress") and is protected by and subject to
+* worldwide patent protection (United States and foreign),
+* United States copyright laws and international treaty provisions.
+* Therefore, you may use this Software only as provided in the license
+* agreement accompanying the software package from which you
+* obtained this Software ("EULA").
+* If no EULA applies, Cypress hereby grants you a personal, non-exclusive,
+* non-transferable license to copy, modify, and compile the Software
+* source code solely for use in connection with Cypress's
+* integrated circuit products.  Any reproduction, modification, translation,
+* compilation, or representation of this Software except as specified
+* above is prohibited without the express written permission of Cypress.
+*
+* Disclaimer: THIS SOFTWARE IS PROVIDED AS-IS, WITH NO WARRANTY OF ANY KIND,
+* EXPRESS OR IMPLIED, INCLUDING, BUT NOT LIMITED TO, NONINFRINGEMENT, IMPLIED
+* WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE. Cypress
+* reserves the right to make changes to the Software without notice. Cypress
+* does not assume any liability arising out of the application or use of the
+* Software or any product or circuit described in the Software. Cypress does
+* not authorize its products for use in any products where a malfunction or
+* failure of the Cypress product may reasonably be expected to result in
+* significant property damage, injury or death ("High Risk Product"). By
+* including Cypress's product in a High Risk Product, the manufacturer
+* of such system or application assumes all risk of such use and in doing
+* so agrees to indemnify Cypress against all liability.
+*******************************************************************************/
+
+/*******************************************************************************
+* Header Files
+*******************************************************************************/
+#include "https_download.h"
+#include "secure_http_client.h"
+#include <stdio.h>
+#include <string.h>
+
+/* FreeRTOS header files */
+#include <FreeRTOS.h>
+#include <task.h>
+
+/*******************************************************************************
+* Macros
+*******************************************************************************/
+#define HTTP_STATUS_OK                               (200U)
+#define HTTP_STATUS_PARTIAL_CONTENT                  (206U)
+#define HTTP_STATUS_REQUEST_TIMEOUT                  (408U)
+#define HTTP_STATUS_TOO_MANY_REQUESTS                (429U)
+#define HTTP_STATUS_CLIENT_ERROR_MIN                 (400U)
+#define HTTP_STATUS_CLIENT_ERROR_MAX                 (499U)
+
+/* End of a range whose length is not known. */
+#define RANGE_END_UNKNOWN                            (UINT32_MAX)
+
+/*******************************************************************************
+* Function Definitions
+*******************************************************************************/
+
+/*******************************************************************************
+* Function Name: range_headers_handler
+********************************************************************************
+* Summary:
+*  Checks the response to a range request before its body arrives. A 206
+*  response must start at or before the next byte the range needs and
+*  describe the same resource as the earlier responses, compared by length
+*  and ETag. A 200 response, from a server that ignores Range, carries the
+*  whole resource and is accepted unless the server answered ranges before.
+*
+* Parameters:
+*  arg      - Range the response belongs to
+*  response - Parsed response headers
+*
+* Return:
+*  cy_rslt_t: CY_RSLT_SUCCESS to receive the body, CY_RSLT_TYPE_ERROR to
+*  abort the request.
+*
+*******************************************************************************/
+static cy_rslt_t range_headers_handler(void *arg,
+                                       const https_stream_response_t *response)
+{
+    https_download_range_t *range = (https_download_range_t *) arg;
+    https_download_t *download = range->download;
+    uint32_t length;
+
+    if ((HTTP_STATUS_PARTIAL_CONTENT == response->status_code) &&
+        response->has_range && (response->range_start <= range->next))
+    {
+        range->offset = response->range_start;
+        length = response->complete_length;
+        download->ranges_supported = true;
+    }
+    else if ((HTTP_STATUS_OK == response->status_code) &&
+             !download->ranges_supported)
+    {
+        /* The whole resource follows. When resuming, the bytes before
+         * range->next are skipped as they arrive.
+         */
+        range->offset = 0U;
+        length = response->content_length;
+        range->end = (HTTPS_STREAM_CONTENT_LENGTH_UNKNOWN == length) ?
+                     RANGE_END_UNKNOWN : length;
+    }
+    else
+    {
+        /* Client errors other than a timeout or rate limit do not go away
+         * by asking again.
+         */
+        if ((response->status_code >= HTTP_STATUS_CLIENT_ERROR_MIN) &&
+            (response->status_code <= HTTP_STATUS_CLIENT_ERROR_MAX) &&
+            (HTTP_STATUS_REQUEST_TIMEOUT != response->status_code) &&
+            (HTTP_STATUS_TOO_MANY_REQUESTS != response->status_code))
+        {
+            download->changed = true;
+        }
+
+        return CY_RSLT_TYPE_ERROR;
+    }
+
+    if ('\0' != response->etag[0])
+    {
+        if ('\0' == download->etag[0])
+        {
+            (void) memcpy(download->etag, response->etag,
+                          sizeof(download->etag));
+        }
+        else if (0 != strcmp(download->etag, response->etag))
+        {
+            download->changed = true;
+        }
+        else
+        {
+            /* Same version of the resource. */
+        }
+    }
+
+    if (HTTPS_STREAM_CONTENT_LENGTH_UNKNOWN != length)
+    {
+        if (HTTPS_STREAM_CONTENT_LENGTH_UNKNOWN == download->length)
+        {
+            download->length = length;
+        }
+        else if (length != download->length)
+        {
+            download->changed = true;
+        }
+        else
+        {
+            /* Same length as before. */
+        }
+
+        if (range->end > length)
+        {
+            range->end = length;
+        }
+    }
+
+    return download->changed ? CY_RSLT_TYPE_ERROR : CY_RSLT_SUCCESS;
+}
+
+/*******************************************************************************
+* Function Name: range_body_handler
+********************************************************************************
+* Summary:
+*  Hands the received bytes that belong to the range to the sink. Bytes
+*  before the next byte of the range, sent again by a server that ignores
+*  Range, and bytes past its end are dropped.
+*
+* Parameters:
+*  arg  - Range the response belongs to
+*  data - Piece of the body
+*  len  - Length of the piece
+*
+* Return:
+*  cy_rslt_t: CY_RSLT_SUCCESS or the error returned by the sink.
+*
+*******************************************************************************/
+static cy_rslt_t range_body_handler(void *arg, const uint8_t *data,
+                                    uint32_t len)
+{
+    https_download_range_t *range = (https_download_range_t *) arg;
+    https_download_t *download = range->download;
+    cy_rslt_t result = CY_RSLT_SUCCESS;
+    uint32_t skip = 0U;
+
+    if (range->offset < range->next)
+    {
+        skip = range->next - range->offset;
+        if (skip > len)
+        {
+            skip = len;
+        }
+    }
+
+    range->offset += len;
+    data += skip;
+    len -= skip;
+
+    if ((range->next + len) > range->end)
+    {
+        len = (range->next < range->end) ? (range->end - range->next) : 0U;
+    }
+
+    if (0U != len)
+    {
+        result = download->sink(download->arg, range->next, data, len);
+        range->next += len;
+        download->received += len;
+    }
+
+    return result;
+}
+
+/*******************************************************************************
+* Function Name: submit_range
+********************************************************************************
+* Summary:
+*  Asks for the bytes of a range from its next byte on. Content coding is
+*  not accepted, since the byte positions of a range refer to the coded
+*  body.
+*
+* Parameters:
+*  download - Download the range belongs to
+*  range    - Range to fetch
+*
+* Return:
+*  cy_rslt_t: CY_RSLT_SUCCESS if the request was submitted.
+*
+*******************************************************************************/
+static cy_rslt_t submit_range(https_download_t *download,
+                              https_download_range_t *range)
+{
+    cy_rslt_t result;
+    https_stream_request_t request =
+    {
+        .method            = CY_HTTP_CLIENT_METHOD_GET,
+        .path              = download->path,
+        .content_type      = NULL,
+        .body              = NULL,
+        .body_len          = 0U,
+        .body_by_reference = false,
+        .accept_encoding   = false,
+        .body_producer     = NULL,
+        .producer_arg      = NULL,
+        .range             = true,
+        .range_start       = range->next,
+        .range_end         = (RANGE_END_UNKNOWN == range->end) ?
+                             HTTPS_STREAM_RANGE_END_OPEN : (range->end - 1U),
+        .headers_cb        = range_headers_handler,
+        .body_cb           = range_body_handler,
+        .arg               = range
+    };
+
+    range->start = range->next;
+    range->offset = range->next;
+
+    result = https_async_submit_notify(&request, xTaskGetCurrentTaskHandle(),
+                                       &range->handle);
+
+    if (CY_RSLT_SUCCESS == result)
+    {
+        range->state = HTTPS_DOWNLOAD_RANGE_ACTIVE;
+        download->requests++;
+    }
+    else
+    {
+        range->state = HTTPS_DOWNLOAD_RANGE_RETRY;
+    }
+
+    return result;
+}
+
+/*******************************************************************************
+* Function Name: start_ranges
+********************************************************************************
+* Summary:
+*  Asks again for the ranges that failed and starts new ranges in the free
+*  slots. Until the length of the resource and support for ranges are
+*  known, only one range is in flight.
+*
+* Parameters:
+*  download - Download in progress
+*
+* Return:
+*  cy_rslt_t: CY_RSLT_SUCCESS if every request was submitted.
+*
+*******************************************************************************/
+static cy_rslt_t start_ranges(https_download_t *download)
+{
+    cy_rslt_t result = CY_RSLT_SUCCESS;
+    bool probing = (!download->ranges_supported ||
+                    (HTTPS_STREAM_CONTENT_LENGTH_UNKNOWN == download->length));
+    uint32_t active = 0U;
+
+    for (uint32_t i = 0U; i < HTTPS_DOWNLOAD_PARALLEL; i++)
+    {
+        if (HTTPS_DOWNLOAD_RANGE_IDLE != download->ranges[i].state)
+        {
+            active++;
+        }
+    }
+
+    for (uint32_t i = 0U;
+         (i < HTTPS_DOWNLOAD_PARALLEL) && (CY_RSLT_SUCCESS == result); i++)
+    {
+        https_download_range_t *range = &download->ranges[i];
+
+        if (HTTPS_DOWNLOAD_RANGE_RETRY == range->state)
+        {
+            download->resumes++;
+            result = submit_range(download, range);
+        }
+        else if ((HTTPS_DOWNLOAD_RANGE_IDLE == range->state) &&
+                 (download->next_start < download->length) &&
+                 (!probing || (0U == active)))
+        {
+            range->next = download->next_start;
+            range->end = range->next + HTTPS_DOWNLOAD_RANGE_SIZE;
+
+            if ((range->end > download->length) ||
+                (range->end < range->next))
+            {
+                range->end = download->length;
+            }
+
+            download->next_start = range->end;
+            active++;
+            result = submit_range(download, range);
+        }
+        else
+        {
+            /* In flight, or nothing left to start. */
+        }
+    }
+
+    return result;
+}
+
+/*******************************************************************************
+* Function Name: finish_range
+********************************************************************************
+* Summary:
+*  Handles the completion of a range request. A range that ended before its
+*  last byte, by failure or a short response, is asked for again from its
+*  next byte, up to HTTPS_DOWNLOAD_MAX_RETRIES times without progress.
+*
+* Parameters:
+*  download - Download in progress
+*  range    - Range whose request completed
+*  result   - Result of the request
+*
+* Return:
+*  cy_rslt_t: CY_RSLT_SUCCESS, or the error that ends the download.
+*
+*******************************************************************************/
+static cy_rslt_t finish_range(https_download_t *download,
+                              https_download_range_t *range,
+                              cy_rslt_t result)
+{
+    range->state = HTTPS_DOWNLOAD_RANGE_IDLE;
+
+    /* A body of unknown length ends the resource. */
+    if ((CY_RSLT_SUCCESS == result) &&
+        (HTTPS_STREAM_CONTENT_LENGTH_UNKNOWN == download->length) &&
+        (range->next < range->end))
+    {
+        download->length = range->next;
+        range->end = range->next;
+    }
+
+    /* Without range support the one request covered the whole resource. */
+    if (!download->ranges_supported)
+    {
+        download->next_start = range->end;
+    }
+
+    if (range->next >= range->end)
+    {
+        range->retries = 0U;
+        return CY_RSLT_SUCCESS;
+    }
+
+    /* The rest of the range stays due, for this run or the next one. */
+    range->state = HTTPS_DOWNLOAD_RANGE_RETRY;
+
+    if (range->next != range->start)
+    {
+        range->retries = 0U;
+    }
+    else
+    {
+        range->retries++;
+    }
+
+    if (download->changed || (range->retries > HTTPS_DOWNLOAD_MAX_RETRIES))
+    {
+        return (CY_RSLT_SUCCESS != result) ? result : CY_RSLT_TYPE_ERROR;
+    }
+
+    return CY_RSLT_SUCCESS;
+}
+
+/*******************************************************************************
+* Function Name: update_committed
+********************************************************************************
+* Summary:
+*  Moves the committed offset to the first byte not yet handed to the sink.
+*  Bytes of a request still in flight count once the request completes.
+*
+*******************************************************************************/
+static void update_committed(https_download_t *download)
+{
+    uint32_t committed;
+
+    /* The first range may have reached past the end of a short resource. */
+    if (download->next_start > download->length)
+    {
+        download->next_start = download->length;
+    }
+
+    committed = download->next_start;
+
+    for (uint32_t i = 0U; i < HTTPS_DOWNLOAD_PARALLEL; i++)
+    {
+        const https_download_range_t *range = &download->ranges[i];
+
+        if ((HTTPS_DOWNLOAD_RANGE_ACTIVE == range->state) &&
+            (range->start < committed))
+        {
+            committed = range->start;
+        }
+        else if ((HTTPS_DOWNLOAD_RANGE_RETRY == range->state) &&
+                 (range->next < committed))
+        {
+            committed = range->next;
+        }
+        else
+        {
+            /* Range complete. */
+        }
+    }
+
+    download->committed = committed;
+}
+
+/*******************************************************************************
+* Function Name: https_download_init
+********************************************************************************
+* Summary:
+*  Prepares the download of a resource from the server of the asynchronous
+*  request API, from its first byte.
+*
+* Parameters:
+*  download - Download state, must stay valid while the download runs
+*  path     - Resource path, must stay valid while the download runs
+*  sink     - Receives the bytes of the resource
+*  arg      - Argument passed to the sink
+*
+* Return:
+*  void
+*
+*******************************************************************************/
+void https_download_init(https_download_t *download, const char *path,
+                         https_download_sink_t sink, void *arg)
+{
+    (void) memset(download, 0, sizeof(*download));
+
+    download->path = path;
+    download->sink = sink;
+    download->arg = arg;
+    download->length = HTTPS_STREAM_CONTENT_LENGTH_UNKNOWN;
+
+    for (uint32_t i = 0U; i < HTTPS_DOWNLOAD_PARALLEL; i++)
+    {
+        download->ranges[i].download = download;
+    }
+}
+
+/*******************************************************************************
+* Function Name: https_download_run
+********************************************************************************
+* Summary:
+*  Downloads the resource from the committed offset on, with up to
+*  HTTPS_DOWNLOAD_PARALLEL range requests in flight on the asynchronous
+*  connections. A range cut off by a dropped connection or a timeout is
+*  asked for again from the byte where it stopped. If the download fails,
+*  the bytes below download->committed are complete and calling this
+*  function again continues from there, as long as the resource keeps the
+*  same length and ETag. Blocks the calling task until the download ends;
+*  the task notifications of the calling task are used for the range
+*  requests.
+*
+* Parameters:
+*  download - Download prepared by https_download_init
+*
+* Return:
+*  cy_rslt_t: CY_RSLT_SUCCESS once the whole resource was handed to the sink.
+*
+*******************************************************************************/
+cy_rslt_t https_download_run(https_download_t *download)
+{
+    cy_rslt_t result = CY_RSLT_SUCCESS;
+    cy_rslt_t range_result;
+    bool active;
+    bool failed;
+
+    if (download->changed)
+    {
+        return CY_RSLT_TYPE_ERROR;
+    }
+
+    download->next_start = download->committed;
+
+    for (uint32_t i = 0U; i < HTTPS_DOWNLOAD_PARALLEL; i++)
+    {
+        download->ranges[i].state = HTTPS_DOWNLOAD_RANGE_IDLE;
+        download->ranges[i].retries = 0U;
+    }
+
+    /* Drop notifications left over from an earlier run. */
+    (void) ulTaskNotifyTake(pdTRUE, 0U);
+
+    do
+    {
+        if (CY_RSLT_SUCCESS == result)
+        {
+            result = start_ranges(download);
+        }
+
+        /* Wait for a request to complete, then collect every completed
+         * one. Ranges in flight are waited for even after a failure, since
+         * their callbacks use the download state.
+         */
+        (void) ulTaskNotifyTake(pdFALSE,
+                                pdMS_TO_TICKS(HTTPS_ASYNC_IDLE_WAIT_MS));
+
+        active = false;
+        failed = false;
+
+        for (uint32_t i = 0U; i < HTTPS_DOWNLOAD_PARALLEL; i++)
+        {
+            https_download_range_t *range = &download->ranges[i];
+
+            if (HTTPS_DOWNLOAD_RANGE_ACTIVE != range->state)
+            {
+                continue;
+            }
+
+            if (!https_async_result(range->handle, &range_result, NULL))
+            {
+                active = true;
+                continue;
+            }
+
+            range_result = finish_range(download, range, range_result);
+
+            if (HTTPS_DOWNLOAD_RANGE_RETRY == range->state)
+            {
+                failed = true;
+            }
+
+            if ((CY_RSLT_SUCCESS == result) &&
+                (CY_RSLT_SUCCESS != range_result))
+            {
+                result = range_result;
+            }
+        }
+
+        update_committed(download);
+
+        if (failed && (CY_RSLT_SUCCESS == result))
+        {
+            vTaskDelay(pdMS_TO_TICKS(HTTPS_DOWNLOAD_RETRY_DELAY_MS));
+        }
+    } while (active ||
+             ((CY_RSLT_SUCCESS == result) &&
+              (download->committed < download->length)));
+
+    return result;
+}
+
+
+/* [] END OF FILE */
@@ -0,0 +1,161 @@
+/*******************************************************************************
+* File Name: https_download.h
+*
+* Description: This file contains the structures, constants and function
+* prototypes of the resumable range downloads.
+*
+* Related Document: See README.md
+********************************************************************************
+* Copyright 2024-2025, Cypress Semiconductor Corporation (an Infineon company) or
+* an affiliate of Cypress Semiconductor Corporation.  All rights reserved.
+*
+* This software, including source code, documentation and related
+* materials ("Software") is owned by Cypress Semiconductor Corporation
+* or one of its affiliates ("Cypress") and is protected by and subject to
+* worldwide patent protection (United States and foreign),
+* United States copyright laws and international treaty provisions.
+* Therefore, you may use this Software only as provided in the license
+* agreement accompanying the software package from which you
+* obtained this Software ("EULA").
+* If no EULA applies, Cypress hereby grants you a personal, non-exclusive,
+* non-transferable license to copy, modify, and compile the Software
+* source code solely for use in connection with Cypress's
+* integrated circuit products.  Any reproduction, modification, translation,
+* compilation, or representation of this Software except as specified
+* above is prohibited without the express written permission of Cypress.
+*
+* Disclaimer: THIS SOFTWARE IS PROVIDED AS-IS, WITH NO WARRANTY OF ANY KIND,
+* EXPRESS OR IMPLIED, INCLUDING, BUT NOT LIMITED TO, NONINFRINGEMENT, IMPLIED
+* WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE. Cypress
+* reserves the right to make changes to the Software without notice. Cypress
+* does not assume any liability arising out of the application or use of the
+* Software or any product or circuit described in the Software. Cypress does
+* not authorize its products for use in any products where a malfunction or
+* failure of the Cypress product may reasonably be expected to result in
+* significant property damage, injury or death ("High Risk Product"). By
+* including Cypress's product in a High Risk Product, the manufacturer
+* of such system or application assumes all risk of such use and in doing
+* so agrees to indemnify Cypress against all liability.
+*******************************************************************************/
+
+/*******************************************************************************
+* Include guard
+*******************************************************************************/
+#ifndef HTTPS_DOWNLOAD_H_
+#define HTTPS_DOWNLOAD_H_
+
+/*******************************************************************************
+* Header Files
+*******************************************************************************/
+#include <stdint.h>
+#include <stdbool.h>
+#include "cy_result.h"
+#include "https_stream.h"
+#include "https_async.h"
+
+/*******************************************************************************
+* Macros
+*******************************************************************************/
+
+/* Bytes asked for by one range request. */
+#define HTTPS_DOWNLOAD_RANGE_SIZE                (16U * 1024U)
+
+/* Range requests in flight at once. They are pipelined or spread over the
+ * HTTPS_ASYNC_CONNECTIONS connections of the event loop. At most
+ * HTTPS_ASYNC_MAX_REQUESTS.
+ */
+#define HTTPS_DOWNLOAD_PARALLEL                  (2U)
+
+/* Attempts of a range that may fail in a row without receiving any byte
+ * before the download gives up.
+ */
+#define HTTPS_DOWNLOAD_MAX_RETRIES               (3U)
+
+/* Pause before a failed range is asked for again. */
+#define HTTPS_DOWNLOAD_RETRY_DELAY_MS            (500U)
+
+/*******************************************************************************
+* Enumerations
+*******************************************************************************/
+
+/* States of a range. */
+typedef enum
+{
+    HTTPS_DOWNLOAD_RANGE_IDLE,
+    HTTPS_DOWNLOAD_RANGE_ACTIVE,
+    HTTPS_DOWNLOAD_RANGE_RETRY,
+} https_download_range_state_t;
+
+/*******************************************************************************
+* Data Types
+*******************************************************************************/
+
+/* Receives len bytes of the resource starting at offset. Ranges complete in
+ * any order, so the pieces may arrive out of order, and a piece may be
+ * repeated after a server that ignores Range is asked again. Called on the
+ * event loop task of https_async.
+ */
+typedef cy_rslt_t (*https_download_sink_t)(void *arg, uint32_t offset,
+                                           const uint8_t *data, uint32_t len);
+
+struct https_download;
+
+/* One range of the resource and the request fetching it. */
+typedef struct
+{
+    struct https_download *download;
+    https_async_handle_t handle;
+    https_download_range_state_t state;
+
+    /* First byte asked for by the request in flight, next byte to hand to
+     * the sink and one past the last byte of the range.
+     */
+    uint32_t start;
+    uint32_t next;
+    uint32_t end;
+
+    /* Offset in the resource of the next body byte received. */
+    uint32_t offset;
+
+    /* Attempts that failed in a row without receiving any byte. */
+    uint32_t retries;
+} https_download_range_t;
+
+/* State of a download. Every byte below committed has been handed to the
+ * sink, so a failed download continues from there when it is run again.
+ */
+typedef struct https_download
+{
+    const char *path;
+    https_download_sink_t sink;
+    void *arg;
+
+    /* Length of the resource, HTTPS_STREAM_CONTENT_LENGTH_UNKNOWN until a
+     * response tells it. Written by the event loop task.
+     */
+    volatile uint32_t length;
+    volatile bool ranges_supported;
+    volatile bool changed;
+    char etag[HTTPS_STREAM_ETAG_LENGTH];
+
+    uint32_t committed;
+    uint32_t next_start;
+    https_download_range_t ranges[HTTPS_DOWNLOAD_PARALLEL];
+
+    /* Counters. */
+    uint32_t requests;
+    uint32_t resumes;
+    uint32_t received;
+} https_download_t;
+
+/*******************************************************************************
+* Function Prototypes
+*******************************************************************************/
+void https_download_init(https_download_t *download, const char *path,
+                         https_download_sink_t sink, void *arg);
+cy_rslt_t https_download_run(https_download_t *download);
+
+#endif /* HTTPS_DOWNLOAD_H_ */
+
+
+/* [] END OF FILE */
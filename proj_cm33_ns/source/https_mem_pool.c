@@ -0,0 +1,442 @@
+/*******************************************************************************
+* File Name: https_mem_pool.c
+*
+* Description: This file implements fixed-size block pools in static RAM and
+* installs them as the Mbed TLS calloc and free, so that TLS connections do
+* not fragment the heap over a long uptime.
+*
+* Related Document: See README.md
+********************************************************************************
+* Copyright 2024-2025, Cypress Semiconductor Corporation (an Infineon company) or
+* an affiliate of Cypress Semiconductor Corporation.  All rights reserved.
+*
+* This software, including source code, documentation and related
+* materials ("Software") is owned by Cypress Semiconductor Corporation
+* or one of its affiliates ("Cypress") and is protected by and subject to
+* worldwide patent protection (United States and foreign),
+* United States copyright laws and international treaty provisions.
+* Therefore, you may use this Software only as provided in the license
+* agreement accompanying the software package from which you
+* obtained this Software ("EULA").
+* If no EULA applies, Cypress hereby grants you a personal, non-exclusive,
+* non-transferable license to copy, modify, and compile the Software
+* source code solely for use in connection with Cypress's
+* integrated circuit products.  Any reproduction, modification, translation,
+* compilation, or representation of this Software except as specified
+* above is prohibited without the express written permission of Cypress.
+*
+* Disclaimer: THIS SOFTWARE IS PROVIDED AS-IS, WITH NO WARRANTY OF ANY KIND,
+* EXPRESS OR IMPLIED, INCLUDING, BUT NOT LIMITED TO, NONINFRINGEMENT, IMPLIED
+* WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE. Cypress
+* reserves the right to make changes to the Software without notice. Cypress
+* does not assume any liability arising out of the application or use of the
+* Software or any product or circuit described in the Software. Cypress does
+* not authorize its products for use in any products where a malfunction or
+* failure of the Cypress product may reasonably be expected to result in
+* significant property damage, injury or death ("High Risk Product"). By
+* including Cypress's product in a High Risk Product, the manufacturer
+* of such system or application assumes all risk of such use and in doing
+* so agrees to indemnify Cypress against all liability.
+*******************************************************************************/
+
+/*******************************************************************************
+* Header Files
+*******************************************************************************/
+#include "https_mem_pool.h"
+#include "https_client_pool.h"
+#include "https_async.h"
+#include "app_log.h"
+#include "mbedtls/platform.h"
+#include "mbedtls/ssl.h"
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+/* FreeRTOS header file */
+#include <FreeRTOS.h>
+#include <task.h>
+
+/*******************************************************************************
+* Macros
+*******************************************************************************/
+
+/* Largest TLS record buffer Mbed TLS allocates with this configuration. */
+#if (MBEDTLS_SSL_IN_CONTENT_LEN > MBEDTLS_SSL_OUT_CONTENT_LEN)
+#define RECORD_CONTENT_LEN                           (MBEDTLS_SSL_IN_CONTENT_LEN)
+#else
+#define RECORD_CONTENT_LEN                           (MBEDTLS_SSL_OUT_CONTENT_LEN)
+#endif
+
+/* Blocks are multiples of this, so every block is aligned for any type. */
+#define BLOCK_ALIGN                                  (sizeof(uint64_t))
+#define RECORD_BLOCK_SIZE                            \
+        ((((uint32_t) RECORD_CONTENT_LEN + HTTPS_MEM_POOL_RECORD_OVERHEAD) + \
+          (BLOCK_ALIGN - 1U)) & ~(BLOCK_ALIGN - 1U))
+
+/* Every TLS connection that can be open at once holds two record buffers:
+ * the pooled clients, the streaming connection and the event loop ones.
+ */
+#if (HTTPS_MEM_POOL_RECORD_BLOCKS < \
+     (2U * (HTTPS_POOL_SIZE + 1U + HTTPS_ASYNC_CONNECTIONS)))
+#error "HTTPS_MEM_POOL_RECORD_BLOCKS is too small for the TLS connections"
+#endif
+
+/* Spare blocks suggested over the peak of a class, as a fraction of it. */
+#define SPARE_DIVISOR                                (4U)
+
+/* Static storage of a size class. */
+#define POOL_ARENA(name, block_size, blocks)                                   \
+        static uint64_t name[((block_size) * (blocks)) / BLOCK_ALIGN]
+
+#define POOL_CLASS(arena, block_size, blocks)                                  \
+        { #blocks, (uint8_t *) (arena), (block_size), (blocks), NULL,          \
+          0U, 0U, 0U, 0U }
+
+/*******************************************************************************
+* Data Types
+*******************************************************************************/
+
+/* Free blocks are chained through their first word. */
+typedef struct pool_block
+{
+    struct pool_block *next;
+} pool_block_t;
+
+/* Size class: an arena of equal blocks and the list of free ones. */
+typedef struct
+{
+    const char *count_name;
+    uint8_t *arena;
+    uint32_t block_size;
+    uint32_t block_count;
+    pool_block_t *free_list;
+    uint32_t in_use;
+    uint32_t peak;
+    uint32_t allocs;
+    uint32_t exhausted;
+} pool_class_t;
+
+/*******************************************************************************
+* Global Variables
+********************************************************************************/
+POOL_ARENA(arena_32, 32U, HTTPS_MEM_POOL_BLOCKS_32);
+POOL_ARENA(arena_64, 64U, HTTPS_MEM_POOL_BLOCKS_64);
+POOL_ARENA(arena_128, 128U, HTTPS_MEM_POOL_BLOCKS_128);
+POOL_ARENA(arena_256, 256U, HTTPS_MEM_POOL_BLOCKS_256);
+POOL_ARENA(arena_512, 512U, HTTPS_MEM_POOL_BLOCKS_512);
+POOL_ARENA(arena_1k, 1024U, HTTPS_MEM_POOL_BLOCKS_1K);
+POOL_ARENA(arena_2k, 2048U, HTTPS_MEM_POOL_BLOCKS_2K);
+POOL_ARENA(arena_4k, 4096U, HTTPS_MEM_POOL_BLOCKS_4K);
+POOL_ARENA(arena_record, RECORD_BLOCK_SIZE, HTTPS_MEM_POOL_RECORD_BLOCKS);
+
+/* Classes in ascending block size. */
+static pool_class_t pool_classes[] =
+{
+    POOL_CLASS(arena_32, 32U, HTTPS_MEM_POOL_BLOCKS_32),
+    POOL_CLASS(arena_64, 64U, HTTPS_MEM_POOL_BLOCKS_64),
+    POOL_CLASS(arena_128, 128U, HTTPS_MEM_POOL_BLOCKS_128),
+    POOL_CLASS(arena_256, 256U, HTTPS_MEM_POOL_BLOCKS_256),
+    POOL_CLASS(arena_512, 512U, HTTPS_MEM_POOL_BLOCKS_512),
+    POOL_CLASS(arena_1k, 1024U, HTTPS_MEM_POOL_BLOCKS_1K),
+    POOL_CLASS(arena_2k, 2048U, HTTPS_MEM_POOL_BLOCKS_2K),
+    POOL_CLASS(arena_4k, 4096U, HTTPS_MEM_POOL_BLOCKS_4K),
+    POOL_CLASS(arena_record, RECORD_BLOCK_SIZE, HTTPS_MEM_POOL_RECORD_BLOCKS)
+};
+
+#define POOL_CLASS_COUNT                                                       \
+        ((uint32_t) (sizeof(pool_classes) / sizeof(pool_classes[0])))
+
+static https_mem_fallback_stats_t fallback_stats;
+
+/*******************************************************************************
+* Function Definitions
+*******************************************************************************/
+
+/*******************************************************************************
+* Function Name: https_mem_pool_init
+********************************************************************************
+* Summary:
+*  Chains the blocks of every class into its free list and installs the
+*  pools as the Mbed TLS allocator. Must run before the first TLS or PSA
+*  crypto call; blocks Mbed TLS got from the heap earlier are still freed
+*  to the heap.
+*
+* Parameters:
+*  void
+*
+* Return:
+*  cy_rslt_t: CY_RSLT_SUCCESS if the allocator was installed.
+*
+*******************************************************************************/
+cy_rslt_t https_mem_pool_init(void)
+{
+    for (uint32_t i = 0U; i < POOL_CLASS_COUNT; i++)
+    {
+        pool_class_t *pool = &pool_classes[i];
+
+        pool->free_list = NULL;
+        for (uint32_t j = pool->block_count; j > 0U; j--)
+        {
+            pool_block_t *block = (pool_block_t *)
+                    &pool->arena[(j - 1U) * pool->block_size];
+
+            block->next = pool->free_list;
+            pool->free_list = block;
+        }
+    }
+
+#if defined(MBEDTLS_PLATFORM_MEMORY)
+    return (0 == mbedtls_platform_set_calloc_free(https_mem_pool_calloc,
+                                                  https_mem_pool_free)) ?
+           CY_RSLT_SUCCESS : CY_RSLT_TYPE_ERROR;
+#else
+    /* Without MBEDTLS_PLATFORM_MEMORY, Mbed TLS calls calloc and free
+     * directly.
+     */
+    return CY_RSLT_TYPE_ERROR;
+#endif /* defined(MBEDTLS_PLATFORM_MEMORY) */
+}
+
+/*******************************************************************************
+* Function Name: https_mem_pool_calloc
+********************************************************************************
+* Summary:
+*  Allocates zeroed memory from the smallest class that fits and has a free
+*  block, in constant time. A full class is counted as exhausted and the
+*  next larger one is tried.
+*
+* Parameters:
+*  count - Number of elements
+*  size  - Size of one element
+*
+* Return:
+*  void *: The memory, or NULL if no class and no fallback could hold it.
+*
+*******************************************************************************/
+void *https_mem_pool_calloc(size_t count, size_t size)
+{
+    pool_block_t *block = NULL;
+    size_t total;
+
+    if ((0U == count) || (0U == size) || (count > (SIZE_MAX / size)))
+    {
+        return NULL;
+    }
+
+    total = count * size;
+
+    taskENTER_CRITICAL();
+    for (uint32_t i = 0U; (NULL == block) && (i < POOL_CLASS_COUNT); i++)
+    {
+        pool_class_t *pool = &pool_classes[i];
+
+        if (total > pool->block_size)
+        {
+            continue;
+        }
+
+        if (NULL == pool->free_list)
+        {
+            pool->exhausted++;
+            continue;
+        }
+
+        block = pool->free_list;
+        pool->free_list = block->next;
+        pool->allocs++;
+        pool->in_use++;
+
+        if (pool->in_use > pool->peak)
+        {
+            pool->peak = pool->in_use;
+        }
+    }
+    taskEXIT_CRITICAL();
+
+    if (NULL != block)
+    {
+        (void) memset(block, 0, total);
+        return block;
+    }
+
+#if (HTTPS_MEM_POOL_HEAP_FALLBACK)
+    block = calloc(count, size);
+#endif /* HTTPS_MEM_POOL_HEAP_FALLBACK */
+
+    taskENTER_CRITICAL();
+    if (NULL != block)
+    {
+        fallback_stats.allocs++;
+        fallback_stats.in_use++;
+
+        if (fallback_stats.in_use > fallback_stats.peak)
+        {
+            fallback_stats.peak = fallback_stats.in_use;
+        }
+
+        if (total > fallback_stats.largest)
+        {
+            fallback_stats.largest = (uint32_t) total;
+        }
+    }
+    else
+    {
+        fallback_stats.failures++;
+    }
+    taskEXIT_CRITICAL();
+
+    return block;
+}
+
+/*******************************************************************************
+* Function Name: https_mem_pool_free
+********************************************************************************
+* Summary:
+*  Returns a block to the class whose arena holds it, in constant time.
+*  Memory from outside the arenas goes back to the heap.
+*
+*******************************************************************************/
+void https_mem_pool_free(void *ptr)
+{
+    const uint8_t *address = (const uint8_t *) ptr;
+
+    if (NULL == ptr)
+    {
+        return;
+    }
+
+    for (uint32_t i = 0U; i < POOL_CLASS_COUNT; i++)
+    {
+        pool_class_t *pool = &pool_classes[i];
+
+        if ((address >= pool->arena) &&
+            (address < &pool->arena[pool->block_count * pool->block_size]))
+        {
+            pool_block_t *block = (pool_block_t *) ptr;
+
+            taskENTER_CRITICAL();
+            block->next = pool->free_list;
+            pool->free_list = block;
+            pool->in_use--;
+            taskEXIT_CRITICAL();
+            return;
+        }
+    }
+
+    free(ptr);
+
+    taskENTER_CRITICAL();
+    if (fallback_stats.in_use > 0U)
+    {
+        fallback_stats.in_use--;
+    }
+    taskEXIT_CRITICAL();
+}
+
+/*******************************************************************************
+* Function Name: https_mem_pool_class_count
+********************************************************************************
+* Summary:
+*  Returns the number of size classes.
+*
+*******************************************************************************/
+uint32_t https_mem_pool_class_count(void)
+{
+    return POOL_CLASS_COUNT;
+}
+
+/*******************************************************************************
+* Function Name: https_mem_pool_get_stats
+********************************************************************************
+* Summary:
+*  Returns the counters of one size class.
+*
+*******************************************************************************/
+void https_mem_pool_get_stats(uint32_t index, https_mem_class_stats_t *stats)
+{
+    (void) memset(stats, 0, sizeof(*stats));
+
+    if (index < POOL_CLASS_COUNT)
+    {
+        const pool_class_t *pool = &pool_classes[index];
+
+        taskENTER_CRITICAL();
+        stats->block_size = pool->block_size;
+        stats->block_count = pool->block_count;
+        stats->in_use = pool->in_use;
+        stats->peak = pool->peak;
+        stats->allocs = pool->allocs;
+        stats->exhausted = pool->exhausted;
+        taskEXIT_CRITICAL();
+    }
+}
+
+/*******************************************************************************
+* Function Name: https_mem_pool_get_fallback_stats
+********************************************************************************
+* Summary:
+*  Returns the counters of the allocations no class could hold.
+*
+*******************************************************************************/
+void https_mem_pool_get_fallback_stats(https_mem_fallback_stats_t *stats)
+{
+    taskENTER_CRITICAL();
+    *stats = fallback_stats;
+    taskEXIT_CRITICAL();
+}
+
+/*******************************************************************************
+* Function Name: https_mem_pool_print_stats
+********************************************************************************
+* Summary:
+*  Prints each class with its blocks in use and its peak, the reserved RAM
+*  and the RAM the peaks needed, and the pool misses. While nothing missed,
+*  the reserved RAM is the worst-case footprint of Mbed TLS. The block
+*  counts sized from the peaks follow, ready to paste into https_mem_pool.h.
+*
+*******************************************************************************/
+void https_mem_pool_print_stats(void)
+{
+    https_mem_class_stats_t stats;
+    https_mem_fallback_stats_t fallback;
+    uint32_t reserved = 0U;
+    uint32_t peak_bytes = 0U;
+
+    for (uint32_t i = 0U; i < POOL_CLASS_COUNT; i++)
+    {
+        https_mem_pool_get_stats(i, &stats);
+        reserved += stats.block_size * stats.block_count;
+        peak_bytes += stats.block_size * stats.peak;
+
+        app_log_printf("  %5lu B x %3lu in use:[%lu] peak:[%lu] allocs:[%lu]"
+               " exhausted:[%lu]\n",
+               (unsigned long) stats.block_size,
+               (unsigned long) stats.block_count,
+               (unsigned long) stats.in_use, (unsigned long) stats.peak,
+               (unsigned long) stats.allocs, (unsigned long) stats.exhausted);
+    }
+
+    https_mem_pool_get_fallback_stats(&fallback);
+
+    app_log_printf(" Pools reserved:[%lu] peak:[%lu] bytes\n",
+           (unsigned long) reserved, (unsigned long) peak_bytes);
+    app_log_printf(" Pool misses:[%lu] from heap:[%lu] heap in use:[%lu]"
+           " heap peak:[%lu] largest:[%lu] failed:[%lu]\n",
+           (unsigned long) (fallback.allocs + fallback.failures),
+           (unsigned long) fallback.allocs, (unsigned long) fallback.in_use,
+           (unsigned long) fallback.peak, (unsigned long) fallback.largest,
+           (unsigned long) fallback.failures);
+
+    app_log_printf(" Block counts from the peaks:\n");
+    for (uint32_t i = 0U; i < POOL_CLASS_COUNT; i++)
+    {
+        https_mem_pool_get_stats(i, &stats);
+
+        app_log_printf("  #define %-40s (%luU)\n", pool_classes[i].count_name,
+               (unsigned long) (stats.peak + 1U +
+                                (stats.peak / SPARE_DIVISOR)));
+    }
+}
+
+
+/* [] END OF FILE */
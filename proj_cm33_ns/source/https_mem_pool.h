@@ -0,0 +1,136 @@
+/*******************************************************************************
+* File Name: https_mem_pool.h
+*
+* Description: This file contains the structures, constants and function
+* prototypes of the size-class memory pools used by Mbed TLS.
+*
+* Related Document: See README.md
+********************************************************************************
+* Copyright 2024-2025, Cypress Semiconductor Corporation (an Infineon company) or
+* an affiliate of Cypress Semiconductor Corporation.  All rights reserved.
+*
+* This software, including source code, documentation and related
+* materials ("Software") is owned by Cypress Semiconductor Corporation
+* or one of its affiliates ("Cypress") and is protected by and subject to
+* worldwide patent protection (United States and foreign),
+* United States copyright laws and international treaty provisions.
+* Therefore, you may use this Software only as provided in the license
+* agreement accompanying the software package from which you
+* obtained this Software ("EULA").
+* If no EULA applies, Cypress hereby grants you a personal, non-exclusive,
+* non-transferable license to copy, modify, and compile the Software
+* source code solely for use in connection with Cypress's
+* integrated circuit products.  Any reproduction, modification, translation,
+* compilation, or representation of this Software except as specified
+* above is prohibited without the express written permission of Cypress.
+*
+* Disclaimer: THIS SOFTWARE IS PROVIDED AS-IS, WITH NO WARRANTY OF ANY KIND,
+* EXPRESS OR IMPLIED, INCLUDING, BUT NOT LIMITED TO, NONINFRINGEMENT, IMPLIED
+* WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE. Cypress
+* reserves the right to make changes to the Software without notice. Cypress
+* does not assume any liability arising out of the application or use of the
+* Software or any product or circuit described in the Software. Cypress does
+* not authorize its products for use in any products where a malfunction or
+* failure of the Cypress product may reasonably be expected to result in
+* significant property damage, injury or death ("High Risk Product"). By
+* including Cypress's product in a High Risk Product, the manufacturer
+* of such system or application assumes all risk of such use and in doing
+* so agrees to indemnify Cypress against all liability.
+*******************************************************************************/
+
+/*******************************************************************************
+* Include guard
+*******************************************************************************/
+#ifndef HTTPS_MEM_POOL_H_
+#define HTTPS_MEM_POOL_H_
+
+/*******************************************************************************
+* Header Files
+*******************************************************************************/
+#include <stdint.h>
+#include <stddef.h>
+#include <stdbool.h>
+#include "cy_result.h"
+
+/*******************************************************************************
+* Macros
+*******************************************************************************/
+
+/* Blocks reserved in each size class. Mbed TLS allocates many small
+ * objects during a handshake (big numbers, X.509 fields) and the two TLS
+ * record buffers of every connection, which get a class of their own.
+ * https_mem_pool_print_stats prints the peaks and these defines sized from
+ * them with a quarter to spare; copy them here after running the workloads
+ * with HTTPS_MEM_POOL_HEAP_FALLBACK set. The classes below reserve 102400
+ * bytes of static RAM.
+ */
+#define HTTPS_MEM_POOL_BLOCKS_32                 (128U)
+#define HTTPS_MEM_POOL_BLOCKS_64                 (128U)
+#define HTTPS_MEM_POOL_BLOCKS_128                (96U)
+#define HTTPS_MEM_POOL_BLOCKS_256                (48U)
+#define HTTPS_MEM_POOL_BLOCKS_512                (32U)
+#define HTTPS_MEM_POOL_BLOCKS_1K                 (16U)
+#define HTTPS_MEM_POOL_BLOCKS_2K                 (8U)
+#define HTTPS_MEM_POOL_BLOCKS_4K                 (4U)
+
+/* Record buffers: one input and one output buffer per TLS connection, for
+ * the pooled clients, the streaming connection and the event loop
+ * connection. Each takes MBEDTLS_SSL_IN_CONTENT_LEN plus the overhead below,
+ * 16896 bytes with the default 16 KB records, so 135168 bytes in total.
+ */
+#define HTTPS_MEM_POOL_RECORD_BLOCKS             (8U)
+
+/* Bytes a TLS record buffer needs beyond its content: the record header,
+ * the explicit IV, the MAC and the padding.
+ */
+#define HTTPS_MEM_POOL_RECORD_OVERHEAD           (512U)
+
+/* Allocations that no class can hold are pool misses. With 0 they fail,
+ * which Mbed TLS reports as an allocation error. Set to 1 while sizing the
+ * classes to serve the misses from the C library heap instead; they are
+ * still counted as misses.
+ */
+#define HTTPS_MEM_POOL_HEAP_FALLBACK             (0)
+
+/*******************************************************************************
+* Data Types
+*******************************************************************************/
+
+/* Counters of one size class. */
+typedef struct
+{
+    uint32_t block_size;
+    uint32_t block_count;
+    uint32_t in_use;
+    uint32_t peak;
+    uint32_t allocs;
+    uint32_t exhausted;
+} https_mem_class_stats_t;
+
+/* Pool misses: allocations no class could hold, served from the heap or
+ * failed.
+ */
+typedef struct
+{
+    uint32_t allocs;
+    uint32_t in_use;
+    uint32_t peak;
+    uint32_t largest;
+    uint32_t failures;
+} https_mem_fallback_stats_t;
+
+/*******************************************************************************
+* Function Prototypes
+*******************************************************************************/
+cy_rslt_t https_mem_pool_init(void);
+void *https_mem_pool_calloc(size_t count, size_t size);
+void https_mem_pool_free(void *ptr);
+uint32_t https_mem_pool_class_count(void);
+void https_mem_pool_get_stats(uint32_t index, https_mem_class_stats_t *stats);
+void https_mem_pool_get_fallback_stats(https_mem_fallback_stats_t *stats);
+void https_mem_pool_print_stats(void);
+
+#endif /* HTTPS_MEM_POOL_H_ */
+
+
+/* [] END OF FILE */
@@ -0,0 +1,725 @@
+/*******************************************************************************
+* File Name: https_metrics.c
+*
+* Description: This file keeps always-on latency histograms of the stages of
+* every HTTPS request and the byte counters, in fixed RAM, and exports them
+* as a table, a JSON document or a compact binary blob.
+*
+* Related Document: See README.md
+********************************************************************************
+* Copyright 2024-2025, Cypress Semiconductor Corporation (an Infineon company) or
+* an affiliate of Cypress Semiconductor Corporation.  All rights reserved.
+*
+* This software, including source code, documentation and related
+* materials ("Software") is owned by Cypress Semiconductor Corporation
+* or one of its affiliates ("Cypress") and is protected by and subject to
+* worldwide patent protection (United States and foreign),
+* United States copyright laws and international treaty provisions.
+* Therefore, you may use this Software only as provided in the license
+* agreement accompanying the software package from which you
+* obtained this Software ("EULA").
+* If no EULA applies, Cypress hereby grants you a personal, non-exclusive,
+* non-transferable license to copy, modify, and compile the Software
+* source code solely for use in connection with Cypress's
+* integrated circuit products.  Any reproduction, modification, translation,
+* compilation, or representation of this Software except as specified
+* above is prohibited without the express written permission of Cypress.
+*
+* Disclaimer: THIS SOFTWARE IS PROVIDED AS-IS, WITH NO WARRANTY OF ANY KIND,
+* EXPRESS OR IMPLIED, INCLUDING, BUT NOT LIMITED TO, NONINFRINGEMENT, IMPLIED
+* WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE. Cypress
+* reserves the right to make changes to the Software without notice. Cypress
+* does not assume any liability arising out of the application or use of the
+* Software or any product or circuit described in the Software. Cypress does
+* not authorize its products for use in any products where a malfunction or
+* failure of the Cypress product may reasonably be expected to result in
+* significant property damage, injury or death ("High Risk Product"). By
+* including Cypress's product in a High Risk Product, the manufacturer
+* of such system or application assumes all risk of such use and in doing
+* so agrees to indemnify Cypress against all liability.
+*******************************************************************************/
+
+/*******************************************************************************
+* Header Files
+*******************************************************************************/
+#include "https_metrics.h"
+#include "app_log.h"
+#include "boot_trace.h"
+#include <stdio.h>
+#include <stdarg.h>
+#include <string.h>
+
+/* FreeRTOS header file */
+#include <FreeRTOS.h>
+#include <task.h>
+
+/*******************************************************************************
+* Macros
+*******************************************************************************/
+#define US_PER_MS                                    (1000U)
+#define US_PER_SEC                                   (1000000U)
+#define BYTES_PER_KB                                 (1024U)
+#define PERCENT_SCALE                                (100U)
+#define PERCENTILE_50                                (50U)
+#define PERCENTILE_90                                (90U)
+#define PERCENTILE_99                                (99U)
+
+/* Bytes of the binary export printed per line. */
+#define HEX_BYTES_PER_LINE                           (32U)
+
+/* Digits of the largest uint64_t and the terminator. */
+#define U64_DIGITS                                   (21U)
+#define DECIMAL_BASE                                 (10U)
+
+/*******************************************************************************
+* Data Types
+*******************************************************************************/
+
+/* Destination of the binary export: a buffer, or hex on the debug UART. */
+typedef struct
+{
+    uint8_t *buffer;
+    uint32_t size;
+    uint32_t length;
+    bool print;
+} metrics_encoder_t;
+
+/*******************************************************************************
+* Global Variables
+********************************************************************************/
+static https_histogram_t histograms[HTTPS_METRIC_COUNT];
+static https_metrics_counters_t counters;
+
+/* Copy of one histogram taken for the binary export. */
+static https_histogram_t export_snapshot;
+
+static char json_buffer[HTTPS_METRICS_JSON_MAX];
+
+static const char * const metric_names[HTTPS_METRIC_COUNT] =
+{
+    "dns",
+    "connect",
+    "send",
+    "first_byte",
+    "complete"
+};
+
+/*******************************************************************************
+* Function Definitions
+*******************************************************************************/
+
+/*******************************************************************************
+* Function Name: bucket_index
+********************************************************************************
+* Summary:
+*  Returns the histogram bucket of a latency. The top
+*  HTTPS_METRICS_SUB_BUCKET_BITS + 1 bits of the value select the bucket
+*  within its power of two.
+*
+*******************************************************************************/
+static uint32_t bucket_index(uint32_t value_us)
+{
+    uint32_t shift = 0U;
+
+    if (value_us < HTTPS_METRICS_SUB_BUCKETS)
+    {
+        return value_us;
+    }
+
+    while ((value_us >> shift) >= (2U * HTTPS_METRICS_SUB_BUCKETS))
+    {
+        shift++;
+    }
+
+    if (shift > (HTTPS_METRICS_MAX_EXPONENT - HTTPS_METRICS_SUB_BUCKET_BITS))
+    {
+        return HTTPS_METRICS_BUCKETS - 1U;
+    }
+
+    return (shift * HTTPS_METRICS_SUB_BUCKETS) + (value_us >> shift);
+}
+
+/*******************************************************************************
+* Function Name: bucket_upper
+********************************************************************************
+* Summary:
+*  Returns the largest latency counted in a bucket.
+*
+*******************************************************************************/
+static uint32_t bucket_upper(uint32_t index)
+{
+    uint32_t shift;
+    uint32_t top;
+
+    if (index < HTTPS_METRICS_SUB_BUCKETS)
+    {
+        return index;
+    }
+
+    shift = (index - HTTPS_METRICS_SUB_BUCKETS) / HTTPS_METRICS_SUB_BUCKETS;
+    top = index - (shift * HTTPS_METRICS_SUB_BUCKETS);
+
+    return ((top + 1U) << shift) - 1U;
+}
+
+/*******************************************************************************
+* Function Name: percentile
+********************************************************************************
+* Summary:
+*  Returns the given percentile of a histogram using the nearest-rank
+*  method, as the upper bound of its bucket but no more than the maximum.
+*
+*******************************************************************************/
+static uint32_t percentile(const https_histogram_t *histogram, uint32_t pct)
+{
+    uint32_t rank = ((pct * histogram->count) + (PERCENT_SCALE - 1U)) /
+                    PERCENT_SCALE;
+    uint32_t seen = 0U;
+
+    if (0U == rank)
+    {
+        rank = 1U;
+    }
+
+    for (uint32_t i = 0U; i < HTTPS_METRICS_BUCKETS; i++)
+    {
+        seen += histogram->buckets[i];
+
+        if (seen >= rank)
+        {
+            uint32_t upper = bucket_upper(i);
+
+            return (upper < histogram->max_us) ? upper : histogram->max_us;
+        }
+    }
+
+    return histogram->max_us;
+}
+
+/*******************************************************************************
+* Function Name: https_metrics_elapsed_us
+********************************************************************************
+* Summary:
+*  Returns the microseconds since a stamp. The cycle counter is used while
+*  it cannot have wrapped, the tick count after that.
+*
+*******************************************************************************/
+uint32_t https_metrics_elapsed_us(const https_metrics_stamp_t *start)
+{
+    uint32_t rate = boot_trace_cycles_per_us();
+    uint32_t elapsed_ms = (uint32_t) pdTICKS_TO_MS(xTaskGetTickCount() -
+                                                   start->ticks);
+    uint32_t wrap_ms = (UINT32_MAX / rate) / US_PER_MS;
+
+    if (elapsed_ms < (wrap_ms / 2U))
+    {
+        return (boot_trace_timestamp() - start->cycles) / rate;
+    }
+
+    return (elapsed_ms < (UINT32_MAX / US_PER_MS)) ?
+           (elapsed_ms * US_PER_MS) : UINT32_MAX;
+}
+
+/*******************************************************************************
+* Function Name: https_histogram_add
+********************************************************************************
+* Summary:
+*  Adds a latency to a histogram.
+*
+* Parameters:
+*  histogram - Histogram to update
+*  value_us  - Latency in microseconds
+*
+* Return:
+*  void
+*
+*******************************************************************************/
+void https_histogram_add(https_histogram_t *histogram, uint32_t value_us)
+{
+    taskENTER_CRITICAL();
+    if ((0U == histogram->count) || (value_us < histogram->min_us))
+    {
+        histogram->min_us = value_us;
+    }
+
+    if (value_us > histogram->max_us)
+    {
+        histogram->max_us = value_us;
+    }
+
+    histogram->count++;
+    histogram->total_us += value_us;
+    histogram->buckets[bucket_index(value_us)]++;
+    taskEXIT_CRITICAL();
+}
+
+/*******************************************************************************
+* Function Name: https_histogram_get_summary
+********************************************************************************
+* Summary:
+*  Returns the count, the extremes, the mean and the percentiles of a
+*  histogram.
+*
+*******************************************************************************/
+void https_histogram_get_summary(const https_histogram_t *histogram,
+                                 https_metrics_summary_t *summary)
+{
+    (void) memset(summary, 0, sizeof(*summary));
+
+    taskENTER_CRITICAL();
+    if (0U != histogram->count)
+    {
+        summary->count = histogram->count;
+        summary->min_us = histogram->min_us;
+        summary->max_us = histogram->max_us;
+        summary->mean_us = (uint32_t) (histogram->total_us /
+                                       histogram->count);
+        summary->p50_us = percentile(histogram, PERCENTILE_50);
+        summary->p90_us = percentile(histogram, PERCENTILE_90);
+        summary->p99_us = percentile(histogram, PERCENTILE_99);
+    }
+    taskEXIT_CRITICAL();
+}
+
+/*******************************************************************************
+* Function Name: https_metrics_stamp
+********************************************************************************
+* Summary:
+*  Marks the start of a timed stage.
+*
+*******************************************************************************/
+void https_metrics_stamp(https_metrics_stamp_t *stamp)
+{
+    stamp->ticks = xTaskGetTickCount();
+    stamp->cycles = boot_trace_timestamp();
+}
+
+/*******************************************************************************
+* Function Name: https_metrics_record
+********************************************************************************
+* Summary:
+*  Records the time from a stamp to now as a latency of the given stage.
+*
+* Parameters:
+*  metric - Stage that ended
+*  start  - Stamp taken when it started
+*
+* Return:
+*  void
+*
+*******************************************************************************/
+void https_metrics_record(https_metric_t metric,
+                          const https_metrics_stamp_t *start)
+{
+    if (metric < HTTPS_METRIC_COUNT)
+    {
+        https_histogram_add(&histograms[metric],
+                            https_metrics_elapsed_us(start));
+    }
+}
+
+/*******************************************************************************
+* Function Name: https_metrics_request_done
+********************************************************************************
+* Summary:
+*  Counts a finished request. A successful one also records its
+*  HTTPS_METRIC_COMPLETE latency.
+*
+* Parameters:
+*  result - Result of the request
+*  start  - Stamp taken when the request was sent
+*
+* Return:
+*  void
+*
+*******************************************************************************/
+void https_metrics_request_done(cy_rslt_t result,
+                                const https_metrics_stamp_t *start)
+{
+    if (CY_RSLT_SUCCESS == result)
+    {
+        https_histogram_add(&histograms[HTTPS_METRIC_COMPLETE],
+                            https_metrics_elapsed_us(start));
+    }
+
+    taskENTER_CRITICAL();
+    counters.requests++;
+    if (CY_RSLT_SUCCESS != result)
+    {
+        counters.failures++;
+    }
+    taskEXIT_CRITICAL();
+}
+
+/*******************************************************************************
+* Function Name: https_metrics_add_bytes
+********************************************************************************
+* Summary:
+*  Counts the bytes sent and received on the connections.
+*
+*******************************************************************************/
+void https_metrics_add_bytes(uint32_t sent, uint32_t received)
+{
+    taskENTER_CRITICAL();
+    counters.bytes_sent += sent;
+    counters.bytes_received += received;
+    taskEXIT_CRITICAL();
+}
+
+/*******************************************************************************
+* Function Name: https_metrics_get_summary
+********************************************************************************
+* Summary:
+*  Returns the count, the extremes, the mean and the percentiles of a stage.
+*
+*******************************************************************************/
+void https_metrics_get_summary(https_metric_t metric,
+                               https_metrics_summary_t *summary)
+{
+    https_histogram_get_summary(&histograms[metric], summary);
+}
+
+/*******************************************************************************
+* Function Name: https_metrics_get_counters
+********************************************************************************
+* Summary:
+*  Returns a copy of the request and byte counters.
+*
+*******************************************************************************/
+void https_metrics_get_counters(https_metrics_counters_t *out)
+{
+    taskENTER_CRITICAL();
+    *out = counters;
+    taskEXIT_CRITICAL();
+}
+
+/*******************************************************************************
+* Function Name: put_bytes
+********************************************************************************
+* Summary:
+*  Appends bytes to the binary export. Bytes past the end of the buffer are
+*  counted but not stored.
+*
+*******************************************************************************/
+static void put_bytes(metrics_encoder_t *encoder, const uint8_t *data,
+                      uint32_t len)
+{
+    for (uint32_t i = 0U; i < len; i++)
+    {
+        if (encoder->print)
+        {
+            if (0U == (encoder->length % HEX_BYTES_PER_LINE))
+            {
+                app_log_printf("%sHM:", (0U == encoder->length) ? "" : "\n");
+            }
+
+            app_log_printf("%02X", (unsigned int) data[i]);
+        }
+        else if (encoder->length < encoder->size)
+        {
+            encoder->buffer[encoder->length] = data[i];
+        }
+        else
+        {
+            /* Only the required size is counted. */
+        }
+
+        encoder->length++;
+    }
+}
+
+/*******************************************************************************
+* Function Name: put_uint
+********************************************************************************
+* Summary:
+*  Appends an unsigned integer of the given size in little-endian order.
+*
+*******************************************************************************/
+static void put_uint(metrics_encoder_t *encoder, uint64_t value,
+                     uint32_t size)
+{
+    uint8_t bytes[sizeof(uint64_t)];
+
+    for (uint32_t i = 0U; i < size; i++)
+    {
+        bytes[i] = (uint8_t) (value >> (8U * i));
+    }
+
+    put_bytes(encoder, bytes, size);
+}
+
+/*******************************************************************************
+* Function Name: encode_metrics
+********************************************************************************
+* Summary:
+*  Writes the binary export: a header, the counters, then per stage its
+*  count, minimum, maximum and total followed by the non-empty buckets as
+*  index and count pairs. Integers are little-endian and unaligned.
+*
+*******************************************************************************/
+static void encode_metrics(metrics_encoder_t *encoder)
+{
+    https_metrics_counters_t snapshot;
+    uint32_t used;
+
+    https_metrics_get_counters(&snapshot);
+
+    put_uint(encoder, HTTPS_METRICS_MAGIC, sizeof(uint32_t));
+    put_uint(encoder, HTTPS_METRICS_VERSION, sizeof(uint8_t));
+    put_uint(encoder, HTTPS_METRIC_COUNT, sizeof(uint8_t));
+    put_uint(encoder, HTTPS_METRICS_SUB_BUCKET_BITS, sizeof(uint8_t));
+    put_uint(encoder, HTTPS_METRICS_BUCKETS, sizeof(uint8_t));
+    put_uint(encoder, snapshot.requests, sizeof(uint32_t));
+    put_uint(encoder, snapshot.failures, sizeof(uint32_t));
+    put_uint(encoder, snapshot.bytes_sent, sizeof(uint64_t));
+    put_uint(encoder, snapshot.bytes_received, sizeof(uint64_t));
+
+    for (uint32_t metric = 0U; metric < HTTPS_METRIC_COUNT; metric++)
+    {
+        taskENTER_CRITICAL();
+        export_snapshot = histograms[metric];
+        taskEXIT_CRITICAL();
+
+        used = 0U;
+        for (uint32_t i = 0U; i < HTTPS_METRICS_BUCKETS; i++)
+        {
+            used += (0U != export_snapshot.buckets[i]) ? 1U : 0U;
+        }
+
+        put_uint(encoder, export_snapshot.count, sizeof(uint32_t));
+        put_uint(encoder, export_snapshot.min_us, sizeof(uint32_t));
+        put_uint(encoder, export_snapshot.max_us, sizeof(uint32_t));
+        put_uint(encoder, export_snapshot.total_us, sizeof(uint64_t));
+        put_uint(encoder, used, sizeof(uint8_t));
+
+        for (uint32_t i = 0U; i < HTTPS_METRICS_BUCKETS; i++)
+        {
+            if (0U != export_snapshot.buckets[i])
+            {
+                put_uint(encoder, i, sizeof(uint8_t));
+                put_uint(encoder, export_snapshot.buckets[i],
+                         sizeof(uint32_t));
+            }
+        }
+    }
+}
+
+/*******************************************************************************
+* Function Name: https_metrics_export_binary
+********************************************************************************
+* Summary:
+*  Copies the histograms and counters in their compact binary form, which
+*  keeps every bucket so that exports of several devices can be merged. Call
+*  from one task at a time.
+*
+* Parameters:
+*  buffer - Destination, may be NULL to only get the size
+*  size   - Size of the destination in bytes
+*
+* Return:
+*  uint32_t: Size of the export. The buffer holds all of it only if this is
+*  not more than size.
+*
+*******************************************************************************/
+uint32_t https_metrics_export_binary(uint8_t *buffer, uint32_t size)
+{
+    metrics_encoder_t encoder =
+    {
+        .buffer = buffer,
+        .size = (NULL != buffer) ? size : 0U,
+        .length = 0U,
+        .print = false
+    };
+
+    encode_metrics(&encoder);
+
+    return encoder.length;
+}
+
+/*******************************************************************************
+* Function Name: format_u64
+********************************************************************************
+* Summary:
+*  Formats an unsigned 64-bit value in decimal, which the C library's
+*  printf may not support.
+*
+*******************************************************************************/
+static const char *format_u64(uint64_t value, char *text)
+{
+    uint32_t pos = U64_DIGITS - 1U;
+
+    text[pos] = '\0';
+
+    do
+    {
+        text[--pos] = (char) ('0' + (value % DECIMAL_BASE));
+        value /= DECIMAL_BASE;
+    } while ((0U != value) && (pos > 0U));
+
+    return &text[pos];
+}
+
+/*******************************************************************************
+* Function Name: append
+********************************************************************************
+* Summary:
+*  Appends formatted text to the JSON export and returns the new length,
+*  which stops growing once the buffer is full.
+*
+*******************************************************************************/
+static uint32_t append(char *buffer, uint32_t size, uint32_t pos,
+                       const char *format, ...)
+{
+    va_list args;
+    int written;
+
+    if (pos >= size)
+    {
+        return pos;
+    }
+
+    va_start(args, format);
+    written = vsnprintf(&buffer[pos], size - pos, format, args);
+    va_end(args);
+
+    if (written < 0)
+    {
+        return size;
+    }
+
+    return ((pos + (uint32_t) written) < size) ?
+           (pos + (uint32_t) written) : size;
+}
+
+/*******************************************************************************
+* Function Name: https_metrics_export_json
+********************************************************************************
+* Summary:
+*  Writes the counters and the summary of every stage as one line of JSON.
+*  Latencies are in microseconds.
+*
+* Parameters:
+*  buffer - Destination
+*  size   - Size of the destination, HTTPS_METRICS_JSON_MAX is enough
+*
+* Return:
+*  uint32_t: Length of the JSON text, or 0 if it did not fit.
+*
+*******************************************************************************/
+uint32_t https_metrics_export_json(char *buffer, uint32_t size)
+{
+    https_metrics_counters_t snapshot;
+    https_metrics_summary_t summary;
+    char sent[U64_DIGITS];
+    char received[U64_DIGITS];
+    uint32_t pos;
+
+    https_metrics_get_counters(&snapshot);
+
+    pos = append(buffer, size, 0U,
+            "{\"requests\":%lu,\"failures\":%lu,\"bytes_sent\":%s,"
+            "\"bytes_received\":%s,\"latency_us\":{",
+            (unsigned long) snapshot.requests,
+            (unsigned long) snapshot.failures,
+            format_u64(snapshot.bytes_sent, sent),
+            format_u64(snapshot.bytes_received, received));
+
+    for (uint32_t metric = 0U; metric < HTTPS_METRIC_COUNT; metric++)
+    {
+        https_metrics_get_summary((https_metric_t) metric, &summary);
+        pos = append(buffer, size, pos,
+                "%s\"%s\":{\"count\":%lu,\"min\":%lu,\"mean\":%lu,"
+                "\"p50\":%lu,\"p90\":%lu,\"p99\":%lu,\"max\":%lu}",
+                (0U == metric) ? "" : ",", metric_names[metric],
+                (unsigned long) summary.count, (unsigned long) summary.min_us,
+                (unsigned long) summary.mean_us,
+                (unsigned long) summary.p50_us, (unsigned long) summary.p90_us,
+                (unsigned long) summary.p99_us,
+                (unsigned long) summary.max_us);
+    }
+
+    pos = append(buffer, size, pos, "}}");
+
+    return (pos < size) ? pos : 0U;
+}
+
+/*******************************************************************************
+* Function Name: https_metrics_print
+********************************************************************************
+* Summary:
+*  Prints the counters, the throughput over the time spent in requests, a
+*  line per stage and the JSON export on the debug UART.
+*
+*******************************************************************************/
+void https_metrics_print(void)
+{
+    https_metrics_counters_t snapshot;
+    https_metrics_summary_t summary;
+    char sent[U64_DIGITS];
+    char received[U64_DIGITS];
+    uint64_t busy_us;
+    uint32_t json_length;
+    uint32_t kb_per_sec = 0U;
+
+    https_metrics_get_counters(&snapshot);
+
+    taskENTER_CRITICAL();
+    busy_us = histograms[HTTPS_METRIC_COMPLETE].total_us;
+    taskEXIT_CRITICAL();
+
+    if (0U != busy_us)
+    {
+        kb_per_sec = (uint32_t) ((snapshot.bytes_received * US_PER_SEC) /
+                                 (busy_us * BYTES_PER_KB));
+    }
+
+    app_log_printf(" Requests:[%lu] failed:[%lu] sent:[%s] received:[%s] bytes"
+           " throughput:[%lu KB/s]\n",
+           (unsigned long) snapshot.requests,
+           (unsigned long) snapshot.failures,
+           format_u64(snapshot.bytes_sent, sent),
+           format_u64(snapshot.bytes_received, received),
+           (unsigned long) kb_per_sec);
+
+    for (uint32_t metric = 0U; metric < HTTPS_METRIC_COUNT; metric++)
+    {
+        https_metrics_get_summary((https_metric_t) metric, &summary);
+        app_log_printf("  %-10s count:[%lu] us min:[%lu] p50:[%lu] p90:[%lu]"
+               " p99:[%lu] max:[%lu]\n", metric_names[metric],
+               (unsigned long) summary.count, (unsigned long) summary.min_us,
+               (unsigned long) summary.p50_us, (unsigned long) summary.p90_us,
+               (unsigned long) summary.p99_us, (unsigned long) summary.max_us);
+    }
+
+    json_length = https_metrics_export_json(json_buffer, sizeof(json_buffer));
+    if (0U != json_length)
+    {
+        app_log_write(json_buffer, json_length);
+        app_log_printf("\n");
+    }
+}
+
+/*******************************************************************************
+* Function Name: https_metrics_print_binary
+********************************************************************************
+* Summary:
+*  Prints the binary export as lines of hex prefixed with "HM:", to be cut
+*  from the terminal log and decoded on the host.
+*
+*******************************************************************************/
+void https_metrics_print_binary(void)
+{
+    metrics_encoder_t encoder =
+    {
+        .buffer = NULL,
+        .size = 0U,
+        .length = 0U,
+        .print = true
+    };
+
+    encode_metrics(&encoder);
+    app_log_printf("\n");
+}
+
+
+/* [] END OF FILE */
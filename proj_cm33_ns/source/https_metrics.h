@@ -0,0 +1,170 @@
+/*******************************************************************************
+* File Name: https_metrics.h
+*
+* Description: This file contains the structures, constants and function
+* prototypes of the HTTPS request metrics.
+*
+* Related Document: See README.md
+********************************************************************************
+* Copyright 2024-2025, Cypress Semiconductor Corporation (an Infineon company) or
+* an affiliate of Cypress Semiconductor Corporation.  All rights reserved.
+*
+* This software, including source code, documentation and related
+* materials ("Software") is owned by Cypress Semiconductor Corporation
+* or one of its affiliates ("Cypress") and is protected by and subject to
+* worldwide patent protection (United States and foreign),
+* United States copyright laws and international treaty provisions.
+* Therefore, you may use this Software only as provided in the license
+* agreement accompanying the software package from which you
+* obtained this Software ("EULA").
+* If no EULA applies, Cypress hereby grants you a personal, non-exclusive,
+* non-transferable license to copy, modify, and compile the Software
+* source code solely for use in connection with Cypress's
+* integrated circuit products.  Any reproduction, modification, translation,
+* compilation, or representation of this Software except as specified
+* above is prohibited without the express written permission of Cypress.
+*
+* Disclaimer: THIS SOFTWARE IS PROVIDED AS-IS, WITH NO WARRANTY OF ANY KIND,
+* EXPRESS OR IMPLIED, INCLUDING, BUT NOT LIMITED TO, NONINFRINGEMENT, IMPLIED
+* WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE. Cypress
+* reserves the right to make changes to the Software without notice. Cypress
+* does not assume any liability arising out of the application or use of the
+* Software or any product or circuit described in the Software. Cypress does
+* not authorize its products for use in any products where a malfunction or
+* failure of the Cypress product may reasonably be expected to result in
+* significant property damage, injury or death ("High Risk Product"). By
+* including Cypress's product in a High Risk Product, the manufacturer
+* of such system or application assumes all risk of such use and in doing
+* so agrees to indemnify Cypress against all liability.
+*******************************************************************************/
+
+/*******************************************************************************
+* Include guard
+*******************************************************************************/
+#ifndef HTTPS_METRICS_H_
+#define HTTPS_METRICS_H_
+
+/*******************************************************************************
+* Header Files
+*******************************************************************************/
+#include <stdint.h>
+#include <stdbool.h>
+#include "FreeRTOS.h"
+#include "cy_result.h"
+
+/*******************************************************************************
+* Macros
+*******************************************************************************/
+
+/* Latencies are counted in microseconds in log-linear buckets: one bucket
+ * per value below 2^HTTPS_METRICS_SUB_BUCKET_BITS, then that many buckets
+ * per power of two, which keeps every bucket within 12.5% of its values.
+ * Values of 2^(HTTPS_METRICS_MAX_EXPONENT + 1) us (67 s) and more share the
+ * last bucket.
+ */
+#define HTTPS_METRICS_SUB_BUCKET_BITS            (3U)
+#define HTTPS_METRICS_SUB_BUCKETS                (1UL << \
+                                                  HTTPS_METRICS_SUB_BUCKET_BITS)
+#define HTTPS_METRICS_MAX_EXPONENT               (25U)
+#define HTTPS_METRICS_BUCKETS                    (HTTPS_METRICS_SUB_BUCKETS + \
+        ((HTTPS_METRICS_MAX_EXPONENT - HTTPS_METRICS_SUB_BUCKET_BITS + 1U) * \
+         HTTPS_METRICS_SUB_BUCKETS))
+
+/* First word and version of the binary export. */
+#define HTTPS_METRICS_MAGIC                      (0x54454D48U)
+#define HTTPS_METRICS_VERSION                    (1U)
+
+/* Size of the JSON export of all the metrics. */
+#define HTTPS_METRICS_JSON_MAX                   (1024U)
+
+/*******************************************************************************
+* Enumerations
+*******************************************************************************/
+
+/* Timed stages of a request. Requests made through the HTTP client library
+ * report HTTPS_METRIC_CONNECT, which includes its DNS lookup, and
+ * HTTPS_METRIC_COMPLETE only; the streaming connections report every stage.
+ */
+typedef enum
+{
+    HTTPS_METRIC_DNS,        /* Host name lookup */
+    HTTPS_METRIC_CONNECT,    /* TCP connect and TLS handshake */
+    HTTPS_METRIC_SEND,       /* Handing the request bytes to the socket */
+    HTTPS_METRIC_FIRST_BYTE, /* Request sent to first response byte */
+    HTTPS_METRIC_COMPLETE,   /* Request sent to end of the response */
+    HTTPS_METRIC_COUNT
+} https_metric_t;
+
+/*******************************************************************************
+* Data Types
+*******************************************************************************/
+
+/* Start of a timed stage. The cycle counter gives the resolution and the
+ * tick count covers stages longer than the counter's wrap period.
+ */
+typedef struct
+{
+    uint32_t cycles;
+    TickType_t ticks;
+} https_metrics_stamp_t;
+
+/* Summary of one stage, in microseconds. The percentiles are the upper
+ * bound of the bucket they fall in.
+ */
+typedef struct
+{
+    uint32_t count;
+    uint32_t min_us;
+    uint32_t max_us;
+    uint32_t mean_us;
+    uint32_t p50_us;
+    uint32_t p90_us;
+    uint32_t p99_us;
+} https_metrics_summary_t;
+
+/* Latency histogram. The metrics keep one per stage; other modules may keep
+ * their own with https_histogram_add.
+ */
+typedef struct
+{
+    uint32_t count;
+    uint32_t min_us;
+    uint32_t max_us;
+    uint64_t total_us;
+    uint32_t buckets[HTTPS_METRICS_BUCKETS];
+} https_histogram_t;
+
+/* Request and byte counters. */
+typedef struct
+{
+    uint32_t requests;
+    uint32_t failures;
+    uint64_t bytes_sent;
+    uint64_t bytes_received;
+} https_metrics_counters_t;
+
+/*******************************************************************************
+* Function Prototypes
+*******************************************************************************/
+void https_metrics_stamp(https_metrics_stamp_t *stamp);
+uint32_t https_metrics_elapsed_us(const https_metrics_stamp_t *start);
+void https_histogram_add(https_histogram_t *histogram, uint32_t value_us);
+void https_histogram_get_summary(const https_histogram_t *histogram,
+                                 https_metrics_summary_t *summary);
+void https_metrics_record(https_metric_t metric,
+                          const https_metrics_stamp_t *start);
+void https_metrics_request_done(cy_rslt_t result,
+                                const https_metrics_stamp_t *start);
+void https_metrics_add_bytes(uint32_t sent, uint32_t received);
+void https_metrics_get_summary(https_metric_t metric,
+                               https_metrics_summary_t *summary);
+void https_metrics_get_counters(https_metrics_counters_t *counters);
+uint32_t https_metrics_export_binary(uint8_t *buffer, uint32_t size);
+uint32_t https_metrics_export_json(char *buffer, uint32_t size);
+void https_metrics_print(void);
+void https_metrics_print_binary(void);
+
+#endif /* HTTPS_METRICS_H_ */
+
+
+/* [] END OF FILE */
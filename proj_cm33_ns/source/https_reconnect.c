@@ -0,0 +1,339 @@
+/*******************************************************************************
+* File Name: https_reconnect.c
+*
+* Description: This file tracks the state of server connections and paces
+* their reconnects with a jittered exponential backoff.
+*
+* Related Document: See README.md
+********************************************************************************
+* Copyright 2024-2025, Cypress Semiconductor Corporation (an Infineon company) or
+* an affiliate of Cypress Semiconductor Corporation.  All rights reserved.
+*
+* This software, including source code, documentation and related
+* materials ("Software") is owned by Cypress Semiconductor Corporation
+* or one of its affiliates ("Cypress") and is protected by and subject to
+* worldwide patent protection (United States and foreign),
+* United States copyright laws and international treaty provisions.
+* Therefore, you may use this Software only as provided in the license
+* agreement accompanying the software package from which you
+* obtained this Software ("EULA").
+* If no EULA applies, Cypress hereby grants you a personal, non-exclusive,
+* non-transferable license to copy, modify, and compile the Software
+* source code solely for use in connection with Cypress's
+* integrated circuit products.  Any reproduction, modification, translation,
+* compilation, or representation of this Software except as specified
+* above is prohibited without the express written permission of Cypress.
+*
+* Disclaimer: THIS SOFTWARE IS PROVIDED AS-IS, WITH NO WARRANTY OF ANY KIND,
+* EXPRESS OR IMPLIED, INCLUDING, BUT NOT LIMITED TO, NONINFRINGEMENT, IMPLIED
+* WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE. Cypress
+* reserves the right to make changes to the Software without notice. Cypress
+* does not assume any liability arising out of the application or use of the
+* Software or any product or circuit described in the Software. Cypress does
+* not authorize its products for use in any products where a malfunction or
+* failure of the Cypress product may reasonably be expected to result in
+* significant property damage, injury or death ("High Risk Product"). By
+* including Cypress's product in a High Risk Product, the manufacturer
+* of such system or application assumes all risk of such use and in doing
+* so agrees to indemnify Cypress against all liability.
+*******************************************************************************/
+
+/*******************************************************************************
+* Header Files
+*******************************************************************************/
+#include "https_reconnect.h"
+#include "app_log.h"
+#include <stdio.h>
+#include <string.h>
+
+/* FreeRTOS header files */
+#include <FreeRTOS.h>
+#include <task.h>
+
+/*******************************************************************************
+* Macros
+*******************************************************************************/
+/* Seed used when the application gives none; xorshift must not start at 0. */
+#define DEFAULT_SEED                                 (0x2545F491U)
+
+/*******************************************************************************
+* Global Variables
+********************************************************************************/
+static uint32_t jitter_state = DEFAULT_SEED;
+static https_reconnect_stats_t reconnect_stats;
+
+/*******************************************************************************
+* Function Definitions
+*******************************************************************************/
+
+/*******************************************************************************
+* Function Name: next_random
+********************************************************************************
+* Summary:
+*  Returns the next number of the xorshift32 sequence used for the jitter.
+*  Called inside a critical section.
+*
+*******************************************************************************/
+static uint32_t next_random(void)
+{
+    uint32_t x = jitter_state;
+
+    x ^= x << 13;
+    x ^= x >> 17;
+    x ^= x << 5;
+    jitter_state = x;
+
+    return x;
+}
+
+/*******************************************************************************
+* Function Name: backoff_delay_ms
+********************************************************************************
+* Summary:
+*  Returns the delay before the next attempt after the given number of failed
+*  attempts: HTTPS_RECONNECT_BASE_DELAY_MS doubled for every failure after the
+*  first, capped at HTTPS_RECONNECT_MAX_DELAY_MS, and then drawn from the
+*  upper half of that value. Called inside a critical section.
+*
+*******************************************************************************/
+static uint32_t backoff_delay_ms(uint32_t attempts)
+{
+    uint32_t delay = HTTPS_RECONNECT_BASE_DELAY_MS;
+
+    for (uint32_t i = 1U; (i < attempts) &&
+                          (delay < HTTPS_RECONNECT_MAX_DELAY_MS); i++)
+    {
+        delay <<= 1U;
+    }
+
+    if (delay > HTTPS_RECONNECT_MAX_DELAY_MS)
+    {
+        delay = HTTPS_RECONNECT_MAX_DELAY_MS;
+    }
+
+    return (delay / 2U) + (next_random() % ((delay / 2U) + 1U));
+}
+
+/*******************************************************************************
+* Function Name: https_reconnect_init
+********************************************************************************
+* Summary:
+*  Seeds the backoff jitter and clears the counters. The seed should differ
+*  between devices, for example be taken from the MAC address.
+*
+* Parameters:
+*  seed - Seed of the jitter
+*
+* Return:
+*  void
+*
+*******************************************************************************/
+void https_reconnect_init(uint32_t seed)
+{
+    taskENTER_CRITICAL();
+    jitter_state = (0U != seed) ? seed : DEFAULT_SEED;
+    (void) memset(&reconnect_stats, 0, sizeof(reconnect_stats));
+    taskEXIT_CRITICAL();
+}
+
+/*******************************************************************************
+* Function Name: https_link_init
+********************************************************************************
+* Summary:
+*  Initializes the reconnect state of a connection that was never opened.
+*
+*******************************************************************************/
+void https_link_init(https_link_t *link)
+{
+    (void) memset(link, 0, sizeof(*link));
+    link->state = HTTPS_LINK_IDLE;
+}
+
+/*******************************************************************************
+* Function Name: https_link_down
+********************************************************************************
+* Summary:
+*  Marks an open connection as lost. The first attempt to reconnect may be
+*  made at once. Nothing happens if the connection is not up, so every path
+*  that notices the loss may call it.
+*
+* Parameters:
+*  link - Reconnect state of the connection
+*
+* Return:
+*  void
+*
+*******************************************************************************/
+void https_link_down(https_link_t *link)
+{
+    TickType_t now = xTaskGetTickCount();
+
+    taskENTER_CRITICAL();
+    if (HTTPS_LINK_UP == link->state)
+    {
+        link->state = HTTPS_LINK_DOWN;
+        link->attempts = 0U;
+        link->recovering = false;
+        link->next_attempt = now;
+        reconnect_stats.disconnects++;
+    }
+    taskEXIT_CRITICAL();
+}
+
+/*******************************************************************************
+* Function Name: https_link_begin
+********************************************************************************
+* Summary:
+*  Checks whether the backoff of a lost connection allows the next attempt
+*  to reconnect, and starts the recovery time on the first attempt. Called
+*  right before connecting.
+*
+* Parameters:
+*  link - Reconnect state of the connection
+*  wait - Returns the ticks left until the next attempt when it is not
+*         allowed yet, may be NULL
+*
+* Return:
+*  bool: true if a connect may be attempted now.
+*
+*******************************************************************************/
+bool https_link_begin(https_link_t *link, TickType_t *wait)
+{
+    TickType_t now = xTaskGetTickCount();
+    int32_t left = 0;
+
+    taskENTER_CRITICAL();
+    if (HTTPS_LINK_DOWN == link->state)
+    {
+        left = (int32_t)(link->next_attempt - now);
+
+        if ((left <= 0) && !link->recovering)
+        {
+            link->recovering = true;
+            link->recovery_start = now;
+        }
+    }
+    taskEXIT_CRITICAL();
+
+    if (left > 0)
+    {
+        if (NULL != wait)
+        {
+            *wait = (TickType_t) left;
+        }
+
+        return false;
+    }
+
+    return true;
+}
+
+/*******************************************************************************
+* Function Name: https_link_connected
+********************************************************************************
+* Summary:
+*  Records the result of a connect. A success ends the recovery of a lost
+*  connection and resets its backoff. A failure schedules the next attempt
+*  after the backoff delay.
+*
+* Parameters:
+*  link   - Reconnect state of the connection
+*  result - Result of the connect
+*
+* Return:
+*  void
+*
+*******************************************************************************/
+void https_link_connected(https_link_t *link, cy_rslt_t result)
+{
+    TickType_t now = xTaskGetTickCount();
+    uint32_t recovery_ms;
+
+    taskENTER_CRITICAL();
+
+    if (HTTPS_LINK_DOWN == link->state)
+    {
+        reconnect_stats.attempts++;
+    }
+
+    if (CY_RSLT_SUCCESS == result)
+    {
+        if ((HTTPS_LINK_DOWN == link->state) && link->recovering)
+        {
+            recovery_ms = (uint32_t) pdTICKS_TO_MS(now - link->recovery_start);
+            reconnect_stats.recoveries++;
+            reconnect_stats.recovery_ms_last = recovery_ms;
+            reconnect_stats.recovery_ms_total += recovery_ms;
+            if (recovery_ms > reconnect_stats.recovery_ms_max)
+            {
+                reconnect_stats.recovery_ms_max = recovery_ms;
+            }
+        }
+
+        link->state = HTTPS_LINK_UP;
+        link->attempts = 0U;
+        link->recovering = false;
+    }
+    else
+    {
+        /* A first connect that fails backs off like a lost connection. */
+        if (HTTPS_LINK_DOWN != link->state)
+        {
+            link->state = HTTPS_LINK_DOWN;
+            link->recovering = true;
+            link->recovery_start = now;
+        }
+
+        link->attempts++;
+        link->next_attempt = now +
+                pdMS_TO_TICKS(backoff_delay_ms(link->attempts));
+        reconnect_stats.failed_attempts++;
+    }
+
+    taskEXIT_CRITICAL();
+}
+
+/*******************************************************************************
+* Function Name: https_reconnect_get_stats
+********************************************************************************
+* Summary:
+*  Returns a copy of the reconnect counters.
+*
+*******************************************************************************/
+void https_reconnect_get_stats(https_reconnect_stats_t *stats)
+{
+    taskENTER_CRITICAL();
+    *stats = reconnect_stats;
+    taskEXIT_CRITICAL();
+}
+
+/*******************************************************************************
+* Function Name: https_reconnect_print_stats
+********************************************************************************
+* Summary:
+*  Prints the reconnect counters and recovery times.
+*
+*******************************************************************************/
+void https_reconnect_print_stats(void)
+{
+    https_reconnect_stats_t stats;
+
+    https_reconnect_get_stats(&stats);
+
+    app_log_printf(" Reconnect disconnects:[%lu] recoveries:[%lu]"
+           " attempts:[%lu] failed:[%lu]\n",
+           (unsigned long) stats.disconnects, (unsigned long) stats.recoveries,
+           (unsigned long) stats.attempts,
+           (unsigned long) stats.failed_attempts);
+
+    if (0U != stats.recoveries)
+    {
+        app_log_printf(" Recovery ms last:[%lu] avg:[%lu] max:[%lu]\n",
+               (unsigned long) stats.recovery_ms_last,
+               (unsigned long) (stats.recovery_ms_total / stats.recoveries),
+               (unsigned long) stats.recovery_ms_max);
+    }
+}
+
+
+/* [] END OF FILE */
@@ -0,0 +1,129 @@
+/*******************************************************************************
+* File Name: https_reconnect.h
+*
+* Description: This file contains the structures, constants and function
+* prototypes of the reconnect engine.
+*
+* Related Document: See README.md
+********************************************************************************
+* Copyright 2024-2025, Cypress Semiconductor Corporation (an Infineon company) or
+* an affiliate of Cypress Semiconductor Corporation.  All rights reserved.
+*
+* This software, including source code, documentation and related
+* materials ("Software") is owned by Cypress Semiconductor Corporation
+* or one of its affiliates ("Cypress") and is protected by and subject to
+* worldwide patent protection (United States and foreign),
+* United States copyright laws and international treaty provisions.
+* Therefore, you may use this Software only as provided in the license
+* agreement accompanying the software package from which you
+* obtained this Software ("EULA").
+* If no EULA applies, Cypress hereby grants you a personal, non-exclusive,
+* non-transferable license to copy, modify, and compile the Software
+* source code solely for use in connection with Cypress's
+* integrated circuit products.  Any reproduction, modification, translation,
+* compilation, or representation of this Software except as specified
+* above is prohibited without the express written permission of Cypress.
+*
+* Disclaimer: THIS SOFTWARE IS PROVIDED AS-IS, WITH NO WARRANTY OF ANY KIND,
+* EXPRESS OR IMPLIED, INCLUDING, BUT NOT LIMITED TO, NONINFRINGEMENT, IMPLIED
+* WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE. Cypress
+* reserves the right to make changes to the Software without notice. Cypress
+* does not assume any liability arising out of the application or use of the
+* Software or any product or circuit described in the Software. Cypress does
+* not authorize its products for use in any products where a malfunction or
+* failure of the Cypress product may reasonably be expected to result in
+* significant property damage, injury or death ("High Risk Product"). By
+* including Cypress's product in a High Risk Product, the manufacturer
+* of such system or application assumes all risk of such use and in doing
+* so agrees to indemnify Cypress against all liability.
+*******************************************************************************/
+
+/*******************************************************************************
+* Include guard
+*******************************************************************************/
+#ifndef HTTPS_RECONNECT_H_
+#define HTTPS_RECONNECT_H_
+
+/*******************************************************************************
+* Header Files
+*******************************************************************************/
+#include <stdint.h>
+#include <stdbool.h>
+#include "FreeRTOS.h"
+#include "cy_result.h"
+
+/*******************************************************************************
+* Macros
+*******************************************************************************/
+
+/* Delay before the second attempt to reconnect a lost connection. The first
+ * attempt is made at once, and the delay doubles after every failed attempt
+ * up to HTTPS_RECONNECT_MAX_DELAY_MS. Each delay is drawn at random from its
+ * upper half so that devices that lost the server together do not come back
+ * in step.
+ */
+#define HTTPS_RECONNECT_BASE_DELAY_MS            (250U)
+#define HTTPS_RECONNECT_MAX_DELAY_MS             (8000U)
+
+/* Failed attempts after which the requests waiting for the connection are
+ * failed. The connection keeps being retried for later requests.
+ */
+#define HTTPS_RECONNECT_MAX_ATTEMPTS             (5U)
+
+/*******************************************************************************
+* Enumerations
+*******************************************************************************/
+
+/* States of a connection to the server. */
+typedef enum
+{
+    HTTPS_LINK_IDLE,
+    HTTPS_LINK_UP,
+    HTTPS_LINK_DOWN,
+} https_link_state_t;
+
+/*******************************************************************************
+* Data Types
+*******************************************************************************/
+
+/* Reconnect state of one connection. */
+typedef struct
+{
+    volatile https_link_state_t state;
+    uint32_t attempts;
+    bool recovering;
+    TickType_t recovery_start;
+    TickType_t next_attempt;
+} https_link_t;
+
+/* Reconnect counters of all connections. The recovery time of a lost
+ * connection runs from the first attempt to reopen it, made when a request
+ * needs it, to the end of the connect that succeeds. Idle time before a
+ * request needs the connection is not counted.
+ */
+typedef struct
+{
+    uint32_t disconnects;
+    uint32_t recoveries;
+    uint32_t attempts;
+    uint32_t failed_attempts;
+    uint32_t recovery_ms_last;
+    uint32_t recovery_ms_max;
+    uint32_t recovery_ms_total;
+} https_reconnect_stats_t;
+
+/*******************************************************************************
+* Function Prototypes
+*******************************************************************************/
+void https_reconnect_init(uint32_t seed);
+void https_link_init(https_link_t *link);
+void https_link_down(https_link_t *link);
+bool https_link_begin(https_link_t *link, TickType_t *wait);
+void https_link_connected(https_link_t *link, cy_rslt_t result);
+void https_reconnect_get_stats(https_reconnect_stats_t *stats);
+void https_reconnect_print_stats(void);
+
+#endif /* HTTPS_RECONNECT_H_ */
+
+
+/* [] END OF FILE */
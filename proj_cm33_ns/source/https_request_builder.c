@@ -0,0 +1,397 @@
+/*******************************************************************************
+* File Name: https_request_builder.c
+*
+* Description: This file contains the HTTP request builder. The request
+* line and headers are serialized straight into the transmit buffer of a
+* streaming connection, without an intermediate header buffer, and the body is
+* described as a scatter-gather list whose segments are either copied next to
+* the headers or handed to the TLS socket from the caller's memory.
+*
+* Related Document: See README.md
+********************************************************************************
+* Copyright 2024-2025, Cypress Semiconductor Corporation (an Infineon company) or
+* an affiliate of Cypress Semiconductor Corporation.  All rights reserved.
+*
+* This software, including source code, documentation and related
+* materials ("Software") is owned by Cypress Semiconductor Corporation
+* or one of its affiliates ("Cypress") and is protected by and subject to
+* worldwide patent protection (United States and foreign),
+* United States copyright laws and international treaty provisions.
+* Therefore, you may use this Software only as provided in the license
+* agreement accompanying the software package from which you
+* obtained this Software ("EULA").
+* If no EULA applies, Cypress hereby grants you a personal, non-exclusive,
+* non-transferable license to copy, modify, and compile the Software
+* source code solely for use in connection with Cypress's
+* integrated circuit products.  Any reproduction, modification, translation,
+* compilation, or representation of this Software except as specified
+* above is prohibited without the express written permission of Cypress.
+*
+* Disclaimer: THIS SOFTWARE IS PROVIDED AS-IS, WITH NO WARRANTY OF ANY KIND,
+* EXPRESS OR IMPLIED, INCLUDING, BUT NOT LIMITED TO, NONINFRINGEMENT, IMPLIED
+* WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE. Cypress
+* reserves the right to make changes to the Software without notice. Cypress
+* does not assume any liability arising out of the application or use of the
+* Software or any product or circuit described in the Software. Cypress does
+* not authorize its products for use in any products where a malfunction or
+* failure of the Cypress product may reasonably be expected to result in
+* significant property damage, injury or death ("High Risk Product"). By
+* including Cypress's product in a High Risk Product, the manufacturer
+* of such system or application assumes all risk of such use and in doing
+* so agrees to indemnify Cypress against all liability.
+*******************************************************************************/
+
+/*******************************************************************************
+* Header Files
+*******************************************************************************/
+#include "https_request_builder.h"
+#include <string.h>
+
+/*******************************************************************************
+* Macros
+*******************************************************************************/
+#define CRLF                                         "\r\n"
+#define CRLF_LEN                                     (2U)
+#define HEADER_SEPARATOR                             ": "
+#define HEADER_SEPARATOR_LEN                         (2U)
+#define REQUEST_LINE_VERSION                         " HTTP/1.1\r\n"
+#define REQUEST_LINE_VERSION_LEN                     (11U)
+#define UINT32_MAX_DIGITS                            (10U)
+#define DECIMAL_BASE                                 (10U)
+#define HEX_DIGIT_BITS                               (4U)
+#define HEX_DIGIT_MASK                               (0x0FU)
+#define LAST_CHUNK                                   "0\r\n\r\n"
+#define LAST_CHUNK_LEN                               (5U)
+
+/*******************************************************************************
+* Function Definitions
+*******************************************************************************/
+
+/*******************************************************************************
+* Function Name: append
+********************************************************************************
+* Summary:
+*  Appends bytes to the request in the transmit buffer. A request that
+*  outgrows the buffer is marked as overflowed and fails in
+*  https_builder_finish.
+*
+*******************************************************************************/
+static void append(https_request_builder_t *builder, const void *data,
+                   uint32_t len)
+{
+    https_stream_conn_t *conn = builder->conn;
+
+    if (builder->overflow ||
+        ((conn->tx_len + len) > HTTPS_STREAM_TX_BUFFER_LENGTH))
+    {
+        builder->overflow = true;
+        return;
+    }
+
+    (void) memcpy(&conn->tx_buffer[conn->tx_len], data, len);
+    conn->tx_len += len;
+    conn->bytes_copied += len;
+}
+
+/*******************************************************************************
+* Function Name: append_string
+********************************************************************************
+* Summary:
+*  Appends a NUL terminated string to the request.
+*
+*******************************************************************************/
+static void append_string(https_request_builder_t *builder, const char *str)
+{
+    append(builder, str, (uint32_t) strlen(str));
+}
+
+/*******************************************************************************
+* Function Name: append_uint
+********************************************************************************
+* Summary:
+*  Appends the decimal representation of a number to the request.
+*
+*******************************************************************************/
+static void append_uint(https_request_builder_t *builder, uint32_t value)
+{
+    char digits[UINT32_MAX_DIGITS];
+    uint32_t pos = UINT32_MAX_DIGITS;
+
+    do
+    {
+        digits[--pos] = (char)('0' + (value % DECIMAL_BASE));
+        value /= DECIMAL_BASE;
+    } while (0U != value);
+
+    append(builder, &digits[pos], UINT32_MAX_DIGITS - pos);
+}
+
+/*******************************************************************************
+* Function Name: https_builder_begin
+********************************************************************************
+* Summary:
+*  Starts a request in the transmit buffer of the connection and writes the
+*  request line and the Host header. Requests already staged are flushed
+*  first if less than HTTPS_BUILDER_HEADER_RESERVE bytes are free.
+*
+* Parameters:
+*  builder - Builder to initialize
+*  conn    - Connected streaming connection
+*  method  - Method token, for example "POST"
+*  path    - Resource path
+*
+* Return:
+*  cy_rslt_t: CY_RSLT_SUCCESS, or the error of the flush.
+*
+*******************************************************************************/
+cy_rslt_t https_builder_begin(https_request_builder_t *builder,
+                              https_stream_conn_t *conn, const char *method,
+                              const char *path)
+{
+    cy_rslt_t result = CY_RSLT_SUCCESS;
+
+    if ((HTTPS_STREAM_TX_BUFFER_LENGTH - conn->tx_len) <
+        HTTPS_BUILDER_HEADER_RESERVE)
+    {
+        result = https_stream_flush(conn);
+    }
+
+    builder->conn = conn;
+    builder->start = conn->tx_len;
+    builder->overflow = false;
+
+    append_string(builder, method);
+    append(builder, " ", 1U);
+    append_string(builder, path);
+    append(builder, REQUEST_LINE_VERSION, REQUEST_LINE_VERSION_LEN);
+    https_builder_add_header(builder, "Host", conn->host_name);
+
+    return result;
+}
+
+/*******************************************************************************
+* Function Name: https_builder_add_header
+********************************************************************************
+* Summary:
+*  Appends a header field to the request.
+*
+*******************************************************************************/
+void https_builder_add_header(https_request_builder_t *builder,
+                              const char *field, const char *value)
+{
+    append_string(builder, field);
+    append(builder, HEADER_SEPARATOR, HEADER_SEPARATOR_LEN);
+    append_string(builder, value);
+    append(builder, CRLF, CRLF_LEN);
+}
+
+/*******************************************************************************
+* Function Name: https_builder_add_header_uint
+********************************************************************************
+* Summary:
+*  Appends a header field with a numeric value, such as Content-Length.
+*
+*******************************************************************************/
+void https_builder_add_header_uint(https_request_builder_t *builder,
+                                   const char *field, uint32_t value)
+{
+    append_string(builder, field);
+    append(builder, HEADER_SEPARATOR, HEADER_SEPARATOR_LEN);
+    append_uint(builder, value);
+    append(builder, CRLF, CRLF_LEN);
+}
+
+/*******************************************************************************
+* Function Name: https_builder_finish
+********************************************************************************
+* Summary:
+*  Ends the header block and queues the body segments. Copy segments go into
+*  the transmit buffer while they fit; reference segments, and copy segments
+*  too large for the buffer, are sent from the caller's memory after the
+*  staged bytes are flushed. Bytes left in the transmit buffer are sent by the
+*  next flush, so several requests can share one TLS record.
+*
+* Parameters:
+*  builder        - Builder started with https_builder_begin
+*  segments       - Body segments, may be NULL if segment_count is 0
+*  segment_count  - Number of body segments
+*  content_length - Add a Content-Length header with the total segment length
+*
+* Return:
+*  cy_rslt_t: CY_RSLT_SUCCESS if the request was queued. On failure the
+*  partial request is removed from the transmit buffer.
+*
+*******************************************************************************/
+cy_rslt_t https_builder_finish(https_request_builder_t *builder,
+                               const https_segment_t *segments,
+                               uint32_t segment_count, bool content_length)
+{
+    cy_rslt_t result = CY_RSLT_SUCCESS;
+    https_stream_conn_t *conn = builder->conn;
+    uint32_t body_len = 0U;
+
+    if (segment_count > HTTPS_BUILDER_MAX_SEGMENTS)
+    {
+        builder->overflow = true;
+    }
+
+    for (uint32_t i = 0U; (i < segment_count) && !builder->overflow; i++)
+    {
+        body_len += segments[i].len;
+    }
+
+    if (content_length)
+    {
+        https_builder_add_header_uint(builder, "Content-Length", body_len);
+    }
+
+    append(builder, CRLF, CRLF_LEN);
+
+    if (builder->overflow)
+    {
+        conn->tx_len = builder->start;
+        return CY_RSLT_TYPE_ERROR;
+    }
+
+    for (uint32_t i = 0U; (i < segment_count) && (CY_RSLT_SUCCESS == result);
+         i++)
+    {
+        const https_segment_t *segment = &segments[i];
+
+        if ((HTTPS_SEGMENT_COPY == segment->mode) &&
+            ((conn->tx_len + segment->len) <= HTTPS_STREAM_TX_BUFFER_LENGTH))
+        {
+            append(builder, segment->data, segment->len);
+        }
+        else
+        {
+            result = https_stream_flush(conn);
+
+            if (CY_RSLT_SUCCESS == result)
+            {
+                result = https_stream_write(conn, segment->data,
+                                            segment->len);
+            }
+        }
+    }
+
+    return result;
+}
+
+
+/*******************************************************************************
+* Function Name: hex_width
+********************************************************************************
+* Summary:
+*  Returns the number of hex digits needed to write a number.
+*
+*******************************************************************************/
+static uint32_t hex_width(uint32_t value)
+{
+    uint32_t width = 1U;
+
+    while (0U != (value >>= HEX_DIGIT_BITS))
+    {
+        width++;
+    }
+
+    return width;
+}
+
+/*******************************************************************************
+* Function Name: https_builder_finish_chunked
+********************************************************************************
+* Summary:
+*  Ends the header block with Transfer-Encoding: chunked and sends the body
+*  that the producer generates, one chunk per call, until it returns an
+*  empty piece. The producer writes straight into the transmit buffer, after
+*  room left for the chunk size; the size is then written in front with
+*  leading zeros to fill that room, so the data is never moved. Staged bytes
+*  are flushed whenever less than HTTPS_BUILDER_MIN_CHUNK bytes are free.
+*  The last chunk stays staged for the next flush.
+*
+* Parameters:
+*  builder  - Builder started with https_builder_begin
+*  producer - Supplies the body
+*  arg      - Argument passed to the producer
+*
+* Return:
+*  cy_rslt_t: CY_RSLT_SUCCESS if the whole body was queued, the error of the
+*  producer or of a flush, or CY_RSLT_TYPE_ERROR if the headers overflowed
+*  the transmit buffer. The connection must be closed after a failure once
+*  part of the body was sent.
+*
+*******************************************************************************/
+cy_rslt_t https_builder_finish_chunked(https_request_builder_t *builder,
+                                       https_stream_body_producer_t producer,
+                                       void *arg)
+{
+    cy_rslt_t result = CY_RSLT_SUCCESS;
+    https_stream_conn_t *conn = builder->conn;
+    uint32_t free_len;
+    uint32_t width;
+    uint32_t len = 0U;
+    uint8_t *size_field;
+
+    https_builder_add_header(builder, "Transfer-Encoding", "chunked");
+    append(builder, CRLF, CRLF_LEN);
+
+    if (builder->overflow)
+    {
+        conn->tx_len = builder->start;
+        return CY_RSLT_TYPE_ERROR;
+    }
+
+    for (;;)
+    {
+        free_len = HTTPS_STREAM_TX_BUFFER_LENGTH - conn->tx_len;
+
+        if (free_len < HTTPS_BUILDER_MIN_CHUNK)
+        {
+            result = https_stream_flush(conn);
+            if (CY_RSLT_SUCCESS != result)
+            {
+                break;
+            }
+            free_len = HTTPS_STREAM_TX_BUFFER_LENGTH;
+        }
+
+        /* Room for the size line in front and the CRLF behind the data. */
+        width = hex_width(free_len);
+        free_len -= width + CRLF_LEN + CRLF_LEN;
+        size_field = &conn->tx_buffer[conn->tx_len];
+
+        len = 0U;
+        result = producer(arg, size_field + width + CRLF_LEN, free_len, &len);
+
+        if ((CY_RSLT_SUCCESS != result) || (0U == len) || (len > free_len))
+        {
+            break;
+        }
+
+        for (uint32_t i = width; i > 0U; i--)
+        {
+            size_field[i - 1U] = (uint8_t) "0123456789abcdef"[
+                    (len >> ((width - i) * HEX_DIGIT_BITS)) & HEX_DIGIT_MASK];
+        }
+        (void) memcpy(&size_field[width], CRLF, CRLF_LEN);
+        conn->tx_len += width + CRLF_LEN + len;
+        conn->bytes_copied += len;
+        append(builder, CRLF, CRLF_LEN);
+    }
+
+    if ((CY_RSLT_SUCCESS == result) && (len > free_len))
+    {
+        result = CY_RSLT_TYPE_ERROR;
+    }
+
+    if (CY_RSLT_SUCCESS == result)
+    {
+        append(builder, LAST_CHUNK, LAST_CHUNK_LEN);
+    }
+
+    return result;
+}
+
+
+/* [] END OF FILE */
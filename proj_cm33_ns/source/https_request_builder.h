@@ -0,0 +1,131 @@
+/*******************************************************************************
+* File Name: https_request_builder.h
+*
+* Description: This file is the public interface of https_request_builder.c.
+*
+* Related Document: See README.md
+********************************************************************************
+* Copyright 2024-2025, Cypress Semiconductor Corporation (an Infineon company) or
+* an affiliate of Cypress Semiconductor Corporation.  All rights reserved.
+*
+* This software, including source code, documentation and related
+* materials ("Software") is owned by Cypress Semiconductor Corporation
+* or one of its affiliates ("Cypress") and is protected by and subject to
+* worldwide patent protection (United States and foreign),
+* United States copyright laws and international treaty provisions.
+* Therefore, you may use this Software only as provided in the license
+* agreement accompanying the software package from which you
+* obtained this Software ("EULA").
+* If no EULA applies, Cypress hereby grants you a personal, non-exclusive,
+* non-transferable license to copy, modify, and compile the Software
+* source code solely for use in connection with Cypress's
+* integrated circuit products.  Any reproduction, modification, translation,
+* compilation, or representation of this Software except as specified
+* above is prohibited without the express written permission of Cypress.
+*
+* Disclaimer: THIS SOFTWARE IS PROVIDED AS-IS, WITH NO WARRANTY OF ANY KIND,
+* EXPRESS OR IMPLIED, INCLUDING, BUT NOT LIMITED TO, NONINFRINGEMENT, IMPLIED
+* WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE. Cypress
+* reserves the right to make changes to the Software without notice. Cypress
+* does not assume any liability arising out of the application or use of the
+* Software or any product or circuit described in the Software. Cypress does
+* not authorize its products for use in any products where a malfunction or
+* failure of the Cypress product may reasonably be expected to result in
+* significant property damage, injury or death ("High Risk Product"). By
+* including Cypress's product in a High Risk Product, the manufacturer
+* of such system or application assumes all risk of such use and in doing
+* so agrees to indemnify Cypress against all liability.
+*******************************************************************************/
+
+/*******************************************************************************
+* Include guard
+*******************************************************************************/
+#ifndef HTTPS_REQUEST_BUILDER_H_
+#define HTTPS_REQUEST_BUILDER_H_
+
+/*******************************************************************************
+* Header Files
+*******************************************************************************/
+#include <stdint.h>
+#include <stdbool.h>
+#include "cy_result.h"
+#include "https_stream.h"
+
+/*******************************************************************************
+* Macros
+*******************************************************************************/
+
+/* Free space the transmit buffer must have before a request is started in
+ * it. Staged requests are flushed first when less is left. The request line
+ * and headers of one request must fit in this space.
+ */
+#define HTTPS_BUILDER_HEADER_RESERVE             (256U)
+
+/* Maximum number of body segments of one request. */
+#define HTTPS_BUILDER_MAX_SEGMENTS               (4U)
+
+/* Smallest chunk a chunked body producer is asked for. Staged bytes are
+ * flushed first when less room is left in the transmit buffer.
+ */
+#define HTTPS_BUILDER_MIN_CHUNK                  (128U)
+
+/*******************************************************************************
+* Enumerations
+*******************************************************************************/
+
+/* How a body segment reaches the TLS socket. */
+typedef enum
+{
+    /* Copied into the transmit buffer next to the headers. Cheapest for
+     * small segments, which then share a TLS record with the headers.
+     */
+    HTTPS_SEGMENT_COPY,
+
+    /* Passed to the socket straight from the caller's memory and never
+     * copied by the application. Use for large or static bodies that stay
+     * valid until the request is sent.
+     */
+    HTTPS_SEGMENT_REFERENCE,
+} https_segment_mode_t;
+
+/*******************************************************************************
+* Data Types
+*******************************************************************************/
+
+/* One piece of a request body. */
+typedef struct
+{
+    const uint8_t *data;
+    uint32_t len;
+    https_segment_mode_t mode;
+} https_segment_t;
+
+/* Request being serialized into the transmit buffer of a connection. */
+typedef struct
+{
+    https_stream_conn_t *conn;
+    uint32_t start;
+    bool overflow;
+} https_request_builder_t;
+
+/*******************************************************************************
+* Function Prototypes
+*******************************************************************************/
+cy_rslt_t https_builder_begin(https_request_builder_t *builder,
+                              https_stream_conn_t *conn, const char *method,
+                              const char *path);
+void https_builder_add_header(https_request_builder_t *builder,
+                              const char *field, const char *value);
+void https_builder_add_header_uint(https_request_builder_t *builder,
+                                   const char *field, uint32_t value);
+cy_rslt_t https_builder_finish(https_request_builder_t *builder,
+                               const https_segment_t *segments,
+                               uint32_t segment_count, bool content_length);
+cy_rslt_t https_builder_finish_chunked(https_request_builder_t *builder,
+                                       https_stream_body_producer_t producer,
+                                       void *arg);
+
+#endif /* HTTPS_REQUEST_BUILDER_H_ */
+
+
+/* [] END OF FILE */
@@ -0,0 +1,235 @@
+/*******************************************************************************
+* File Name: https_request_template.c
+*
+* Description: This file contains precompiled request templates for the
+* HTTP client library. The request line and the fixed headers of a request
+* that is sent repeatedly are rendered once by cy_http_client_write_header,
+* and every later send only copies the rendered block into the request buffer.
+* The library appends the Content-Length of the body at send time.
+*
+* Related Document: See README.md
+********************************************************************************
+* Copyright 2024-2025, Cypress Semiconductor Corporation (an Infineon company) or
+* an affiliate of Cypress Semiconductor Corporation.  All rights reserved.
+*
+* This software, including source code, documentation and related
+* materials ("Software") is owned by Cypress Semiconductor Corporation
+* or one of its affiliates ("Cypress") and is protected by and subject to
+* worldwide patent protection (United States and foreign),
+* United States copyright laws and international treaty provisions.
+* Therefore, you may use this Software only as provided in the license
+* agreement accompanying the software package from which you
+* obtained this Software ("EULA").
+* If no EULA applies, Cypress hereby grants you a personal, non-exclusive,
+* non-transferable license to copy, modify, and compile the Software
+* source code solely for use in connection with Cypress's
+* integrated circuit products.  Any reproduction, modification, translation,
+* compilation, or representation of this Software except as specified
+* above is prohibited without the express written permission of Cypress.
+*
+* Disclaimer: THIS SOFTWARE IS PROVIDED AS-IS, WITH NO WARRANTY OF ANY KIND,
+* EXPRESS OR IMPLIED, INCLUDING, BUT NOT LIMITED TO, NONINFRINGEMENT, IMPLIED
+* WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE. Cypress
+* reserves the right to make changes to the Software without notice. Cypress
+* does not assume any liability arising out of the application or use of the
+* Software or any product or circuit described in the Software. Cypress does
+* not authorize its products for use in any products where a malfunction or
+* failure of the Cypress product may reasonably be expected to result in
+* significant property damage, injury or death ("High Risk Product"). By
+* including Cypress's product in a High Risk Product, the manufacturer
+* of such system or application assumes all risk of such use and in doing
+* so agrees to indemnify Cypress against all liability.
+*******************************************************************************/
+
+/*******************************************************************************
+* Header Files
+*******************************************************************************/
+#include "https_request_template.h"
+#include <string.h>
+
+/*******************************************************************************
+* Macros
+*******************************************************************************/
+
+/* Range used by the templates. The whole resource is requested. */
+#define TEMPLATE_RANGE_START                         (0)
+#define TEMPLATE_RANGE_END                           (-1)
+
+/* Empty line that ends the rendered headers. */
+#define HEADER_TERMINATOR                            "\r\n\r\n"
+#define HEADER_TERMINATOR_LEN                        (4U)
+#define LINE_TERMINATOR_LEN                          (2U)
+#define HEADER_SEPARATOR                             ": "
+#define HEADER_SEPARATOR_LEN                         (2U)
+
+/*******************************************************************************
+* Function Definitions
+*******************************************************************************/
+
+/*******************************************************************************
+* Function Name: https_template_render
+********************************************************************************
+* Summary:
+*  Renders the request line and the given headers of a request into the
+*  template. The headers must not change between requests.
+*
+* Parameters:
+*  tpl         - Template to render
+*  handle      - HTTP client used to format the headers (for the Host field)
+*  method      - Request method
+*  path        - Resource path. Must remain valid while the template is used.
+*  headers     - Fixed headers of the request
+*  num_headers - Number of fixed headers
+*
+* Return:
+*  cy_rslt_t: CY_RSLT_SUCCESS if the template was rendered.
+*
+*******************************************************************************/
+cy_rslt_t https_template_render(https_request_template_t *tpl,
+                                cy_http_client_t handle,
+                                cy_http_client_method_t method,
+                                const char *path,
+                                cy_http_client_header_t *headers,
+                                uint32_t num_headers)
+{
+    cy_rslt_t result;
+    cy_http_client_request_header_t request;
+
+    (void) memset(tpl, 0, sizeof(*tpl));
+    (void) memset(&request, 0, sizeof(request));
+
+    request.buffer = tpl->blob;
+    request.buffer_len = HTTPS_TEMPLATE_MAX_LENGTH;
+    request.headers_len = 0U;
+    request.method = method;
+    request.range_start = TEMPLATE_RANGE_START;
+    request.range_end = TEMPLATE_RANGE_END;
+    request.resource_path = path;
+
+    result = cy_http_client_write_header(handle, &request, headers,
+                                         num_headers);
+
+    if (CY_RSLT_SUCCESS == result)
+    {
+        tpl->method = method;
+        tpl->path = path;
+        tpl->len = (uint32_t) request.headers_len;
+        tpl->ready = true;
+    }
+
+    return result;
+}
+
+/*******************************************************************************
+* Function Name: https_template_find
+********************************************************************************
+* Summary:
+*  Looks up the rendered template of a method and path.
+*
+* Return:
+*  const https_request_template_t *: The template, or NULL if none matches.
+*
+*******************************************************************************/
+const https_request_template_t *https_template_find(
+        const https_request_template_t *templates, uint32_t count,
+        cy_http_client_method_t method, const char *path)
+{
+    const https_request_template_t *found = NULL;
+
+    for (uint32_t i = 0U; (i < count) && (NULL == found); i++)
+    {
+        if (templates[i].ready && (templates[i].method == method) &&
+            ((templates[i].path == path) ||
+             (0 == strcmp(templates[i].path, path))))
+        {
+            found = &templates[i];
+        }
+    }
+
+    return found;
+}
+
+/*******************************************************************************
+* Function Name: https_template_apply
+********************************************************************************
+* Summary:
+*  Prepares a request from a template, in place of
+*  cy_http_client_write_header. The rendered block is copied into the request
+*  buffer, leaving the rest of the buffer for the Content-Length that the
+*  library adds and for the response.
+*
+* Parameters:
+*  tpl     - Rendered template
+*  request - Request whose buffer and buffer_len are set
+*
+* Return:
+*  cy_rslt_t: CY_RSLT_SUCCESS if the template fits in the request buffer.
+*
+*******************************************************************************/
+cy_rslt_t https_template_apply(const https_request_template_t *tpl,
+                               cy_http_client_request_header_t *request)
+{
+    cy_rslt_t result = CY_RSLT_TYPE_ERROR;
+
+    if ((NULL != tpl) && tpl->ready && (tpl->len <= request->buffer_len))
+    {
+        (void) memcpy(request->buffer, tpl->blob, tpl->len);
+        request->headers_len = tpl->len;
+        request->method = tpl->method;
+        request->resource_path = tpl->path;
+        request->range_start = TEMPLATE_RANGE_START;
+        request->range_end = TEMPLATE_RANGE_END;
+        result = CY_RSLT_SUCCESS;
+    }
+
+    return result;
+}
+
+/*******************************************************************************
+* Function Name: https_template_append_header
+********************************************************************************
+* Summary:
+*  Adds a header that changes between requests, such as a cache validator, to
+*  a request prepared by https_template_apply. The header is inserted before
+*  the empty line that ends the headers.
+*
+* Parameters:
+*  request - Request prepared from a template
+*  header  - Header to add
+*
+* Return:
+*  cy_rslt_t: CY_RSLT_SUCCESS if the header fits in the request buffer.
+*
+*******************************************************************************/
+cy_rslt_t https_template_append_header(cy_http_client_request_header_t *request,
+                                       const cy_http_client_header_t *header)
+{
+    cy_rslt_t result = CY_RSLT_TYPE_ERROR;
+    size_t line_len = header->field_len + HEADER_SEPARATOR_LEN +
+                      header->value_len + LINE_TERMINATOR_LEN;
+    uint8_t *end;
+
+    if ((request->headers_len >= HEADER_TERMINATOR_LEN) &&
+        ((request->headers_len + line_len) <= request->buffer_len) &&
+        (0 == memcmp(&request->buffer[request->headers_len -
+                                      HEADER_TERMINATOR_LEN],
+                     HEADER_TERMINATOR, HEADER_TERMINATOR_LEN)))
+    {
+        /* Overwrite the final CR LF and terminate again after the header. */
+        end = &request->buffer[request->headers_len - LINE_TERMINATOR_LEN];
+        (void) memcpy(end, header->field, header->field_len);
+        end += header->field_len;
+        (void) memcpy(end, HEADER_SEPARATOR, HEADER_SEPARATOR_LEN);
+        end += HEADER_SEPARATOR_LEN;
+        (void) memcpy(end, header->value, header->value_len);
+        end += header->value_len;
+        (void) memcpy(end, HEADER_TERMINATOR, HEADER_TERMINATOR_LEN);
+        request->headers_len += line_len;
+        result = CY_RSLT_SUCCESS;
+    }
+
+    return result;
+}
+
+
+/* [] END OF FILE */
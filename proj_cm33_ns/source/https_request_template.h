@@ -0,0 +1,94 @@
+/*******************************************************************************
+* File Name: https_request_template.h
+*
+* Description: This file is the public interface of https_request_template.c.
+*
+* Related Document: See README.md
+********************************************************************************
+* Copyright 2024-2025, Cypress Semiconductor Corporation (an Infineon company) or
+* an affiliate of Cypress Semiconductor Corporation.  All rights reserved.
+*
+* This software, including source code, documentation and related
+* materials ("Software") is owned by Cypress Semiconductor Corporation
+* or one of its affiliates ("Cypress") and is protected by and subject to
+* worldwide patent protection (United States and foreign),
+* United States copyright laws and international treaty provisions.
+* Therefore, you may use this Software only as provided in the license
+* agreement accompanying the software package from which you
+* obtained this Software ("EULA").
+* If no EULA applies, Cypress hereby grants you a personal, non-exclusive,
+* non-transferable license to copy, modify, and compile the Software
+* source code solely for use in connection with Cypress's
+* integrated circuit products.  Any reproduction, modification, translation,
+* compilation, or representation of this Software except as specified
+* above is prohibited without the express written permission of Cypress.
+*
+* Disclaimer: THIS SOFTWARE IS PROVIDED AS-IS, WITH NO WARRANTY OF ANY KIND,
+* EXPRESS OR IMPLIED, INCLUDING, BUT NOT LIMITED TO, NONINFRINGEMENT, IMPLIED
+* WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE. Cypress
+* reserves the right to make changes to the Software without notice. Cypress
+* does not assume any liability arising out of the application or use of the
+* Software or any product or circuit described in the Software. Cypress does
+* not authorize its products for use in any products where a malfunction or
+* failure of the Cypress product may reasonably be expected to result in
+* significant property damage, injury or death ("High Risk Product"). By
+* including Cypress's product in a High Risk Product, the manufacturer
+* of such system or application assumes all risk of such use and in doing
+* so agrees to indemnify Cypress against all liability.
+*******************************************************************************/
+
+/*******************************************************************************
+* Include guard
+*******************************************************************************/
+#ifndef HTTPS_REQUEST_TEMPLATE_H_
+#define HTTPS_REQUEST_TEMPLATE_H_
+
+/*******************************************************************************
+* Header Files
+*******************************************************************************/
+#include <stdint.h>
+#include <stdbool.h>
+#include "cy_http_client_api.h"
+
+/*******************************************************************************
+* Macros
+*******************************************************************************/
+
+/* Maximum length of a rendered request line and header block. */
+#define HTTPS_TEMPLATE_MAX_LENGTH                (256U)
+
+/*******************************************************************************
+* Data Types
+*******************************************************************************/
+
+/* Request line and fixed headers of a request, rendered once. */
+typedef struct
+{
+    cy_http_client_method_t method;
+    const char *path;
+    bool ready;
+    uint32_t len;
+    uint8_t blob[HTTPS_TEMPLATE_MAX_LENGTH];
+} https_request_template_t;
+
+/*******************************************************************************
+* Function Prototypes
+*******************************************************************************/
+cy_rslt_t https_template_render(https_request_template_t *tpl,
+                                cy_http_client_t handle,
+                                cy_http_client_method_t method,
+                                const char *path,
+                                cy_http_client_header_t *headers,
+                                uint32_t num_headers);
+const https_request_template_t *https_template_find(
+        const https_request_template_t *templates, uint32_t count,
+        cy_http_client_method_t method, const char *path);
+cy_rslt_t https_template_apply(const https_request_template_t *tpl,
+                               cy_http_client_request_header_t *request);
+cy_rslt_t https_template_append_header(cy_http_client_request_header_t *request,
+                                       const cy_http_client_header_t *header);
+
+#endif /* HTTPS_REQUEST_TEMPLATE_H_ */
+
+
+/* [] END OF FILE */
@@ -0,0 +1,301 @@
+/*******************************************************************************
+* File Name: https_response_cache.c
+*
+* Description: This file contains a RAM cache of GET responses keyed by
+* resource path. It keeps the ETag and Last-Modified validators of a resource
+* and, when it is small enough, its body. Later GET requests of the resource
+* carry If-None-Match and If-Modified-Since, and a 304 (Not Modified) response
+* is served from the cache instead of downloading the body again.
+*
+* Related Document: See README.md
+********************************************************************************
+* Copyright 2024-2025, Cypress Semiconductor Corporation (an Infineon company) or
+* an affiliate of Cypress Semiconductor Corporation.  All rights reserved.
+*
+* This software, including source code, documentation and related
+* materials ("Software") is owned by Cypress Semiconductor Corporation
+* or one of its affiliates ("Cypress") and is protected by and subject to
+* worldwide patent protection (United States and foreign),
+* United States copyright laws and international treaty provisions.
+* Therefore, you may use this Software only as provided in the license
+* agreement accompanying the software package from which you
+* obtained this Software ("EULA").
+* If no EULA applies, Cypress hereby grants you a personal, non-exclusive,
+* non-transferable license to copy, modify, and compile the Software
+* source code solely for use in connection with Cypress's
+* integrated circuit products.  Any reproduction, modification, translation,
+* compilation, or representation of this Software except as specified
+* above is prohibited without the express written permission of Cypress.
+*
+* Disclaimer: THIS SOFTWARE IS PROVIDED AS-IS, WITH NO WARRANTY OF ANY KIND,
+* EXPRESS OR IMPLIED, INCLUDING, BUT NOT LIMITED TO, NONINFRINGEMENT, IMPLIED
+* WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE. Cypress
+* reserves the right to make changes to the Software without notice. Cypress
+* does not assume any liability arising out of the application or use of the
+* Software or any product or circuit described in the Software. Cypress does
+* not authorize its products for use in any products where a malfunction or
+* failure of the Cypress product may reasonably be expected to result in
+* significant property damage, injury or death ("High Risk Product"). By
+* including Cypress's product in a High Risk Product, the manufacturer
+* of such system or application assumes all risk of such use and in doing
+* so agrees to indemnify Cypress against all liability.
+*******************************************************************************/
+
+/*******************************************************************************
+* Header Files
+*******************************************************************************/
+#include "https_response_cache.h"
+#include "app_log.h"
+
+/* Standard C header files */
+#include <stdio.h>
+#include <string.h>
+
+/* FreeRTOS header file */
+#include <FreeRTOS.h>
+#include <task.h>
+
+/*******************************************************************************
+* Global Variables
+********************************************************************************/
+static https_cache_entry_t cache[HTTPS_CACHE_SIZE];
+static https_cache_stats_t cache_stats;
+
+/*******************************************************************************
+* Function Definitions
+*******************************************************************************/
+
+/*******************************************************************************
+* Function Name: copy_validator
+********************************************************************************
+* Summary:
+*  Copies a validator into a NUL terminated field. A validator that does not
+*  fit is dropped, as a truncated one would never match.
+*
+*******************************************************************************/
+static void copy_validator(char *dest, const char *value, uint32_t len)
+{
+    if ((NULL != value) && (len < HTTPS_CACHE_VALIDATOR_LENGTH))
+    {
+        (void) memcpy(dest, value, len);
+        dest[len] = '\0';
+    }
+    else
+    {
+        dest[0] = '\0';
+    }
+}
+
+/*******************************************************************************
+* Function Name: https_cache_lookup
+********************************************************************************
+* Summary:
+*  Finds the cache entry of a resource.
+*
+* Parameters:
+*  path - Resource path
+*
+* Return:
+*  https_cache_entry_t *: The entry, or NULL if the resource is not cached.
+*
+*******************************************************************************/
+https_cache_entry_t *https_cache_lookup(const char *path)
+{
+    for (uint32_t i = 0U; i < HTTPS_CACHE_SIZE; i++)
+    {
+        if (cache[i].valid &&
+            (0 == strncmp(cache[i].path, path, HTTPS_CACHE_PATH_LENGTH)))
+        {
+            cache[i].last_used = (uint32_t) xTaskGetTickCount();
+            return &cache[i];
+        }
+    }
+
+    return NULL;
+}
+
+/*******************************************************************************
+* Function Name: https_cache_conditional_headers
+********************************************************************************
+* Summary:
+*  Fills in the If-None-Match and If-Modified-Since headers that revalidate a
+*  cached resource. The header values point into the entry.
+*
+* Parameters:
+*  entry       - Cached resource, may be NULL
+*  headers     - Array to fill
+*  max_headers - Number of elements in headers
+*
+* Return:
+*  uint32_t: Number of headers filled in.
+*
+*******************************************************************************/
+uint32_t https_cache_conditional_headers(const https_cache_entry_t *entry,
+                                         cy_http_client_header_t *headers,
+                                         uint32_t max_headers)
+{
+    uint32_t count = 0U;
+
+    if (NULL != entry)
+    {
+        if (('\0' != entry->etag[0]) && (count < max_headers))
+        {
+            headers[count].field = "If-None-Match";
+            headers[count].field_len = sizeof("If-None-Match") - 1U;
+            headers[count].value = (char *) entry->etag;
+            headers[count].value_len = strlen(entry->etag);
+            count++;
+        }
+
+        if (('\0' != entry->last_modified[0]) && (count < max_headers))
+        {
+            headers[count].field = "If-Modified-Since";
+            headers[count].field_len = sizeof("If-Modified-Since") - 1U;
+            headers[count].value = (char *) entry->last_modified;
+            headers[count].value_len = strlen(entry->last_modified);
+            count++;
+        }
+
+        if (count > 0U)
+        {
+            cache_stats.conditional_requests++;
+        }
+    }
+
+    return count;
+}
+
+/*******************************************************************************
+* Function Name: https_cache_store
+********************************************************************************
+* Summary:
+*  Records the validators and body of a 200 (OK) response, replacing the
+*  least recently used entry when the cache is full. A response without
+*  validators, or with a body larger than HTTPS_CACHE_BODY_LENGTH, removes
+*  the resource from the cache.
+*
+* Parameters:
+*  path              - Resource path
+*  etag              - ETag of the response, or NULL
+*  etag_len          - Length of the ETag
+*  last_modified     - Last-Modified of the response, or NULL
+*  last_modified_len - Length of Last-Modified
+*  body              - Response body
+*  body_len          - Length of the body
+*
+* Return:
+*  https_cache_entry_t *: The entry, or NULL if the response is not cached.
+*
+*******************************************************************************/
+https_cache_entry_t *https_cache_store(const char *path,
+                                       const char *etag, uint32_t etag_len,
+                                       const char *last_modified,
+                                       uint32_t last_modified_len,
+                                       const uint8_t *body, uint32_t body_len)
+{
+    https_cache_entry_t *entry = https_cache_lookup(path);
+
+    if (NULL == entry)
+    {
+        entry = &cache[0];
+
+        for (uint32_t i = 1U; (i < HTTPS_CACHE_SIZE) && entry->valid; i++)
+        {
+            if (!cache[i].valid || (cache[i].last_used < entry->last_used))
+            {
+                entry = &cache[i];
+            }
+        }
+    }
+
+    entry->valid = false;
+
+    if ((strlen(path) >= HTTPS_CACHE_PATH_LENGTH) ||
+        (body_len > HTTPS_CACHE_BODY_LENGTH))
+    {
+        return NULL;
+    }
+
+    copy_validator(entry->etag, etag, etag_len);
+    copy_validator(entry->last_modified, last_modified, last_modified_len);
+
+    if (('\0' == entry->etag[0]) && ('\0' == entry->last_modified[0]))
+    {
+        return NULL;
+    }
+
+    (void) strcpy(entry->path, path);
+    entry->body_len = body_len;
+
+    if (body_len > 0U)
+    {
+        (void) memcpy(entry->body, body, body_len);
+    }
+
+    entry->last_used = (uint32_t) xTaskGetTickCount();
+    entry->valid = true;
+    cache_stats.stores++;
+
+    return entry;
+}
+
+/*******************************************************************************
+* Function Name: https_cache_not_modified
+********************************************************************************
+* Summary:
+*  Records that the server answered a conditional request with 304 (Not
+*  Modified), so the cached body is still current.
+*
+*******************************************************************************/
+void https_cache_not_modified(https_cache_entry_t *entry)
+{
+    cache_stats.not_modified++;
+    cache_stats.body_bytes_saved += entry->body_len;
+}
+
+/*******************************************************************************
+* Function Name: https_cache_clear
+********************************************************************************
+* Summary:
+*  Removes every resource from the cache. Called after requests that may
+*  change resources on the server.
+*
+*******************************************************************************/
+void https_cache_clear(void)
+{
+    for (uint32_t i = 0U; i < HTTPS_CACHE_SIZE; i++)
+    {
+        cache[i].valid = false;
+    }
+}
+
+/*******************************************************************************
+* Function Name: https_cache_get_stats
+********************************************************************************
+* Summary:
+*  Returns a copy of the cache counters.
+*
+*******************************************************************************/
+void https_cache_get_stats(https_cache_stats_t *stats)
+{
+    *stats = cache_stats;
+}
+
+/*******************************************************************************
+* Function Name: https_cache_print_stats
+********************************************************************************
+* Summary:
+*  Prints the cache counters on the debug UART.
+*
+*******************************************************************************/
+void https_cache_print_stats(void)
+{
+    app_log_printf(" Response cache  : %lu conditional, %lu not modified, "
+            "%lu body bytes saved\n",
+            (unsigned long) cache_stats.conditional_requests,
+            (unsigned long) cache_stats.not_modified,
+            (unsigned long) cache_stats.body_bytes_saved);
+}
+
+
+/* [] END OF FILE */
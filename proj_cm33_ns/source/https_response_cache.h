@@ -0,0 +1,123 @@
+/*******************************************************************************
+* File Name: https_response_cache.h
+*
+* Description: This file is the public interface of https_response_cache.c.
+*
+* Related Document: See README.md
+********************************************************************************
+* Copyright 2024-2025, Cypress Semiconductor Corporation (an Infineon company) or
+* an affiliate of Cypress Semiconductor Corporation.  All rights reserved.
+*
+* This software, including source code, documentation and related
+* materials ("Software") is owned by Cypress Semiconductor Corporation
+* or one of its affiliates ("Cypress") and is protected by and subject to
+* worldwide patent protection (United States and foreign),
+* United States copyright laws and international treaty provisions.
+* Therefore, you may use this Software only as provided in the license
+* agreement accompanying the software package from which you
+* obtained this Software ("EULA").
+* If no EULA applies, Cypress hereby grants you a personal, non-exclusive,
+* non-transferable license to copy, modify, and compile the Software
+* source code solely for use in connection with Cypress's
+* integrated circuit products.  Any reproduction, modification, translation,
+* compilation, or representation of this Software except as specified
+* above is prohibited without the express written permission of Cypress.
+*
+* Disclaimer: THIS SOFTWARE IS PROVIDED AS-IS, WITH NO WARRANTY OF ANY KIND,
+* EXPRESS OR IMPLIED, INCLUDING, BUT NOT LIMITED TO, NONINFRINGEMENT, IMPLIED
+* WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE. Cypress
+* reserves the right to make changes to the Software without notice. Cypress
+* does not assume any liability arising out of the application or use of the
+* Software or any product or circuit described in the Software. Cypress does
+* not authorize its products for use in any products where a malfunction or
+* failure of the Cypress product may reasonably be expected to result in
+* significant property damage, injury or death ("High Risk Product"). By
+* including Cypress's product in a High Risk Product, the manufacturer
+* of such system or application assumes all risk of such use and in doing
+* so agrees to indemnify Cypress against all liability.
+*******************************************************************************/
+
+/*******************************************************************************
+* Include guard
+*******************************************************************************/
+#ifndef HTTPS_RESPONSE_CACHE_H_
+#define HTTPS_RESPONSE_CACHE_H_
+
+/*******************************************************************************
+* Header Files
+*******************************************************************************/
+#include <stdint.h>
+#include <stdbool.h>
+#include "cy_http_client_api.h"
+#include "http_content_coding.h"
+
+/*******************************************************************************
+* Macros
+*******************************************************************************/
+
+/* Number of resources remembered by the cache. */
+#define HTTPS_CACHE_SIZE                         (2U)
+
+/* Longest resource path that can be cached, including the terminating NUL. */
+#define HTTPS_CACHE_PATH_LENGTH                  (64U)
+
+/* Longest ETag or Last-Modified value kept, including the terminating NUL.
+ * A Last-Modified date is 29 characters long.
+ */
+#define HTTPS_CACHE_VALIDATOR_LENGTH             (64U)
+
+/* Largest response body kept. Resources with a larger body are not cached,
+ * since a 304 (Not Modified) answer could not be served without the body.
+ */
+#define HTTPS_CACHE_BODY_LENGTH                  (512U)
+
+/* Maximum number of conditional headers added to a request. */
+#define HTTPS_CACHE_MAX_CONDITIONAL_HEADERS      (2U)
+
+/*******************************************************************************
+* Data Types
+*******************************************************************************/
+
+/* Validators and body of one cached resource. */
+typedef struct
+{
+    bool valid;
+    char path[HTTPS_CACHE_PATH_LENGTH];
+    char etag[HTTPS_CACHE_VALIDATOR_LENGTH];
+    char last_modified[HTTPS_CACHE_VALIDATOR_LENGTH];
+    uint32_t body_len;
+    uint8_t body[HTTPS_CACHE_BODY_LENGTH];
+    http_coding_t content_coding;
+    uint32_t last_used;
+} https_cache_entry_t;
+
+/* Counters of the conditional requests. */
+typedef struct
+{
+    uint32_t conditional_requests;
+    uint32_t not_modified;
+    uint32_t stores;
+    uint32_t body_bytes_saved;
+} https_cache_stats_t;
+
+/*******************************************************************************
+* Function Prototypes
+*******************************************************************************/
+https_cache_entry_t *https_cache_lookup(const char *path);
+uint32_t https_cache_conditional_headers(const https_cache_entry_t *entry,
+                                         cy_http_client_header_t *headers,
+                                         uint32_t max_headers);
+https_cache_entry_t *https_cache_store(const char *path,
+                                       const char *etag, uint32_t etag_len,
+                                       const char *last_modified,
+                                       uint32_t last_modified_len,
+                                       const uint8_t *body, uint32_t body_len);
+void https_cache_not_modified(https_cache_entry_t *entry);
+void https_cache_clear(void);
+void https_cache_get_stats(https_cache_stats_t *stats);
+void https_cache_print_stats(void);
+
+#endif /* HTTPS_RESPONSE_CACHE_H_ */
+
+
+/* [] END OF FILE */
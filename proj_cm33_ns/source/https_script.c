@@ -0,0 +1,700 @@
+/*******************************************************************************
+* File Name: https_script.c
+*
+* Description: This file implements the request script runner. A script lists
+* requests to send back to back, each with a repeat count, a number of
+* requests kept in flight and a delay, and the runner reports the aggregate
+* throughput and latency.
+*
+* Related Document: See README.md
+********************************************************************************
+* Copyright 2024-2025, Cypress Semiconductor Corporation (an Infineon company) or
+* an affiliate of Cypress Semiconductor Corporation.  All rights reserved.
+*
+* This software, including source code, documentation and related
+* materials ("Software") is owned by Cypress Semiconductor Corporation
+* or one of its affiliates ("Cypress") and is protected by and subject to
+* worldwide patent protection (United States and foreign),
+* United States copyright laws and international treaty provisions.
+* Therefore, you may use this Software only as provided in the license
+* agreement accompanying the software package from which you
+* obtained this Software ("EULA").
+* If no EULA applies, Cypress hereby grants you a personal, non-exclusive,
+* non-transferable license to copy, modify, and compile the Software
+* source code solely for use in connection with Cypress's
+* integrated circuit products.  Any reproduction, modification, translation,
+* compilation, or representation of this Software except as specified
+* above is prohibited without the express written permission of Cypress.
+*
+* Disclaimer: THIS SOFTWARE IS PROVIDED AS-IS, WITH NO WARRANTY OF ANY KIND,
+* EXPRESS OR IMPLIED, INCLUDING, BUT NOT LIMITED TO, NONINFRINGEMENT, IMPLIED
+* WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE. Cypress
+* reserves the right to make changes to the Software without notice. Cypress
+* does not assume any liability arising out of the application or use of the
+* Software or any product or circuit described in the Software. Cypress does
+* not authorize its products for use in any products where a malfunction or
+* failure of the Cypress product may reasonably be expected to result in
+* significant property damage, injury or death ("High Risk Product"). By
+* including Cypress's product in a High Risk Product, the manufacturer
+* of such system or application assumes all risk of such use and in doing
+* so agrees to indemnify Cypress against all liability.
+*******************************************************************************/
+
+/*******************************************************************************
+* Header Files
+*******************************************************************************/
+#include "https_script.h"
+#include "app_log.h"
+#include "secure_http_client.h"
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+/* FreeRTOS header file */
+#include <FreeRTOS.h>
+#include <task.h>
+
+/*******************************************************************************
+* Macros
+*******************************************************************************/
+#define MS_PER_SEC                                   (1000U)
+#define PERCENT_SCALE                                (100U)
+
+/* Status codes from this one on count as failed requests. */
+#define FAILED_STATUS_CODE                           (400U)
+
+/* Longest word of a step, the path included. */
+#define WORD_LENGTH                                  (HTTPS_SCRIPT_PATH_LENGTH)
+
+/* Characters the request bodies are filled with. */
+#define BODY_PATTERN                                 "0123456789abcdef"
+
+/*******************************************************************************
+* Data Types
+*******************************************************************************/
+
+/* Request kept in flight by the runner. */
+typedef struct
+{
+    bool in_use;
+    uint32_t run;
+    https_metrics_stamp_t start;
+} script_request_t;
+
+/* Method names of the script. */
+typedef struct
+{
+    const char *name;
+    cy_http_client_method_t method;
+} script_method_t;
+
+/*******************************************************************************
+* Global Variables
+********************************************************************************/
+static const script_method_t script_methods[] =
+{
+    { "GET",  CY_HTTP_CLIENT_METHOD_GET  },
+    { "POST", CY_HTTP_CLIENT_METHOD_POST },
+    { "PUT",  CY_HTTP_CLIENT_METHOD_PUT  },
+    { "HEAD", CY_HTTP_CLIENT_METHOD_HEAD },
+};
+
+/* Request bodies are sent by reference from this buffer. */
+static uint8_t body_buffer[HTTPS_SCRIPT_BODY_MAX];
+static bool body_filled = false;
+
+/* Requests in flight, and the results of the step being run. Both are
+ * updated by the event loop task as the requests complete. run identifies
+ * the step, so that a completion arriving after its step was abandoned is
+ * ignored.
+ */
+static script_request_t script_requests[HTTPS_SCRIPT_MAX_CONCURRENCY];
+static https_script_result_t step_result;
+static uint32_t step_run = 0U;
+static uint32_t step_in_flight = 0U;
+static TaskHandle_t runner_task = NULL;
+
+/* Steps of the script entered on the console or the built-in script. */
+static https_script_step_t script_steps[HTTPS_SCRIPT_MAX_STEPS];
+
+/*******************************************************************************
+* Function Definitions
+*******************************************************************************/
+
+/*******************************************************************************
+* Function Name: method_name
+********************************************************************************
+* Summary:
+*  Returns the name of a method as written in a script.
+*
+*******************************************************************************/
+static const char *method_name(cy_http_client_method_t method)
+{
+    for (uint32_t i = 0U; i < (sizeof(script_methods) /
+                               sizeof(script_methods[0])); i++)
+    {
+        if (method == script_methods[i].method)
+        {
+            return script_methods[i].name;
+        }
+    }
+
+    return "?";
+}
+
+/*******************************************************************************
+* Function Name: next_word
+********************************************************************************
+* Summary:
+*  Copies the next word of a step into word. Words are separated by spaces
+*  and tabs, and a step ends at a ';', a line feed or the end of the text.
+*
+* Parameters:
+*  text - Position in the script, advanced past the word
+*  word - Receives the word, NUL terminated
+*
+* Return:
+*  bool: true if a word was found, false at the end of the step. A word
+*  longer than the buffer is cut short.
+*
+*******************************************************************************/
+static bool next_word(const char **text, char *word)
+{
+    const char *p = *text;
+    uint32_t len = 0U;
+
+    while ((' ' == *p) || ('\t' == *p) || ('\r' == *p))
+    {
+        p++;
+    }
+
+    while (('\0' != *p) && (';' != *p) && ('\n' != *p) && (' ' != *p) &&
+           ('\t' != *p) && ('\r' != *p))
+    {
+        if (len < (WORD_LENGTH - 1U))
+        {
+            word[len++] = *p;
+        }
+        p++;
+    }
+
+    word[len] = '\0';
+    *text = p;
+
+    return (0U != len);
+}
+
+/*******************************************************************************
+* Function Name: parse_option
+********************************************************************************
+* Summary:
+*  Parses a "name=value" option of a step into the step.
+*
+* Return:
+*  cy_rslt_t: CY_RSLT_SUCCESS, or CY_RSLT_TYPE_ERROR if the option is unknown
+*  or its value is out of range.
+*
+*******************************************************************************/
+static cy_rslt_t parse_option(const char *word, https_script_step_t *step)
+{
+    const char *equals = strchr(word, '=');
+    char *end = NULL;
+    unsigned long value;
+    size_t name_len;
+
+    /* strtoul would accept a sign or spaces, and wrap "-1" to the largest
+     * value, so the value must start with a digit.
+     */
+    if ((NULL == equals) || ('0' > equals[1]) || ('9' < equals[1]))
+    {
+        return CY_RSLT_TYPE_ERROR;
+    }
+
+    value = strtoul(&equals[1], &end, 10);
+    if ('\0' != *end)
+    {
+        return CY_RSLT_TYPE_ERROR;
+    }
+
+    name_len = (size_t) (equals - word);
+
+    if ((4U == name_len) && (0 == strncmp(word, "size", name_len)) &&
+        (value <= HTTPS_SCRIPT_BODY_MAX))
+    {
+        step->body_len = (uint32_t) value;
+    }
+    else if ((1U == name_len) && ('n' == word[0]) && (0U != value))
+    {
+        step->repeat = (uint32_t) value;
+    }
+    else if ((1U == name_len) && ('c' == word[0]) && (0U != value) &&
+             (value <= HTTPS_SCRIPT_MAX_CONCURRENCY))
+    {
+        step->concurrency = (uint32_t) value;
+    }
+    else if ((5U == name_len) && (0 == strncmp(word, "delay", name_len)))
+    {
+        step->delay_ms = (uint32_t) value;
+    }
+    else
+    {
+        return CY_RSLT_TYPE_ERROR;
+    }
+
+    return CY_RSLT_SUCCESS;
+}
+
+/*******************************************************************************
+* Function Name: https_script_parse
+********************************************************************************
+* Summary:
+*  Parses a script into its steps. A step is
+*
+*    METHOD PATH [size=BYTES] [n=REPEAT] [c=CONCURRENCY] [delay=MS]
+*
+*  and steps are separated by ';' or a line feed. Empty steps are skipped.
+*  A step without options sends one request without a body.
+*
+* Parameters:
+*  text      - Script, NUL terminated
+*  steps     - Receives the steps
+*  max_steps - Number of entries of steps
+*  count     - Returns the number of steps parsed
+*
+* Return:
+*  cy_rslt_t: CY_RSLT_SUCCESS if the whole script was parsed and has at least
+*  one step, CY_RSLT_TYPE_ERROR otherwise.
+*
+*******************************************************************************/
+cy_rslt_t https_script_parse(const char *text, https_script_step_t *steps,
+                             uint32_t max_steps, uint32_t *count)
+{
+    char word[WORD_LENGTH];
+    uint32_t number = 1U;
+
+    *count = 0U;
+
+    if (NULL == text)
+    {
+        return CY_RSLT_TYPE_ERROR;
+    }
+
+    while ('\0' != *text)
+    {
+        https_script_step_t *step = &steps[*count];
+        bool found = false;
+
+        if (!next_word(&text, word))
+        {
+            /* Empty step. */
+            if ('\0' != *text)
+            {
+                text++;
+                number++;
+            }
+            continue;
+        }
+
+        if (*count >= max_steps)
+        {
+            ERR_INFO(("Script has more than %lu steps.\n",
+                    (unsigned long) max_steps));
+            return CY_RSLT_TYPE_ERROR;
+        }
+
+        (void) memset(step, 0, sizeof(*step));
+        step->repeat = 1U;
+        step->concurrency = 1U;
+
+        for (uint32_t i = 0U; i < (sizeof(script_methods) /
+                                   sizeof(script_methods[0])); i++)
+        {
+            if (0 == strcmp(word, script_methods[i].name))
+            {
+                step->method = script_methods[i].method;
+                found = true;
+                break;
+            }
+        }
+
+        if ((!found) || (!next_word(&text, step->path)) ||
+            ('/' != step->path[0]))
+        {
+            ERR_INFO(("Script step %lu needs a method and a path.\n",
+                    (unsigned long) number));
+            return CY_RSLT_TYPE_ERROR;
+        }
+
+        while (next_word(&text, word))
+        {
+            if (CY_RSLT_SUCCESS != parse_option(word, step))
+            {
+                ERR_INFO(("Script step %lu has a bad option: %s\n",
+                        (unsigned long) number, word));
+                return CY_RSLT_TYPE_ERROR;
+            }
+        }
+
+        (*count)++;
+    }
+
+    return (0U != *count) ? CY_RSLT_SUCCESS : CY_RSLT_TYPE_ERROR;
+}
+
+/*******************************************************************************
+* Function Name: request_done
+********************************************************************************
+* Summary:
+*  Called on the event loop task when a request of the runner completes.
+*  Records its latency and result, and wakes the runner.
+*
+*******************************************************************************/
+static void request_done(https_async_handle_t handle, cy_rslt_t result,
+                         const https_stream_response_t *response, void *arg)
+{
+    script_request_t *request = (script_request_t *) arg;
+    uint32_t latency_us = https_metrics_elapsed_us(&request->start);
+    bool failed = ((CY_RSLT_SUCCESS != result) ||
+                   (response->status_code >= FAILED_STATUS_CODE));
+    bool current;
+
+    CY_UNUSED_PARAMETER(handle);
+
+    /* The latency is added in the same critical section as the decrement,
+     * since the runner takes the result once nothing is in flight. The
+     * critical section of the histogram nests in this one.
+     */
+    taskENTER_CRITICAL();
+    current = (request->run == step_run);
+    if (current)
+    {
+        if (failed)
+        {
+            step_result.failures++;
+        }
+        step_result.bytes_received += response->body_len;
+        https_histogram_add(&step_result.latency, latency_us);
+        step_in_flight--;
+    }
+    request->in_use = false;
+    taskEXIT_CRITICAL();
+
+    (void) xTaskNotifyGive(runner_task);
+}
+
+/*******************************************************************************
+* Function Name: run_step
+********************************************************************************
+* Summary:
+*  Sends the requests of one step on the event loop, keeping up to the
+*  concurrency of the step in flight, and waits for all of them to complete.
+*
+* Parameters:
+*  step   - Step to run
+*  result - Filled with the result of the step
+*
+* Return:
+*  cy_rslt_t: CY_RSLT_SUCCESS if every request completed, CY_RSLT_TYPE_ERROR
+*  if the requests could not be submitted or their completions stopped.
+*
+*******************************************************************************/
+static cy_rslt_t run_step(const https_script_step_t *step,
+                          https_script_result_t *result)
+{
+    cy_rslt_t status = CY_RSLT_SUCCESS;
+    https_async_handle_t handle;
+    uint32_t submitted = 0U;
+    uint32_t in_flight;
+    TickType_t start;
+    https_stream_request_t request =
+    {
+        .method            = step->method,
+        .path              = step->path,
+        .content_type      = (0U != step->body_len) ? "text/plain" : NULL,
+        .body              = body_buffer,
+        .body_len          = step->body_len,
+        .body_by_reference = true,
+        .accept_encoding   = false,
+        .body_cb           = NULL,
+        .arg               = NULL
+    };
+
+    taskENTER_CRITICAL();
+    step_run++;
+    (void) memset(&step_result, 0, sizeof(step_result));
+    step_in_flight = 0U;
+    taskEXIT_CRITICAL();
+
+    runner_task = xTaskGetCurrentTaskHandle();
+
+    /* Drop notifications left over from an earlier step. */
+    (void) ulTaskNotifyTake(pdTRUE, 0U);
+
+    start = xTaskGetTickCount();
+
+    while (true)
+    {
+        /* Top up the requests in flight. */
+        while ((CY_RSLT_SUCCESS == status) && (submitted < step->repeat) &&
+               (step_in_flight < step->concurrency))
+        {
+            script_request_t *slot = NULL;
+
+            for (uint32_t i = 0U; i < HTTPS_SCRIPT_MAX_CONCURRENCY; i++)
+            {
+                if (!script_requests[i].in_use)
+                {
+                    slot = &script_requests[i];
+                    break;
+                }
+            }
+
+            if (NULL == slot)
+            {
+                /* Requests of an abandoned step are still in flight. */
+                break;
+            }
+
+            slot->in_use = true;
+            slot->run = step_run;
+            https_metrics_stamp(&slot->start);
+
+            taskENTER_CRITICAL();
+            step_in_flight++;
+            taskEXIT_CRITICAL();
+
+            if (CY_RSLT_SUCCESS != https_async_submit(&request, request_done,
+                                                      slot, &handle))
+            {
+                taskENTER_CRITICAL();
+                step_in_flight--;
+                slot->in_use = false;
+                taskEXIT_CRITICAL();
+                status = CY_RSLT_TYPE_ERROR;
+                break;
+            }
+
+            submitted++;
+
+            if (0U != step->delay_ms)
+            {
+                vTaskDelay(pdMS_TO_TICKS(step->delay_ms));
+            }
+        }
+
+        taskENTER_CRITICAL();
+        in_flight = step_in_flight;
+        taskEXIT_CRITICAL();
+
+        /* Done once every request sent has completed, and all were sent or
+         * no more can be.
+         */
+        if ((0U == in_flight) &&
+            ((submitted >= step->repeat) || (CY_RSLT_SUCCESS != status)))
+        {
+            break;
+        }
+
+        /* One notification is given per completed request. */
+        if (0U == ulTaskNotifyTake(pdFALSE,
+                pdMS_TO_TICKS(HTTPS_SCRIPT_COMPLETION_TIMEOUT_MS)))
+        {
+            ERR_INFO(("Script step abandoned, %lu requests still in "
+                    "flight.\n", (unsigned long) in_flight));
+            status = CY_RSLT_TYPE_ERROR;
+            break;
+        }
+    }
+
+    taskENTER_CRITICAL();
+    step_run++;
+    in_flight = step_in_flight;
+    *result = step_result;
+    taskEXIT_CRITICAL();
+
+    /* Requests never answered count as failed. */
+    result->requests = submitted;
+    result->failures += in_flight;
+    result->bytes_sent = (uint64_t) submitted * step->body_len;
+    result->elapsed_ms = (uint32_t) pdTICKS_TO_MS(xTaskGetTickCount() -
+                                                  start);
+
+    return status;
+}
+
+/*******************************************************************************
+* Function Name: add_result
+********************************************************************************
+* Summary:
+*  Adds the result of a step to the total of the script.
+*
+*******************************************************************************/
+static void add_result(https_script_result_t *total,
+                       const https_script_result_t *step)
+{
+    total->requests += step->requests;
+    total->failures += step->failures;
+    total->bytes_sent += step->bytes_sent;
+    total->bytes_received += step->bytes_received;
+    total->elapsed_ms += step->elapsed_ms;
+
+    if ((0U == total->latency.count) ||
+        ((0U != step->latency.count) &&
+         (step->latency.min_us < total->latency.min_us)))
+    {
+        total->latency.min_us = step->latency.min_us;
+    }
+
+    if (step->latency.max_us > total->latency.max_us)
+    {
+        total->latency.max_us = step->latency.max_us;
+    }
+
+    total->latency.count += step->latency.count;
+    total->latency.total_us += step->latency.total_us;
+
+    for (uint32_t i = 0U; i < HTTPS_METRICS_BUCKETS; i++)
+    {
+        total->latency.buckets[i] += step->latency.buckets[i];
+    }
+}
+
+/*******************************************************************************
+* Function Name: https_script_run
+********************************************************************************
+* Summary:
+*  Runs the steps of a script one after the other on the event loop of the
+*  asynchronous requests, and prints the result of every step and the total.
+*
+* Parameters:
+*  steps - Steps to run
+*  count - Number of steps
+*  total - Filled with the total of all steps, may be NULL
+*
+* Return:
+*  cy_rslt_t: CY_RSLT_SUCCESS if every step ran to the end. A request
+*  answered with an error status still counts as run.
+*
+*******************************************************************************/
+cy_rslt_t https_script_run(const https_script_step_t *steps, uint32_t count,
+                           https_script_result_t *total)
+{
+    cy_rslt_t status = CY_RSLT_SUCCESS;
+    https_script_result_t result;
+    https_script_result_t sum;
+    char name[WORD_LENGTH + 16U];
+
+    if (!body_filled)
+    {
+        for (uint32_t i = 0U; i < HTTPS_SCRIPT_BODY_MAX; i++)
+        {
+            body_buffer[i] = (uint8_t) BODY_PATTERN[i %
+                    (sizeof(BODY_PATTERN) - 1U)];
+        }
+        body_filled = true;
+    }
+
+    (void) memset(&sum, 0, sizeof(sum));
+
+    for (uint32_t i = 0U; (i < count) && (CY_RSLT_SUCCESS == status); i++)
+    {
+        app_log_printf("\n Step %lu: %s %s size=%lu n=%lu c=%lu delay=%lu\n",
+                (unsigned long) (i + 1U), method_name(steps[i].method),
+                steps[i].path, (unsigned long) steps[i].body_len,
+                (unsigned long) steps[i].repeat,
+                (unsigned long) steps[i].concurrency,
+                (unsigned long) steps[i].delay_ms);
+
+        status = run_step(&steps[i], &result);
+        add_result(&sum, &result);
+
+        (void) snprintf(name, sizeof(name), "Step %lu",
+                (unsigned long) (i + 1U));
+        https_script_print_result(name, &result);
+    }
+
+    if (count > 1U)
+    {
+        app_log_printf("\n");
+        https_script_print_result("Total", &sum);
+    }
+
+    if (NULL != total)
+    {
+        *total = sum;
+    }
+
+    return status;
+}
+
+/*******************************************************************************
+* Function Name: https_script_run_text
+********************************************************************************
+* Summary:
+*  Parses a script and runs it.
+*
+* Parameters:
+*  text - Script, NUL terminated
+*
+* Return:
+*  cy_rslt_t: CY_RSLT_SUCCESS if the script was parsed and ran to the end.
+*
+*******************************************************************************/
+cy_rslt_t https_script_run_text(const char *text)
+{
+    uint32_t count = 0U;
+    cy_rslt_t result = https_script_parse(text, script_steps,
+                                          HTTPS_SCRIPT_MAX_STEPS, &count);
+
+    if (CY_RSLT_SUCCESS == result)
+    {
+        result = https_script_run(script_steps, count, NULL);
+    }
+
+    return result;
+}
+
+/*******************************************************************************
+* Function Name: https_script_print_result
+********************************************************************************
+* Summary:
+*  Prints the throughput and latency of a step or a whole script on the
+*  debug UART.
+*
+*******************************************************************************/
+void https_script_print_result(const char *name,
+                               const https_script_result_t *result)
+{
+    https_metrics_summary_t latency;
+    uint32_t requests_per_sec_x100 = 0U;
+    uint32_t kbytes_per_sec = 0U;
+
+    https_histogram_get_summary(&result->latency, &latency);
+
+    if (0U != result->elapsed_ms)
+    {
+        requests_per_sec_x100 = (uint32_t) (((uint64_t) result->requests *
+                MS_PER_SEC * PERCENT_SCALE) / result->elapsed_ms);
+        kbytes_per_sec = (uint32_t) ((result->bytes_sent +
+                result->bytes_received) / result->elapsed_ms);
+    }
+
+    app_log_printf(" %s: %lu requests, %lu failed, %lu ms\n", name,
+            (unsigned long) result->requests,
+            (unsigned long) result->failures,
+            (unsigned long) result->elapsed_ms);
+    app_log_printf(" Requests/sec    : %lu.%02lu\n",
+            (unsigned long) (requests_per_sec_x100 / PERCENT_SCALE),
+            (unsigned long) (requests_per_sec_x100 % PERCENT_SCALE));
+    app_log_printf(" Body bytes      : sent %lu received %lu (%lu kB/s)\n",
+            (unsigned long) result->bytes_sent,
+            (unsigned long) result->bytes_received,
+            (unsigned long) kbytes_per_sec);
+    app_log_printf(" Latency (us)    : min %lu p50 %lu p90 %lu p99 %lu"
+            " max %lu\n", (unsigned long) latency.min_us,
+            (unsigned long) latency.p50_us, (unsigned long) latency.p90_us,
+            (unsigned long) latency.p99_us, (unsigned long) latency.max_us);
+}
+
+
+/* [] END OF FILE */
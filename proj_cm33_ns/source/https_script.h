@@ -0,0 +1,139 @@
+/*******************************************************************************
+* File Name: https_script.h
+*
+* Description: This file contains the constants, structures and function
+* prototypes of the request script runner.
+*
+* Related Document: See README.md
+********************************************************************************
+* Copyright 2024-2025, Cypress Semiconductor Corporation (an Infineon company) or
+* an affiliate of Cypress Semiconductor Corporation.  All rights reserved.
+*
+* This software, including source code, documentation and related
+* materials ("Software") is owned by Cypress Semiconductor Corporation
+* or one of its affiliates ("Cypress") and is protected by and subject to
+* worldwide patent protection (United States and foreign),
+* United States copyright laws and international treaty provisions.
+* Therefore, you may use this Software only as provided in the license
+* agreement accompanying the software package from which you
+* obtained this Software ("EULA").
+* If no EULA applies, Cypress hereby grants you a personal, non-exclusive,
+* non-transferable license to copy, modify, and compile the Software
+* source code solely for use in connection with Cypress's
+* integrated circuit products.  Any reproduction, modification, translation,
+* compilation, or representation of this Software except as specified
+* above is prohibited without the express written permission of Cypress.
+*
+* Disclaimer: THIS SOFTWARE IS PROVIDED AS-IS, WITH NO WARRANTY OF ANY KIND,
+* EXPRESS OR IMPLIED, INCLUDING, BUT NOT LIMITED TO, NONINFRINGEMENT, IMPLIED
+* WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE. Cypress
+* reserves the right to make changes to the Software without notice. Cypress
+* does not assume any liability arising out of the application or use of the
+* Software or any product or circuit described in the Software. Cypress does
+* not authorize its products for use in any products where a malfunction or
+* failure of the Cypress product may reasonably be expected to result in
+* significant property damage, injury or death ("High Risk Product"). By
+* including Cypress's product in a High Risk Product, the manufacturer
+* of such system or application assumes all risk of such use and in doing
+* so agrees to indemnify Cypress against all liability.
+*******************************************************************************/
+
+/*******************************************************************************
+* Include guard
+*******************************************************************************/
+#ifndef HTTPS_SCRIPT_H_
+#define HTTPS_SCRIPT_H_
+
+/*******************************************************************************
+* Header Files
+*******************************************************************************/
+#include <stdint.h>
+#include "cy_result.h"
+#include "cy_http_client_api.h"
+#include "https_async.h"
+#include "https_metrics.h"
+
+/*******************************************************************************
+* Macros
+*******************************************************************************/
+
+/* Script run by the menu when '.' is entered, and at startup when
+ * HTTPS_SCRIPT_AUTORUN_COUNT is not 0. Steps are separated by ';' or a line
+ * feed and have the form
+ *
+ *   METHOD PATH [size=BYTES] [n=REPEAT] [c=CONCURRENCY] [delay=MS]
+ *
+ * METHOD is GET, POST, PUT or HEAD. size is the request body length, n the
+ * number of requests, c the number of requests kept in flight and delay the
+ * wait after each request is submitted.
+ */
+#define HTTPS_SCRIPT_BUILTIN                                                \
+        "GET / n=20 c=4;"                                                   \
+        "POST / size=256 n=10 c=2;"                                         \
+        "PUT /myhellomessage size=64 n=5 delay=100;"                        \
+        "GET /myhellomessage n=5"
+
+/* Number of times the built-in script runs after the first connection,
+ * before the menu is shown. Set a large count to soak-test the client
+ * without a terminal.
+ */
+#define HTTPS_SCRIPT_AUTORUN_COUNT               (0U)
+
+/* Limits of a script. */
+#define HTTPS_SCRIPT_MAX_STEPS                   (8U)
+#define HTTPS_SCRIPT_PATH_LENGTH                 (64U)
+#define HTTPS_SCRIPT_LINE_LENGTH                 (256U)
+#define HTTPS_SCRIPT_BODY_MAX                    (4096U)
+
+/* Requests kept in flight on the event loop. One of its slots is left free,
+ * since a completed slot is only released after its callback returns.
+ */
+#define HTTPS_SCRIPT_MAX_CONCURRENCY             (HTTPS_ASYNC_MAX_REQUESTS - 1U)
+
+/* Longest wait for the next completion before a step is abandoned. */
+#define HTTPS_SCRIPT_COMPLETION_TIMEOUT_MS       \
+        (2U * HTTPS_ASYNC_REQUEST_TIMEOUT_MS)
+
+/*******************************************************************************
+* Data Types
+*******************************************************************************/
+
+/* One step of a script. */
+typedef struct
+{
+    cy_http_client_method_t method;
+    char path[HTTPS_SCRIPT_PATH_LENGTH];
+    uint32_t body_len;
+    uint32_t repeat;
+    uint32_t concurrency;
+    uint32_t delay_ms;
+} https_script_step_t;
+
+/* Aggregate result of a step or of a whole script. A request fails if it
+ * gets no response or a status code of 400 or more.
+ */
+typedef struct
+{
+    uint32_t requests;
+    uint32_t failures;
+    uint64_t bytes_sent;
+    uint64_t bytes_received;
+    uint32_t elapsed_ms;
+    https_histogram_t latency;
+} https_script_result_t;
+
+/*******************************************************************************
+* Function Prototypes
+*******************************************************************************/
+cy_rslt_t https_script_parse(const char *text, https_script_step_t *steps,
+                             uint32_t max_steps, uint32_t *count);
+cy_rslt_t https_script_run(const https_script_step_t *steps, uint32_t count,
+                           https_script_result_t *total);
+cy_rslt_t https_script_run_text(const char *text);
+void https_script_print_result(const char *name,
+                               const https_script_result_t *result);
+
+#endif /* HTTPS_SCRIPT_H_ */
+
+
+/* [] END OF FILE */
@@ -0,0 +1,221 @@
+/*******************************************************************************
+* File Name: https_server_cache.c
+*
+* Description: This file contains a small per-server address cache.
+* For every host and port it keeps the resolved address so a reconnect of
+* the streaming connections skips the DNS lookup. Only https_stream.c uses
+* it; the pooled connections of the HTTP client library resolve the host on
+* every connect. With an IP address as the host, there is no lookup to
+* skip. TLS session resumption is not implemented: every connect runs a
+* full handshake, which is counted here.
+*
+* Related Document: See README.md
+********************************************************************************
+* Copyright 2024-2025, Cypress Semiconductor Corporation (an Infineon company) or
+* an affiliate of Cypress Semiconductor Corporation.  All rights reserved.
+*
+* This software, including source code, documentation and related
+* materials ("Software") is owned by Cypress Semiconductor Corporation
+* or one of its affiliates ("Cypress") and is protected by and subject to
+* worldwide patent protection (United States and foreign),
+* United States copyright laws and international treaty provisions.
+* Therefore, you may use this Software only as provided in the license
+* agreement accompanying the software package from which you
+* obtained this Software ("EULA").
+* If no EULA applies, Cypress hereby grants you a personal, non-exclusive,
+* non-transferable license to copy, modify, and compile the Software
+* source code solely for use in connection with Cypress's
+* integrated circuit products.  Any reproduction, modification, translation,
+* compilation, or representation of this Software except as specified
+* above is prohibited without the express written permission of Cypress.
+*
+* Disclaimer: THIS SOFTWARE IS PROVIDED AS-IS, WITH NO WARRANTY OF ANY KIND,
+* EXPRESS OR IMPLIED, INCLUDING, BUT NOT LIMITED TO, NONINFRINGEMENT, IMPLIED
+* WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE. Cypress
+* reserves the right to make changes to the Software without notice. Cypress
+* does not assume any liability arising out of the application or use of the
+* Software or any product or circuit described in the Software. Cypress does
+* not authorize its products for use in any products where a malfunction or
+* failure of the Cypress product may reasonably be expected to result in
+* significant property damage, injury or death ("High Risk Product"). By
+* including Cypress's product in a High Risk Product, the manufacturer
+* of such system or application assumes all risk of such use and in doing
+* so agrees to indemnify Cypress against all liability.
+*******************************************************************************/
+
+/*******************************************************************************
+* Header Files
+*******************************************************************************/
+#include "https_server_cache.h"
+#include "app_log.h"
+#include <stdio.h>
+#include <string.h>
+
+/* FreeRTOS header file */
+#include <FreeRTOS.h>
+#include <task.h>
+
+/*******************************************************************************
+* Global Variables
+********************************************************************************/
+static https_server_entry_t cache[HTTPS_SERVER_CACHE_SIZE];
+static https_server_stats_t cache_stats;
+
+/*******************************************************************************
+* Function Definitions
+*******************************************************************************/
+
+/*******************************************************************************
+* Function Name: https_server_cache_lookup
+********************************************************************************
+* Summary:
+*  Finds the cache entry of a server.
+*
+* Parameters:
+*  host_name - Server host name
+*  port      - Server port
+*
+* Return:
+*  https_server_entry_t *: The entry, or NULL if the server is not cached.
+*
+*******************************************************************************/
+https_server_entry_t *https_server_cache_lookup(const char *host_name,
+                                                  uint16_t port)
+{
+    for (uint32_t i = 0U; i < HTTPS_SERVER_CACHE_SIZE; i++)
+    {
+        if (cache[i].valid && (cache[i].port == port) &&
+            (0 == strncmp(cache[i].host_name, host_name,
+                          HTTPS_SERVER_HOST_NAME_LENGTH)))
+        {
+            cache[i].last_used = (uint32_t) xTaskGetTickCount();
+            cache_stats.cache_hits++;
+            return &cache[i];
+        }
+    }
+
+    cache_stats.cache_misses++;
+
+    return NULL;
+}
+
+/*******************************************************************************
+* Function Name: https_server_cache_store
+********************************************************************************
+* Summary:
+*  Adds a server to the cache, replacing the least recently used entry when
+*  the cache is full.
+*
+* Parameters:
+*  host_name - Server host name
+*  port      - Server port
+*  address   - Resolved address of the server
+*
+* Return:
+*  https_server_entry_t *: The new entry, or NULL if the host name is too
+*  long to be cached.
+*
+*******************************************************************************/
+https_server_entry_t *https_server_cache_store(const char *host_name,
+        uint16_t port, const cy_socket_ip_address_t *address)
+{
+    https_server_entry_t *entry = &cache[0];
+
+    if (strlen(host_name) >= HTTPS_SERVER_HOST_NAME_LENGTH)
+    {
+        return NULL;
+    }
+
+    for (uint32_t i = 0U; i < HTTPS_SERVER_CACHE_SIZE; i++)
+    {
+        if (!cache[i].valid)
+        {
+            entry = &cache[i];
+            break;
+        }
+
+        if (cache[i].last_used < entry->last_used)
+        {
+            entry = &cache[i];
+        }
+    }
+
+    (void) memset(entry, 0, sizeof(*entry));
+    (void) strncpy(entry->host_name, host_name,
+                   HTTPS_SERVER_HOST_NAME_LENGTH - 1U);
+    entry->port = port;
+    entry->address = *address;
+    entry->last_used = (uint32_t) xTaskGetTickCount();
+    entry->valid = true;
+
+    return entry;
+}
+
+/*******************************************************************************
+* Function Name: https_server_cache_record_handshake
+********************************************************************************
+* Summary:
+*  Counts a TLS handshake. A failed handshake drops the entry so that the next
+*  connect resolves the host again, in case its address changed.
+*
+* Parameters:
+*  entry        - Cache entry used by the connect, or NULL
+*  result       - Result of the connect
+*  handshake_ms - Time the TCP connect and TLS handshake took
+*
+*******************************************************************************/
+void https_server_cache_record_handshake(https_server_entry_t *entry,
+                                          cy_rslt_t result,
+                                          uint32_t handshake_ms)
+{
+    if (CY_RSLT_SUCCESS != result)
+    {
+        cache_stats.handshake_failures++;
+
+        if (NULL != entry)
+        {
+            entry->valid = false;
+        }
+        return;
+    }
+
+    cache_stats.handshakes++;
+    cache_stats.handshake_ms_total += handshake_ms;
+}
+
+/*******************************************************************************
+* Function Name: https_server_cache_get_stats
+********************************************************************************
+* Summary:
+*  Returns a copy of the handshake counters.
+*
+*******************************************************************************/
+void https_server_cache_get_stats(https_server_stats_t *stats)
+{
+    *stats = cache_stats;
+}
+
+/*******************************************************************************
+* Function Name: https_server_cache_print_stats
+********************************************************************************
+* Summary:
+*  Prints the handshake counters on the debug UART.
+*
+*******************************************************************************/
+void https_server_cache_print_stats(void)
+{
+    uint32_t average_ms = (0U == cache_stats.handshakes) ? 0U :
+            (cache_stats.handshake_ms_total / cache_stats.handshakes);
+
+    app_log_printf(" TLS handshakes  : %lu ok, %lu failed, %lu ms average"
+            " (full, no session resumption)\n",
+            (unsigned long) cache_stats.handshakes,
+            (unsigned long) cache_stats.handshake_failures,
+            (unsigned long) average_ms);
+    app_log_printf(" Address cache   : %lu hits, %lu misses\n",
+            (unsigned long) cache_stats.cache_hits,
+            (unsigned long) cache_stats.cache_misses);
+}
+
+
+/* [] END OF FILE */
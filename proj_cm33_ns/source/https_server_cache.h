@@ -0,0 +1,107 @@
+/*******************************************************************************
+* File Name: https_server_cache.h
+*
+* Description: This file is the public interface of https_server_cache.c
+* and contains the configuration parameters of the server address cache.
+*
+* Related Document: See README.md
+********************************************************************************
+* Copyright 2024-2025, Cypress Semiconductor Corporation (an Infineon company) or
+* an affiliate of Cypress Semiconductor Corporation.  All rights reserved.
+*
+* This software, including source code, documentation and related
+* materials ("Software") is owned by Cypress Semiconductor Corporation
+* or one of its affiliates ("Cypress") and is protected by and subject to
+* worldwide patent protection (United States and foreign),
+* United States copyright laws and international treaty provisions.
+* Therefore, you may use this Software only as provided in the license
+* agreement accompanying the software package from which you
+* obtained this Software ("EULA").
+* If no EULA applies, Cypress hereby grants you a personal, non-exclusive,
+* non-transferable license to copy, modify, and compile the Software
+* source code solely for use in connection with Cypress's
+* integrated circuit products.  Any reproduction, modification, translation,
+* compilation, or representation of this Software except as specified
+* above is prohibited without the express written permission of Cypress.
+*
+* Disclaimer: THIS SOFTWARE IS PROVIDED AS-IS, WITH NO WARRANTY OF ANY KIND,
+* EXPRESS OR IMPLIED, INCLUDING, BUT NOT LIMITED TO, NONINFRINGEMENT, IMPLIED
+* WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE. Cypress
+* reserves the right to make changes to the Software without notice. Cypress
+* does not assume any liability arising out of the application or use of the
+* Software or any product or circuit described in the Software. Cypress does
+* not authorize its products for use in any products where a malfunction or
+* failure of the Cypress product may reasonably be expected to result in
+* significant property damage, injury or death ("High Risk Product"). By
+* including Cypress's product in a High Risk Product, the manufacturer
+* of such system or application assumes all risk of such use and in doing
+* so agrees to indemnify Cypress against all liability.
+*******************************************************************************/
+
+/*******************************************************************************
+* Include guard
+*******************************************************************************/
+#ifndef HTTPS_SERVER_CACHE_H_
+#define HTTPS_SERVER_CACHE_H_
+
+/*******************************************************************************
+* Header Files
+*******************************************************************************/
+#include <stdint.h>
+#include <stdbool.h>
+#include "cy_result.h"
+#include "cy_secure_sockets.h"
+
+/*******************************************************************************
+* Macros
+*******************************************************************************/
+
+/* Number of servers (host and port pairs) remembered by the cache. */
+#define HTTPS_SERVER_CACHE_SIZE                 (4U)
+
+/* Longest host name that can be cached, including the terminating NUL. */
+#define HTTPS_SERVER_HOST_NAME_LENGTH           (64U)
+
+/*******************************************************************************
+* Data Types
+*******************************************************************************/
+
+/* State kept for one server across connections. */
+typedef struct
+{
+    bool valid;
+    char host_name[HTTPS_SERVER_HOST_NAME_LENGTH];
+    uint16_t port;
+    cy_socket_ip_address_t address;
+    uint32_t last_used;
+} https_server_entry_t;
+
+/* Handshake counters of all cached servers. Every handshake is a full one,
+ * as TLS session resumption is not implemented.
+ */
+typedef struct
+{
+    uint32_t handshakes;
+    uint32_t handshake_failures;
+    uint32_t handshake_ms_total;
+    uint32_t cache_hits;
+    uint32_t cache_misses;
+} https_server_stats_t;
+
+/*******************************************************************************
+* Function Prototypes
+*******************************************************************************/
+https_server_entry_t *https_server_cache_lookup(const char *host_name,
+                                                  uint16_t port);
+https_server_entry_t *https_server_cache_store(const char *host_name,
+        uint16_t port, const cy_socket_ip_address_t *address);
+void https_server_cache_record_handshake(https_server_entry_t *entry,
+                                          cy_rslt_t result,
+                                          uint32_t handshake_ms);
+void https_server_cache_get_stats(https_server_stats_t *stats);
+void https_server_cache_print_stats(void);
+
+#endif /* HTTPS_SERVER_CACHE_H_ */
+
+
+/* [] END OF FILE */
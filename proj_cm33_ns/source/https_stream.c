@@ -0,0 +1,1742 @@
+/*******************************************************************************
+* File Name: https_stream.c
+*
+* Description: This file contains a streaming HTTPS connection built on the
+* secure sockets library. The response body is decoded incrementally
+* (Content-Length, chunked transfer-encoding or until close) and handed to the
+* application in pieces as it comes off the TLS socket, so responses of any
+* size are received in constant RAM.
+*
+* Related Document: See README.md
+********************************************************************************
+* Copyright 2024-2025, Cypress Semiconductor Corporation (an Infineon company) or
+* an affiliate of Cypress Semiconductor Corporation.  All rights reserved.
+*
+* This software, including source code, documentation and related
+* materials ("Software") is owned by Cypress Semiconductor Corporation
+* or one of its affiliates ("Cypress") and is protected by and subject to
+* worldwide patent protection (United States and foreign),
+* United States copyright laws and international treaty provisions.
+* Therefore, you may use this Software only as provided in the license
+* agreement accompanying the software package from which you
+* obtained this Software ("EULA").
+* If no EULA applies, Cypress hereby grants you a personal, non-exclusive,
+* non-transferable license to copy, modify, and compile the Software
+* source code solely for use in connection with Cypress's
+* integrated circuit products.  Any reproduction, modification, translation,
+* compilation, or representation of this Software except as specified
+* above is prohibited without the express written permission of Cypress.
+*
+* Disclaimer: THIS SOFTWARE IS PROVIDED AS-IS, WITH NO WARRANTY OF ANY KIND,
+* EXPRESS OR IMPLIED, INCLUDING, BUT NOT LIMITED TO, NONINFRINGEMENT, IMPLIED
+* WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE. Cypress
+* reserves the right to make changes to the Software without notice. Cypress
+* does not assume any liability arising out of the application or use of the
+* Software or any product or circuit described in the Software. Cypress does
+* not authorize its products for use in any products where a malfunction or
+* failure of the Cypress product may reasonably be expected to result in
+* significant property damage, injury or death ("High Risk Product"). By
+* including Cypress's product in a High Risk Product, the manufacturer
+* of such system or application assumes all risk of such use and in doing
+* so agrees to indemnify Cypress against all liability.
+*******************************************************************************/
+
+/*******************************************************************************
+* Header Files
+*******************************************************************************/
+#include "https_stream.h"
+#include "https_server_cache.h"
+#include "https_request_builder.h"
+#include "http_response_parser.h"
+#include "secure_http_client.h"
+#include "cy_tls.h"
+
+/* Standard C header files */
+#include <stdio.h>
+#include <string.h>
+
+/*******************************************************************************
+* Macros
+*******************************************************************************/
+#define HEX_BASE                                     (16U)
+#define HEX_DIGIT_ALPHA_OFFSET                       (10U)
+
+/* Largest chunk size accepted, guards the chunk size parser from overflow. */
+#define MAX_CHUNK_SIZE                               (0x0FFFFFFFU)
+
+/* Size of the value of a Range header: "bytes=" and two 32-bit numbers. */
+#define RANGE_VALUE_LENGTH                           (32U)
+#define DECIMAL_BASE                                 (10U)
+
+#define HTTP_STATUS_NO_CONTENT                       (204U)
+#define HTTP_STATUS_PARTIAL_CONTENT                  (206U)
+#define HTTP_STATUS_NOT_MODIFIED                     (304U)
+#define HTTP_STATUS_INFORMATIONAL_MAX                (199U)
+
+/*******************************************************************************
+* Data Types
+*******************************************************************************/
+struct https_stream_decoder
+{
+    bool in_use;
+    http_inflate_status_t status;
+    http_inflate_t inflater;
+    uint8_t buffer[HTTPS_STREAM_DECODE_BUFFER_LENGTH];
+};
+
+/*******************************************************************************
+* Global Variables
+********************************************************************************/
+/* TLS identity created once from the client certificate and key and shared
+ * by all streaming connections.
+ */
+static void *tls_identity;
+
+/* Trusted root CA of the server. */
+static const char *root_ca;
+static uint32_t root_ca_size;
+
+/* Decoders of gzip and deflate encoded bodies. Each is taken by one coded
+ * body until the body ends.
+ */
+static https_stream_decoder_t body_decoders[HTTPS_STREAM_INFLATERS];
+
+/*******************************************************************************
+* Function Definitions
+*******************************************************************************/
+
+/*******************************************************************************
+* Function Name: to_lower
+********************************************************************************
+* Summary:
+*  Returns the lower case of an ASCII character.
+*
+*******************************************************************************/
+static char to_lower(char c)
+{
+    return ((c >= 'A') && (c <= 'Z')) ? (char)(c - 'A' + 'a') : c;
+}
+
+/*******************************************************************************
+* Function Name: header_name_equals
+********************************************************************************
+* Summary:
+*  Compares a header name case-insensitively with a lower case string.
+*
+*******************************************************************************/
+static bool header_name_equals(const char *name, uint32_t name_len,
+                               const char *lower)
+{
+    uint32_t i;
+
+    for (i = 0U; (i < name_len) && ('\0' != lower[i]); i++)
+    {
+        if (to_lower(name[i]) != lower[i])
+        {
+            return false;
+        }
+    }
+
+    return ((i == name_len) && ('\0' == lower[i]));
+}
+
+/*******************************************************************************
+* Function Name: header_value_contains
+********************************************************************************
+* Summary:
+*  Checks case-insensitively whether a header value contains a lower case
+*  token, for example "chunked" in "gzip, chunked".
+*
+*******************************************************************************/
+static bool header_value_contains(const char *value, uint32_t value_len,
+                                  const char *lower)
+{
+    uint32_t token_len = (uint32_t) strlen(lower);
+
+    for (uint32_t i = 0U; (i + token_len) <= value_len; i++)
+    {
+        if (header_name_equals(&value[i], token_len, lower))
+        {
+            return true;
+        }
+    }
+
+    return false;
+}
+
+/*******************************************************************************
+* Function Name: parse_decimal
+********************************************************************************
+* Summary:
+*  Parses an unsigned decimal number starting at value[*pos] and advances
+*  *pos past it.
+*
+* Return:
+*  bool: true if at least one digit was found and the number fits in 32 bits.
+*
+*******************************************************************************/
+static bool parse_decimal(const char *value, uint32_t value_len,
+                          uint32_t *pos, uint32_t *number)
+{
+    uint32_t start = *pos;
+    uint32_t n = 0U;
+
+    while ((*pos < value_len) && (value[*pos] >= '0') && (value[*pos] <= '9'))
+    {
+        uint32_t digit = (uint32_t)(value[*pos] - '0');
+
+        if (n > ((UINT32_MAX - digit) / DECIMAL_BASE))
+        {
+            return false;
+        }
+
+        n = (n * DECIMAL_BASE) + digit;
+        (*pos)++;
+    }
+
+    *number = n;
+
+    return (*pos != start);
+}
+
+/*******************************************************************************
+* Function Name: parse_content_range
+********************************************************************************
+* Summary:
+*  Parses a Content-Range value of the form "bytes first-last/length", where
+*  length may be "*" when the server does not know it.
+*
+* Return:
+*  bool: true if the value is a valid byte range.
+*
+*******************************************************************************/
+static bool parse_content_range(const char *value, uint32_t value_len,
+                                https_stream_response_t *response)
+{
+    static const char unit[] = "bytes ";
+    uint32_t pos = sizeof(unit) - 1U;
+
+    if ((value_len <= pos) || !header_name_equals(value, pos, unit) ||
+        !parse_decimal(value, value_len, &pos, &response->range_start) ||
+        (pos >= value_len) || ('-' != value[pos++]) ||
+        !parse_decimal(value, value_len, &pos, &response->range_end) ||
+        (response->range_end < response->range_start) ||
+        (pos >= value_len) || ('/' != value[pos++]))
+    {
+        return false;
+    }
+
+    if ((pos < value_len) && ('*' == value[pos]))
+    {
+        response->complete_length = HTTPS_STREAM_CONTENT_LENGTH_UNKNOWN;
+        pos++;
+    }
+    else if (!parse_decimal(value, value_len, &pos,
+                            &response->complete_length) ||
+             (response->range_end >= response->complete_length))
+    {
+        return false;
+    }
+    else
+    {
+        /* Complete length given. */
+    }
+
+    return (pos == value_len);
+}
+
+/*******************************************************************************
+* Function Name: parse_headers
+********************************************************************************
+* Summary:
+*  Decides from the indexed response headers how the body is framed
+*  (Content-Length, Transfer-Encoding and Connection) and encoded
+*  (Content-Encoding), and copies the fields
+*  the application checks after the headers are gone from the buffer,
+*  including the Content-Range of a partial response.
+*
+* Parameters:
+*  headers  - Start of the response headers
+*  parser   - Parser that indexed the headers
+*  response - Filled with the parsed status
+*
+*******************************************************************************/
+static void parse_headers(const char *headers, const http_parser_t *parser,
+                          https_stream_response_t *response)
+{
+    const char *value;
+    uint32_t value_len = 0U;
+    bool chunked = false;
+    bool has_length;
+
+    response->status_code = parser->status_code;
+    response->content_length = HTTPS_STREAM_CONTENT_LENGTH_UNKNOWN;
+
+    /* HTTP/1.1 connections are persistent unless the server says otherwise. */
+    response->keep_alive = (0U != parser->minor_version);
+
+    has_length = http_parser_value_uint(parser, headers,
+                                        HTTP_HEADER_HASH_CONTENT_LENGTH,
+                                        HTTP_HEADER_CONTENT_LENGTH,
+                                        &response->content_length);
+
+    value = http_parser_value(parser, headers,
+                              HTTP_HEADER_HASH_TRANSFER_ENCODING,
+                              HTTP_HEADER_TRANSFER_ENCODING, &value_len);
+    if (NULL != value)
+    {
+        chunked = header_value_contains(value, value_len, "chunked");
+    }
+
+    value = http_parser_value(parser, headers, HTTP_HEADER_HASH_CONNECTION,
+                              HTTP_HEADER_CONNECTION, &value_len);
+    if (NULL != value)
+    {
+        if (header_value_contains(value, value_len, "close"))
+        {
+            response->keep_alive = false;
+        }
+        else if (header_value_contains(value, value_len, "keep-alive"))
+        {
+            response->keep_alive = true;
+        }
+    }
+
+    /* Only the delay-seconds form of Retry-After is reported. */
+    if (!http_parser_value_uint(parser, headers, HTTP_HEADER_HASH_RETRY_AFTER,
+                                HTTP_HEADER_RETRY_AFTER,
+                                &response->retry_after))
+    {
+        response->retry_after = HTTPS_STREAM_RETRY_AFTER_NONE;
+    }
+
+    value = http_parser_value(parser, headers,
+                              HTTP_HEADER_HASH_CONTENT_ENCODING,
+                              HTTP_HEADER_CONTENT_ENCODING, &value_len);
+    response->content_coding = http_coding_parse(value, value_len);
+
+    value = http_parser_value(parser, headers, HTTP_HEADER_HASH_ETAG,
+                              HTTP_HEADER_ETAG, &value_len);
+    if ((NULL != value) && (value_len < sizeof(response->etag)))
+    {
+        (void) memcpy(response->etag, value, value_len);
+        response->etag[value_len] = '\0';
+    }
+
+    if (HTTP_STATUS_PARTIAL_CONTENT == parser->status_code)
+    {
+        value = http_parser_value(parser, headers,
+                                  HTTP_HEADER_HASH_CONTENT_RANGE,
+                                  HTTP_HEADER_CONTENT_RANGE, &value_len);
+        response->has_range = ((NULL != value) &&
+                               parse_content_range(value, value_len,
+                                                   response));
+    }
+
+    /* Transfer-Encoding takes precedence over Content-Length (RFC 9112). */
+    if ((response->status_code <= HTTP_STATUS_INFORMATIONAL_MAX) ||
+        (HTTP_STATUS_NO_CONTENT == response->status_code) ||
+        (HTTP_STATUS_NOT_MODIFIED == response->status_code))
+    {
+        response->body_mode = HTTPS_STREAM_BODY_NONE;
+    }
+    else if (chunked)
+    {
+        response->body_mode = HTTPS_STREAM_BODY_CHUNKED;
+    }
+    else if (has_length)
+    {
+        response->body_mode = (0U == response->content_length) ?
+                HTTPS_STREAM_BODY_NONE : HTTPS_STREAM_BODY_CONTENT_LENGTH;
+    }
+    else
+    {
+        response->body_mode = HTTPS_STREAM_BODY_UNTIL_CLOSE;
+        response->keep_alive = false;
+    }
+}
+
+/*******************************************************************************
+* Function Name: hex_digit_value
+********************************************************************************
+* Summary:
+*  Returns the value of a hexadecimal digit, or HEX_BASE if the character is
+*  not a hexadecimal digit.
+*
+*******************************************************************************/
+static uint32_t hex_digit_value(uint8_t c)
+{
+    if ((c >= '0') && (c <= '9'))
+    {
+        return (uint32_t)(c - '0');
+    }
+
+    c = (uint8_t) to_lower((char) c);
+
+    if ((c >= 'a') && (c <= 'f'))
+    {
+        return (uint32_t)(c - 'a') + HEX_DIGIT_ALPHA_OFFSET;
+    }
+
+    return HEX_BASE;
+}
+
+/*******************************************************************************
+* Function Name: deliver_body
+********************************************************************************
+* Summary:
+*  Hands a piece of the body to the callback. A gzip or deflate encoded body
+*  is decoded first, in pieces of at most HTTPS_STREAM_DECODE_BUFFER_LENGTH
+*  bytes. Bytes after the end of the compressed stream are ignored.
+*
+* Parameters:
+*  decoder  - Inflater of a coded body, NULL for other bodies
+*  data     - Piece of the body as received
+*  len      - Length of the piece
+*  body_cb  - Body callback
+*  arg      - Argument passed to the body callback
+*  response - Updated with the decoded length
+*
+* Return:
+*  cy_rslt_t: CY_RSLT_SUCCESS, the error returned by the callback, or
+*  CY_RSLT_TYPE_ERROR if the body cannot be decoded.
+*
+*******************************************************************************/
+static cy_rslt_t deliver_body(https_stream_decoder_t *decoder,
+                              const uint8_t *data, uint32_t len,
+                              https_stream_body_cb_t body_cb, void *arg,
+                              https_stream_response_t *response)
+{
+    cy_rslt_t result = CY_RSLT_SUCCESS;
+    uint32_t consumed = 0U;
+    uint32_t produced = 0U;
+
+    if (NULL == decoder)
+    {
+        response->decoded_len += len;
+        result = body_cb(arg, data, len);
+    }
+    else if (HTTP_INFLATE_DONE != decoder->status)
+    {
+        do
+        {
+            decoder->status = http_inflate(&decoder->inflater, data, len,
+                                           &consumed, decoder->buffer,
+                                           sizeof(decoder->buffer),
+                                           &produced);
+            data += consumed;
+            len -= consumed;
+
+            if (produced > 0U)
+            {
+                response->decoded_len += produced;
+                result = body_cb(arg, decoder->buffer, produced);
+            }
+        } while ((CY_RSLT_SUCCESS == result) &&
+                 (HTTP_INFLATE_OUTPUT_FULL == decoder->status));
+
+        if (HTTP_INFLATE_ERROR == decoder->status)
+        {
+            result = CY_RSLT_TYPE_ERROR;
+        }
+    }
+    else
+    {
+        /* Trailing bytes after the compressed stream. */
+    }
+
+    return result;
+}
+
+/*******************************************************************************
+* Function Name: decode_body
+********************************************************************************
+* Summary:
+*  Runs the incremental body decoder over the given bytes. Body data is passed
+*  to the callback straight from the input without copying, unless it has to
+*  be decompressed. Decoding stops at the end of the body so the bytes of a
+*  following response stay unconsumed.
+*
+* Parameters:
+*  conn     - Connection holding the decoder state
+*  data     - Received bytes
+*  len      - Number of received bytes
+*  consumed - Returns the number of bytes used by the decoder
+*  body_cb  - Body callback
+*  arg      - Argument passed to the body callback
+*  response - Updated with the body length and chunk count
+*
+* Return:
+*  cy_rslt_t: CY_RSLT_SUCCESS, the error returned by the callback, or
+*  CY_RSLT_TYPE_ERROR if the chunked framing or the compressed data is
+*  malformed.
+*
+*******************************************************************************/
+static cy_rslt_t decode_body(https_stream_conn_t *conn, const uint8_t *data,
+                             uint32_t len, uint32_t *consumed,
+                             https_stream_body_cb_t body_cb, void *arg,
+                             https_stream_response_t *response)
+{
+    cy_rslt_t result = CY_RSLT_SUCCESS;
+    uint32_t pos = 0U;
+
+    while ((pos < len) && (HTTPS_STREAM_STATE_DONE != conn->state) &&
+           (CY_RSLT_SUCCESS == result))
+    {
+        uint8_t c = data[pos];
+
+        switch (conn->state)
+        {
+            case HTTPS_STREAM_STATE_LENGTH_DATA:
+            case HTTPS_STREAM_STATE_CHUNK_DATA:
+            case HTTPS_STREAM_STATE_UNTIL_CLOSE:
+            {
+                uint32_t piece = len - pos;
+
+                if ((HTTPS_STREAM_STATE_UNTIL_CLOSE != conn->state) &&
+                    (piece > conn->remaining))
+                {
+                    piece = conn->remaining;
+                }
+
+                result = deliver_body(conn->decoder, &data[pos], piece,
+                                      body_cb, arg, response);
+                response->body_len += piece;
+                pos += piece;
+
+                if (HTTPS_STREAM_STATE_UNTIL_CLOSE != conn->state)
+                {
+                    conn->remaining -= piece;
+
+                    if (0U == conn->remaining)
+                    {
+                        conn->state =
+                            (HTTPS_STREAM_STATE_LENGTH_DATA == conn->state) ?
+                            HTTPS_STREAM_STATE_DONE :
+                            HTTPS_STREAM_STATE_CHUNK_DATA_CR;
+                    }
+                }
+                break;
+            }
+
+            case HTTPS_STREAM_STATE_CHUNK_SIZE:
+            {
+                uint32_t digit = hex_digit_value(c);
+
+                if (HEX_BASE != digit)
+                {
+                    if (conn->remaining > (MAX_CHUNK_SIZE / HEX_BASE))
+                    {
+                        result = CY_RSLT_TYPE_ERROR;
+                    }
+                    conn->remaining = (conn->remaining * HEX_BASE) + digit;
+                }
+                else if ('\r' == c)
+                {
+                    conn->state = HTTPS_STREAM_STATE_CHUNK_SIZE_LF;
+                }
+                else if ((';' == c) || (' ' == c) || ('\t' == c))
+                {
+                    conn->state = HTTPS_STREAM_STATE_CHUNK_EXT;
+                }
+                else
+                {
+                    result = CY_RSLT_TYPE_ERROR;
+                }
+                pos++;
+                break;
+            }
+
+            case HTTPS_STREAM_STATE_CHUNK_EXT:
+            {
+                /* Chunk extensions are ignored. */
+                if ('\r' == c)
+                {
+                    conn->state = HTTPS_STREAM_STATE_CHUNK_SIZE_LF;
+                }
+                pos++;
+                break;
+            }
+
+            case HTTPS_STREAM_STATE_CHUNK_SIZE_LF:
+            {
+                if ('\n' != c)
+                {
+                    result = CY_RSLT_TYPE_ERROR;
+                }
+                else if (0U == conn->remaining)
+                {
+                    conn->state = HTTPS_STREAM_STATE_TRAILER_LINE_START;
+                }
+                else
+                {
+                    response->chunk_count++;
+                    conn->state = HTTPS_STREAM_STATE_CHUNK_DATA;
+                }
+                pos++;
+                break;
+            }
+
+            case HTTPS_STREAM_STATE_CHUNK_DATA_CR:
+            {
+                conn->state = HTTPS_STREAM_STATE_CHUNK_DATA_LF;
+                result = ('\r' == c) ? CY_RSLT_SUCCESS : CY_RSLT_TYPE_ERROR;
+                pos++;
+                break;
+            }
+
+            case HTTPS_STREAM_STATE_CHUNK_DATA_LF:
+            {
+                conn->state = HTTPS_STREAM_STATE_CHUNK_SIZE;
+                conn->remaining = 0U;
+                result = ('\n' == c) ? CY_RSLT_SUCCESS : CY_RSLT_TYPE_ERROR;
+                pos++;
+                break;
+            }
+
+            case HTTPS_STREAM_STATE_TRAILER_LINE_START:
+            {
+                /* Trailer fields are skipped up to the final empty line. */
+                conn->state = ('\r' == c) ?
+                        HTTPS_STREAM_STATE_TRAILER_END_LF :
+                        HTTPS_STREAM_STATE_TRAILER_LINE;
+                pos++;
+                break;
+            }
+
+            case HTTPS_STREAM_STATE_TRAILER_LINE:
+            {
+                if ('\n' == c)
+                {
+                    conn->state = HTTPS_STREAM_STATE_TRAILER_LINE_START;
+                }
+                pos++;
+                break;
+            }
+
+            case HTTPS_STREAM_STATE_TRAILER_END_LF:
+            {
+                conn->state = HTTPS_STREAM_STATE_DONE;
+                result = ('\n' == c) ? CY_RSLT_SUCCESS : CY_RSLT_TYPE_ERROR;
+                pos++;
+                break;
+            }
+
+            default:
+            {
+                break;
+            }
+        }
+    }
+
+    *consumed = pos;
+
+    return result;
+}
+
+/*******************************************************************************
+* Function Name: discard_body
+********************************************************************************
+* Summary:
+*  Body callback used when the caller does not want the body.
+*
+*******************************************************************************/
+static cy_rslt_t discard_body(void *arg, const uint8_t *data, uint32_t len)
+{
+    CY_UNUSED_PARAMETER(arg);
+    CY_UNUSED_PARAMETER(data);
+    CY_UNUSED_PARAMETER(len);
+
+    return CY_RSLT_SUCCESS;
+}
+
+/*******************************************************************************
+* Function Name: receive_more
+********************************************************************************
+* Summary:
+*  Reads more bytes from the TLS socket into the free part of the receive
+*  buffer. Bytes already consumed are discarded first.
+*
+*******************************************************************************/
+static cy_rslt_t receive_more(https_stream_conn_t *conn)
+{
+    cy_rslt_t result;
+    uint32_t bytes_received = 0U;
+
+    if (conn->rx_start > 0U)
+    {
+        (void) memmove(conn->rx_buffer, &conn->rx_buffer[conn->rx_start],
+                       conn->rx_end - conn->rx_start);
+        conn->rx_end -= conn->rx_start;
+        conn->rx_start = 0U;
+    }
+
+    if (conn->rx_end >= HTTPS_STREAM_BUFFER_LENGTH)
+    {
+        return CY_RSLT_TYPE_ERROR;
+    }
+
+    result = cy_socket_recv(conn->socket, &conn->rx_buffer[conn->rx_end],
+                            HTTPS_STREAM_BUFFER_LENGTH - conn->rx_end,
+                            CY_SOCKET_FLAGS_NONE, &bytes_received);
+
+    if ((CY_RSLT_SUCCESS == result) && (0U == bytes_received))
+    {
+        result = CY_RSLT_MODULE_SECURE_SOCKETS_CLOSED;
+    }
+
+    if (CY_RSLT_SUCCESS == result)
+    {
+        conn->rx_end += bytes_received;
+        conn->bytes_received += bytes_received;
+        conn->bytes_copied += bytes_received;
+        https_metrics_add_bytes(0U, bytes_received);
+    }
+
+    return result;
+}
+
+/*******************************************************************************
+* Function Name: https_stream_write
+********************************************************************************
+* Summary:
+*  Sends the whole buffer on the TLS socket, straight from the caller's
+*  memory.
+*
+*******************************************************************************/
+cy_rslt_t https_stream_write(https_stream_conn_t *conn, const void *data,
+                             uint32_t len)
+{
+    cy_rslt_t result = CY_RSLT_SUCCESS;
+    const uint8_t *pos = (const uint8_t *) data;
+
+    while ((len > 0U) && (CY_RSLT_SUCCESS == result))
+    {
+        uint32_t bytes_sent = 0U;
+
+        result = cy_socket_send(conn->socket, pos, len, CY_SOCKET_FLAGS_NONE,
+                                &bytes_sent);
+        pos += bytes_sent;
+        len -= bytes_sent;
+        conn->bytes_sent += bytes_sent;
+        https_metrics_add_bytes(bytes_sent, 0U);
+    }
+
+    return result;
+}
+
+/*******************************************************************************
+* Function Name: https_stream_init
+********************************************************************************
+* Summary:
+*  Creates the TLS identity used by all streaming connections. The client
+*  certificate and key are parsed once here instead of on every connect.
+*
+* Parameters:
+*  credentials - Client certificate, private key and root CA
+*
+* Return:
+*  cy_rslt_t: CY_RSLT_SUCCESS if the identity was created.
+*
+*******************************************************************************/
+cy_rslt_t https_stream_init(const https_stream_credentials_t *credentials)
+{
+    cy_rslt_t result;
+
+    result = cy_socket_init();
+
+    if (CY_RSLT_SUCCESS == result)
+    {
+        result = cy_tls_create_identity(credentials->client_cert,
+                                        credentials->client_cert_size,
+                                        credentials->private_key,
+                                        credentials->private_key_size,
+                                        &tls_identity);
+    }
+
+    if (CY_RSLT_SUCCESS == result)
+    {
+        root_ca = credentials->root_ca;
+        root_ca_size = credentials->root_ca_size;
+    }
+    else
+    {
+        ERR_INFO(("Failed to create the TLS identity for streaming.\n"));
+    }
+
+    return result;
+}
+
+/*******************************************************************************
+* Function Name: https_stream_connect
+********************************************************************************
+* Summary:
+*  Opens a TLS connection to the server with mutual authentication. The
+*  address of a server connected before is taken from the server cache, so a
+*  reconnect goes straight to the TCP connect and TLS handshake.
+*
+* Parameters:
+*  conn      - Connection object
+*  host_name - Server host name or IP address
+*  port      - Server port
+*
+* Return:
+*  cy_rslt_t: CY_RSLT_SUCCESS if the connection was established.
+*
+*******************************************************************************/
+cy_rslt_t https_stream_connect(https_stream_conn_t *conn,
+                               const char *host_name, uint16_t port)
+{
+    cy_rslt_t result;
+    cy_socket_sockaddr_t address;
+    uint32_t timeout = TRANSPORT_SEND_RECV_TIMEOUT_MS;
+    cy_socket_tls_auth_mode_t auth_mode = CY_SOCKET_TLS_VERIFY_REQUIRED;
+    https_server_entry_t *server;
+    TickType_t start;
+    https_metrics_stamp_t stage_start;
+
+    (void) memset(conn, 0, sizeof(*conn));
+    (void) memset(&address, 0, sizeof(address));
+    conn->host_name = host_name;
+    conn->port = port;
+
+    server = https_server_cache_lookup(host_name, port);
+
+    if (NULL != server)
+    {
+        address.ip_address = server->address;
+        result = CY_RSLT_SUCCESS;
+    }
+    else
+    {
+        https_metrics_stamp(&stage_start);
+        result = cy_socket_gethostbyname(host_name, CY_SOCKET_IP_VER_V4,
+                                         &address.ip_address);
+
+        if (CY_RSLT_SUCCESS == result)
+        {
+            https_metrics_record(HTTPS_METRIC_DNS, &stage_start);
+            server = https_server_cache_store(host_name, port,
+                    &address.ip_address);
+        }
+    }
+
+    if (CY_RSLT_SUCCESS == result)
+    {
+        address.port = port;
+        result = cy_socket_create(CY_SOCKET_DOMAIN_AF_INET,
+                                  CY_SOCKET_TYPE_STREAM, CY_SOCKET_IPPROTO_TLS,
+                                  &conn->socket);
+    }
+
+    if (CY_RSLT_SUCCESS != result)
+    {
+        return result;
+    }
+
+    result = cy_socket_setsockopt(conn->socket, CY_SOCKET_SOL_TLS,
+                                  CY_SOCKET_SO_TLS_IDENTITY, tls_identity,
+                                  sizeof(tls_identity));
+
+    if (CY_RSLT_SUCCESS == result)
+    {
+        result = cy_socket_setsockopt(conn->socket, CY_SOCKET_SOL_TLS,
+                                      CY_SOCKET_SO_TRUSTED_ROOTCA_CERTIFICATE,
+                                      root_ca, root_ca_size);
+    }
+
+    if (CY_RSLT_SUCCESS == result)
+    {
+        result = cy_socket_setsockopt(conn->socket, CY_SOCKET_SOL_TLS,
+                                      CY_SOCKET_SO_TLS_AUTH_MODE, &auth_mode,
+                                      sizeof(auth_mode));
+    }
+
+    if (CY_RSLT_SUCCESS == result)
+    {
+        result = cy_socket_setsockopt(conn->socket, CY_SOCKET_SOL_SOCKET,
+                                      CY_SOCKET_SO_RCVTIMEO, &timeout,
+                                      sizeof(timeout));
+    }
+
+    if (CY_RSLT_SUCCESS == result)
+    {
+        result = cy_socket_setsockopt(conn->socket, CY_SOCKET_SOL_SOCKET,
+                                      CY_SOCKET_SO_SNDTIMEO, &timeout,
+                                      sizeof(timeout));
+    }
+
+    if (CY_RSLT_SUCCESS == result)
+    {
+        start = xTaskGetTickCount();
+        https_metrics_stamp(&stage_start);
+        result = cy_socket_connect(conn->socket, &address, sizeof(address));
+        https_server_cache_record_handshake(server, result,
+                (uint32_t) pdTICKS_TO_MS(xTaskGetTickCount() - start));
+    }
+
+    if (CY_RSLT_SUCCESS == result)
+    {
+        https_metrics_record(HTTPS_METRIC_CONNECT, &stage_start);
+        conn->connected = true;
+    }
+    else
+    {
+        (void) cy_socket_delete(conn->socket);
+    }
+
+    return result;
+}
+
+/*******************************************************************************
+* Function Name: method_name
+********************************************************************************
+* Summary:
+*  Returns the request line token of an HTTP method.
+*
+*******************************************************************************/
+static const char *method_name(cy_http_client_method_t method)
+{
+    switch (method)
+    {
+        case CY_HTTP_CLIENT_METHOD_POST:
+            return "POST";
+        case CY_HTTP_CLIENT_METHOD_PUT:
+            return "PUT";
+        case CY_HTTP_CLIENT_METHOD_HEAD:
+            return "HEAD";
+        default:
+            return "GET";
+    }
+}
+
+/*******************************************************************************
+* Function Name: https_stream_flush
+********************************************************************************
+* Summary:
+*  Sends the bytes staged in the transmit buffer. The start of the flush is
+*  kept as the send time of the requests in it.
+*
+*******************************************************************************/
+cy_rslt_t https_stream_flush(https_stream_conn_t *conn)
+{
+    cy_rslt_t result = CY_RSLT_SUCCESS;
+
+    if (conn->tx_len > 0U)
+    {
+        https_metrics_stamp(&conn->flushed_at);
+        conn->flushed = true;
+        result = https_stream_write(conn, conn->tx_buffer, conn->tx_len);
+        conn->tx_len = 0U;
+
+        if (CY_RSLT_SUCCESS == result)
+        {
+            https_metrics_record(HTTPS_METRIC_SEND, &conn->flushed_at);
+        }
+    }
+
+    return result;
+}
+
+/*******************************************************************************
+* Function Name: queue_request
+********************************************************************************
+* Summary:
+*  Serializes a request into the transmit buffer behind any request already
+*  staged there, so that several requests leave in one TLS record. The body is
+*  copied next to the headers unless the request asks for it to be sent by
+*  reference or it does not fit. A body producer is drained here, with the
+*  body sent in chunks as the transmit buffer fills. A byte range of the
+*  resource is asked for with a Range header.
+*
+* Parameters:
+*  conn    - Connected streaming connection
+*  request - Request to queue
+*
+* Return:
+*  cy_rslt_t: CY_RSLT_SUCCESS if the request was queued or sent.
+*
+*******************************************************************************/
+static cy_rslt_t queue_request(https_stream_conn_t *conn,
+                               const https_stream_request_t *request)
+{
+    cy_rslt_t result;
+    https_request_builder_t builder;
+    https_segment_t body =
+    {
+        .data = request->body,
+        .len  = request->body_len,
+        .mode = request->body_by_reference ? HTTPS_SEGMENT_REFERENCE :
+                                             HTTPS_SEGMENT_COPY
+    };
+    bool has_body = ((0U != request->body_len) ||
+                     (CY_HTTP_CLIENT_METHOD_POST == request->method) ||
+                     (CY_HTTP_CLIENT_METHOD_PUT == request->method));
+    char range[RANGE_VALUE_LENGTH];
+
+    result = https_builder_begin(&builder, conn, method_name(request->method),
+                                 request->path);
+
+    if ((CY_RSLT_SUCCESS == result) && (NULL != request->content_type))
+    {
+        https_builder_add_header(&builder, "Content-Type",
+                                 request->content_type);
+    }
+
+    if ((CY_RSLT_SUCCESS == result) && request->accept_encoding)
+    {
+        https_builder_add_header(&builder, "Accept-Encoding",
+                                 HTTP_ACCEPT_ENCODING_VALUE);
+    }
+
+    if ((CY_RSLT_SUCCESS == result) && request->range)
+    {
+        if (HTTPS_STREAM_RANGE_END_OPEN == request->range_end)
+        {
+            (void) snprintf(range, sizeof(range), "bytes=%lu-",
+                            (unsigned long) request->range_start);
+        }
+        else
+        {
+            (void) snprintf(range, sizeof(range), "bytes=%lu-%lu",
+                            (unsigned long) request->range_start,
+                            (unsigned long) request->range_end);
+        }
+
+        https_builder_add_header(&builder, "Range", range);
+    }
+
+    if ((CY_RSLT_SUCCESS == result) && (NULL != request->body_producer))
+    {
+        result = https_builder_finish_chunked(&builder,
+                                              request->body_producer,
+                                              request->producer_arg);
+    }
+    else if (CY_RSLT_SUCCESS == result)
+    {
+        result = https_builder_finish(&builder, &body,
+                                      (0U != request->body_len) ? 1U : 0U,
+                                      has_body);
+    }
+    else
+    {
+        /* The flush of the staged requests failed. */
+    }
+
+    return result;
+}
+
+/*******************************************************************************
+* Function Name: claim_decoder
+********************************************************************************
+* Summary:
+*  Takes a free inflater for a gzip or deflate coded body and starts it.
+*  Responses on different tasks may be received at the same time, so each
+*  takes one of HTTPS_STREAM_INFLATERS until its body ends.
+*
+* Parameters:
+*  coding - Content-Encoding of the body
+*
+* Return:
+*  https_stream_decoder_t *: The inflater, NULL if all of them are in use.
+*
+*******************************************************************************/
+static https_stream_decoder_t *claim_decoder(http_coding_t coding)
+{
+    https_stream_decoder_t *decoder = NULL;
+
+    taskENTER_CRITICAL();
+    for (uint32_t i = 0U; (i < HTTPS_STREAM_INFLATERS) && (NULL == decoder);
+         i++)
+    {
+        if (!body_decoders[i].in_use)
+        {
+            decoder = &body_decoders[i];
+            decoder->in_use = true;
+        }
+    }
+    taskEXIT_CRITICAL();
+
+    if (NULL != decoder)
+    {
+        http_inflate_init(&decoder->inflater, coding);
+        decoder->status = HTTP_INFLATE_MORE;
+    }
+
+    return decoder;
+}
+
+/*******************************************************************************
+* Function Name: release_decoder
+********************************************************************************
+* Summary:
+*  Returns an inflater taken with claim_decoder. NULL is ignored.
+*
+*******************************************************************************/
+static void release_decoder(https_stream_decoder_t *decoder)
+{
+    if (NULL != decoder)
+    {
+        taskENTER_CRITICAL();
+        decoder->in_use = false;
+        taskEXIT_CRITICAL();
+    }
+}
+
+/*******************************************************************************
+* Function Name: start_body
+********************************************************************************
+* Summary:
+*  Parses the complete response headers held in the receive buffer and sets
+*  up the body decoder for the framing and content coding of the response.
+*  The headers callback sees the response before any of its body.
+*
+* Parameters:
+*  conn - Connection whose response headers were received
+*
+* Return:
+*  cy_rslt_t: CY_RSLT_SUCCESS, the error returned by the headers callback, or
+*  CY_RSLT_TYPE_ERROR if the body is coded and all inflaters are in use by
+*  other responses.
+*
+*******************************************************************************/
+static cy_rslt_t start_body(https_stream_conn_t *conn)
+{
+    https_stream_response_t *response = conn->response;
+    cy_rslt_t result;
+
+    parse_headers((const char *) &conn->rx_buffer[conn->rx_start],
+                  &conn->parser, response);
+    conn->rx_start += conn->parser.headers_len;
+    conn->remaining = response->content_length;
+
+    /* The response to HEAD describes a body that is never sent. */
+    if (CY_HTTP_CLIENT_METHOD_HEAD == conn->method)
+    {
+        response->body_mode = HTTPS_STREAM_BODY_NONE;
+    }
+
+    switch (response->body_mode)
+    {
+        case HTTPS_STREAM_BODY_CONTENT_LENGTH:
+            conn->state = HTTPS_STREAM_STATE_LENGTH_DATA;
+            break;
+        case HTTPS_STREAM_BODY_CHUNKED:
+            conn->state = HTTPS_STREAM_STATE_CHUNK_SIZE;
+            conn->remaining = 0U;
+            break;
+        case HTTPS_STREAM_BODY_UNTIL_CLOSE:
+            conn->state = HTTPS_STREAM_STATE_UNTIL_CLOSE;
+            break;
+        default:
+            conn->state = HTTPS_STREAM_STATE_DONE;
+            break;
+    }
+
+    if (NULL != conn->headers_cb)
+    {
+        result = conn->headers_cb(conn->body_arg, response);
+
+        if (CY_RSLT_SUCCESS != result)
+        {
+            return result;
+        }
+    }
+
+    if (((HTTP_CODING_GZIP == response->content_coding) ||
+         (HTTP_CODING_DEFLATE == response->content_coding)) &&
+        (HTTPS_STREAM_STATE_DONE != conn->state) && !conn->pass_coded_body)
+    {
+        conn->decoder = claim_decoder(response->content_coding);
+
+        if (NULL == conn->decoder)
+        {
+            return CY_RSLT_TYPE_ERROR;
+        }
+    }
+
+    return CY_RSLT_SUCCESS;
+}
+
+/*******************************************************************************
+* Function Name: read_buffered
+********************************************************************************
+* Summary:
+*  Advances the response being received over the bytes already in the receive
+*  buffer, without reading from the socket.
+*
+* Parameters:
+*  conn - Connection receiving a response
+*
+* Return:
+*  cy_rslt_t: CY_RSLT_SUCCESS if the response is complete or more bytes are
+*  needed (conn->reading tells which), or the error that ends the response.
+*
+*******************************************************************************/
+static cy_rslt_t read_buffered(https_stream_conn_t *conn)
+{
+    cy_rslt_t result = CY_RSLT_SUCCESS;
+    http_parser_status_t status;
+    uint32_t consumed;
+
+    if (!conn->first_byte_seen && (conn->rx_start != conn->rx_end))
+    {
+        conn->first_byte_seen = true;
+        https_metrics_record(HTTPS_METRIC_FIRST_BYTE, &conn->request_start);
+    }
+
+    /* Each call to the parser scans only the bytes that arrived since the
+     * previous one.
+     */
+    if (!conn->headers_done)
+    {
+        status = http_parser_feed(&conn->parser,
+                (const char *) &conn->rx_buffer[conn->rx_start],
+                conn->rx_end - conn->rx_start);
+
+        if (HTTP_PARSER_INCOMPLETE == status)
+        {
+            return CY_RSLT_SUCCESS;
+        }
+
+        if (HTTP_PARSER_DONE != status)
+        {
+            return CY_RSLT_TYPE_ERROR;
+        }
+
+        conn->headers_done = true;
+        result = start_body(conn);
+    }
+
+    /* Decode the body straight out of the receive buffer. */
+    while ((CY_RSLT_SUCCESS == result) &&
+           (HTTPS_STREAM_STATE_DONE != conn->state) &&
+           (conn->rx_start != conn->rx_end))
+    {
+        consumed = 0U;
+        result = decode_body(conn, &conn->rx_buffer[conn->rx_start],
+                             conn->rx_end - conn->rx_start, &consumed,
+                             conn->body_cb, conn->body_arg, conn->response);
+        conn->rx_start += consumed;
+    }
+
+    if ((CY_RSLT_SUCCESS == result) &&
+        (HTTPS_STREAM_STATE_DONE == conn->state))
+    {
+        conn->reading = false;
+    }
+
+    return result;
+}
+
+/*******************************************************************************
+* Function Name: finish_response
+********************************************************************************
+* Summary:
+*  Ends the response being received. A compressed body must end with the end
+*  of its compressed stream. The connection is closed when the server does
+*  not keep it alive or the response failed.
+*
+* Parameters:
+*  conn   - Connection receiving a response
+*  result - Result of receiving the response
+*
+* Return:
+*  cy_rslt_t: Final result of the response.
+*
+*******************************************************************************/
+static cy_rslt_t finish_response(https_stream_conn_t *conn, cy_rslt_t result)
+{
+    https_stream_response_t *response = conn->response;
+
+    if ((CY_RSLT_SUCCESS == result) && (NULL != conn->decoder) &&
+        (HTTP_INFLATE_DONE != conn->decoder->status))
+    {
+        result = CY_RSLT_TYPE_ERROR;
+    }
+
+    release_decoder(conn->decoder);
+    conn->decoder = NULL;
+    conn->reading = false;
+    https_metrics_request_done(result, &conn->request_start);
+
+    if ((CY_RSLT_SUCCESS != result) || !response->keep_alive)
+    {
+        https_stream_disconnect(conn);
+    }
+
+    return result;
+}
+
+/*******************************************************************************
+* Function Name: https_stream_read_begin
+********************************************************************************
+* Summary:
+*  Starts receiving the next response on the connection. The response is
+*  then advanced with https_stream_read_poll, which streams its body to the
+*  callback as it is received.
+*
+* Parameters:
+*  conn       - Connected streaming connection
+*  method     - Method of the request being answered
+*  headers_cb - Called once the headers are parsed, may be NULL
+*  body_cb    - Called for every piece of the body, may be NULL to discard it
+*  arg        - Argument passed to the callbacks
+*  response   - Filled with the response status; must stay valid until the
+*               response is complete
+*
+* Return:
+*  void
+*
+*******************************************************************************/
+void https_stream_read_begin(https_stream_conn_t *conn,
+                             cy_http_client_method_t method,
+                             https_stream_headers_cb_t headers_cb,
+                             https_stream_body_cb_t body_cb, void *arg,
+                             https_stream_response_t *response)
+{
+    (void) memset(response, 0, sizeof(*response));
+    http_parser_init(&conn->parser, true);
+
+    conn->reading = true;
+    conn->headers_done = false;
+    conn->state = HTTPS_STREAM_STATE_DONE;
+    conn->method = method;
+    conn->headers_cb = headers_cb;
+    conn->body_cb = (NULL != body_cb) ? body_cb : discard_body;
+    conn->body_arg = arg;
+    conn->response = response;
+    conn->first_byte_seen = false;
+    conn->pass_coded_body = false;
+
+    if (conn->flushed)
+    {
+        conn->request_start = conn->flushed_at;
+    }
+    else
+    {
+        https_metrics_stamp(&conn->request_start);
+    }
+}
+
+/*******************************************************************************
+* Function Name: https_stream_read_poll
+********************************************************************************
+* Summary:
+*  Advances the response started by https_stream_read_begin. The bytes
+*  already received are decoded first; if the response is still incomplete,
+*  the socket is read once and the new bytes are decoded too. The socket
+*  receive timeout bounds how long this blocks, so with a short timeout the
+*  call can be driven from an event loop.
+*
+*  The connection is closed when the response fails or the server does not
+*  keep it alive. A receive timeout is returned without closing it, so the
+*  caller decides whether the response is late or more bytes are on the way.
+*
+* Parameters:
+*  conn - Connection receiving a response
+*  done - Returns true once the response is complete or has failed
+*
+* Return:
+*  cy_rslt_t: CY_RSLT_SUCCESS if the response is complete or progressing,
+*  CY_RSLT_MODULE_SECURE_SOCKETS_TIMEOUT if no bytes arrived, or the error
+*  that ended the response.
+*
+*******************************************************************************/
+cy_rslt_t https_stream_read_poll(https_stream_conn_t *conn, bool *done)
+{
+    cy_rslt_t result;
+
+    *done = false;
+
+    if (!conn->reading)
+    {
+        return CY_RSLT_TYPE_ERROR;
+    }
+
+    result = read_buffered(conn);
+
+    if ((CY_RSLT_SUCCESS == result) && conn->reading)
+    {
+        result = receive_more(conn);
+
+        if (CY_RSLT_MODULE_SECURE_SOCKETS_TIMEOUT == result)
+        {
+            return result;
+        }
+
+        if ((CY_RSLT_MODULE_SECURE_SOCKETS_CLOSED == result) &&
+            conn->headers_done &&
+            (HTTPS_STREAM_STATE_UNTIL_CLOSE == conn->state))
+        {
+            conn->state = HTTPS_STREAM_STATE_DONE;
+            conn->reading = false;
+            result = CY_RSLT_SUCCESS;
+        }
+        else if (CY_RSLT_SUCCESS == result)
+        {
+            result = read_buffered(conn);
+        }
+        else
+        {
+            /* The connection failed part way through the response. */
+        }
+    }
+
+    if ((CY_RSLT_SUCCESS != result) || !conn->reading)
+    {
+        *done = true;
+        result = finish_response(conn, result);
+    }
+
+    return result;
+}
+
+/*******************************************************************************
+* Function Name: read_response
+********************************************************************************
+* Summary:
+*  Receives the next response on the connection, blocking until it is
+*  complete. See https_stream_read_response. coded_body hands a coded body
+*  to body_cb without inflating it.
+*
+*******************************************************************************/
+static cy_rslt_t read_response(https_stream_conn_t *conn,
+                               cy_http_client_method_t method,
+                               https_stream_headers_cb_t headers_cb,
+                               https_stream_body_cb_t body_cb, void *arg,
+                               bool coded_body,
+                               https_stream_response_t *response)
+{
+    cy_rslt_t result;
+    bool done = false;
+
+    https_stream_read_begin(conn, method, headers_cb, body_cb, arg, response);
+    conn->pass_coded_body = coded_body;
+
+    do
+    {
+        result = https_stream_read_poll(conn, &done);
+    } while ((CY_RSLT_SUCCESS == result) && !done);
+
+    if (!done)
+    {
+        (void) finish_response(conn, result);
+    }
+
+    return result;
+}
+
+/*******************************************************************************
+* Function Name: https_stream_read_response
+********************************************************************************
+* Summary:
+*  Receives the next response on the connection and streams its body to the
+*  callback as it is received. Only HTTPS_STREAM_BUFFER_LENGTH bytes of RAM
+*  are used no matter how large the body is, plus the decode buffer and the
+*  inflater window for a gzip or deflate encoded body. Bytes of a following
+*  pipelined response stay in the receive buffer. The connection is closed
+*  when the server does not keep it alive, the response is malformed or the
+*  server does not send for TRANSPORT_SEND_RECV_TIMEOUT_MS.
+*
+* Parameters:
+*  conn     - Connected streaming connection
+*  method   - Method of the request being answered
+*  body_cb  - Called for every piece of the body, may be NULL to discard it
+*  arg      - Argument passed to the body callback
+*  response - Filled with the response status
+*
+* Return:
+*  cy_rslt_t: CY_RSLT_SUCCESS if the whole response was received.
+*
+*******************************************************************************/
+cy_rslt_t https_stream_read_response(https_stream_conn_t *conn,
+                                     cy_http_client_method_t method,
+                                     https_stream_body_cb_t body_cb, void *arg,
+                                     https_stream_response_t *response)
+{
+    return read_response(conn, method, NULL, body_cb, arg, false, response);
+}
+
+/*******************************************************************************
+* Function Name: https_stream_queue
+********************************************************************************
+* Summary:
+*  Stages one request in the transmit buffer without flushing it, so that
+*  requests queued together leave in as few TLS records as possible. A
+*  request that does not fit is sent at once, along with those staged before
+*  it.
+*
+*******************************************************************************/
+cy_rslt_t https_stream_queue(https_stream_conn_t *conn,
+                             const https_stream_request_t *request)
+{
+    if (!conn->connected)
+    {
+        return CY_RSLT_MODULE_SECURE_SOCKETS_NOT_CONNECTED;
+    }
+
+    return queue_request(conn, request);
+}
+
+/*******************************************************************************
+* Function Name: https_stream_send
+********************************************************************************
+* Summary:
+*  Sends one request on the connection.
+*
+*******************************************************************************/
+cy_rslt_t https_stream_send(https_stream_conn_t *conn,
+                            const https_stream_request_t *request)
+{
+    cy_rslt_t result;
+
+    result = https_stream_queue(conn, request);
+
+    if (CY_RSLT_SUCCESS == result)
+    {
+        result = https_stream_flush(conn);
+    }
+
+    return result;
+}
+
+/*******************************************************************************
+* Function Name: https_stream_exchange
+********************************************************************************
+* Summary:
+*  Sends one request and receives its response, with the callbacks and
+*  options the request gives.
+*
+* Parameters:
+*  conn     - Connected streaming connection
+*  request  - Request to send
+*  response - Filled with the response status
+*
+* Return:
+*  cy_rslt_t: CY_RSLT_SUCCESS if the whole response was received.
+*
+*******************************************************************************/
+cy_rslt_t https_stream_exchange(https_stream_conn_t *conn,
+                                const https_stream_request_t *request,
+                                https_stream_response_t *response)
+{
+    cy_rslt_t result;
+
+    result = https_stream_send(conn, request);
+
+    if (CY_RSLT_SUCCESS == result)
+    {
+        result = read_response(conn, request->method, request->headers_cb,
+                               request->body_cb, request->arg,
+                               request->coded_body, response);
+    }
+    else
+    {
+        https_stream_disconnect(conn);
+    }
+
+    return result;
+}
+
+/*******************************************************************************
+* Function Name: https_stream_get
+********************************************************************************
+* Summary:
+*  Sends a GET request and streams the response body to the callback.
+*
+* Parameters:
+*  conn     - Connected streaming connection
+*  path     - Resource path
+*  body_cb  - Called for every piece of the body
+*  arg      - Argument passed to the body callback
+*  response - Filled with the response status
+*
+* Return:
+*  cy_rslt_t: CY_RSLT_SUCCESS if the whole response was received.
+*
+*******************************************************************************/
+cy_rslt_t https_stream_get(https_stream_conn_t *conn, const char *path,
+                           https_stream_body_cb_t body_cb, void *arg,
+                           https_stream_response_t *response)
+{
+    https_stream_request_t request =
+    {
+        .method            = CY_HTTP_CLIENT_METHOD_GET,
+        .path              = path,
+        .content_type      = NULL,
+        .body              = NULL,
+        .body_len          = 0U,
+        .body_by_reference = false,
+        .accept_encoding   = (0 != HTTP_ACCEPT_ENCODING_ENABLE),
+        .body_cb           = body_cb,
+        .arg               = arg
+    };
+
+    return https_stream_exchange(conn, &request, response);
+}
+
+/*******************************************************************************
+* Function Name: https_stream_pipeline
+********************************************************************************
+* Summary:
+*  Sends a batch of requests back to back on the kept-alive connection without
+*  waiting for the responses, then receives the responses in request order.
+*  The requests share TLS records as far as the transmit buffer allows, so
+*  the batch costs about one round trip instead of one per request.
+*
+*  If the server closes the connection part way, the requests from index
+*  *completed onward were not answered and can be sent again on a new
+*  connection. Requests that are not idempotent should only be resent when
+*  the application knows the server did not process them.
+*
+* Parameters:
+*  conn      - Connected streaming connection
+*  requests  - Requests of the batch
+*  count     - Number of requests, at most HTTPS_STREAM_PIPELINE_MAX
+*  responses - Array of count entries filled with the responses
+*  completed - Returns the number of responses received
+*
+* Return:
+*  cy_rslt_t: CY_RSLT_SUCCESS if every response was received.
+*
+*******************************************************************************/
+cy_rslt_t https_stream_pipeline(https_stream_conn_t *conn,
+                                const https_stream_request_t *requests,
+                                uint32_t count,
+                                https_stream_response_t *responses,
+                                uint32_t *completed)
+{
+    cy_rslt_t result = CY_RSLT_SUCCESS;
+
+    *completed = 0U;
+
+    if ((count > HTTPS_STREAM_PIPELINE_MAX) || !conn->connected)
+    {
+        return CY_RSLT_TYPE_ERROR;
+    }
+
+    for (uint32_t i = 0U; (i < count) && (CY_RSLT_SUCCESS == result); i++)
+    {
+        result = queue_request(conn, &requests[i]);
+    }
+
+    if (CY_RSLT_SUCCESS == result)
+    {
+        result = https_stream_flush(conn);
+    }
+
+    if (CY_RSLT_SUCCESS != result)
+    {
+        https_stream_disconnect(conn);
+    }
+
+    for (uint32_t i = 0U; (i < count) && (CY_RSLT_SUCCESS == result); i++)
+    {
+        result = read_response(conn, requests[i].method,
+                               requests[i].headers_cb, requests[i].body_cb,
+                               requests[i].arg, requests[i].coded_body,
+                               &responses[i]);
+
+        if (CY_RSLT_SUCCESS == result)
+        {
+            (*completed)++;
+
+            /* A response without keep-alive ends the batch early. */
+            if (!conn->connected && ((i + 1U) < count))
+            {
+                result = CY_RSLT_MODULE_SECURE_SOCKETS_CLOSED;
+            }
+        }
+    }
+
+    return result;
+}
+
+/*******************************************************************************
+* Function Name: https_stream_decode
+********************************************************************************
+* Summary:
+*  Decodes a complete body held in memory, such as one received by the HTTP
+*  client library, and hands it to the callback in pieces of at most
+*  HTTPS_STREAM_DECODE_BUFFER_LENGTH bytes. It takes one of the inflaters of
+*  the streaming connections while it runs.
+*
+* Parameters:
+*  coding      - Content-Encoding of the body
+*  data        - Body as received
+*  len         - Length of the body
+*  body_cb     - Called for every piece of the decoded body
+*  arg         - Argument passed to the body callback
+*  decoded_len - Returns the length of the decoded body
+*
+* Return:
+*  cy_rslt_t: CY_RSLT_SUCCESS if the whole body was decoded.
+*
+*******************************************************************************/
+cy_rslt_t https_stream_decode(http_coding_t coding, const uint8_t *data,
+                              uint32_t len, https_stream_body_cb_t body_cb,
+                              void *arg, uint32_t *decoded_len)
+{
+    cy_rslt_t result;
+    https_stream_response_t response;
+    https_stream_decoder_t *decoder = NULL;
+
+    *decoded_len = 0U;
+
+    if ((HTTP_CODING_GZIP == coding) || (HTTP_CODING_DEFLATE == coding))
+    {
+        decoder = claim_decoder(coding);
+
+        if (NULL == decoder)
+        {
+            return CY_RSLT_TYPE_ERROR;
+        }
+    }
+
+    (void) memset(&response, 0, sizeof(response));
+    response.content_coding = coding;
+
+    result = deliver_body(decoder, data, len, body_cb, arg, &response);
+
+    if ((CY_RSLT_SUCCESS == result) && (NULL != decoder) &&
+        (HTTP_INFLATE_DONE != decoder->status))
+    {
+        result = CY_RSLT_TYPE_ERROR;
+    }
+
+    release_decoder(decoder);
+
+    *decoded_len = response.decoded_len;
+
+    return result;
+}
+
+/*******************************************************************************
+* Function Name: https_stream_disconnect
+********************************************************************************
+* Summary:
+*  Closes the TLS connection and releases the socket. A response still being
+*  received is counted as a failed request.
+*
+*******************************************************************************/
+void https_stream_disconnect(https_stream_conn_t *conn)
+{
+    if (conn->connected)
+    {
+        (void) cy_socket_disconnect(conn->socket, 0U);
+        (void) cy_socket_delete(conn->socket);
+        conn->connected = false;
+    }
+
+    if (conn->reading)
+    {
+        release_decoder(conn->decoder);
+        conn->decoder = NULL;
+        conn->reading = false;
+        https_metrics_request_done(CY_RSLT_TYPE_ERROR, &conn->request_start);
+    }
+}
+
+
+/* [] END OF FILE */
@@ -0,0 +1,355 @@
+/*******************************************************************************
+* File Name: https_stream.h
+*
+* Description: This file is the public interface of https_stream.c. It
+* contains the configuration parameters of the streaming HTTPS connection used
+* to receive response bodies of any size in constant RAM.
+*
+* Related Document: See README.md
+********************************************************************************
+* Copyright 2024-2025, Cypress Semiconductor Corporation (an Infineon company) or
+* an affiliate of Cypress Semiconductor Corporation.  All rights reserved.
+*
+* This software, including source code, documentation and related
+* materials ("Software") is owned by Cypress Semiconductor Corporation
+* or one of its affiliates ("Cypress") and is protected by and subject to
+* worldwide patent protection (United States and foreign),
+* United States copyright laws and international treaty provisions.
+* Therefore, you may use this Software only as provided in the license
+* agreement accompanying the software package from which you
+* obtained this Software ("EULA").
+* If no EULA applies, Cypress hereby grants you a personal, non-exclusive,
+* non-transferable license to copy, modify, and compile the Software
+* source code solely for use in connection with Cypress's
+* integrated circuit products.  Any reproduction, modification, translation,
+* compilation, or representation of this Software except as specified
+* above is prohibited without the express written permission of Cypress.
+*
+* Disclaimer: THIS SOFTWARE IS PROVIDED AS-IS, WITH NO WARRANTY OF ANY KIND,
+* EXPRESS OR IMPLIED, INCLUDING, BUT NOT LIMITED TO, NONINFRINGEMENT, IMPLIED
+* WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE. Cypress
+* reserves the right to make changes to the Software without notice. Cypress
+* does not assume any liability arising out of the application or use of the
+* Software or any product or circuit described in the Software. Cypress does
+* not authorize its products for use in any products where a malfunction or
+* failure of the Cypress product may reasonably be expected to result in
+* significant property damage, injury or death ("High Risk Product"). By
+* including Cypress's product in a High Risk Product, the manufacturer
+* of such system or application assumes all risk of such use and in doing
+* so agrees to indemnify Cypress against all liability.
+*******************************************************************************/
+
+/*******************************************************************************
+* Include guard
+*******************************************************************************/
+#ifndef HTTPS_STREAM_H_
+#define HTTPS_STREAM_H_
+
+/*******************************************************************************
+* Header Files
+*******************************************************************************/
+#include <stdint.h>
+#include <stdbool.h>
+#include "cy_result.h"
+#include "cy_secure_sockets.h"
+#include "cy_http_client_api.h"
+#include "http_response_parser.h"
+#include "http_content_coding.h"
+#include "https_metrics.h"
+
+/*******************************************************************************
+* Macros
+*******************************************************************************/
+
+/* Size of the receive buffer of a streaming connection. The response headers
+ * must fit in this buffer; the body is handed to the application in pieces of
+ * at most this size.
+ */
+#define HTTPS_STREAM_BUFFER_LENGTH               (1024U)
+
+/* Size of the transmit buffer. Requests are staged here so that pipelined
+ * requests and small bodies leave in as few TLS records as possible.
+ */
+#define HTTPS_STREAM_TX_BUFFER_LENGTH            (1024U)
+
+/* Size of the buffer that compressed bodies are decoded into. The decoded
+ * body is handed to the application in pieces of at most this size.
+ */
+#define HTTPS_STREAM_DECODE_BUFFER_LENGTH        (512U)
+
+/* Number of gzip or deflate coded bodies that can be decoded at once, each
+ * with an inflater of about 34 KB. One serves the HTTPS client task, the
+ * other the connection of the event loop. A connection takes an inflater
+ * when a coded body starts and returns it when the body ends.
+ */
+#define HTTPS_STREAM_INFLATERS                   (2U)
+
+/* Maximum number of requests in one pipelined batch. */
+#define HTTPS_STREAM_PIPELINE_MAX                (8U)
+
+/* Value of content_length when the response carries no Content-Length. */
+#define HTTPS_STREAM_CONTENT_LENGTH_UNKNOWN      (UINT32_MAX)
+
+/* Value of range_end in a request for all bytes from range_start on. */
+#define HTTPS_STREAM_RANGE_END_OPEN              (UINT32_MAX)
+
+/* Value of retry_after when the response carries no Retry-After in seconds. */
+#define HTTPS_STREAM_RETRY_AFTER_NONE            (UINT32_MAX)
+
+/* Size of the ETag copied from the response, including the terminating NUL.
+ * A longer ETag is not reported.
+ */
+#define HTTPS_STREAM_ETAG_LENGTH                 (64U)
+
+/*******************************************************************************
+* Enumerations
+*******************************************************************************/
+
+/* How the end of the response body is found. */
+typedef enum
+{
+    HTTPS_STREAM_BODY_NONE,
+    HTTPS_STREAM_BODY_CONTENT_LENGTH,
+    HTTPS_STREAM_BODY_CHUNKED,
+    HTTPS_STREAM_BODY_UNTIL_CLOSE,
+} https_stream_body_mode_t;
+
+/* States of the incremental body decoder. */
+typedef enum
+{
+    HTTPS_STREAM_STATE_LENGTH_DATA,
+    HTTPS_STREAM_STATE_CHUNK_SIZE,
+    HTTPS_STREAM_STATE_CHUNK_EXT,
+    HTTPS_STREAM_STATE_CHUNK_SIZE_LF,
+    HTTPS_STREAM_STATE_CHUNK_DATA,
+    HTTPS_STREAM_STATE_CHUNK_DATA_CR,
+    HTTPS_STREAM_STATE_CHUNK_DATA_LF,
+    HTTPS_STREAM_STATE_TRAILER_LINE_START,
+    HTTPS_STREAM_STATE_TRAILER_LINE,
+    HTTPS_STREAM_STATE_TRAILER_END_LF,
+    HTTPS_STREAM_STATE_UNTIL_CLOSE,
+    HTTPS_STREAM_STATE_DONE,
+} https_stream_state_t;
+
+/*******************************************************************************
+* Data Types
+*******************************************************************************/
+
+/* Inflater with its decode buffer, taken by one coded body at a time. */
+typedef struct https_stream_decoder https_stream_decoder_t;
+
+/* Called for every piece of the response body, in order. data points into
+ * the receive buffer of the connection, or the decode buffer for a gzip or
+ * deflate encoded body, and is only valid during the call. Returning an
+ * error aborts the request.
+ */
+typedef cy_rslt_t (*https_stream_body_cb_t)(void *arg, const uint8_t *data,
+                                            uint32_t len);
+
+struct https_stream_response;
+
+/* Called once the response headers are parsed, before any of the body.
+ * Returning an error aborts the request, for example when the response is
+ * not the one expected.
+ */
+typedef cy_rslt_t (*https_stream_headers_cb_t)(void *arg,
+        const struct https_stream_response *response);
+
+/* Supplies the next piece of a request body sent with chunked
+ * transfer-encoding. Up to size bytes are written to buffer, which lies in
+ * the transmit buffer of the connection, and their number is returned in
+ * len. Returning a len of 0 ends the body; returning an error aborts the
+ * request.
+ */
+typedef cy_rslt_t (*https_stream_body_producer_t)(void *arg, uint8_t *buffer,
+                                                  uint32_t size,
+                                                  uint32_t *len);
+
+/* Credentials used for every streaming connection. */
+typedef struct
+{
+    const char *client_cert;
+    uint32_t client_cert_size;
+    const char *private_key;
+    uint32_t private_key_size;
+    const char *root_ca;
+    uint32_t root_ca_size;
+} https_stream_credentials_t;
+
+/* Request sent on a streaming connection. */
+typedef struct
+{
+    cy_http_client_method_t method;
+    const char *path;
+    const char *content_type;
+    const uint8_t *body;
+    uint32_t body_len;
+
+    /* Send the body from the caller's memory instead of copying it next to
+     * the headers. The body must stay valid until the request is sent.
+     */
+    bool body_by_reference;
+
+    /* Ask the server to compress the response body with gzip or deflate. */
+    bool accept_encoding;
+
+    /* Generates the body while the request is sent, with chunked
+     * transfer-encoding, instead of taking it from body and body_len. The
+     * body length need not be known and the body is never held in full.
+     * May be NULL.
+     */
+    https_stream_body_producer_t body_producer;
+    void *producer_arg;
+
+    /* Ask for the bytes range_start to range_end, inclusive, of the
+     * resource only. range_end may be HTTPS_STREAM_RANGE_END_OPEN.
+     */
+    bool range;
+    uint32_t range_start;
+    uint32_t range_end;
+
+    /* Called with arg once the response headers are parsed, may be NULL. */
+    https_stream_headers_cb_t headers_cb;
+
+    /* Hand a gzip or deflate coded response body to body_cb as received,
+     * for a callback that inflates it elsewhere, instead of inflating it
+     * here. content_coding of the response tells the coding, and
+     * decoded_len then counts the coded bytes.
+     */
+    bool coded_body;
+
+    /* Receives the body of the response, may be NULL to discard it. arg is
+     * passed to both callbacks.
+     */
+    https_stream_body_cb_t body_cb;
+    void *arg;
+} https_stream_request_t;
+
+/* Status of a streamed response. */
+typedef struct https_stream_response
+{
+    uint16_t status_code;
+    https_stream_body_mode_t body_mode;
+    uint32_t content_length;
+    uint32_t body_len;
+    uint32_t chunk_count;
+
+    /* Content-Encoding of the body. body_len counts the bytes received and
+     * decoded_len the bytes handed to the callback after decoding.
+     */
+    http_coding_t content_coding;
+    uint32_t decoded_len;
+    bool keep_alive;
+    uint32_t retry_after;
+    char etag[HTTPS_STREAM_ETAG_LENGTH];
+
+    /* Content-Range of a 206 (Partial Content) response: the first and last
+     * byte sent and the length of the whole resource, which is
+     * HTTPS_STREAM_CONTENT_LENGTH_UNKNOWN if the server did not say.
+     */
+    bool has_range;
+    uint32_t range_start;
+    uint32_t range_end;
+    uint32_t complete_length;
+} https_stream_response_t;
+
+/* Streaming HTTPS connection. */
+typedef struct
+{
+    cy_socket_t socket;
+    bool connected;
+    const char *host_name;
+    uint16_t port;
+
+    /* Index of the headers of the response being received. */
+    http_parser_t parser;
+
+    /* Incremental body decoder state. */
+    https_stream_state_t state;
+    uint32_t remaining;
+
+    /* Inflater of the coded body being received, NULL for other bodies,
+     * and whether the request asked for the coded body as received.
+     */
+    https_stream_decoder_t *decoder;
+    bool pass_coded_body;
+
+    /* Response being received with https_stream_read_poll. */
+    bool reading;
+    bool headers_done;
+    cy_http_client_method_t method;
+    https_stream_headers_cb_t headers_cb;
+    https_stream_body_cb_t body_cb;
+    void *body_arg;
+    https_stream_response_t *response;
+
+    /* Timing of the response being received. It is timed from the start of
+     * the last flush before it was awaited, which for pipelined requests
+     * includes the wait for the responses ahead of it.
+     */
+    https_metrics_stamp_t flushed_at;
+    https_metrics_stamp_t request_start;
+    bool flushed;
+    bool first_byte_seen;
+
+    /* Requests waiting to be sent are staged in tx_buffer[0, tx_len). */
+    uint32_t tx_len;
+    uint8_t tx_buffer[HTTPS_STREAM_TX_BUFFER_LENGTH];
+
+    /* Received bytes are held in rx_buffer[rx_start, rx_end). */
+    uint32_t rx_start;
+    uint32_t rx_end;
+    uint8_t rx_buffer[HTTPS_STREAM_BUFFER_LENGTH];
+
+    /* Traffic counters since the connection was opened. bytes_copied counts
+     * the bytes the application moved through its own buffers: serialized
+     * requests and received responses.
+     */
+    uint32_t bytes_sent;
+    uint32_t bytes_received;
+    uint32_t bytes_copied;
+} https_stream_conn_t;
+
+/*******************************************************************************
+* Function Prototypes
+*******************************************************************************/
+cy_rslt_t https_stream_init(const https_stream_credentials_t *credentials);
+cy_rslt_t https_stream_connect(https_stream_conn_t *conn,
+                               const char *host_name, uint16_t port);
+cy_rslt_t https_stream_write(https_stream_conn_t *conn, const void *data,
+                             uint32_t len);
+cy_rslt_t https_stream_flush(https_stream_conn_t *conn);
+cy_rslt_t https_stream_queue(https_stream_conn_t *conn,
+                             const https_stream_request_t *request);
+cy_rslt_t https_stream_send(https_stream_conn_t *conn,
+                            const https_stream_request_t *request);
+void https_stream_read_begin(https_stream_conn_t *conn,
+                             cy_http_client_method_t method,
+                             https_stream_headers_cb_t headers_cb,
+                             https_stream_body_cb_t body_cb, void *arg,
+                             https_stream_response_t *response);
+cy_rslt_t https_stream_read_poll(https_stream_conn_t *conn, bool *done);
+cy_rslt_t https_stream_read_response(https_stream_conn_t *conn,
+                                     cy_http_client_method_t method,
+                                     https_stream_body_cb_t body_cb, void *arg,
+                                     https_stream_response_t *response);
+cy_rslt_t https_stream_exchange(https_stream_conn_t *conn,
+                                const https_stream_request_t *request,
+                                https_stream_response_t *response);
+cy_rslt_t https_stream_get(https_stream_conn_t *conn, const char *path,
+                           https_stream_body_cb_t body_cb, void *arg,
+                           https_stream_response_t *response);
+cy_rslt_t https_stream_pipeline(https_stream_conn_t *conn,
+                                const https_stream_request_t *requests,
+                                uint32_t count,
+                                https_stream_response_t *responses,
+                                uint32_t *completed);
+cy_rslt_t https_stream_decode(http_coding_t coding, const uint8_t *data,
+                              uint32_t len, https_stream_body_cb_t body_cb,
+                              void *arg, uint32_t *decoded_len);
+void https_stream_disconnect(https_stream_conn_t *conn);
+
+#endif /* HTTPS_STREAM_H_ */
+
+
+/* [] END OF FILE */
@@ -49,6 +49,7 @@
 #include <task.h>
 #include "retarget_io_init.h"
 #include "cy_time.h"
+#include "boot_trace.h"
 
 /*******************************************************************************
 * Macros
@@ -199,7 +200,8 @@ static void setup_clib_support(void)
 * Summary:
 *  Entry function for the application.
 *  This function initializes the BSP and UART port for debugging. Then it
-*  creates an "HTTPS Client" task and starts the RTOS scheduler.
+*  creates an "HTTPS Client" task and starts the RTOS scheduler. Each step
+*  is recorded in the boot trace.
 *
 * Parameters:
 *  void
@@ -212,8 +214,13 @@ int main(void)
 {
     cy_rslt_t result;
 
+    /* Start the cycle counter for the boot trace. */
+    boot_trace_init();
+
     /* Initialize the Board Support Package (BSP) */
+    BOOT_TRACE_BEGIN_PHASE(BOOT_TRACE_CYBSP_INIT);
     result = cybsp_init();
+    BOOT_TRACE_END_PHASE(BOOT_TRACE_CYBSP_INIT);
 
     /* Board init failed. Stop program execution */
     if (CY_RSLT_SUCCESS != result)
@@ -222,13 +229,19 @@ int main(void)
     }
 
     /* Setup CLIB support library. */
+    BOOT_TRACE_BEGIN_PHASE(BOOT_TRACE_CLIB_SUPPORT);
     setup_clib_support();
+    BOOT_TRACE_END_PHASE(BOOT_TRACE_CLIB_SUPPORT);
 
     /* Setup the LPTimer instance for CM33 CPU. */
+    BOOT_TRACE_BEGIN_PHASE(BOOT_TRACE_LPTIMER_SETUP);
     setup_tickless_idle_timer();
+    BOOT_TRACE_END_PHASE(BOOT_TRACE_LPTIMER_SETUP);
 
     /* Initialize retarget-io middleware */
+    BOOT_TRACE_BEGIN_PHASE(BOOT_TRACE_RETARGET_IO);
     init_retarget_io();
+    BOOT_TRACE_END_PHASE(BOOT_TRACE_RETARGET_IO);
 
     /* \x1b[2J\x1b[;H - ANSI ESC sequence to clear screen. */
     printf("\x1b[2J\x1b[;H");
@@ -239,7 +252,9 @@ int main(void)
    /* Enable CM55. CM55_APP_BOOT_ADDR must be updated if CM55 memory layout
     * is changed.
     */
+    BOOT_TRACE_BEGIN_PHASE(BOOT_TRACE_CM55_ENABLE);
     Cy_SysEnableCM55(MXCM55, CM55_APP_BOOT_ADDR, CM55_BOOT_WAIT_TIME_US);
+    BOOT_TRACE_END_PHASE(BOOT_TRACE_CM55_ENABLE);
 
     /* Enable global interrupts */
     __enable_irq();
@@ -252,7 +267,10 @@ int main(void)
     /* Start the FreeRTOS scheduler */
     if( pdPASS == result )
     {
-        /* Start the RTOS Scheduler */
+        /* Start the RTOS Scheduler. The phase ends when the HTTPS Client
+         * task starts running.
+         */
+        BOOT_TRACE_BEGIN_PHASE(BOOT_TRACE_SCHEDULER_START);
         vTaskStartScheduler();
 
     }
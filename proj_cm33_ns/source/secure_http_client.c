@@ -52,8 +52,27 @@
 
 /* HTTPS client task header file. */
 #include "secure_http_client.h"
+#include "app_log.h"
 #include "cy_http_client_api.h"
 #include "secure_keys.h"
+#include "https_benchmark.h"
+#include "https_stream.h"
+#include "https_server_cache.h"
+#include "https_client_pool.h"
+#include "https_request_template.h"
+#include "http_response_parser.h"
+#include "https_response_cache.h"
+#include "crypto_offload.h"
+#include "body_offload.h"
+#include "http_content_coding.h"
+#include "https_async.h"
+#include "https_download.h"
+#include "https_reconnect.h"
+#include "wifi_join_cache.h"
+#include "boot_trace.h"
+#include "https_metrics.h"
+#include "https_mem_pool.h"
+#include "https_script.h"
 #include "lwip/ip_addr.h"
 
 /* FreeRTOS header file */
@@ -72,13 +91,50 @@
 #define APP_SDIO_FREQUENCY_HZ                        (25000000U)
 #define SDHC_SDIO_64BYTES_BLOCK                      (64U)
 #define INITIAL_VALUE                                (0U)
+#define HTTP_STATUS_OK                               (200U)
+#define HTTP_STATUS_NOT_MODIFIED                     (304U)
+
+/* Longest generated line of the chunked upload. */
+#define UPLOAD_LINE_LENGTH                           (48U)
+
+/*******************************************************************************
+* Data Types
+*******************************************************************************/
+
+/* Response body of the streaming request, processed by the body pipeline.
+ * coded_body asks for a gzip or deflate body as received, for the CM55 to
+ * inflate, and begun tells whether the headers started the pipeline.
+ */
+typedef struct
+{
+    body_offload_t body;
+    bool coded_body;
+    bool begun;
+} stream_body_t;
+
+/* State of the generated body of a chunked upload. */
+typedef struct
+{
+    uint32_t remaining;
+    uint32_t line;
+    uint32_t chunks;
+} upload_source_t;
 
 /*******************************************************************************
 * Global Variables
 ********************************************************************************/
 static bool get_after_put_flag = false;
+
+/* Suppresses the per-request console output while a benchmark is running. */
+static bool quiet_mode = false;
+
+/* Bytes moved through application buffers by the last request. */
+static uint32_t last_request_bytes_copied;
 static cy_http_client_method_t http_client_method;
 
+/* Script entered on the console for the script runner. */
+static char script_line[HTTPS_SCRIPT_LINE_LENGTH];
+
 /* Holds the security configuration such as client certificate,
  * client key, and rootCA.
  */
@@ -96,9 +152,36 @@ static cy_http_client_response_t http_response;
 /* Holds the IP address obtained using Wi-Fi Connection Manager (WCM). */
 static cy_wcm_ip_address_t ip_addr;
 
-/* Secure HTTP client instance. */
+/* Time taken by wifi_connect to join the network, in milliseconds. */
+static uint32_t wifi_join_ms;
+
+/* Secure HTTP client instance borrowed from the connection pool for the
+ * request in progress.
+ */
 static cy_http_client_t https_client;
 
+/* Streaming connection used for responses larger than http_get_buffer. */
+static https_stream_conn_t stream_conn;
+
+/* Index of the headers of the last response received by send_http_request. */
+static http_parser_t response_index;
+
+#if (HTTP_GZIP_UPLOAD_ENABLE)
+/* Request body compressed by send_http_request. */
+static uint8_t http_upload_buffer[HTTP_GZIP_UPLOAD_BUFFER_LENGTH];
+#endif
+
+/* Requests with a fixed request line and headers, rendered once after the
+ * first connection.
+ */
+static https_request_template_t request_templates[] =
+{
+    { .method = CY_HTTP_CLIENT_METHOD_GET,  .path = HTTP_PATH },
+    { .method = CY_HTTP_CLIENT_METHOD_POST, .path = HTTP_PATH },
+    { .method = CY_HTTP_CLIENT_METHOD_PUT,  .path = HTTP_PATH },
+    { .method = CY_HTTP_CLIENT_METHOD_GET,  .path = HTTP_GET_PATH_AFTER_PUT },
+};
+
 /* SDIO Instance */
 static mtb_hal_sdio_t sdio_instance;
 static cy_stc_sd_host_context_t sdhc_host_context;
@@ -135,7 +218,40 @@ static void disconnect_callback_handler(cy_http_client_t handle,
 static cy_rslt_t send_http_request(cy_http_client_t handle,
                             cy_http_client_method_t method,const char * pPath);
 static cy_rslt_t configure_https_client(void);
+static void render_request_templates(cy_http_client_t handle);
+static void set_request_headers(cy_http_client_header_t *headers);
+static void print_indexed_headers(const cy_http_client_response_t *response);
+static void print_response_body(const uint8_t *body, uint32_t body_len,
+                                http_coding_t coding);
+static bool compress_request_body(const uint8_t **body, uint32_t *body_len);
+static void update_response_cache(https_cache_entry_t *cached,
+        const char *path, const cy_http_client_response_t *response,
+        const uint8_t **body, uint32_t *body_len, http_coding_t *coding);
 static cy_rslt_t wifi_connect(void);
+static cy_rslt_t benchmark_request(void *arg, uint32_t *bytes_copied);
+static cy_rslt_t benchmark_reconnect_request(void *arg,
+                                             uint32_t *bytes_copied);
+static void http_stream_request(void);
+static void http_pipeline_request(void);
+static void http_async_request(void);
+static void http_chunked_upload(void);
+static void http_range_download(void);
+static void http_script_request(void);
+static uint32_t read_console_line(char *line, uint32_t size);
+static cy_rslt_t download_sink_handler(void *arg, uint32_t offset,
+                                       const uint8_t *data, uint32_t len);
+static cy_rslt_t upload_producer(void *arg, uint8_t *buffer, uint32_t size,
+                                 uint32_t *len);
+static cy_rslt_t stream_headers_handler(void *arg,
+        const https_stream_response_t *response);
+static cy_rslt_t stream_body_handler(void *arg, const uint8_t *data,
+                                     uint32_t len);
+static void print_body_summary(const body_offload_t *body,
+                               const json_scan_summary_t *summary);
+static cy_rslt_t discard_body_handler(void *arg, const uint8_t *data,
+                                      uint32_t len);
+static cy_rslt_t print_body_handler(void *arg, const uint8_t *data,
+                                    uint32_t len);
 
 /*******************************************************************************
 * Function Definitions
@@ -248,7 +364,10 @@ static void app_sdio_init(void)
 * Summary:
 *  The device associates to the Access Point with given SSID, PASSWORD, and
 *  SECURITY type. It retries for MAX_WIFI_RETRY_COUNT times if the Wi-Fi
-*  connection fails.
+*  connection fails. When the join cache holds the access point of the
+*  previous join, the first attempt is a directed join to that BSSID with
+*  the cached IP settings; if it fails, the cache is dropped and the
+*  remaining attempts scan and use DHCP.
 *
 * Parameters:
 *  void
@@ -262,6 +381,9 @@ static cy_rslt_t wifi_connect(void)
 {
     cy_rslt_t result = CY_RSLT_SUCCESS;
     uint32_t retry_count = INITIAL_VALUE;
+    bool cached_join = false;
+    TickType_t join_start = INITIAL_VALUE;
+    cy_wcm_ip_setting_t cached_ip_settings;
     cy_wcm_connect_params_t connect_param = (cy_wcm_connect_params_t)
     {
         .ap_credentials =  {{INITIAL_VALUE}},
@@ -279,14 +401,18 @@ static cy_rslt_t wifi_connect(void)
 #endif /* (CY_CFG_PWR_SYS_IDLE_MODE == CY_CFG_PWR_MODE_DEEPSLEEP) */
 
     /* Initialize SDIO Instance */
+    BOOT_TRACE_BEGIN_PHASE(BOOT_TRACE_SDIO_INIT);
     app_sdio_init();
+    BOOT_TRACE_END_PHASE(BOOT_TRACE_SDIO_INIT);
 
     /* Initialize the Wi-Fi device as a STA.*/
     wcm_config.interface = CY_WCM_INTERFACE_TYPE_STA;
     wcm_config.wifi_interface_instance = &sdio_instance;
 
     /* Initialize WiFi Connection Manager (WCM) */
+    BOOT_TRACE_BEGIN_PHASE(BOOT_TRACE_WCM_INIT);
     result = cy_wcm_init(&wcm_config);
+    BOOT_TRACE_END_PHASE(BOOT_TRACE_WCM_INIT);
 
     if (CY_RSLT_SUCCESS == result)
     {
@@ -298,18 +424,43 @@ static cy_rslt_t wifi_connect(void)
         connect_param.ap_credentials.security = WIFI_SECURITY_TYPE;
         APP_INFO(("Join to AP: %s\n", connect_param.ap_credentials.SSID));
 
+#if (WIFI_JOIN_CACHE_ENABLE)
+        cached_join = wifi_join_cache_load(WIFI_SSID, &connect_param,
+                &cached_ip_settings);
+
+        if (cached_join)
+        {
+            APP_INFO(("Joining cached AP on channel %u\n",
+                    (unsigned int) wifi_join_cache_channel()));
+        }
+#endif /* WIFI_JOIN_CACHE_ENABLE */
+
+        join_start = xTaskGetTickCount();
+
        /* Connect to Access Point. It validates the connection parameters
         * and then establishes connection to AP.
         */
         for (retry_count = INITIAL_VALUE; retry_count < MAX_WIFI_RETRY_COUNT;
                 retry_count++)
         {
+            boot_trace_record(BOOT_TRACE_WCM_CONNECT_AP, BOOT_TRACE_BEGIN,
+                    (uint16_t) retry_count);
             result = cy_wcm_connect_ap(&connect_param, &ip_addr);
+            boot_trace_record(BOOT_TRACE_WCM_CONNECT_AP, BOOT_TRACE_END,
+                    (uint16_t) retry_count);
 
             if (CY_RSLT_SUCCESS == result)
             {
-                APP_INFO(("Successfully joined Wi-Fi network %s\n",
-                        connect_param.ap_credentials.SSID));
+                wifi_join_ms = (uint32_t) pdTICKS_TO_MS(xTaskGetTickCount() -
+                        join_start);
+                APP_INFO(("Successfully joined Wi-Fi network %s in %u ms "
+                        "(%s)\n", connect_param.ap_credentials.SSID,
+                        (unsigned int) wifi_join_ms,
+                        cached_join ? "cached BSSID" : "full scan"));
+
+#if (WIFI_JOIN_CACHE_ENABLE)
+                wifi_join_cache_store(WIFI_SSID, &ip_addr);
+#endif /* WIFI_JOIN_CACHE_ENABLE */
 
                 if (CY_WCM_IP_VER_V4 == ip_addr.version)
                 {
@@ -325,12 +476,28 @@ static cy_rslt_t wifi_connect(void)
                 break;
             }
 
+            if (cached_join)
+            {
+                /* The access point or the lease has changed since the
+                 * last boot. Forget it and fall back to a full scan with
+                 * DHCP.
+                 */
+                ERR_INFO(("Cached join failed, scanning for the AP\n"));
+                wifi_join_cache_invalidate();
+                (void) memset(connect_param.BSSID, INITIAL_VALUE,
+                        sizeof(connect_param.BSSID));
+                connect_param.band = (cy_wcm_wifi_band_t)INITIAL_VALUE;
+                connect_param.static_ip_settings = NULL;
+                cached_join = false;
+                continue;
+            }
+
             ERR_INFO(("Failed to join Wi-Fi network. Retrying...\n"));
         }
     }
     else
     {
-        printf("Wi-Fi Connection Manager initialization failed!\n");
+        app_log_printf("Wi-Fi Connection Manager initialization failed!\n");
         handle_app_error();
     }
 
@@ -341,13 +508,16 @@ static cy_rslt_t wifi_connect(void)
 * Function Name: disconnect_callback
 ********************************************************************************
 * Summary:
-*  Callback function for http disconnect.
+*  Callback function for http disconnect. The pool has already marked the
+*  connection as lost; it is reopened with backoff when it is next borrowed.
 *******************************************************************************/
 static void disconnect_callback_handler(cy_http_client_t handle,
         cy_http_client_disconn_type_t type, void *args)
 {
-    printf("\nApplication Disconnect callback triggered for handle = "
-            "%p type=%d\n", handle, type);
+    CY_UNUSED_PARAMETER(args);
+
+    app_log_printf("\nApplication Disconnect callback triggered for handle = "
+            "%p type=%d, reconnecting on the next request\n", handle, type);
 }
 
 /*******************************************************************************
@@ -368,8 +538,22 @@ static cy_rslt_t send_http_request( cy_http_client_t handle,
         cy_http_client_method_t method, const char * pPath)
 {
     cy_http_client_request_header_t request;
-    cy_http_client_header_t header;
+    /* Conditional headers are only added to a GET and Content-Encoding only
+     * to a POST or PUT, so they share the extra entries.
+     */
+    cy_http_client_header_t header[NUM_HTTP_HEADERS +
+                                   HTTPS_CACHE_MAX_CONDITIONAL_HEADERS];
     cy_http_client_response_t response;
+    https_cache_entry_t *cached = NULL;
+    uint32_t num_extra = 0U;
+    const uint8_t *body;
+    uint32_t body_len;
+    const char *coding_value;
+    uint32_t coding_len = 0U;
+    http_coding_t coding;
+    const uint8_t *request_body = (const uint8_t *) REQUEST_BODY;
+    uint32_t request_body_len = REQUEST_BODY_LENGTH;
+    https_metrics_stamp_t request_start;
 
     /* Return value of all methods from the HTTP Client library API. */
     cy_rslt_t http_status = CY_RSLT_SUCCESS;
@@ -384,58 +568,422 @@ static cy_rslt_t send_http_request( cy_http_client_t handle,
     request.range_end = HTTP_REQUEST_RANGE_END;
     request.range_start = HTTP_REQUEST_RANGE_START;
     request.resource_path = pPath;
-    header.field = "Content-Type";
-    header.field_len = sizeof("Content-Type")-LAST_INDEX;
-    header.value = "application/x-www-form-urlencoded";
-    header.value_len = sizeof("application/x-www-form-urlencoded") - LAST_INDEX;
 
-    http_status = cy_http_client_write_header(handle, &request, &header,
-            NUM_HTTP_HEADERS);
+    last_request_bytes_copied = INITIAL_VALUE;
+
+   /* A GET of a cached resource asks the server to send the body only if it
+    * changed. Other methods may change resources, so the cache is dropped.
+    */
+    if (CY_HTTP_CLIENT_METHOD_GET == method)
+    {
+        cached = https_cache_lookup(pPath);
+        num_extra = https_cache_conditional_headers(cached,
+                &header[NUM_HTTP_HEADERS], HTTPS_CACHE_MAX_CONDITIONAL_HEADERS);
+    }
+    else
+    {
+        https_cache_clear();
+    }
+
+    /* Large uploads are sent gzip compressed when enabled. */
+    if (((CY_HTTP_CLIENT_METHOD_POST == method) ||
+         (CY_HTTP_CLIENT_METHOD_PUT == method)) &&
+        compress_request_body(&request_body, &request_body_len))
+    {
+        header[NUM_HTTP_HEADERS + num_extra].field = "Content-Encoding";
+        header[NUM_HTTP_HEADERS + num_extra].field_len =
+                sizeof("Content-Encoding") - LAST_INDEX;
+        header[NUM_HTTP_HEADERS + num_extra].value = "gzip";
+        header[NUM_HTTP_HEADERS + num_extra].value_len =
+                sizeof("gzip") - LAST_INDEX;
+        num_extra++;
+    }
+
+    /* Fixed requests copy their pre-rendered headers. Others are formatted
+     * by the library.
+     */
+    http_status = https_template_apply(https_template_find(request_templates,
+            (uint32_t)(sizeof(request_templates) /
+                       sizeof(request_templates[0])), method, pPath),
+            &request);
+
+    for (uint32_t i = 0U; (CY_RSLT_SUCCESS == http_status) &&
+                          (i < num_extra); i++)
+    {
+        http_status = https_template_append_header(&request,
+                &header[NUM_HTTP_HEADERS + i]);
+    }
+
+    if(CY_RSLT_SUCCESS != http_status)
+    {
+        request.headers_len = HTTP_REQUEST_HEADER_LEN;
+        set_request_headers(&header[0]);
+        http_status = cy_http_client_write_header(handle, &request, header,
+                NUM_HTTP_HEADERS + num_extra);
+    }
 
     if(CY_RSLT_SUCCESS != http_status)
     {
-        printf("\nWrite Header ----------- Fail \n");
+        app_log_printf("\nWrite Header ----------- Fail \n");
     }
     else
     {
-        printf( "\n Sending Request Headers:\n%.*s\n",
-                ( int ) request.headers_len, ( char * ) request.buffer);
+        if (!quiet_mode)
+        {
+            app_log_printf("\n Sending Request Headers:\n");
+            app_log_write(request.buffer, request.headers_len);
+            app_log_printf("\n");
+        }
+        https_metrics_stamp(&request_start);
         http_status = cy_http_client_send(handle, &request,
-                (uint8_t *)REQUEST_BODY, REQUEST_BODY_LENGTH, &response);
+                (uint8_t *) request_body, request_body_len, &response);
+        https_metrics_request_done(http_status, &request_start);
 
         if(CY_RSLT_SUCCESS != http_status)
         {
-            printf("\nFailed to send HTTP method=%d\n Error=%ld\r\n",
+            app_log_printf("\nFailed to send HTTP method=%d\n Error=%ld\r\n",
                     request.method,(unsigned long)http_status);
         }
         else
         {
-            if ( CY_HTTP_CLIENT_METHOD_HEAD != method )
+           /* Request headers and body are copied once into the TLS record
+            * and the response headers and body once into http_get_buffer.
+            */
+            last_request_bytes_copied = request.headers_len +
+                    request_body_len + response.headers_len +
+                    response.body_len;
+            https_metrics_add_bytes(request.headers_len + request_body_len,
+                    response.headers_len + response.body_len);
+
+            /* Index the response headers once for the cache and the log. */
+            if ((NULL == response.header) ||
+                (HTTP_PARSER_DONE != http_parser_index(&response_index,
+                        (const char *) response.header,
+                        (uint32_t) response.headers_len)))
+            {
+                http_parser_init(&response_index, false);
+            }
+
+            coding_value = http_parser_value(&response_index,
+                    (const char *) response.header,
+                    HTTP_HEADER_HASH_CONTENT_ENCODING,
+                    HTTP_HEADER_CONTENT_ENCODING, &coding_len);
+            coding = http_coding_parse(coding_value, coding_len);
+            body = response.body;
+            body_len = (uint32_t) response.body_len;
+
+            if (CY_HTTP_CLIENT_METHOD_GET == method)
+            {
+                update_response_cache(cached, pPath, &response, &body,
+                                      &body_len, &coding);
+            }
+
+            if (( CY_HTTP_CLIENT_METHOD_HEAD != method ) && !quiet_mode)
             {
                 TEST_INFO(( "Received HTTP response from %.*s%.*s...\n"
-                       "Response Headers:\n %.*s\n"
-                       "Response Status :\n %u \n"
-                       "Response Body   :\n %.*s\n",
+                       "Response Headers:\n ",
                        ( int ) sizeof(HTTPS_SERVER_HOST)-LAST_INDEX,
                        HTTPS_SERVER_HOST,
                        ( int ) sizeof(request.resource_path) -LAST_INDEX,
-                       request.resource_path,
-                       ( int ) response.headers_len, response.header,
-                       response.status_code,
-                       ( int ) response.body_len, response.body ));
-
+                       request.resource_path ));
+                app_log_write(response.header, response.headers_len);
+                TEST_INFO(( "\nResponse Status :\n %u \n"
+                       "Response Body   :\n",
+                       response.status_code ));
+                print_response_body(body, body_len, coding);
+            }
+            if (!quiet_mode)
+            {
+                app_log_printf("\n buffer_len:[%d] headers_len:[%d]"
+                        " header_count:[%d] body_len:[%d] content_len:[%d]\n",
+                         response.buffer_len, response.headers_len,
+                         response.header_count, response.body_len,
+                         response.content_len);
+                print_indexed_headers(&response);
             }
-            printf("\n buffer_len:[%d] headers_len:[%d] header_count:"
-                    "[%d] body_len:[%d] content_len:[%d]\n",
-                     response.buffer_len, response.headers_len,
-                     response.header_count, response.body_len,
-                     response.content_len);
         }
     }
 
     return http_status;
 }
 
+/*******************************************************************************
+* Function Name: print_indexed_headers
+********************************************************************************
+* Summary:
+*  Prints the indexed response fields that control caching and retries, if
+*  the server sent them.
+*
+* Parameters:
+*  response: Response received by the HTTP client library
+*
+* Return:
+*  void
+*
+*******************************************************************************/
+static void print_indexed_headers(const cy_http_client_response_t *response)
+{
+    const char *headers = (const char *) response->header;
+    const char *etag;
+    uint32_t etag_len = 0U;
+    uint32_t retry_after = 0U;
+
+    etag = http_parser_value(&response_index, headers, HTTP_HEADER_HASH_ETAG,
+                             HTTP_HEADER_ETAG, &etag_len);
+    if (NULL != etag)
+    {
+        app_log_printf(" ETag:[%.*s]\n", (int) etag_len, etag);
+    }
+
+    if (http_parser_value_uint(&response_index, headers,
+                               HTTP_HEADER_HASH_RETRY_AFTER,
+                               HTTP_HEADER_RETRY_AFTER, &retry_after))
+    {
+        app_log_printf(" Retry-After:[%lu] s\n", (unsigned long) retry_after);
+    }
+}
+
+/*******************************************************************************
+* Function Name: update_response_cache
+********************************************************************************
+* Summary:
+*  Updates the response cache with the response to a GET request. A 304 (Not
+*  Modified) response is answered with the cached body; a 200 (OK) response
+*  stores its validators and body.
+*
+* Parameters:
+*  cached:   Cache entry the request was made conditional on, or NULL
+*  path:     Resource path of the request
+*  response: Response received by the HTTP client library
+*  body:     Set to the body to present to the user
+*  body_len: Set to the length of that body
+*  coding:   Content coding of the received body; set to the coding of the
+*            cached body when that is presented instead
+*
+* Return:
+*  void
+*
+*******************************************************************************/
+static void update_response_cache(https_cache_entry_t *cached,
+        const char *path, const cy_http_client_response_t *response,
+        const uint8_t **body, uint32_t *body_len, http_coding_t *coding)
+{
+    https_cache_entry_t *stored;
+    const char *headers = (const char *) response->header;
+    const char *etag;
+    const char *last_modified;
+    uint32_t etag_len = 0U;
+    uint32_t last_modified_len = 0U;
+
+    if ((HTTP_STATUS_NOT_MODIFIED == response->status_code) &&
+        (NULL != cached))
+    {
+        https_cache_not_modified(cached);
+        *body = cached->body;
+        *body_len = cached->body_len;
+        *coding = cached->content_coding;
+    }
+    else if (HTTP_STATUS_OK == response->status_code)
+    {
+        etag = http_parser_value(&response_index, headers,
+                                 HTTP_HEADER_HASH_ETAG, HTTP_HEADER_ETAG,
+                                 &etag_len);
+        last_modified = http_parser_value(&response_index, headers,
+                                          HTTP_HEADER_HASH_LAST_MODIFIED,
+                                          HTTP_HEADER_LAST_MODIFIED,
+                                          &last_modified_len);
+        stored = https_cache_store(path, etag, etag_len, last_modified,
+                                   last_modified_len, response->body,
+                                   (uint32_t) response->body_len);
+        if (NULL != stored)
+        {
+            /* The body is cached as received, still content coded. */
+            stored->content_coding = *coding;
+        }
+    }
+    else
+    {
+        /* Keep the cached validators for the next request. */
+    }
+}
+
+/*******************************************************************************
+* Function Name: print_body_handler
+********************************************************************************
+* Summary:
+*  Prints a piece of a decoded response body.
+*
+* Parameters:
+*  arg:  Unused
+*  data: Decoded body bytes
+*  len:  Number of bytes at data
+*
+* Return:
+*  cy_rslt_t: CY_RSLT_SUCCESS
+*
+*******************************************************************************/
+static cy_rslt_t print_body_handler(void *arg, const uint8_t *data,
+                                    uint32_t len)
+{
+    (void) arg;
+
+    app_log_write(data, len);
+
+    return CY_RSLT_SUCCESS;
+}
+
+/*******************************************************************************
+* Function Name: print_response_body
+********************************************************************************
+* Summary:
+*  Prints a response body, decoding it first if the server sent it gzip or
+*  deflate coded.
+*
+* Parameters:
+*  body:     Response body as received
+*  body_len: Length of the body
+*  coding:   Content coding of the body
+*
+* Return:
+*  void
+*
+*******************************************************************************/
+static void print_response_body(const uint8_t *body, uint32_t body_len,
+                                http_coding_t coding)
+{
+    uint32_t decoded_len = 0U;
+
+    if (HTTP_CODING_IDENTITY == coding)
+    {
+        app_log_printf(" ");
+        app_log_write(body, body_len);
+        app_log_printf("\n");
+    }
+    else if (CY_RSLT_SUCCESS == https_stream_decode(coding, body, body_len,
+                                     print_body_handler, NULL, &decoded_len))
+    {
+        app_log_printf("\n (%lu bytes decoded from %lu)\n",
+               (unsigned long) decoded_len, (unsigned long) body_len);
+    }
+    else
+    {
+        app_log_printf("\n Failed to decode the %lu byte response body.\n",
+               (unsigned long) body_len);
+    }
+}
+
+/*******************************************************************************
+* Function Name: compress_request_body
+********************************************************************************
+* Summary:
+*  Compresses a request body with gzip when upload compression is enabled,
+*  the body is large enough to benefit and the result is smaller.
+*
+* Parameters:
+*  body:     Body to send; set to the compressed body on success
+*  body_len: Length of the body; set to the compressed length on success
+*
+* Return:
+*  bool: true if the body was replaced by its gzip encoding
+*
+*******************************************************************************/
+static bool compress_request_body(const uint8_t **body, uint32_t *body_len)
+{
+#if (HTTP_GZIP_UPLOAD_ENABLE)
+    uint32_t compressed_len = 0U;
+
+    if ((*body_len < HTTP_GZIP_UPLOAD_MIN_LENGTH) ||
+        (CY_RSLT_SUCCESS != http_gzip_compress(*body, *body_len,
+                http_upload_buffer, sizeof(http_upload_buffer),
+                &compressed_len)) ||
+        (compressed_len >= *body_len))
+    {
+        return false;
+    }
+
+    if (!quiet_mode)
+    {
+        app_log_printf(" Request body compressed from %lu to %lu bytes.\n",
+               (unsigned long) *body_len, (unsigned long) compressed_len);
+    }
+
+    *body = http_upload_buffer;
+    *body_len = compressed_len;
+
+    return true;
+#else
+    (void) body;
+    (void) body_len;
+
+    return false;
+#endif
+}
+
+/*******************************************************************************
+* Function Name: set_request_headers
+********************************************************************************
+* Summary:
+*  Fills in the fixed headers sent with every request: the Content-Type and,
+*  when enabled, the content codings the client accepts.
+*
+* Parameters:
+*  headers: NUM_HTTP_HEADERS headers to fill in
+*
+* Return:
+*  void
+*
+*******************************************************************************/
+static void set_request_headers(cy_http_client_header_t *headers)
+{
+    headers[0].field = "Content-Type";
+    headers[0].field_len = sizeof("Content-Type")-LAST_INDEX;
+    headers[0].value = "application/x-www-form-urlencoded";
+    headers[0].value_len = sizeof("application/x-www-form-urlencoded") -
+            LAST_INDEX;
+
+#if (HTTP_ACCEPT_ENCODING_ENABLE)
+    headers[1].field = "Accept-Encoding";
+    headers[1].field_len = sizeof("Accept-Encoding") - LAST_INDEX;
+    headers[1].value = HTTP_ACCEPT_ENCODING_VALUE;
+    headers[1].value_len = sizeof(HTTP_ACCEPT_ENCODING_VALUE) - LAST_INDEX;
+#endif
+}
+
+/*******************************************************************************
+* Function Name: render_request_templates
+********************************************************************************
+* Summary:
+*  Renders the request line and headers of the fixed requests once, so that
+*  send_http_request only copies them. A template that fails to render is
+*  left unused and its request is formatted on every send.
+*
+* Parameters:
+*  handle: Connected HTTP client used to format the headers
+*
+* Return:
+*  void
+*
+*******************************************************************************/
+static void render_request_templates(cy_http_client_t handle)
+{
+    cy_http_client_header_t header[NUM_HTTP_HEADERS];
+    https_request_template_t *tpl;
+
+    for (uint32_t i = 0U;
+         i < (sizeof(request_templates) / sizeof(request_templates[0])); i++)
+    {
+        tpl = &request_templates[i];
+        set_request_headers(header);
+
+        if (CY_RSLT_SUCCESS != https_template_render(tpl, handle,
+                tpl->method, tpl->path, header, NUM_HTTP_HEADERS))
+        {
+            ERR_INFO(("Failed to render request template %lu.\n",
+                      (unsigned long) i));
+        }
+    }
+}
+
 /*******************************************************************************
 * Function Name: configure_https_client
 ********************************************************************************
@@ -455,19 +1003,57 @@ static cy_rslt_t configure_https_client(void)
 {
     cy_rslt_t result = CY_RSLT_SUCCESS;
     cy_http_disconnect_callback_t http_cb;
+    cy_wcm_mac_t mac;
+    uint32_t seed = (uint32_t) xTaskGetTickCount();
     ( void ) memset( &security_config, MEMSET_VAL, sizeof( security_config ) );
     ( void ) memset( &server_info, MEMSET_VAL, sizeof( server_info ) );
 
     /* Set the credential information. */
+#if (SECURE_KEYS_USE_DER)
+   /* DER buffers are passed with their exact size. Mbed TLS treats a buffer
+    * that does not end with a NUL as DER and parses it without decoding.
+    */
+    security_config.client_cert      = (const char *) keyCLIENT_CERTIFICATE_DER;
+    security_config.client_cert_size = sizeof( keyCLIENT_CERTIFICATE_DER );
+    security_config.private_key      = (const char *) keyCLIENT_PRIVATE_KEY_DER;
+    security_config.private_key_size = sizeof( keyCLIENT_PRIVATE_KEY_DER );
+    security_config.root_ca          = (const char *) keySERVER_ROOTCA_DER;
+    security_config.root_ca_size     = sizeof( keySERVER_ROOTCA_DER );
+#else
     security_config.client_cert      = (const char *) &keyCLIENT_CERTIFICATE_PEM;
     security_config.client_cert_size = sizeof( keyCLIENT_CERTIFICATE_PEM );
     security_config.private_key      = (const char *) &keyCLIENT_PRIVATE_KEY_PEM;
     security_config.private_key_size = sizeof( keyCLIENT_PRIVATE_KEY_PEM );
     security_config.root_ca          = (const char *) &keySERVER_ROOTCA_PEM;
     security_config.root_ca_size     = sizeof( keySERVER_ROOTCA_PEM );
+#endif /* SECURE_KEYS_USE_DER */
     server_info.host_name = HTTPS_SERVER_HOST;
     server_info.port = HTTPS_PORT;
 
+    /* The streaming connection uses the same credentials. */
+    https_stream_credentials_t stream_credentials =
+    {
+        .client_cert      = security_config.client_cert,
+        .client_cert_size = security_config.client_cert_size,
+        .private_key      = security_config.private_key,
+        .private_key_size = security_config.private_key_size,
+        .root_ca          = security_config.root_ca,
+        .root_ca_size     = security_config.root_ca_size
+    };
+
+    /* Seed the reconnect jitter with the MAC address, so that devices that
+     * lose the server together do not reconnect in step.
+     */
+    if (CY_RSLT_SUCCESS == cy_wcm_get_mac_addr(CY_WCM_INTERFACE_TYPE_STA,
+                                               &mac))
+    {
+        for (uint32_t i = INITIAL_VALUE; i < sizeof(mac); i++)
+        {
+            seed = (seed << 8U) ^ (seed >> 24U) ^ mac[i];
+        }
+    }
+    https_reconnect_init(seed);
+
     /* Initialize the HTTP Client Library. */
     result = cy_http_client_init();
 
@@ -478,14 +1064,25 @@ static cy_rslt_t configure_https_client(void)
     }
     http_cb = disconnect_callback_handler;
 
-    /* Create an instance of the HTTP client. */
-    result = cy_http_client_create(&security_config, &server_info, http_cb,
-            NULL, &https_client);
+   /* Initialize the pool of HTTP client instances. The instances are created
+    * and connected when they are first borrowed.
+    */
+    result = https_client_pool_init(&security_config, http_cb);
     
     if(CY_RSLT_SUCCESS != result)
     {
         /* Failure path */
-        ERR_INFO(("Failed to create http client.\n"));
+        ERR_INFO(("Failed to create http client pool.\n"));
+    }
+    else
+    {
+        result = https_stream_init(&stream_credentials);
+    }
+
+    /* Start the event loop of the asynchronous requests. */
+    if (CY_RSLT_SUCCESS == result)
+    {
+        result = https_async_init(HTTPS_SERVER_HOST, HTTPS_PORT);
     }
 
     return result;
@@ -512,8 +1109,28 @@ static cy_rslt_t configure_https_client(void)
 void https_client_task(void *arg)
 {
     cy_rslt_t result = CY_RSLT_TYPE_ERROR;
+    TickType_t task_start = xTaskGetTickCount();
     CY_UNUSED_PARAMETER(arg);
 
+    BOOT_TRACE_END_PHASE(BOOT_TRACE_SCHEDULER_START);
+
+    /* Console output is sent by a low-priority task from here on. */
+    if (CY_RSLT_SUCCESS != app_log_init())
+    {
+        ERR_INFO(("Console output stays blocking.\n"));
+    }
+
+    /* Serve the Mbed TLS allocations from the size-class pools. This must
+     * happen before Wi-Fi and TLS start using Mbed TLS.
+     */
+    if (CY_RSLT_SUCCESS != https_mem_pool_init())
+    {
+        ERR_INFO(("Mbed TLS keeps using the heap allocator.\n"));
+    }
+
+    /* Announce the crypto offload service to the CM55 worker. */
+    crypto_offload_init();
+
     /* Connects to the Wi-Fi Access Point. */
     result = wifi_connect();
     PRINT_AND_ASSERT(result, "Wi-Fi connection failed.\n");
@@ -524,9 +1141,11 @@ void https_client_task(void *arg)
     result = configure_https_client();
     PRINT_AND_ASSERT(result, "Failed to configure the HTTPS client.\n");
 
-    /* Connect the HTTP client to server. */
-    result = cy_http_client_connect(https_client, TRANSPORT_SEND_RECV_TIMEOUT_MS,
-                                     TRANSPORT_SEND_RECV_TIMEOUT_MS);
+   /* Connect the HTTP client to server. The connection stays open in the
+    * pool and is reused by the following requests.
+    */
+    result = https_client_pool_borrow(&server_info,
+            HTTPS_POOL_BORROW_TIMEOUT_MS, &https_client);
 
     if(CY_RSLT_SUCCESS != result)
     {
@@ -534,7 +1153,24 @@ void https_client_task(void *arg)
     }
     else
     {
-        printf("Successfully connected to http server\r\n");
+        render_request_templates(https_client);
+        https_client_pool_return(https_client, true);
+        boot_trace_stop();
+        app_log_printf("Successfully connected to http server\r\n");
+        app_log_printf("Time to first connection: %u ms (Wi-Fi join %u ms)\r\n",
+                (unsigned int) pdTICKS_TO_MS(xTaskGetTickCount() - task_start),
+                (unsigned int) wifi_join_ms);
+
+        /* Run the built-in script before the menu, for soak tests that
+         * need no terminal.
+         */
+        for (uint32_t i = INITIAL_VALUE; i < HTTPS_SCRIPT_AUTORUN_COUNT; i++)
+        {
+            app_log_printf("\n Script run %lu of %lu..\n",
+                    (unsigned long) (i + 1U),
+                    (unsigned long) HTTPS_SCRIPT_AUTORUN_COUNT);
+            (void) https_script_run_text(HTTPS_SCRIPT_BUILTIN);
+        }
 
         while(true)
         {
@@ -558,23 +1194,28 @@ static void fetch_https_client_method(void)
     uint8_t uart_result;
 
     /* Options to select the method*/
-    printf("\n===============================================================\n");
-    printf(MENU_HTTPS_METHOD);
-    printf("\n===============================================================\n");
+    app_log_printf("\n===============================================================\n");
+    app_log_write(MENU_HTTPS_METHOD, sizeof(MENU_HTTPS_METHOD) - 1U);
+    app_log_printf("\n===============================================================\n");
+
+    /* Reading the console keeps the CPU busy, so the pending log output is
+     * sent first.
+     */
+    app_log_flush(APP_LOG_FLUSH_TIMEOUT_MS);
 
     /* Reading option number from console */
     uart_result=scanf("%hhu", &uart_read_value);
 
     if(UART_RESULT_SUCCESS != uart_result)
     {
-        printf("Failed to read input value");
+        app_log_printf("Failed to read input value");
     }
 
     switch(uart_read_value)
     {
          case HTTPS_GET_METHOD:
          {
-             printf("\n HTTP GET Request..\n");
+             app_log_printf("\n HTTP GET Request..\n");
              http_client_method = CY_HTTP_CLIENT_METHOD_GET;
 
             /* Send the HTTP request and body to the server, and receive
@@ -585,7 +1226,7 @@ static void fetch_https_client_method(void)
          }
          case HTTPS_POST_METHOD:
          {
-             printf("\n HTTP POST Request..\n");
+             app_log_printf("\n HTTP POST Request..\n");
              http_client_method = CY_HTTP_CLIENT_METHOD_POST;
 
             /* Send the HTTP request and body to the server, and receive the
@@ -596,7 +1237,7 @@ static void fetch_https_client_method(void)
          }
          case HTTPS_PUT_METHOD:
          {
-             printf("\n HTTP PUT Request..\n");
+             app_log_printf("\n HTTP PUT Request..\n");
              http_client_method = CY_HTTP_CLIENT_METHOD_PUT;
 
             /* Send the HTTP request and body to the server, and receive the
@@ -607,7 +1248,7 @@ static void fetch_https_client_method(void)
          }
          case HTTPS_GET_METHOD_AFTER_PUT:
          {
-             printf("\n HTTP GET FOR PUT Request..\n");
+             app_log_printf("\n HTTP GET FOR PUT Request..\n");
              http_client_method = CY_HTTP_CLIENT_METHOD_GET;
              get_after_put_flag = true;
 
@@ -617,49 +1258,956 @@ static void fetch_https_client_method(void)
              http_request();
              break;
          }
-        default:
-        {
-            printf("\x1b[2J\x1b[;H");
-            printf("\r\nPlease select from the given valid options\r\n");
-            break;
-        }
-    }
-}
+         case HTTPS_GET_BENCHMARK:
+         {
+             https_benchmark_result_t bench_result;
 
-/*******************************************************************************
-* Function Name: http_request
-********************************************************************************
-* Summary:
-*  The function handles an http request operation.
-*******************************************************************************/
-static void http_request(void)
-{
-    cy_rslt_t result = CY_RSLT_SUCCESS;
+             app_log_printf("\n HTTP GET Benchmark, %u requests..\n",
+                     HTTPS_BENCHMARK_ITERATIONS);
 
-   /* Send the HTTP request and body to the server, and receive the response
-    * from it.
-    */
-    if(get_after_put_flag)
-    {
-        get_after_put_flag = false;
-        result = send_http_request(https_client, http_client_method,
-                HTTP_GET_PATH_AFTER_PUT);
-    }
-    else
-    {
-        result = send_http_request(https_client, http_client_method, HTTP_PATH);
-    }
+            /* Issue the GET requests back to back without printing each
+             * response, and report the aggregate numbers at the end.
+             */
+             if (CY_RSLT_SUCCESS != https_client_pool_borrow(&server_info,
+                     HTTPS_POOL_BORROW_TIMEOUT_MS, &https_client))
+             {
+                 ERR_INFO(("Failed to connect to the http server.\n"));
+                 break;
+             }
+
+             quiet_mode = true;
+             (void) https_benchmark_run(HTTPS_BENCHMARK_ITERATIONS,
+                     benchmark_request, NULL, &bench_result);
+             quiet_mode = false;
+             https_client_pool_return(https_client, true);
+             https_benchmark_print(&bench_result);
+             https_cache_print_stats();
+             https_reconnect_print_stats();
+
+            /* Repeat on the streaming connection with a fresh connection per
+             * request, to measure the reconnect cost with the server cache.
+             */
+             app_log_printf("\n Reconnect + GET Benchmark..\n");
+             (void) https_benchmark_run(HTTPS_BENCHMARK_ITERATIONS,
+                     benchmark_reconnect_request, NULL, &bench_result);
+             https_benchmark_print(&bench_result);
+             https_server_cache_print_stats();
+             break;
+         }
+         case HTTPS_GET_STREAM:
+         {
+             app_log_printf("\n HTTP GET Stream Request..\n");
 
-    if(CY_RSLT_SUCCESS != result)
-    {
-        ERR_INFO(("Failed to send the http request.\n"));
-    }
-    else
-    {
-        printf("\r\n Successfully sent GET request to http server\r\n");
-        printf("\r\n The http status code is :: %d\r\n",
-                 http_response.status_code);
-    }
+            /* Receive the response body in pieces of at most
+             * HTTPS_STREAM_BUFFER_LENGTH bytes, whatever its size.
+             */
+             http_stream_request();
+             break;
+         }
+         case HTTPS_POST_PIPELINE:
+         {
+             app_log_printf("\n HTTP POST Pipeline, %u requests..\n",
+                     HTTPS_PIPELINE_BATCH_SIZE);
+
+            /* Write the POST requests back to back on the streaming
+             * connection and match the responses in order.
+             */
+             http_pipeline_request();
+             break;
+         }
+         case HTTPS_GET_ASYNC:
+         {
+             app_log_printf("\n HTTP GET Async, %u requests..\n",
+                     HTTPS_ASYNC_BATCH_SIZE);
+
+            /* Submit the GET requests to the event loop without waiting,
+             * then collect them as their completions are notified.
+             */
+             http_async_request();
+             break;
+         }
+         case HTTPS_POST_CHUNKED:
+         {
+             app_log_printf("\n HTTP POST Chunked Upload, %u bytes..\n",
+                     HTTPS_CHUNKED_UPLOAD_LENGTH);
+
+            /* Generate the body while it is sent, without a buffer for the
+             * whole body or a Content-Length.
+             */
+             http_chunked_upload();
+             break;
+         }
+         case HTTPS_GET_RANGES:
+         {
+             app_log_printf("\n HTTP GET Ranges, %u bytes per range..\n",
+                     HTTPS_DOWNLOAD_RANGE_SIZE);
+
+            /* Fetch the resource in byte ranges on the event loop
+             * connections, resuming any range that is cut off.
+             */
+             http_range_download();
+             break;
+         }
+         case BOOT_TRACE:
+         {
+             app_log_printf("\n Boot Trace..\n");
+
+            /* Print the startup phases up to the first connection, then
+             * the same events in binary form for decoding on the host.
+             */
+             boot_trace_print();
+             boot_trace_print_binary();
+             break;
+         }
+         case HTTPS_METRICS:
+         {
+             app_log_printf("\n HTTPS Metrics..\n");
+
+            /* Print the latency percentiles of every request stage since
+             * boot, then the histograms in binary form.
+             */
+             https_metrics_print();
+             https_metrics_print_binary();
+             break;
+         }
+         case MEMORY_POOLS:
+         {
+             app_log_printf("\n Memory Pools..\n");
+
+            /* Print the blocks in use and the peak of every size class of
+             * the Mbed TLS allocator.
+             */
+             https_mem_pool_print_stats();
+             break;
+         }
+         case HTTPS_SCRIPT:
+         {
+             app_log_printf("\n HTTPS Script..\n");
+
+            /* Read a script from the console and run its requests back to
+             * back, then print their throughput and latency.
+             */
+             http_script_request();
+             break;
+         }
+        default:
+        {
+            app_log_printf("\x1b[2J\x1b[;H");
+            app_log_printf(
+                    "\r\nPlease select from the given valid options\r\n");
+            break;
+        }
+    }
+}
+
+/*******************************************************************************
+* Function Name: http_request
+********************************************************************************
+* Summary:
+*  The function handles an http request operation.
+*******************************************************************************/
+static void http_request(void)
+{
+    cy_rslt_t result = CY_RSLT_SUCCESS;
+    const char *path = HTTP_PATH;
+    bool idempotent = (CY_HTTP_CLIENT_METHOD_POST != http_client_method);
+    uint32_t resends = INITIAL_VALUE;
+
+    if(get_after_put_flag)
+    {
+        get_after_put_flag = false;
+        path = HTTP_GET_PATH_AFTER_PUT;
+    }
+
+    do
+    {
+        /* Borrow a connected client from the pool. A lost connection is
+         * reopened here, after the backoff delay if it failed before.
+         */
+        result = https_client_pool_borrow(&server_info,
+                HTTPS_POOL_BORROW_TIMEOUT_MS, &https_client);
+
+        if(CY_RSLT_SUCCESS != result)
+        {
+            ERR_INFO(("Failed to connect to the http server.\n"));
+            break;
+        }
+
+       /* Send the HTTP request and body to the server, and receive the
+        * response from it.
+        */
+        result = send_http_request(https_client, http_client_method, path);
+
+        /* A failed request leaves the connection in an unknown state. */
+        https_client_pool_return(https_client, (CY_RSLT_SUCCESS == result));
+
+        if(CY_RSLT_SUCCESS != result)
+        {
+            ERR_INFO(("Failed to send the http request.\n"));
+        }
+    } while ((CY_RSLT_SUCCESS != result) && idempotent &&
+             (resends++ < HTTPS_REQUEST_RESEND_LIMIT));
+
+    if(CY_RSLT_SUCCESS == result)
+    {
+        app_log_printf("\r\n Successfully sent GET request to http server\r\n");
+        app_log_printf("\r\n The http status code is :: %d\r\n",
+                 http_response.status_code);
+    }
+}
+
+/*******************************************************************************
+* Function Name: benchmark_request
+********************************************************************************
+* Summary:
+*  Issues one GET request for the benchmark. Servers such as "openssl s_server
+*  -WWW" close the connection after every response, so the client reconnects
+*  when a request fails and the next iteration runs on a fresh connection.
+*
+* Parameters:
+*  arg          - Unused
+*  bytes_copied - Returns the bytes copied by the request
+*
+* Return:
+*  cy_rslt_t: Result of the request.
+*
+*******************************************************************************/
+static cy_rslt_t benchmark_request(void *arg, uint32_t *bytes_copied)
+{
+    cy_rslt_t result;
+    CY_UNUSED_PARAMETER(arg);
+
+    result = send_http_request(https_client, CY_HTTP_CLIENT_METHOD_GET,
+            HTTP_PATH);
+    *bytes_copied = last_request_bytes_copied;
+
+    if(CY_RSLT_SUCCESS != result)
+    {
+        (void) https_client_pool_reconnect(https_client);
+    }
+
+    return result;
+}
+
+/*******************************************************************************
+* Function Name: benchmark_reconnect_request
+********************************************************************************
+* Summary:
+*  Closes the streaming connection, reconnects and issues one GET request, so
+*  each iteration pays a full TCP connect and TLS handshake. The body is
+*  discarded.
+*
+* Parameters:
+*  arg          - Unused
+*  bytes_copied - Returns the bytes copied by the request
+*
+* Return:
+*  cy_rslt_t: Result of the connect or the request.
+*
+*******************************************************************************/
+static cy_rslt_t benchmark_reconnect_request(void *arg, uint32_t *bytes_copied)
+{
+    cy_rslt_t result;
+    https_stream_response_t response;
+    CY_UNUSED_PARAMETER(arg);
+
+    https_stream_disconnect(&stream_conn);
+    result = https_stream_connect(&stream_conn, HTTPS_SERVER_HOST, HTTPS_PORT);
+
+    if (CY_RSLT_SUCCESS == result)
+    {
+        result = https_stream_get(&stream_conn, HTTP_PATH,
+                discard_body_handler, NULL, &response);
+    }
+
+   /* The request is serialized straight into the transmit buffer and the
+    * body is passed to the callback straight from the receive buffer.
+    */
+    *bytes_copied = stream_conn.bytes_copied;
+
+    return result;
+}
+
+/*******************************************************************************
+* Function Name: discard_body_handler
+********************************************************************************
+* Summary:
+*  Discards one piece of a streamed response body.
+*
+*******************************************************************************/
+static cy_rslt_t discard_body_handler(void *arg, const uint8_t *data,
+                                      uint32_t len)
+{
+    CY_UNUSED_PARAMETER(arg);
+    CY_UNUSED_PARAMETER(data);
+    CY_UNUSED_PARAMETER(len);
+
+    return CY_RSLT_SUCCESS;
+}
+
+/*******************************************************************************
+* Function Name: stream_headers_handler
+********************************************************************************
+* Summary:
+*  Starts the body pipeline once the headers of a streamed response tell how
+*  its body is coded. A gzip or deflate body asked for as received is
+*  inflated by the CM55.
+*
+*******************************************************************************/
+static cy_rslt_t stream_headers_handler(void *arg,
+        const https_stream_response_t *response)
+{
+    stream_body_t *stream = (stream_body_t *) arg;
+    uint32_t flags = CRYPTO_OFFLOAD_BODY_FLAG_JSON;
+
+    if (stream->coded_body &&
+        (HTTP_CODING_GZIP == response->content_coding))
+    {
+        flags |= CRYPTO_OFFLOAD_BODY_FLAG_GZIP;
+    }
+    else if (stream->coded_body &&
+             (HTTP_CODING_DEFLATE == response->content_coding))
+    {
+        flags |= CRYPTO_OFFLOAD_BODY_FLAG_DEFLATE;
+    }
+    else
+    {
+        /* The body reaches the pipeline decoded. */
+    }
+
+    stream->begun = true;
+
+    return body_offload_begin(&stream->body, flags);
+}
+
+/*******************************************************************************
+* Function Name: stream_body_handler
+********************************************************************************
+* Summary:
+*  Receives one piece of a streamed response body, prints it and passes it
+*  to the body pipeline. A body inflated by the CM55 is not printed, as the
+*  CM33 only sees it coded.
+*
+*******************************************************************************/
+static cy_rslt_t stream_body_handler(void *arg, const uint8_t *data,
+                                     uint32_t len)
+{
+    stream_body_t *stream = (stream_body_t *) arg;
+
+    if (0U == (stream->body.flags & (CRYPTO_OFFLOAD_BODY_FLAG_GZIP |
+                                     CRYPTO_OFFLOAD_BODY_FLAG_DEFLATE)))
+    {
+        app_log_write(data, len);
+    }
+
+    /* The piece is copied for the CM55, which parses it while the next one
+     * is received.
+     */
+    return body_offload_feed(&stream->body, data, len);
+}
+
+/*******************************************************************************
+* Function Name: print_body_summary
+********************************************************************************
+* Summary:
+*  Prints what the body pipeline found in a streamed response body.
+*
+*******************************************************************************/
+static void print_body_summary(const body_offload_t *body,
+                               const json_scan_summary_t *summary)
+{
+    if (JSON_SCAN_COMPLETE == summary->status)
+    {
+        app_log_printf(" body JSON:[valid] values:[%lu] keys:[%lu] depth:[%lu]",
+                (unsigned long) summary->values,
+                (unsigned long) summary->keys,
+                (unsigned long) summary->max_depth);
+    }
+    else
+    {
+        app_log_printf(" body JSON:[invalid at byte %lu]",
+                (unsigned long) summary->error_offset);
+    }
+
+    app_log_printf(" parsed on %s\n",
+                   body->offloaded ? "CM55" : "CM33");
+}
+
+/*******************************************************************************
+* Function Name: http_stream_request
+********************************************************************************
+* Summary:
+*  Sends a GET request on the streaming connection, opening it first if it is
+*  not connected, and prints the body as it is received along with its JSON
+*  summary, computed on the CM55 when its worker runs. A gzip or deflate
+*  coded body is then passed to the CM55 as received and inflated there;
+*  otherwise the CM33 decodes it first. Either way the summary is of the
+*  decoded body.
+*******************************************************************************/
+static void http_stream_request(void)
+{
+    cy_rslt_t result = CY_RSLT_SUCCESS;
+    https_stream_response_t response;
+    stream_body_t stream =
+    {
+        .coded_body = crypto_offload_available(),
+        .begun      = false
+    };
+    json_scan_summary_t summary;
+    https_stream_request_t request =
+    {
+        .method            = CY_HTTP_CLIENT_METHOD_GET,
+        .path              = HTTP_PATH,
+        .content_type      = NULL,
+        .body              = NULL,
+        .body_len          = 0U,
+        .body_by_reference = false,
+        .accept_encoding   = (0 != HTTP_ACCEPT_ENCODING_ENABLE),
+        .headers_cb        = stream_headers_handler,
+        .coded_body        = stream.coded_body,
+        .body_cb           = stream_body_handler,
+        .arg               = &stream
+    };
+
+    if (!stream_conn.connected)
+    {
+        result = https_stream_connect(&stream_conn, HTTPS_SERVER_HOST,
+                HTTPS_PORT);
+    }
+
+    if (CY_RSLT_SUCCESS == result)
+    {
+        app_log_printf("\n Response Body   :\n");
+        result = https_stream_exchange(&stream_conn, &request, &response);
+
+        /* Always end a started body so that its CM55 session is released. */
+        if (stream.begun &&
+            (CY_RSLT_SUCCESS != body_offload_end(&stream.body, &summary)))
+        {
+            result = CY_RSLT_TYPE_ERROR;
+        }
+    }
+
+    if(CY_RSLT_SUCCESS != result)
+    {
+        ERR_INFO(("Failed to stream the http response.\n"));
+    }
+    else
+    {
+        app_log_printf("\n\n status_code:[%u] body_len:[%lu]"
+                " chunk_count:[%lu]\n",
+                response.status_code, (unsigned long) response.body_len,
+                (unsigned long) response.chunk_count);
+        if (HTTP_CODING_IDENTITY != response.content_coding)
+        {
+            app_log_printf(" content_coding:[%s] decoded_len:[%lu]"
+                    " inflated on %s\n",
+                    (HTTP_CODING_GZIP == response.content_coding) ?
+                    "gzip" : "deflate",
+                    (unsigned long) stream.body.decoded_len,
+                    stream.coded_body ? "CM55" : "CM33");
+        }
+        print_body_summary(&stream.body, &summary);
+        https_server_cache_print_stats();
+    }
+}
+
+/*******************************************************************************
+* Function Name: http_pipeline_request
+********************************************************************************
+* Summary:
+*  Sends HTTPS_PIPELINE_BATCH_SIZE POST requests as one pipelined batch on the
+*  streaming connection. When the server closes the connection part way, the
+*  unanswered GET, HEAD and PUT requests are sent again as a new batch on a
+*  new connection. An unanswered POST may have been processed by the server
+*  before it closed, so it is reported as failed instead of being sent twice.
+*******************************************************************************/
+static void http_pipeline_request(void)
+{
+    cy_rslt_t result = CY_RSLT_SUCCESS;
+    https_stream_request_t requests[HTTPS_PIPELINE_BATCH_SIZE];
+    https_stream_response_t responses[HTTPS_PIPELINE_BATCH_SIZE];
+    https_stream_response_t received[HTTPS_PIPELINE_BATCH_SIZE];
+    bool answered[HTTPS_PIPELINE_BATCH_SIZE];
+
+    /* Position in the batch of each request still to be sent. */
+    uint32_t order[HTTPS_PIPELINE_BATCH_SIZE];
+    uint32_t pending = HTTPS_PIPELINE_BATCH_SIZE;
+    uint32_t remaining;
+    uint32_t completed = INITIAL_VALUE;
+    uint32_t failed = INITIAL_VALUE;
+    TickType_t start = xTaskGetTickCount();
+
+    for (uint32_t i = INITIAL_VALUE; i < HTTPS_PIPELINE_BATCH_SIZE; i++)
+    {
+        requests[i].method = CY_HTTP_CLIENT_METHOD_POST;
+        requests[i].path = HTTP_PATH;
+        requests[i].content_type = "application/x-www-form-urlencoded";
+        requests[i].body = (const uint8_t *) REQUEST_BODY;
+        requests[i].body_len = REQUEST_BODY_LENGTH;
+
+        /* The body is small, so it is copied next to the headers and the
+         * whole batch shares TLS records.
+         */
+        requests[i].body_by_reference = false;
+        requests[i].body_cb = discard_body_handler;
+        requests[i].accept_encoding = (0 != HTTP_ACCEPT_ENCODING_ENABLE);
+        requests[i].body_producer = NULL;
+        requests[i].producer_arg = NULL;
+        requests[i].range = false;
+        requests[i].headers_cb = NULL;
+        requests[i].arg = NULL;
+        answered[i] = false;
+        order[i] = i;
+    }
+
+    while ((CY_RSLT_SUCCESS == result) && (INITIAL_VALUE != pending))
+    {
+        if (!stream_conn.connected)
+        {
+            result = https_stream_connect(&stream_conn, HTTPS_SERVER_HOST,
+                    HTTPS_PORT);
+        }
+
+        if (CY_RSLT_SUCCESS == result)
+        {
+            result = https_stream_pipeline(&stream_conn, requests, pending,
+                    received, &completed);
+
+            for (uint32_t i = INITIAL_VALUE; i < completed; i++)
+            {
+                responses[order[i]] = received[i];
+                answered[order[i]] = true;
+            }
+
+            /* Retry the rest only if the batch made progress, and only the
+             * requests that are safe to send twice.
+             */
+            if ((CY_RSLT_SUCCESS != result) && (INITIAL_VALUE != completed))
+            {
+                remaining = INITIAL_VALUE;
+                for (uint32_t i = completed; i < pending; i++)
+                {
+                    if (CY_HTTP_CLIENT_METHOD_POST == requests[i].method)
+                    {
+                        failed++;
+                    }
+                    else
+                    {
+                        requests[remaining] = requests[i];
+                        order[remaining] = order[i];
+                        remaining++;
+                    }
+                }
+                pending = remaining;
+                result = CY_RSLT_SUCCESS;
+            }
+            else
+            {
+                pending -= completed;
+            }
+        }
+    }
+
+    if(CY_RSLT_SUCCESS != result)
+    {
+        ERR_INFO(("Pipelined batch failed after %lu responses.\n",
+                (unsigned long) (HTTPS_PIPELINE_BATCH_SIZE - pending -
+                                 failed)));
+    }
+    else
+    {
+        for (uint32_t i = INITIAL_VALUE; i < HTTPS_PIPELINE_BATCH_SIZE; i++)
+        {
+            if (answered[i])
+            {
+                app_log_printf(" Response %lu status_code:[%u]"
+                        " body_len:[%lu]\n", (unsigned long) i,
+                        responses[i].status_code,
+                        (unsigned long) responses[i].body_len);
+            }
+            else
+            {
+                app_log_printf(" Request %lu failed: no response, POST not"
+                        " sent again\n", (unsigned long) i);
+            }
+        }
+
+        app_log_printf("\n %lu requests completed, %lu failed in %lu ms\n",
+                (unsigned long) (HTTPS_PIPELINE_BATCH_SIZE - failed),
+                (unsigned long) failed,
+                (unsigned long) pdTICKS_TO_MS(xTaskGetTickCount() - start));
+    }
+}
+
+
+/*******************************************************************************
+* Function Name: http_async_request
+********************************************************************************
+* Summary:
+*  Submits HTTPS_ASYNC_BATCH_SIZE GET requests to the asynchronous request
+*  event loop, which returns at once for each, then waits for the task
+*  notifications of their completions and collects the results. The task is
+*  free to do other work between the submissions and the waits.
+*******************************************************************************/
+static void http_async_request(void)
+{
+    cy_rslt_t result = CY_RSLT_SUCCESS;
+    https_async_handle_t handles[HTTPS_ASYNC_BATCH_SIZE];
+    https_stream_response_t response;
+    cy_rslt_t request_result;
+    https_stream_request_t request =
+    {
+        .method            = CY_HTTP_CLIENT_METHOD_GET,
+        .path              = HTTP_PATH,
+        .content_type      = NULL,
+        .body              = NULL,
+        .body_len          = 0U,
+        .body_by_reference = false,
+        .accept_encoding   = (0 != HTTP_ACCEPT_ENCODING_ENABLE),
+        .body_cb           = discard_body_handler,
+        .arg               = NULL
+    };
+    uint32_t submitted = INITIAL_VALUE;
+    uint32_t collected = INITIAL_VALUE;
+    TickType_t start = xTaskGetTickCount();
+
+    /* Drop notifications left over from an earlier batch. */
+    (void) ulTaskNotifyTake(pdTRUE, 0U);
+
+    for (uint32_t i = INITIAL_VALUE; (i < HTTPS_ASYNC_BATCH_SIZE) &&
+                                     (CY_RSLT_SUCCESS == result); i++)
+    {
+        result = https_async_submit_notify(&request,
+                xTaskGetCurrentTaskHandle(), &handles[i]);
+        if (CY_RSLT_SUCCESS == result)
+        {
+            submitted++;
+        }
+    }
+
+    app_log_printf(" %lu requests submitted in %lu ms\n",
+            (unsigned long) submitted,
+            (unsigned long) pdTICKS_TO_MS(xTaskGetTickCount() - start));
+
+    /* One notification is given per completed request. */
+    while ((collected < submitted) &&
+           (0U != ulTaskNotifyTake(pdFALSE,
+                   pdMS_TO_TICKS(HTTPS_ASYNC_REQUEST_TIMEOUT_MS * 2U))))
+    {
+        for (uint32_t i = INITIAL_VALUE; i < submitted; i++)
+        {
+            if ((HTTPS_ASYNC_INVALID_HANDLE != handles[i]) &&
+                https_async_result(handles[i], &request_result, &response))
+            {
+                app_log_printf(" Response %lu result:[0x%lx] status_code:[%u]"
+                        " body_len:[%lu]\n", (unsigned long) i,
+                        (unsigned long) request_result, response.status_code,
+                        (unsigned long) response.body_len);
+                handles[i] = HTTPS_ASYNC_INVALID_HANDLE;
+                collected++;
+            }
+        }
+    }
+
+    if (collected < submitted)
+    {
+        ERR_INFO(("Async batch timed out after %lu responses.\n",
+                (unsigned long) collected));
+
+        /* The event loop frees the slots of the requests left behind. */
+        for (uint32_t i = INITIAL_VALUE; i < submitted; i++)
+        {
+            if (HTTPS_ASYNC_INVALID_HANDLE != handles[i])
+            {
+                https_async_detach(handles[i]);
+            }
+        }
+    }
+    else
+    {
+        app_log_printf("\n %lu requests completed in %lu ms\n",
+                (unsigned long) collected,
+                (unsigned long) pdTICKS_TO_MS(xTaskGetTickCount() - start));
+    }
+
+    https_async_print_stats();
+    https_reconnect_print_stats();
+}
+
+
+/*******************************************************************************
+* Function Name: upload_producer
+********************************************************************************
+* Summary:
+*  Body producer of the chunked upload. Writes as many whole text lines of
+*  generated samples as fit in the space offered, standing in for data such
+*  as sensor logs that is produced while it is sent.
+*
+* Parameters:
+*  arg    - upload_source_t of the upload
+*  buffer - Space for the next chunk
+*  size   - Size of the space
+*  len    - Returns the number of bytes written; 0 at the end of the body
+*
+* Return:
+*  cy_rslt_t: CY_RSLT_SUCCESS
+*
+*******************************************************************************/
+static cy_rslt_t upload_producer(void *arg, uint8_t *buffer, uint32_t size,
+                                 uint32_t *len)
+{
+    upload_source_t *source = (upload_source_t *) arg;
+    char line[UPLOAD_LINE_LENGTH];
+    uint32_t line_len;
+
+    *len = INITIAL_VALUE;
+
+    while (source->remaining > INITIAL_VALUE)
+    {
+        line_len = (uint32_t) snprintf(line, sizeof(line),
+                "sample=%lu tick=%lu\n", (unsigned long) source->line,
+                (unsigned long) xTaskGetTickCount());
+
+        if (line_len > source->remaining)
+        {
+            line_len = source->remaining;
+        }
+
+        if ((*len + line_len) > size)
+        {
+            break;
+        }
+
+        (void) memcpy(&buffer[*len], line, line_len);
+        *len += line_len;
+        source->remaining -= line_len;
+        source->line++;
+    }
+
+    if (*len > INITIAL_VALUE)
+    {
+        source->chunks++;
+    }
+
+    return CY_RSLT_SUCCESS;
+}
+
+/*******************************************************************************
+* Function Name: http_chunked_upload
+********************************************************************************
+* Summary:
+*  POSTs HTTPS_CHUNKED_UPLOAD_LENGTH bytes of generated text on the streaming
+*  connection with chunked transfer-encoding. The body is produced piece by
+*  piece straight into the transmit buffer, so its size is not limited by RAM.
+*******************************************************************************/
+static void http_chunked_upload(void)
+{
+    cy_rslt_t result = CY_RSLT_SUCCESS;
+    https_stream_response_t response;
+    upload_source_t source =
+    {
+        .remaining = HTTPS_CHUNKED_UPLOAD_LENGTH,
+        .line      = INITIAL_VALUE,
+        .chunks    = INITIAL_VALUE
+    };
+    https_stream_request_t request =
+    {
+        .method            = CY_HTTP_CLIENT_METHOD_POST,
+        .path              = HTTP_PATH,
+        .content_type      = "text/plain",
+        .body              = NULL,
+        .body_len          = 0U,
+        .body_by_reference = false,
+        .accept_encoding   = (0 != HTTP_ACCEPT_ENCODING_ENABLE),
+        .body_producer     = upload_producer,
+        .producer_arg      = &source,
+        .body_cb           = discard_body_handler,
+        .arg               = NULL
+    };
+    TickType_t start = xTaskGetTickCount();
+
+    if (!stream_conn.connected)
+    {
+        result = https_stream_connect(&stream_conn, HTTPS_SERVER_HOST,
+                HTTPS_PORT);
+    }
+
+    if (CY_RSLT_SUCCESS == result)
+    {
+        result = https_stream_send(&stream_conn, &request);
+
+        if (CY_RSLT_SUCCESS == result)
+        {
+            result = https_stream_read_response(&stream_conn, request.method,
+                    request.body_cb, request.arg, &response);
+        }
+        else
+        {
+            /* The body was sent only in part. */
+            https_stream_disconnect(&stream_conn);
+        }
+    }
+
+    if(CY_RSLT_SUCCESS != result)
+    {
+        ERR_INFO(("Chunked upload failed after %lu chunks.\n",
+                (unsigned long) source.chunks));
+    }
+    else
+    {
+        app_log_printf(" status_code:[%u] sent:[%lu] bytes in [%lu] chunks"
+                " in %lu ms\n", response.status_code,
+                (unsigned long) (HTTPS_CHUNKED_UPLOAD_LENGTH -
+                                 source.remaining),
+                (unsigned long) source.chunks,
+                (unsigned long) pdTICKS_TO_MS(xTaskGetTickCount() - start));
+    }
+}
+
+
+/*******************************************************************************
+* Function Name: download_sink_handler
+********************************************************************************
+* Summary:
+*  Counts the bytes of the range download. An application would write them
+*  to storage at the given offset.
+*******************************************************************************/
+static cy_rslt_t download_sink_handler(void *arg, uint32_t offset,
+                                       const uint8_t *data, uint32_t len)
+{
+    (void) offset;
+    (void) data;
+
+    *(uint32_t *) arg += len;
+
+    return CY_RSLT_SUCCESS;
+}
+
+/*******************************************************************************
+* Function Name: http_range_download
+********************************************************************************
+* Summary:
+*  Downloads HTTP_PATH in ranges of HTTPS_DOWNLOAD_RANGE_SIZE bytes with the
+*  asynchronous request API. If a run fails, the next one continues from the
+*  last committed byte instead of starting over.
+*******************************************************************************/
+static void http_range_download(void)
+{
+    static https_download_t download;
+    cy_rslt_t result = CY_RSLT_TYPE_ERROR;
+    uint32_t received = INITIAL_VALUE;
+    uint32_t run;
+    TickType_t start = xTaskGetTickCount();
+
+    https_download_init(&download, HTTP_PATH, download_sink_handler,
+                        &received);
+
+    for (run = INITIAL_VALUE; (run < HTTPS_RANGE_DOWNLOAD_RUNS) &&
+                              (CY_RSLT_SUCCESS != result); run++)
+    {
+        result = https_download_run(&download);
+
+        if (CY_RSLT_SUCCESS != result)
+        {
+            ERR_INFO(("Range download stopped at byte %lu.\n",
+                    (unsigned long) download.committed));
+        }
+    }
+
+    if (CY_RSLT_SUCCESS == result)
+    {
+        app_log_printf(" received:[%lu] of [%lu] bytes in [%lu] ranges,"
+                " resumed:[%lu] in %lu ms\n", (unsigned long) received,
+                (unsigned long) download.length,
+                (unsigned long) download.requests,
+                (unsigned long) download.resumes,
+                (unsigned long) pdTICKS_TO_MS(xTaskGetTickCount() - start));
+        if ('\0' != download.etag[0])
+        {
+            app_log_printf(" ETag:[%s]\n", download.etag);
+        }
+    }
+
+    https_async_print_stats();
+    https_reconnect_print_stats();
+}
+
+/*******************************************************************************
+* Function Name: read_console_line
+********************************************************************************
+* Summary:
+*  Reads a line from the console. Line ends left by an earlier input and
+*  leading spaces are skipped, and the line ends at a carriage return or a
+*  line feed. Characters that do not fit are dropped.
+*
+* Parameters:
+*  line - Receives the line, NUL terminated
+*  size - Size of the line buffer
+*
+* Return:
+*  uint32_t: Length of the line.
+*
+*******************************************************************************/
+static uint32_t read_console_line(char *line, uint32_t size)
+{
+    uint32_t len = INITIAL_VALUE;
+    int c;
+
+    do
+    {
+        c = getchar();
+    } while (('\r' == c) || ('\n' == c) || (' ' == c));
+
+    while ((EOF != c) && ('\r' != c) && ('\n' != c))
+    {
+        if (len < (size - 1U))
+        {
+            line[len++] = (char) c;
+        }
+        c = getchar();
+    }
+
+    line[len] = '\0';
+
+    return len;
+}
+
+/*******************************************************************************
+* Function Name: http_script_request
+********************************************************************************
+* Summary:
+*  Reads a request script from the console, or takes the built-in script
+*  HTTPS_SCRIPT_BUILTIN, and runs it on the event loop of the asynchronous
+*  requests. Steps are separated by ';' on the console, as a line feed ends
+*  the input.
+*******************************************************************************/
+static void http_script_request(void)
+{
+    const char *script = script_line;
+
+    app_log_printf(" Enter a script, or '.' for the built-in script:\n"
+            " METHOD PATH [size=BYTES] [n=REPEAT] [c=CONCURRENCY]"
+            " [delay=MS]; ...\n");
+
+    /* Reading the console keeps the CPU busy, so the pending log output is
+     * sent first.
+     */
+    app_log_flush(APP_LOG_FLUSH_TIMEOUT_MS);
+
+    (void) read_console_line(script_line, sizeof(script_line));
+
+    if (0 == strcmp(script_line, "."))
+    {
+        script = HTTPS_SCRIPT_BUILTIN;
+    }
+
+    if (CY_RSLT_SUCCESS != https_script_run_text(script))
+    {
+        ERR_INFO(("Script did not run to the end.\n"));
+    }
+
+    https_async_print_stats();
 }
 
 
@@ -50,11 +50,17 @@
 #include "cy_wcm.h"
 #include "cybsp.h"
 #include "cy_network_mw_core.h"
+#include "app_log.h"
+#include "app_log_token.h"
 
 /*******************************************************************************
 * Macros
 *******************************************************************************/
-#define TEST_INFO( x )                           (printf x)
+#if (APP_LOG_TOKENIZE)
+#define TEST_INFO( x )                           APP_LOG_TOKENIZED x
+#else
+#define TEST_INFO( x )                           (app_log_printf x)
+#endif /* APP_LOG_TOKENIZE */
 
 /* Wi-Fi Credentials: Modify WIFI_SSID and WIFI_PASSWORD to match your Wi-Fi
  * network Credentials.
@@ -67,19 +73,39 @@
  */
 #define WIFI_SECURITY_TYPE                       CY_WCM_SECURITY_WPA2_AES_PSK
 #define MAX_WIFI_RETRY_COUNT                     (3U)
-#define APP_INFO(x)                do { printf("Info: "); printf x; } while(0);
-#define ERR_INFO(x)                do { printf("Error: "); printf x; } while(0);
+#if (APP_LOG_TOKENIZE)
+/* The prefix is joined to the format string, so it is part of the token */
+#define APP_INFO(x)                APP_INFO_TOKENIZED x;
+#define ERR_INFO(x)                ERR_INFO_TOKENIZED x;
+#define APP_INFO_TOKENIZED(fmt, ...)                                        \
+                                   APP_LOG_TOKENIZED("Info: " fmt,          \
+                                                     ##__VA_ARGS__)
+#define ERR_INFO_TOKENIZED(fmt, ...)                                        \
+                                   APP_LOG_TOKENIZED("Error: " fmt,         \
+                                                     ##__VA_ARGS__)
+#else
+#define APP_INFO(x)                do { app_log_printf("Info: ");          \
+                                        app_log_printf x; } while(0);
+#define ERR_INFO(x)                do { app_log_printf("Error: ");         \
+                                        app_log_printf x; } while(0);
+#endif /* APP_LOG_TOKENIZE */
 #define PRINT_AND_ASSERT(result, msg, args...)   \
                                      do                                 \
                                      {                                  \
                                          if (CY_RSLT_SUCCESS != result) \
                                          {                              \
                                              ERR_INFO((msg, ## args));  \
+                                             app_log_flush(             \
+                                             APP_LOG_FLUSH_TIMEOUT_MS); \
                                              CY_ASSERT(0);              \
                                          }                              \
                                      } while(0);
+#ifndef HTTPS_PORT
 #define HTTPS_PORT                               (50007U)
+#endif
+#ifndef HTTPS_SERVER_HOST
 #define HTTPS_SERVER_HOST                        "172.20.10.3"
+#endif
 #define TRANSPORT_SEND_RECV_TIMEOUT_MS           (5000U)
 #define HTTP_GET_BUFFER_LENGTH                   (2048U)
 #define REQUEST_BODY                             "/myhellomessage=Hello!"
@@ -98,8 +124,48 @@
 /* Start Range from where the server should return. */
 #define HTTP_REQUEST_RANGE_START                 (0U)
 
+/* Times a GET, HEAD or PUT request is sent again on a reopened connection
+ * after the connection failed during the request. POST requests are not
+ * sent again, since the server may have processed them.
+ */
+#define HTTPS_REQUEST_RESEND_LIMIT               (1U)
+
+/* Number of POST requests written back to back by HTTPS_POST_PIPELINE. */
+#define HTTPS_PIPELINE_BATCH_SIZE                (4U)
+
+/* Number of GET requests submitted at once by HTTPS_GET_ASYNC. At most
+ * HTTPS_ASYNC_MAX_REQUESTS.
+ */
+#define HTTPS_ASYNC_BATCH_SIZE                   (4U)
+
+/* Size of the body generated and sent by HTTPS_POST_CHUNKED. Only one
+ * transmit buffer of it is held in RAM at a time.
+ */
+#define HTTPS_CHUNKED_UPLOAD_LENGTH              (64U * 1024U)
+
+/* Times HTTPS_GET_RANGES runs the download. A later run resumes an
+ * interrupted one from its last committed byte.
+ */
+#define HTTPS_RANGE_DOWNLOAD_RUNS                (2U)
+
+/* Set to 1 to ask the server for gzip or deflate compressed responses with
+ * Accept-Encoding. Compressed responses are decoded as they are received.
+ */
+#define HTTP_ACCEPT_ENCODING_ENABLE              (0)
+
+/* Set to 1 to send POST and PUT bodies of at least HTTP_GZIP_UPLOAD_MIN_LENGTH
+ * bytes gzip compressed. The server must accept Content-Encoding: gzip.
+ */
+#define HTTP_GZIP_UPLOAD_ENABLE                  (0)
+#define HTTP_GZIP_UPLOAD_MIN_LENGTH              (256U)
+
+/* Size of the buffer a request body is compressed into. Larger bodies are
+ * sent uncompressed.
+ */
+#define HTTP_GZIP_UPLOAD_BUFFER_LENGTH           (1024U)
+
 /* Number of headers in the header list */
-#define NUM_HTTP_HEADERS                         (1U)
+#define NUM_HTTP_HEADERS                 (1U + HTTP_ACCEPT_ENCODING_ENABLE)
 
 /* Length of the request header. */
 #define HTTP_REQUEST_HEADER_LEN                  (0U)
@@ -113,6 +179,16 @@
         "2. HTTPS_POST_METHOD\n"                                               \
         "3. HTTPS_PUT_METHOD\n"                                                \
         "4. HTTPS_GET_METHOD_AFTER_PUT\n"                                      \
+        "5. HTTPS_GET_BENCHMARK\n"                                             \
+        "6. HTTPS_GET_STREAM\n"                                                \
+        "7. HTTPS_POST_PIPELINE\n"                                             \
+        "8. HTTPS_GET_ASYNC\n"                                                 \
+        "9. HTTPS_POST_CHUNKED\n"                                              \
+        "10. HTTPS_GET_RANGES\n"                                               \
+        "11. BOOT_TRACE\n"                                                     \
+        "12. HTTPS_METRICS\n"                                                  \
+        "13. MEMORY_POOLS\n"                                                   \
+        "14. HTTPS_SCRIPT\n"                                                   \
 
 /*******************************************************************************
 * Enumerations
@@ -125,6 +201,16 @@ typedef enum
     HTTPS_POST_METHOD,
     HTTPS_PUT_METHOD,
     HTTPS_GET_METHOD_AFTER_PUT,
+    HTTPS_GET_BENCHMARK,
+    HTTPS_GET_STREAM,
+    HTTPS_POST_PIPELINE,
+    HTTPS_GET_ASYNC,
+    HTTPS_POST_CHUNKED,
+    HTTPS_GET_RANGES,
+    BOOT_TRACE,
+    HTTPS_METRICS,
+    MEMORY_POOLS,
+    HTTPS_SCRIPT,
 } https_menu_t;
 
 /*******************************************************************************
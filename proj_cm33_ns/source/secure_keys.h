@@ -69,6 +69,36 @@
 "Root CA content"\
 "-----END CERTIFICATE-----\n"
 
+/* Set to 1 to use the DER byte arrays below instead of the PEM strings.
+ * Mbed TLS parses DER directly, which skips the base64 decode of PEM and its
+ * scratch buffer on every TLS identity and root CA load. Generate the array
+ * contents with "python format_cert_key.py --der <file>".
+ */
+#define SECURE_KEYS_USE_DER                      (0)
+
+#if (SECURE_KEYS_USE_DER)
+/* DER encoding of keyCLIENT_CERTIFICATE_PEM. */
+static const unsigned char keyCLIENT_CERTIFICATE_DER[] =
+{
+    /* Client certificate content */
+    0x00
+};
+
+/* DER encoding of keyCLIENT_PRIVATE_KEY_PEM. */
+static const unsigned char keyCLIENT_PRIVATE_KEY_DER[] =
+{
+    /* Client private key content */
+    0x00
+};
+
+/* DER encoding of keySERVER_ROOTCA_PEM. A DER array holds one certificate. */
+static const unsigned char keySERVER_ROOTCA_DER[] =
+{
+    /* Root CA content */
+    0x00
+};
+#endif /* SECURE_KEYS_USE_DER */
+
 #endif /* SECURE_KEYS_H_ */
 
 /* [] END OF FILE */
@@ -0,0 +1,232 @@
+/*******************************************************************************
+* File Name: wifi_join_cache.c
+*
+* Description: This file keeps the access point and IP settings of the last
+* successful Wi-Fi join in retention RAM, so that the next boot can join
+* the same access point directly and skip DHCP.
+*
+* Related Document: See README.md
+********************************************************************************
+* Copyright 2024-2025, Cypress Semiconductor Corporation (an Infineon company) or
+* an affiliate of Cypress Semiconductor Corporation.  All rights reserved.
+*
+* This software, including source code, documentation and related
+* materials ("Software") is owned by Cypress Semiconductor Corporation
+* or one of its affiliates ("Cypress") and is protected by and subject to
+* worldwide patent protection (United States and foreign),
+* United States copyright laws and international treaty provisions.
+* Therefore, you may use this Software only as provided in the license
+* agreement accompanying the software package from which you
+* obtained this Software ("EULA").
+* If no EULA applies, Cypress hereby grants you a personal, non-exclusive,
+* non-transferable license to copy, modify, and compile the Software
+* source code solely for use in connection with Cypress's
+* integrated circuit products.  Any reproduction, modification, translation,
+* compilation, or representation of this Software except as specified
+* above is prohibited without the express written permission of Cypress.
+*
+* Disclaimer: THIS SOFTWARE IS PROVIDED AS-IS, WITH NO WARRANTY OF ANY KIND,
+* EXPRESS OR IMPLIED, INCLUDING, BUT NOT LIMITED TO, NONINFRINGEMENT, IMPLIED
+* WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE. Cypress
+* reserves the right to make changes to the Software without notice. Cypress
+* does not assume any liability arising out of the application or use of the
+* Software or any product or circuit described in the Software. Cypress does
+* not authorize its products for use in any products where a malfunction or
+* failure of the Cypress product may reasonably be expected to result in
+* significant property damage, injury or death ("High Risk Product"). By
+* including Cypress's product in a High Risk Product, the manufacturer
+* of such system or application assumes all risk of such use and in doing
+* so agrees to indemnify Cypress against all liability.
+*******************************************************************************/
+
+/*******************************************************************************
+* Header Files
+*******************************************************************************/
+#include "wifi_join_cache.h"
+#include "cy_syslib.h"
+#include "cy_utils.h"
+#include <stddef.h>
+#include <string.h>
+
+/*******************************************************************************
+* Macros
+*******************************************************************************/
+#define RECORD_MAGIC                                 (0x4A4F494EU)
+#define FNV_OFFSET_BASIS                             (0x811C9DC5U)
+#define FNV_PRIME                                    (0x01000193U)
+
+/*******************************************************************************
+* Global Variables
+********************************************************************************/
+CY_NOINIT static wifi_join_record_t join_record;
+
+/*******************************************************************************
+* Function Definitions
+*******************************************************************************/
+
+/*******************************************************************************
+* Function Name: fnv_hash
+********************************************************************************
+* Summary:
+*  Computes the FNV-1a hash of a block of bytes, continuing from hash.
+*
+*******************************************************************************/
+static uint32_t fnv_hash(uint32_t hash, const uint8_t *data, uint32_t len)
+{
+    for (uint32_t i = 0U; i < len; i++)
+    {
+        hash ^= data[i];
+        hash *= FNV_PRIME;
+    }
+
+    return hash;
+}
+
+/*******************************************************************************
+* Function Name: ssid_hash
+********************************************************************************
+* Summary:
+*  Hashes the SSID the record belongs to, so that a record of another
+*  network is never used.
+*
+*******************************************************************************/
+static uint32_t ssid_hash(const char *ssid)
+{
+    return fnv_hash(FNV_OFFSET_BASIS, (const uint8_t *) ssid,
+                    (uint32_t) strlen(ssid));
+}
+
+/*******************************************************************************
+* Function Name: record_checksum
+********************************************************************************
+* Summary:
+*  Checksum of the record, covering every field before the checksum. The
+*  retention RAM holds random data after a power cycle.
+*
+*******************************************************************************/
+static uint32_t record_checksum(const wifi_join_record_t *record)
+{
+    return fnv_hash(FNV_OFFSET_BASIS, (const uint8_t *) record,
+                    (uint32_t) offsetof(wifi_join_record_t, checksum));
+}
+
+/*******************************************************************************
+* Function Name: wifi_join_cache_load
+********************************************************************************
+* Summary:
+*  Fills the connect parameters from the record of the last join to the same
+*  SSID: the BSSID for a directed join without a full scan and, with
+*  WIFI_JOIN_CACHE_STATIC_IP, the IPv4 settings so that DHCP is skipped.
+*  The band is left to WCM. The associated AP information gives the channel
+*  but not the band, and the channel numbers of the 2.4, 5 and 6 GHz bands
+*  overlap, so the band cannot be told from the channel.
+*
+* Parameters:
+*  ssid        - SSID about to be joined
+*  params      - Connect parameters to fill
+*  ip_settings - Storage for the static IP settings, referenced by params
+*
+* Return:
+*  bool: true if a valid record was found and applied.
+*
+*******************************************************************************/
+bool wifi_join_cache_load(const char *ssid, cy_wcm_connect_params_t *params,
+                          cy_wcm_ip_setting_t *ip_settings)
+{
+    if ((RECORD_MAGIC != join_record.magic) ||
+        (record_checksum(&join_record) != join_record.checksum) ||
+        (ssid_hash(ssid) != join_record.ssid_hash))
+    {
+        return false;
+    }
+
+    (void) memcpy(params->BSSID, join_record.bssid, sizeof(params->BSSID));
+
+#if (WIFI_JOIN_CACHE_STATIC_IP)
+    if (join_record.has_ip)
+    {
+        *ip_settings = join_record.ip_settings;
+        params->static_ip_settings = ip_settings;
+    }
+#else
+    CY_UNUSED_PARAMETER(ip_settings);
+#endif /* WIFI_JOIN_CACHE_STATIC_IP */
+
+    return true;
+}
+
+/*******************************************************************************
+* Function Name: wifi_join_cache_store
+********************************************************************************
+* Summary:
+*  Records the access point and the IPv4 settings of the join that just
+*  succeeded.
+*
+* Parameters:
+*  ssid - SSID that was joined
+*  ip   - IP address assigned by the join
+*
+* Return:
+*  void
+*
+*******************************************************************************/
+void wifi_join_cache_store(const char *ssid, const cy_wcm_ip_address_t *ip)
+{
+    cy_wcm_associated_ap_info_t ap_info;
+    wifi_join_record_t record;
+
+    (void) memset(&record, 0, sizeof(record));
+
+    if (CY_RSLT_SUCCESS != cy_wcm_get_associated_ap_info(&ap_info))
+    {
+        wifi_join_cache_invalidate();
+        return;
+    }
+
+    record.magic = RECORD_MAGIC;
+    record.ssid_hash = ssid_hash(ssid);
+    (void) memcpy(record.bssid, ap_info.BSSID, sizeof(record.bssid));
+    record.channel = ap_info.channel;
+
+    if ((CY_WCM_IP_VER_V4 == ip->version) &&
+        (CY_RSLT_SUCCESS == cy_wcm_get_ip_netmask(CY_WCM_INTERFACE_TYPE_STA,
+                &record.ip_settings.netmask)) &&
+        (CY_RSLT_SUCCESS == cy_wcm_get_gateway_ip_address(
+                CY_WCM_INTERFACE_TYPE_STA, &record.ip_settings.gateway)))
+    {
+        record.ip_settings.ip_address = *ip;
+        record.has_ip = true;
+    }
+
+    record.checksum = record_checksum(&record);
+    join_record = record;
+}
+
+/*******************************************************************************
+* Function Name: wifi_join_cache_invalidate
+********************************************************************************
+* Summary:
+*  Drops the record, for example after a directed join failed because the
+*  access point or the network changed.
+*
+*******************************************************************************/
+void wifi_join_cache_invalidate(void)
+{
+    (void) memset(&join_record, 0, sizeof(join_record));
+}
+
+/*******************************************************************************
+* Function Name: wifi_join_cache_channel
+********************************************************************************
+* Summary:
+*  Returns the channel of the recorded access point, or 0 if there is no
+*  record.
+*
+*******************************************************************************/
+uint16_t wifi_join_cache_channel(void)
+{
+    return (RECORD_MAGIC == join_record.magic) ? join_record.channel : 0U;
+}
+
+
+/* [] END OF FILE */
@@ -0,0 +1,99 @@
+/*******************************************************************************
+* File Name: wifi_join_cache.h
+*
+* Description: This file contains the structures, constants and function
+* prototypes of the Wi-Fi join cache.
+*
+* Related Document: See README.md
+********************************************************************************
+* Copyright 2024-2025, Cypress Semiconductor Corporation (an Infineon company) or
+* an affiliate of Cypress Semiconductor Corporation.  All rights reserved.
+*
+* This software, including source code, documentation and related
+* materials ("Software") is owned by Cypress Semiconductor Corporation
+* or one of its affiliates ("Cypress") and is protected by and subject to
+* worldwide patent protection (United States and foreign),
+* United States copyright laws and international treaty provisions.
+* Therefore, you may use this Software only as provided in the license
+* agreement accompanying the software package from which you
+* obtained this Software ("EULA").
+* If no EULA applies, Cypress hereby grants you a personal, non-exclusive,
+* non-transferable license to copy, modify, and compile the Software
+* source code solely for use in connection with Cypress's
+* integrated circuit products.  Any reproduction, modification, translation,
+* compilation, or representation of this Software except as specified
+* above is prohibited without the express written permission of Cypress.
+*
+* Disclaimer: THIS SOFTWARE IS PROVIDED AS-IS, WITH NO WARRANTY OF ANY KIND,
+* EXPRESS OR IMPLIED, INCLUDING, BUT NOT LIMITED TO, NONINFRINGEMENT, IMPLIED
+* WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE. Cypress
+* reserves the right to make changes to the Software without notice. Cypress
+* does not assume any liability arising out of the application or use of the
+* Software or any product or circuit described in the Software. Cypress does
+* not authorize its products for use in any products where a malfunction or
+* failure of the Cypress product may reasonably be expected to result in
+* significant property damage, injury or death ("High Risk Product"). By
+* including Cypress's product in a High Risk Product, the manufacturer
+* of such system or application assumes all risk of such use and in doing
+* so agrees to indemnify Cypress against all liability.
+*******************************************************************************/
+
+/*******************************************************************************
+* Include guard
+*******************************************************************************/
+#ifndef WIFI_JOIN_CACHE_H_
+#define WIFI_JOIN_CACHE_H_
+
+/*******************************************************************************
+* Header Files
+*******************************************************************************/
+#include <stdint.h>
+#include <stdbool.h>
+#include "cy_result.h"
+#include "cy_wcm.h"
+
+/*******************************************************************************
+* Macros
+*******************************************************************************/
+
+/* Set to 0 to scan for the access point and use DHCP on every boot. */
+#define WIFI_JOIN_CACHE_ENABLE                   (1)
+
+/* Set to 1 to also configure the cached IPv4 address, netmask and gateway
+ * statically, so that DHCP is skipped. The lease is not renewed then, so
+ * only use it with a DHCP server that reserves the address for the device.
+ * With 0 the cached access point is joined directly and DHCP still runs.
+ */
+#define WIFI_JOIN_CACHE_STATIC_IP                (0)
+
+/*******************************************************************************
+* Data Types
+*******************************************************************************/
+
+/* Last successful join. Kept in a section that is not cleared on reset, so
+ * it survives a software or watchdog reset but not a power cycle.
+ */
+typedef struct
+{
+    uint32_t magic;
+    uint32_t ssid_hash;
+    cy_wcm_mac_t bssid;
+    uint16_t channel;
+    bool has_ip;
+    cy_wcm_ip_setting_t ip_settings;
+    uint32_t checksum;
+} wifi_join_record_t;
+
+/*******************************************************************************
+* Function Prototypes
+*******************************************************************************/
+bool wifi_join_cache_load(const char *ssid, cy_wcm_connect_params_t *params,
+                          cy_wcm_ip_setting_t *ip_settings);
+void wifi_join_cache_store(const char *ssid, const cy_wcm_ip_address_t *ip);
+void wifi_join_cache_invalidate(void);
+uint16_t wifi_join_cache_channel(void);
+
+#endif /* WIFI_JOIN_CACHE_H_ */
+
+
+/* [] END OF FILE */
@@ -0,0 +1,261 @@
+/*******************************************************************************
+* File Name: body_pipeline.c
+*
+* Description: This file contains the response body stage of the CM55
+* offload worker. The CM33 forwards each piece of a response body as soon as
+* it is received, and the body is processed here while the CM33 goes on
+* receiving the next TLS records. A gzip or deflate coded body arrives as
+* received from the server and is inflated here before it is scanned, so the
+* CM33 only decrypts it.
+*
+* Related Document: See README.md
+********************************************************************************
+* Copyright 2024-2025, Cypress Semiconductor Corporation (an Infineon company) or
+* an affiliate of Cypress Semiconductor Corporation.  All rights reserved.
+*
+* This software, including source code, documentation and related
+* materials ("Software") is owned by Cypress Semiconductor Corporation
+* or one of its affiliates ("Cypress") and is protected by and subject to
+* worldwide patent protection (United States and foreign),
+* United States copyright laws and international treaty provisions.
+* Therefore, you may use this Software only as provided in the license
+* agreement accompanying the software package from which you
+* obtained this Software ("EULA").
+* If no EULA applies, Cypress hereby grants you a personal, non-exclusive,
+* non-transferable license to copy, modify, and compile the Software
+* source code solely for use in connection with Cypress's
+* integrated circuit products.  Any reproduction, modification, translation,
+* compilation, or representation of this Software except as specified
+* above is prohibited without the express written permission of Cypress.
+*
+* Disclaimer: THIS SOFTWARE IS PROVIDED AS-IS, WITH NO WARRANTY OF ANY KIND,
+* EXPRESS OR IMPLIED, INCLUDING, BUT NOT LIMITED TO, NONINFRINGEMENT, IMPLIED
+* WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE. Cypress
+* reserves the right to make changes to the Software without notice. Cypress
+* does not assume any liability arising out of the application or use of the
+* Software or any product or circuit described in the Software. Cypress does
+* not authorize its products for use in any products where a malfunction or
+* failure of the Cypress product may reasonably be expected to result in
+* significant property damage, injury or death ("High Risk Product"). By
+* including Cypress's product in a High Risk Product, the manufacturer
+* of such system or application assumes all risk of such use and in doing
+* so agrees to indemnify Cypress against all liability.
+*******************************************************************************/
+
+/*******************************************************************************
+* Header Files
+*******************************************************************************/
+#include "body_pipeline.h"
+#include "http_content_coding.h"
+#include "json_scan.h"
+#include <stdbool.h>
+
+/*******************************************************************************
+ * Macros
+ ******************************************************************************/
+#define BODY_PIPELINE_STATUS_SUCCESS        (0U)
+#define BODY_PIPELINE_STATUS_BAD_SESSION    (1U)
+
+/* Size of the buffer a coded body is inflated into. The inflated body is
+ * scanned in pieces of at most this size.
+ */
+#define BODY_PIPELINE_INFLATE_BUFFER_LENGTH (512U)
+
+#define BODY_PIPELINE_CODED_FLAGS   (CRYPTO_OFFLOAD_BODY_FLAG_GZIP | \
+                                     CRYPTO_OFFLOAD_BODY_FLAG_DEFLATE)
+
+/*******************************************************************************
+ * Data Types
+ ******************************************************************************/
+
+/* State of one body session. The inflater, with its history window, takes
+ * most of the memory and is only used by coded bodies.
+ */
+typedef struct
+{
+    uint32_t flags;
+    uint32_t decoded_len;
+    http_inflate_status_t inflate_status;
+    json_scan_t scan;
+    http_inflate_t inflater;
+} body_session_t;
+
+/*******************************************************************************
+ * Global Variables
+ ******************************************************************************/
+static body_session_t body_sessions[CRYPTO_OFFLOAD_BODY_SESSIONS];
+
+/* Shared by the sessions, as the worker processes one job at a time. */
+static uint8_t inflate_buffer[BODY_PIPELINE_INFLATE_BUFFER_LENGTH];
+
+/*******************************************************************************
+* Function Definitions
+*******************************************************************************/
+
+/*******************************************************************************
+* Function Name: process_decoded
+********************************************************************************
+* Summary:
+* Passes a piece of the body, after any inflating, to the stages selected by
+* the flags of the body.
+*
+*******************************************************************************/
+static void process_decoded(body_session_t *body, const uint8_t *data,
+                            uint32_t len)
+{
+    body->decoded_len += len;
+
+    if (0U != (body->flags & CRYPTO_OFFLOAD_BODY_FLAG_JSON))
+    {
+        (void) json_scan_feed(&body->scan, data, len);
+    }
+}
+
+/*******************************************************************************
+* Function Name: body_pipeline_begin
+********************************************************************************
+* Summary:
+* Starts processing a new body.
+*
+* Parameters:
+*  session - Body session chosen by the CM33
+*  flags   - Processing options of the body
+*
+* Return:
+*  uint32_t: 0 on success.
+*
+*******************************************************************************/
+uint32_t body_pipeline_begin(uint32_t session, uint32_t flags)
+{
+    uint32_t status = BODY_PIPELINE_STATUS_BAD_SESSION;
+    body_session_t *body;
+
+    if (session < CRYPTO_OFFLOAD_BODY_SESSIONS)
+    {
+        body = &body_sessions[session];
+        body->flags = flags;
+        body->decoded_len = 0U;
+        body->inflate_status = HTTP_INFLATE_MORE;
+        json_scan_init(&body->scan);
+
+        if (0U != (flags & CRYPTO_OFFLOAD_BODY_FLAG_GZIP))
+        {
+            http_inflate_init(&body->inflater, HTTP_CODING_GZIP);
+        }
+        else if (0U != (flags & CRYPTO_OFFLOAD_BODY_FLAG_DEFLATE))
+        {
+            http_inflate_init(&body->inflater, HTTP_CODING_DEFLATE);
+        }
+        else
+        {
+            /* The body is processed as received. */
+        }
+
+        status = BODY_PIPELINE_STATUS_SUCCESS;
+    }
+
+    return status;
+}
+
+/*******************************************************************************
+* Function Name: body_pipeline_data
+********************************************************************************
+* Summary:
+* Processes the next piece of a body. A coded body is inflated first; bytes
+* after the end of its compressed stream, or after an error in it, are
+* ignored. A syntax error is kept in the summary and the rest of the body is
+* ignored.
+*
+*******************************************************************************/
+uint32_t body_pipeline_data(uint32_t session, const uint8_t *data,
+                            uint32_t len)
+{
+    uint32_t status = BODY_PIPELINE_STATUS_BAD_SESSION;
+    body_session_t *body;
+    uint32_t consumed;
+    uint32_t produced;
+
+    if (session < CRYPTO_OFFLOAD_BODY_SESSIONS)
+    {
+        body = &body_sessions[session];
+
+        if (0U == (body->flags & BODY_PIPELINE_CODED_FLAGS))
+        {
+            process_decoded(body, data, len);
+        }
+        else if ((HTTP_INFLATE_DONE != body->inflate_status) &&
+                 (HTTP_INFLATE_ERROR != body->inflate_status))
+        {
+            do
+            {
+                body->inflate_status = http_inflate(&body->inflater, data,
+                                                    len, &consumed,
+                                                    inflate_buffer,
+                                                    sizeof(inflate_buffer),
+                                                    &produced);
+                data += consumed;
+                len -= consumed;
+
+                if (produced > 0U)
+                {
+                    process_decoded(body, inflate_buffer, produced);
+                }
+            } while (HTTP_INFLATE_OUTPUT_FULL == body->inflate_status);
+        }
+        else
+        {
+            /* Trailing bytes after the compressed stream. */
+        }
+
+        status = BODY_PIPELINE_STATUS_SUCCESS;
+    }
+
+    return status;
+}
+
+/*******************************************************************************
+* Function Name: body_pipeline_end
+********************************************************************************
+* Summary:
+* Ends a body and returns what was found in it. The summary of a body that
+* was not checked as JSON only has its status set to JSON_SCAN_MORE.
+*
+* Parameters:
+*  session     - Body session chosen by the CM33
+*  summary     - Receives the JSON summary of the body
+*  decoded_len - Receives the length of the body after inflating
+*
+* Return:
+*  uint32_t: 0 on success, or CRYPTO_OFFLOAD_STATUS_BAD_CODING if a coded
+*  body ended before its compressed stream or the stream is corrupt.
+*
+*******************************************************************************/
+uint32_t body_pipeline_end(uint32_t session, json_scan_summary_t *summary,
+                           uint32_t *decoded_len)
+{
+    uint32_t status = BODY_PIPELINE_STATUS_BAD_SESSION;
+    body_session_t *body;
+
+    if (session < CRYPTO_OFFLOAD_BODY_SESSIONS)
+    {
+        body = &body_sessions[session];
+        status = BODY_PIPELINE_STATUS_SUCCESS;
+
+        if ((0U != (body->flags & BODY_PIPELINE_CODED_FLAGS)) &&
+            (HTTP_INFLATE_DONE != body->inflate_status))
+        {
+            status = CRYPTO_OFFLOAD_STATUS_BAD_CODING;
+        }
+
+        if (0U != (body->flags & CRYPTO_OFFLOAD_BODY_FLAG_JSON))
+        {
+            (void) json_scan_finish(&body->scan);
+        }
+        *summary = body->scan.summary;
+        *decoded_len = body->decoded_len;
+    }
+
+    return status;
+}
+
+/* [] END OF FILE */
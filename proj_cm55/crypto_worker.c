@@ -0,0 +1,274 @@
+/*******************************************************************************
+* File Name: crypto_worker.c
+*
+* Description: This file contains the offload worker of the CM55 core. It
+* takes the jobs queued by the CM33 in shared memory, the pieces of response
+* bodies, and hands them to the body pipeline (body_pipeline.c). The CM33
+* keeps receiving while the CM55 works.
+*
+* Related Document: See README.md
+********************************************************************************
+* Copyright 2024-2025, Cypress Semiconductor Corporation (an Infineon company) or
+* an affiliate of Cypress Semiconductor Corporation.  All rights reserved.
+*
+* This software, including source code, documentation and related
+* materials ("Software") is owned by Cypress Semiconductor Corporation
+* or one of its affiliates ("Cypress") and is protected by and subject to
+* worldwide patent protection (United States and foreign),
+* United States copyright laws and international treaty provisions.
+* Therefore, you may use this Software only as provided in the license
+* agreement accompanying the software package from which you
+* obtained this Software ("EULA").
+* If no EULA applies, Cypress hereby grants you a personal, non-exclusive,
+* non-transferable license to copy, modify, and compile the Software
+* source code solely for use in connection with Cypress's
+* integrated circuit products.  Any reproduction, modification, translation,
+* compilation, or representation of this Software except as specified
+* above is prohibited without the express written permission of Cypress.
+*
+* Disclaimer: THIS SOFTWARE IS PROVIDED AS-IS, WITH NO WARRANTY OF ANY KIND,
+* EXPRESS OR IMPLIED, INCLUDING, BUT NOT LIMITED TO, NONINFRINGEMENT, IMPLIED
+* WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE. Cypress
+* reserves the right to make changes to the Software without notice. Cypress
+* does not assume any liability arising out of the application or use of the
+* Software or any product or circuit described in the Software. Cypress does
+* not authorize its products for use in any products where a malfunction or
+* failure of the Cypress product may reasonably be expected to result in
+* significant property damage, injury or death ("High Risk Product"). By
+* including Cypress's product in a High Risk Product, the manufacturer
+* of such system or application assumes all risk of such use and in doing
+* so agrees to indemnify Cypress against all liability.
+*******************************************************************************/
+
+/*******************************************************************************
+* Header Files
+*******************************************************************************/
+#include "cybsp.h"
+#include "FreeRTOS.h"
+#include "task.h"
+#include "crypto_worker.h"
+#include "crypto_offload_ipc.h"
+#include "body_pipeline.h"
+
+/*******************************************************************************
+ * Macros
+ ******************************************************************************/
+/* The worker sleeps until the IPC notify event of the CM33. It only polls
+ * while it waits for the CM33 to set up the shared memory block at startup,
+ * while the result ring is full, and every CRYPTO_WORKER_FALLBACK_POLL_MS if
+ * the notify interrupt could not be set up.
+ */
+#define CRYPTO_WORKER_START_POLL_MS         (100U)
+#define CRYPTO_WORKER_RESULT_POLL_MS        (1U)
+#define CRYPTO_WORKER_FALLBACK_POLL_MS      (20U)
+
+/* Priority of the IPC notify interrupt. It calls the kernel, so it must not
+ * be more urgent than configMAX_SYSCALL_INTERRUPT_PRIORITY.
+ */
+#define CRYPTO_WORKER_IPC_INTR_PRIORITY     (3U)
+
+/*******************************************************************************
+ * Global Variables
+ ******************************************************************************/
+/* Shared with the CM33, see crypto_offload_ipc.h. */
+CY_SECTION_SHAREDMEM CY_ALIGN(IPC_RING_CACHE_LINE)
+static crypto_offload_shm_t crypto_offload_shm;
+
+static TaskHandle_t worker_task;
+
+/*******************************************************************************
+* Function Definitions
+*******************************************************************************/
+
+/*******************************************************************************
+* Function Name: reserve_result
+********************************************************************************
+* Summary:
+* Returns a free result slot, waiting while the result ring is full. The
+* caller fills the slot and publishes it with ipc_ring_commit.
+*
+*******************************************************************************/
+static crypto_offload_result_t *reserve_result(const crypto_offload_job_t *job)
+{
+    crypto_offload_result_t *result;
+
+    while (NULL == (result = ipc_ring_reserve(&crypto_offload_shm.result_ring,
+                                              crypto_offload_shm.results,
+                                              sizeof(*result))))
+    {
+        vTaskDelay(pdMS_TO_TICKS(CRYPTO_WORKER_RESULT_POLL_MS));
+    }
+
+    result->session = job->session;
+    result->op = job->op;
+    result->sequence = job->sequence;
+
+    return result;
+}
+
+/*******************************************************************************
+* Function Name: process_job
+********************************************************************************
+* Summary:
+* Runs one job queued by the CM33.
+*
+*******************************************************************************/
+static void process_job(const crypto_offload_job_t *job)
+{
+    crypto_offload_result_t *result;
+    uint32_t len = (job->len <= CRYPTO_OFFLOAD_JOB_DATA_LENGTH) ? job->len : 0U;
+
+    switch (job->op)
+    {
+        case CRYPTO_OFFLOAD_OP_BODY_BEGIN:
+            (void) body_pipeline_begin(job->session, job->flags);
+            break;
+        case CRYPTO_OFFLOAD_OP_BODY_DATA:
+            (void) body_pipeline_data(job->session, job->data, len);
+            break;
+        case CRYPTO_OFFLOAD_OP_BODY_END:
+            result = reserve_result(job);
+            result->status = body_pipeline_end(job->session, &result->json,
+                                               &result->decoded_len);
+            ipc_ring_commit(&crypto_offload_shm.result_ring, result,
+                            sizeof(*result));
+            break;
+        default:
+            /* Unknown jobs are dropped. */
+            break;
+    }
+}
+
+/*******************************************************************************
+* Function Name: ipc_notify_handler
+********************************************************************************
+* Summary:
+* Interrupt handler of the IPC notify event of the CM33. Wakes the worker.
+*
+*******************************************************************************/
+static void ipc_notify_handler(void)
+{
+    BaseType_t higher_priority_woken = pdFALSE;
+
+    Cy_IPC_Drv_ClearInterrupt(
+            Cy_IPC_Drv_GetIntrBaseAddr(CRYPTO_OFFLOAD_IPC_INTR),
+            CY_IPC_NO_NOTIFICATION, (1UL << CRYPTO_OFFLOAD_IPC_CHANNEL));
+
+    vTaskNotifyGiveFromISR(worker_task, &higher_priority_woken);
+    portYIELD_FROM_ISR(higher_priority_woken);
+}
+
+/*******************************************************************************
+* Function Name: setup_ipc_notify
+********************************************************************************
+* Summary:
+* Routes the notify events of the offload IPC channel to the worker. A notify
+* sent before this is latched and raises the interrupt once it is enabled.
+*
+* Return:
+*  bool: true if the interrupt is enabled.
+*
+*******************************************************************************/
+static bool setup_ipc_notify(void)
+{
+    cy_stc_sysint_t intr_cfg =
+    {
+        .intrSrc = (IRQn_Type) CY_IPC_INTR_NUM_TO_VECT(CRYPTO_OFFLOAD_IPC_INTR),
+        .intrPriority = CRYPTO_WORKER_IPC_INTR_PRIORITY
+    };
+
+    worker_task = xTaskGetCurrentTaskHandle();
+
+    Cy_IPC_Drv_SetInterruptMask(
+            Cy_IPC_Drv_GetIntrBaseAddr(CRYPTO_OFFLOAD_IPC_INTR),
+            CY_IPC_NO_NOTIFICATION, (1UL << CRYPTO_OFFLOAD_IPC_CHANNEL));
+
+    if (CY_SYSINT_SUCCESS != Cy_SysInt_Init(&intr_cfg, ipc_notify_handler))
+    {
+        return false;
+    }
+
+    NVIC_EnableIRQ(intr_cfg.intrSrc);
+
+    return true;
+}
+
+/*******************************************************************************
+* Function Name: wait_for_host
+********************************************************************************
+* Summary:
+* Waits until the CM33 has initialized the shared memory block, then
+* announces the worker.
+*
+*******************************************************************************/
+static void wait_for_host(void)
+{
+    for (;;)
+    {
+        IPC_RING_CACHE_INVALIDATE(&crypto_offload_shm, IPC_RING_CACHE_LINE);
+
+        if ((CRYPTO_OFFLOAD_MAGIC == crypto_offload_shm.host_magic) &&
+            (CRYPTO_OFFLOAD_VERSION == crypto_offload_shm.host_version))
+        {
+            break;
+        }
+        (void) ulTaskNotifyTake(pdTRUE,
+                                pdMS_TO_TICKS(CRYPTO_WORKER_START_POLL_MS));
+    }
+
+    /* Drop any line of the block cached before the CM33 initialized it. */
+    IPC_RING_CACHE_INVALIDATE(&crypto_offload_shm, sizeof(crypto_offload_shm));
+
+    crypto_offload_shm.worker_version = CRYPTO_OFFLOAD_VERSION;
+    crypto_offload_shm.worker_magic = CRYPTO_OFFLOAD_MAGIC;
+    IPC_RING_CACHE_CLEAN(&crypto_offload_shm.worker_magic, IPC_RING_CACHE_LINE);
+}
+
+/*******************************************************************************
+* Function Name: crypto_worker_task
+********************************************************************************
+* Summary:
+* Serves the offload jobs of the CM33. The worker drains the job ring, then
+* blocks until the CM33 notifies it of the next job, so the CM55 stays in
+* DeepSleep while no response is being received.
+*
+* Parameters:
+*  void * arg
+*
+* Return:
+*  void
+*
+*******************************************************************************/
+void crypto_worker_task(void *arg)
+{
+    crypto_offload_job_t *job;
+    TickType_t idle_wait;
+
+    CY_UNUSED_PARAMETER(arg);
+
+    idle_wait = setup_ipc_notify() ? portMAX_DELAY :
+                pdMS_TO_TICKS(CRYPTO_WORKER_FALLBACK_POLL_MS);
+
+    wait_for_host();
+
+    for (;;)
+    {
+        job = ipc_ring_peek(&crypto_offload_shm.job_ring,
+                            crypto_offload_shm.jobs, sizeof(*job));
+
+        if (NULL != job)
+        {
+            process_job(job);
+            ipc_ring_release(&crypto_offload_shm.job_ring);
+        }
+        else
+        {
+            /* A job queued since the ring was read has left a notification,
+             * so this returns at once.
+             */
+            (void) ulTaskNotifyTake(pdTRUE, idle_wait);
+        }
+    }
+}
+
+/* [] END OF FILE */
@@ -43,6 +43,7 @@
 #include "cyabs_rtos.h"
 #include "cyabs_rtos_impl.h"
 #include "cy_time.h"
+#include "crypto_worker.h"
 
 /*******************************************************************************
  * Macros
@@ -247,7 +248,8 @@ static void setup_tickless_idle_timer(void)
 *    1. It initializes the device and board peripherals.
 *    2. It sets up the CLIB support library for CM55 CPU.
 *    3. It sets up the LPTimer instance for CM55 CPU. 
-*    4. It creates the FreeRTOS application task 'cm55_blinky_task'
+*    4. It creates the FreeRTOS application task 'cm55_blinky_task' and the
+*       crypto offload worker task.
 *    5. It starts the RTOS task scheduler.
 * Parameters:
 *  void
@@ -282,6 +284,15 @@ int main(void)
     result = xTaskCreate(cm55_task, TASK_NAME,
                         TASK_STACK_SIZE, NULL,
                         TASK_PRIORITY, NULL);
+
+    /* Create the task that serves the crypto jobs of the CM33 */
+    if( pdPASS == result )
+    {
+        result = xTaskCreate(crypto_worker_task, CRYPTO_WORKER_TASK_NAME,
+                            CRYPTO_WORKER_TASK_STACK_SIZE, NULL,
+                            CRYPTO_WORKER_TASK_PRIORITY, NULL);
+    }
+
     if( pdPASS == result )
     {
         /* Start the RTOS Scheduler */
@@ -0,0 +1,258 @@
+# Python script to turn the tokenized log lines of the application back into text.
+#
+# With APP_LOG_TOKENIZE set to 1, the APP_INFO, ERR_INFO and TEST_INFO messages
+# are sent as a '$' followed by base64 text instead of the formatted message.
+# The format strings are kept in the .app_log_tokens section of the ELF file,
+# which is not programmed into flash. This script reads the section, finds each
+# message by the hash of its format string and formats the arguments again.
+# Lines without a token are printed unchanged.
+#
+# Usage:
+#   python decode_log.py <elf-file> [<log-file>]
+#   python decode_log.py <elf-file> --port <serial-port> [--baud <rate>]
+#
+# Without a log file, the log is read from the standard input. Reading a serial
+# port needs the pyserial package.
+#
+# Example:
+#   python decode_log.py ../build/APP_KIT_PSE84_EVAL_EPC2/Debug/proj_cm33_ns.elf uart.log
+#
+# With --hash-macro, the script prints the APP_LOG_TOKEN_HASH macro of
+# app_log_token.h, which must compute the same hash as this script.
+#
+import sys
+import re
+import struct
+import base64
+import argparse
+
+# Name of the ELF section that holds the format strings
+TOKEN_SECTION = ".app_log_tokens"
+
+# Only this many characters of a format string are hashed, as on the device
+HASH_LENGTH = 96
+HASH_CONSTANT = 65599
+
+# A string argument starts with a length byte. Its top bit is set when the
+# device cut the string to APP_LOG_TOKEN_STRING_MAX characters.
+STRING_LENGTH_MASK = 0x7F
+STRING_TRUNCATED = 0x80
+
+# printf conversion: flags, width, precision, length and conversion character
+CONVERSION = re.compile(
+    r"%([-+ #0]*)(\*|\d+)?(?:\.(\*|\d*))?(hh|h|ll|l|j|z|t|L)?([diouxXcspfFeEgGaA%])")
+
+# A token is a '$' followed by the base64 text of the message
+TOKEN_LINE = re.compile(r"\$([A-Za-z0-9+/]+={0,2})")
+
+
+#Function that returns the token of a format string
+def token_hash(fmt):
+    token = len(fmt)
+    coefficient = HASH_CONSTANT
+    for c in fmt[:HASH_LENGTH]:
+        token = (token + coefficient * c) & 0xFFFFFFFF
+        coefficient = (coefficient * HASH_CONSTANT) & 0xFFFFFFFF
+    return token
+
+
+#Function that prints the C macro computing the same hash at compile time
+def print_hash_macro():
+    lines = ["#define APP_LOG_TOKEN_HASH(str)",
+             "    ((uint32_t) ((uint32_t) (sizeof(str) - 1U) +"]
+    coefficient = HASH_CONSTANT
+    for i in range(HASH_LENGTH):
+        lines.append("    0x%08xU * APP_LOG_TOKEN_CHAR(str, %uU) +" % (coefficient, i))
+        coefficient = (coefficient * HASH_CONSTANT) & 0xFFFFFFFF
+    lines[-1] = lines[-1][:-2] + "))"
+    for line in lines[:-1]:
+        print(line.ljust(76) + "\\")
+    print(lines[-1])
+
+
+#Function that returns the contents of a section of an ELF file
+def read_section(elf_file, name):
+    with open(elf_file, 'rb') as fd:
+        elf = fd.read()
+
+    if (elf[:4] != b"\x7fELF"):
+        raise ValueError(elf_file + " is not an ELF file")
+
+    is_64 = (elf[4] == 2)
+    order = "<" if (elf[5] == 1) else ">"
+    if (is_64):
+        shoff, = struct.unpack_from(order + "Q", elf, 0x28)
+        shentsize, shnum, shstrndx = struct.unpack_from(order + "HHH", elf, 0x3A)
+        header = order + "IIQQQQIIQQ"
+    else:
+        shoff, = struct.unpack_from(order + "I", elf, 0x20)
+        shentsize, shnum, shstrndx = struct.unpack_from(order + "HHH", elf, 0x2E)
+        header = order + "IIIIIIIIII"
+
+    sections = [struct.unpack_from(header, elf, shoff + i * shentsize)
+                for i in range(shnum)]
+    names = sections[shstrndx]
+    for section in sections:
+        start = names[4] + section[0]
+        section_name = elf[start:elf.index(b"\0", start)].decode()
+        if (section_name == name):
+            return elf[section[4]:section[4] + section[5]]
+
+    raise ValueError(elf_file + " has no " + name + " section")
+
+
+#Function that returns the format strings of the ELF file by token
+def load_tokens(elf_file):
+    tokens = {}
+    for fmt in read_section(elf_file, TOKEN_SECTION).split(b"\0"):
+        if (len(fmt) == 0):
+            continue
+        token = token_hash(fmt)
+        if ((token in tokens) and (tokens[token] != fmt)):
+            print("Warning: token %08x is used by more than one format string"
+                  % token, file=sys.stderr)
+        tokens[token] = fmt
+    return tokens
+
+
+#Function that reads a zigzag encoded varint
+def read_varint(data, pos):
+    value = 0
+    shift = 0
+    while (pos < len(data)):
+        byte = data[pos]
+        pos += 1
+        value |= (byte & 0x7F) << shift
+        shift += 7
+        if (byte & 0x80) == 0:
+            return ((value >> 1) ^ -(value & 1)), pos
+    raise IndexError("argument cut short")
+
+
+#Function that reads the next argument for a conversion character
+def read_argument(data, pos, conversion):
+    if (conversion == "s"):
+        length = data[pos] & STRING_LENGTH_MASK
+        truncated = (data[pos] & STRING_TRUNCATED) != 0
+        text = data[pos + 1:pos + 1 + length].decode(errors="replace")
+        return (text + "[...]" if truncated else text), pos + 1 + length
+    if (conversion in "fFeEgGaA"):
+        return struct.unpack_from("<f", data, pos)[0], pos + 4
+    return read_varint(data, pos)
+
+
+#Function that formats the arguments of a message like printf on the device
+def format_message(fmt, data):
+    pos = 0
+    out = []
+    last = 0
+    fmt = fmt.decode(errors="replace")
+    for m in CONVERSION.finditer(fmt):
+        out.append(fmt[last:m.start()])
+        last = m.end()
+        flags, width, precision, length, conversion = m.groups()
+        if (conversion == "%"):
+            out.append("%")
+            continue
+        try:
+            if (width == "*"):
+                width, pos = read_varint(data, pos)
+            if (precision == "*"):
+                precision, pos = read_varint(data, pos)
+            value, pos = read_argument(data, pos, conversion)
+        except (IndexError, struct.error):
+            out.append("<missing>")
+            continue
+
+        # long is 32 bits wide on the device, long long 64 bits
+        bits = 64 if (length in ("ll", "j")) else 32
+        if (conversion in "ouxXcp"):
+            value &= (1 << bits) - 1
+        if (conversion == "c"):
+            conversion, value = "s", chr(value & 0xFF)
+        if (conversion == "p"):
+            conversion, flags = "x", "#" + flags
+        if (conversion == "i"):
+            conversion = "d"
+
+        spec = "%" + flags
+        spec += "" if (width is None) else str(width)
+        spec += "" if (precision is None) else "." + str(precision or 0)
+        out.append((spec + conversion) % value)
+    out.append(fmt[last:])
+    return "".join(out)
+
+
+#Function that replaces the tokens of a log line with their text. The device
+#ends every token with a line feed, so a line that ends in a token gets no
+#line feed of its own; the message brings its own if it had one.
+def decode_line(line, tokens):
+    ends_in_token = [False]
+
+    def replace(m):
+        try:
+            data = base64.b64decode(m.group(1))
+        except ValueError:
+            return m.group(0)
+        if (len(data) < 4):
+            return m.group(0)
+        token, = struct.unpack_from("<I", data)
+        if (token not in tokens):
+            print("Warning: unknown token %08x, is the ELF file up to date?"
+                  % token, file=sys.stderr)
+            return m.group(0)
+        ends_in_token[0] = (m.end() == len(line))
+        return format_message(tokens[token], data[4:])
+
+    text = TOKEN_LINE.sub(replace, line)
+    return text + ("" if ends_in_token[0] else "\n")
+
+
+#Function that yields the lines of the log from a serial port, a file or stdin
+def read_lines(options):
+    if (options.port):
+        import serial
+        port = serial.Serial(options.port, options.baud)
+        while True:
+            yield port.readline().decode(errors="replace")
+    elif (options.log_file):
+        with open(options.log_file, 'r', errors="replace") as fd:
+            for line in fd:
+                yield line
+    else:
+        for line in sys.stdin:
+            yield line
+
+
+#Function that returns the parser of the options
+def make_parser():
+    parser = argparse.ArgumentParser(
+        description="Turns the tokenized log lines of the application back into text")
+    parser.add_argument("elf_file", nargs="?",
+                        help="ELF file of the CM33 non-secure application")
+    parser.add_argument("log_file", nargs="?",
+                        help="log to decode, the standard input without it")
+    parser.add_argument("--port", help="serial port to read the log from")
+    parser.add_argument("--baud", type=int, default=115200, help="baud rate of the serial port")
+    parser.add_argument("--hash-macro", action="store_true",
+                        help="print the APP_LOG_TOKEN_HASH macro of app_log_token.h and exit")
+    return parser
+
+
+#Main function. Execution starts here
+if __name__ == '__main__':
+
+    parser = make_parser()
+    options = parser.parse_args()
+
+    if (options.hash_macro):
+        print_hash_macro()
+        sys.exit(0)
+
+    if (options.elf_file is None):
+        parser.error("pass the ELF file of the CM33 non-secure application")
+
+    tokens = load_tokens(options.elf_file)
+    for line in read_lines(options):
+        sys.stdout.write(decode_line(line.rstrip("\r\n"), tokens))
+        sys.stdout.flush()
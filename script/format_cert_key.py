@@ -1,12 +1,24 @@
 # Python script to convert certificate/key file to string format that can be used in C source files.
 #
 # Usage:
-#   python format_cert_key.py <one-or-more-file-name-of-certificate-or-key-with-extension>
+#   python format_cert_key.py [--der] <one-or-more-file-name-of-certificate-or-key-with-extension>
 #
 # Example:
 #   python format_cert_key.py mosquitto_ca.crt mosquitto_client.crt mosquitto_client.key
 #
+# With --der, the certificate/key is converted to DER and printed as the
+# contents of a C byte array instead of a PEM string. Mbed TLS parses DER
+# directly, without the base64 decode of PEM. Files ending in .der are
+# accepted as is.
+#
+# Example:
+#   python format_cert_key.py --der mysecurehttpclient.crt mysecurehttpclient.key
+#
 import sys
+import base64
+
+# Number of bytes printed on each line of a DER byte array
+DER_BYTES_PER_LINE = 12
 
 #Function that adds a new line character and trailing backslash except on the final line
 def format_file(f):
@@ -22,17 +34,72 @@ def format_file(f):
                 print(i+"\\")
 
 
+#Function that returns the DER encoding of every PEM block in the file
+def pem_to_der(f):
+    blocks = []
+    body = None
+    with open(f, 'r') as fd:
+        for line in fd.read().splitlines():
+            line = line.strip()
+            if line.startswith("-----BEGIN"):
+                # Skip "EC PARAMETERS" blocks that OpenSSL writes before a key
+                body = None if ("PARAMETERS" in line) else []
+            elif line.startswith("-----END"):
+                if body is not None:
+                    blocks.append(base64.b64decode("".join(body)))
+                body = None
+            elif (body is not None) and (":" not in line):
+                # Lines with a colon are PEM headers, not base64 data
+                body.append(line)
+    return blocks
+
+
+#Function that prints the DER encoding of a file as C byte array contents
+def format_file_der(f):
+    if f.endswith(".der"):
+        with open(f, 'rb') as fd:
+            blocks = [fd.read()]
+    else:
+        blocks = pem_to_der(f)
+
+    if (len(blocks) == 0):
+        print("No PEM block found in", f)
+        return
+
+    if (len(blocks) > 1):
+        # Mbed TLS reads a single certificate from a DER buffer
+        print("/* Note:", f, "holds", len(blocks), "blocks, only the first is converted */")
+
+    der = blocks[0]
+    print("/*", len(der), "bytes */")
+    for start in range(0, len(der), DER_BYTES_PER_LINE):
+        chunk = der[start:start + DER_BYTES_PER_LINE]
+        print("    " + " ".join("0x%02x," % b for b in chunk))
+
+
 #Main function. Execution starts here
 if __name__ == '__main__':
 
+    der_format = ("--der" in sys.argv)
+
     for arg in (sys.argv):
+        if (arg == "--der"):
+            continue
         if (arg.endswith(".crt") or arg.endswith(".pem") or arg.endswith(".key")):
-            print("String format of",arg,"file:")
-            format_file(arg)
+            if (der_format):
+                print("DER format of",arg,"file:")
+                format_file_der(arg)
+            else:
+                print("String format of",arg,"file:")
+                format_file(arg)
+            print("")
+        elif (der_format and arg.endswith(".der")):
+            print("DER format of",arg,"file:")
+            format_file_der(arg)
             print("")
         else:
             if (arg.endswith(".py") == False):
-                print("Pass file with extension (*.crt) (*.pem) or (*.key) only!")
+                print("Pass file with extension (*.crt) (*.pem) (*.key) or, with --der, (*.der) only!")
             
     input("Enter any key to exit...")
 
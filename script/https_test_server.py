@@ -0,0 +1,399 @@
+# Python script of a local HTTPS server that stands in for the HTTPS Server code
+# example when measuring the client.
+#
+# The server speaks mutual TLS with the certificates made by generate_ssl_certs.sh:
+# it presents mysecurehttpserver.local.crt and only accepts clients whose
+# certificate is signed by root_ca.crt. It answers the requests of the client:
+#
+#   GET  /                 HTML page with the LED status
+#   POST /                 toggles the LED and returns the page
+#   PUT  /                 registers a resource from a "/<name>=<text>" body
+#   PUT  /<name>           stores the body as the resource <name>
+#   GET  /<name>           returns a stored resource, "Hello!" for /myhellomessage
+#   HEAD <path>            headers of the GET response
+#
+# The responses are shaped by the options below, or per request by query
+# parameters of the path, which take precedence:
+#
+#   size=<bytes>     length of the page, padded with text (--size)
+#   delay=<ms>       latency added before the response (--delay-ms, --jitter-ms)
+#   chunked=1        chunked transfer-encoding (--chunked, --chunk-size)
+#   gzip=1           gzip the body even without Accept-Encoding (--gzip sends it
+#                    only when the client accepts it)
+#   close=1          close the connection after the response (--close-after)
+#
+# Usage:
+#   python https_test_server.py [--cert-dir <dir>] [--port 50007] [options]
+#
+# Example:
+#   python https_test_server.py --cert-dir . --size 4096 --delay-ms 20 --chunked
+#
+# Set HTTPS_SERVER_HOST in secure_http_client.h to the address of the PC. The
+# counters of the server are returned as JSON by GET /stats and printed on exit.
+#
+import os
+import sys
+import ssl
+import gzip
+import json
+import time
+import random
+import hashlib
+import argparse
+import threading
+import urllib.parse
+from http.server import BaseHTTPRequestHandler, ThreadingHTTPServer
+
+# Port of the HTTPS Server code example, HTTPS_PORT of the client
+DEFAULT_PORT = 50007
+
+# Files made by generate_ssl_certs.sh
+SERVER_CERT = "mysecurehttpserver.local.crt"
+SERVER_KEY = "mysecurehttpserver.local.key"
+ROOT_CA = "root_ca.crt"
+CLIENT_CERT = "mysecurehttpclient.crt"
+
+# Resource registered by the PUT request of the client
+HELLO_PATH = "/myhellomessage"
+HELLO_TEXT = "Hello!"
+
+# Largest request body and response page accepted
+MAX_BODY_SIZE = 1024 * 1024
+
+# Text the page is padded with up to the requested size
+PADDING = "The quick brown fox jumps over the lazy dog. "
+
+
+#Class that holds the options of the server and the counters it keeps
+class ServerState:
+    def __init__(self, options):
+        self.options = options
+        self.lock = threading.Lock()
+        self.led_on = False
+        self.resources = {HELLO_PATH: HELLO_TEXT.encode()}
+        self.counters = {}
+        self.reset_counters()
+
+    #Function that clears the counters
+    def reset_counters(self):
+        with self.lock:
+            self.counters = {
+                "connections": 0,
+                "handshake_failures": 0,
+                "handshake_ms": 0.0,
+                "requests": 0,
+                "methods": {},
+                "status": {},
+                "bytes_received": 0,
+                "bytes_sent": 0,
+                "closed_by_server": 0,
+            }
+
+    #Function that adds to a counter, or to a key of a counter
+    def count(self, name, value=1, key=None):
+        with self.lock:
+            if (key is None):
+                self.counters[name] += value
+            else:
+                self.counters[name][key] = self.counters[name].get(key, 0) + value
+
+    #Function that returns a copy of the counters
+    def snapshot(self):
+        with self.lock:
+            return json.loads(json.dumps(self.counters))
+
+
+#Class that handles the requests of one connection
+class RequestHandler(BaseHTTPRequestHandler):
+    # HTTP/1.1 keeps the connection open between requests
+    protocol_version = "HTTP/1.1"
+    server_version = "HTTPSTestServer/1.0"
+
+    # Send the headers and body of a response in one write, without Nagle
+    # holding back the last segment
+    wbufsize = 64 * 1024
+    disable_nagle_algorithm = True
+
+    #Function that runs the TLS handshake on the connection's own thread
+    def setup(self):
+        state = self.server.state
+        start = time.monotonic()
+        try:
+            self.request.do_handshake()
+        except (ssl.SSLError, OSError) as error:
+            state.count("handshake_failures")
+            self.log_message("TLS handshake failed: %s", error)
+            raise
+        state.count("connections")
+        state.count("handshake_ms", (time.monotonic() - start) * 1000.0)
+        self.response_count = 0
+        super().setup()
+
+    #Function that prints a request when --verbose is set
+    def log_message(self, fmt, *args):
+        if (self.server.state.options.verbose):
+            super().log_message(fmt, *args)
+
+    #Function that returns the value of a query parameter, or the default
+    def option(self, query, name, default):
+        if (name in query):
+            try:
+                return type(default)(int(query[name][0]))
+            except ValueError:
+                pass
+        return default
+
+    #Function that reads a request body sent with chunked transfer-encoding
+    def read_chunked_body(self):
+        body = b""
+        while (True):
+            size = int(self.rfile.readline().split(b";")[0].strip() or b"0", 16)
+            if (len(body) + size > MAX_BODY_SIZE):
+                raise ValueError("request body too large")
+            if (size == 0):
+                break
+            body += self.rfile.read(size)
+            self.rfile.readline()
+        # Trailer fields end with an empty line
+        while (self.rfile.readline().strip()):
+            pass
+        return body
+
+    #Function that reads the request body
+    def read_body(self):
+        if ("chunked" in self.headers.get("Transfer-Encoding", "").lower()):
+            body = self.read_chunked_body()
+            length = len(body)
+        else:
+            length = int(self.headers.get("Content-Length", 0))
+            if (length > MAX_BODY_SIZE):
+                raise ValueError("request body too large")
+            body = self.rfile.read(length) if (length > 0) else b""
+        if (self.headers.get("Content-Encoding", "") == "gzip"):
+            body = gzip.decompress(body)
+        self.server.state.count("bytes_received", length)
+        return body
+
+    #Function that returns the HTML page of the LED status, padded to size
+    def page(self, size):
+        state = self.server.state
+        text = ("<html><head><title>HTTPS Server</title></head><body>"
+                "<h1>HTTPS Server</h1><p>LED status: %s</p>"
+                % ("ON" if state.led_on else "OFF"))
+        tail = "</body></html>"
+        if (size > len(text) + len(tail)):
+            fill = size - len(text) - len(tail)
+            text += (PADDING * (fill // len(PADDING) + 1))[:fill]
+        return (text + tail).encode()
+
+    #Function that sends a response shaped by the options and the query
+    def respond(self, status, body, content_type, query, send_body=True):
+        options = self.server.state.options
+        state = self.server.state
+
+        delay = self.option(query, "delay", options.delay_ms)
+        if (options.jitter_ms > 0):
+            delay += random.uniform(0, options.jitter_ms)
+        if (delay > 0):
+            time.sleep(delay / 1000.0)
+
+        use_gzip = (self.option(query, "gzip", 0) != 0) or \
+                   (options.gzip and ("gzip" in self.headers.get("Accept-Encoding", "")))
+        chunked = (self.option(query, "chunked", int(options.chunked)) != 0)
+
+        self.response_count += 1
+        close = (self.option(query, "close", 0) != 0) or \
+                ((options.close_after > 0) and (self.response_count >= options.close_after))
+
+        # GET and HEAD responses carry an ETag, which the client's cache
+        # sends back in If-None-Match
+        etag = None
+        if ((status == 200) and options.etag and (self.command in ("GET", "HEAD"))):
+            etag = '"%s"' % hashlib.sha1(body).hexdigest()[:16]
+            if (self.headers.get("If-None-Match", "") == etag):
+                status, body, use_gzip, chunked = 304, b"", False, False
+
+        if (use_gzip and (len(body) > 0)):
+            body = gzip.compress(body)
+
+        self.send_response(status)
+        self.send_header("Content-Type", content_type)
+        if (use_gzip and (len(body) > 0)):
+            self.send_header("Content-Encoding", "gzip")
+        if (etag is not None):
+            self.send_header("ETag", etag)
+        if (chunked and send_body and (status != 304)):
+            self.send_header("Transfer-Encoding", "chunked")
+        elif (status != 304):
+            self.send_header("Content-Length", str(len(body)))
+        if (close):
+            self.send_header("Connection", "close")
+            self.close_connection = True
+            state.count("closed_by_server")
+        self.end_headers()
+
+        if (send_body and (status != 304)):
+            if (chunked):
+                size = options.chunk_size
+                for start in range(0, len(body), size):
+                    piece = body[start:start + size]
+                    self.wfile.write(b"%x\r\n%s\r\n" % (len(piece), piece))
+                self.wfile.write(b"0\r\n\r\n")
+            else:
+                self.wfile.write(body)
+            state.count("bytes_sent", len(body))
+
+        self.wfile.flush()
+        state.count("status", key=str(status))
+
+    #Function that counts a request and splits its path from the query
+    def begin(self):
+        state = self.server.state
+        state.count("requests")
+        state.count("methods", key=self.command)
+        url = urllib.parse.urlsplit(self.path)
+        return url.path, urllib.parse.parse_qs(url.query)
+
+    #Function that answers GET and HEAD
+    def do_GET(self, send_body=True):
+        state = self.server.state
+        path, query = self.begin()
+
+        # The client sends its request body with every method, which must
+        # not be taken for the next request
+        self.read_body()
+
+        if (path == "/stats"):
+            body = json.dumps(state.snapshot()).encode()
+            self.respond(200, body, "application/json", {}, send_body)
+        elif (path == "/"):
+            size = min(self.option(query, "size", state.options.size), MAX_BODY_SIZE)
+            self.respond(200, self.page(size), "text/html", query, send_body)
+        else:
+            with state.lock:
+                resource = state.resources.get(path)
+            if (resource is None):
+                self.respond(404, b"Not Found", "text/plain", query, send_body)
+            else:
+                self.respond(200, resource, "text/plain", query, send_body)
+
+    #Function that answers HEAD
+    def do_HEAD(self):
+        self.do_GET(send_body=False)
+
+    #Function that answers POST
+    def do_POST(self):
+        state = self.server.state
+        path, query = self.begin()
+        self.read_body()
+
+        if (path == "/"):
+            with state.lock:
+                state.led_on = not state.led_on
+            size = min(self.option(query, "size", state.options.size), MAX_BODY_SIZE)
+            self.respond(200, self.page(size), "text/html", query)
+        else:
+            self.respond(404, b"Not Found", "text/plain", query)
+
+    #Function that answers PUT
+    def do_PUT(self):
+        state = self.server.state
+        path, query = self.begin()
+        body = self.read_body()
+
+        # PUT / carries "/<name>=<text>", as sent by HTTPS_PUT_METHOD
+        if (path == "/"):
+            name, _, text = body.decode(errors="replace").partition("=")
+            path, body = ("/" + name.lstrip("/")), text.encode()
+
+        if (path in ("/", "/stats")):
+            self.respond(400, b"Bad Request", "text/plain", query)
+            return
+
+        with state.lock:
+            created = (path not in state.resources)
+            state.resources[path] = body
+        self.log_message("Resource %s set to %d bytes", path, len(body))
+        self.respond(201 if created else 200, b"", "text/plain", query)
+
+
+#Class of the server, which reports a dropped connection in one line
+class TestServer(ThreadingHTTPServer):
+    daemon_threads = True
+
+    #Function that reports an error of a connection
+    def handle_error(self, request, client_address):
+        if (self.state.options.verbose):
+            super().handle_error(request, client_address)
+        else:
+            print("Connection from %s:%d failed: %s" %
+                  (client_address[0], client_address[1], sys.exc_info()[1]),
+                  file=sys.stderr)
+
+
+#Function that returns the TLS context of the server, with client certificates required.
+#generate_ssl_certs.sh gives every certificate the subject of the root CA, so
+#OpenSSL takes the client certificate for a self-signed one and cannot chain it
+#to the root. The client certificate is trusted as well, as a partial chain.
+def make_context(cert_dir):
+    context = ssl.SSLContext(ssl.PROTOCOL_TLS_SERVER)
+    context.load_cert_chain(cert_dir + "/" + SERVER_CERT, cert_dir + "/" + SERVER_KEY)
+    context.load_verify_locations(cert_dir + "/" + ROOT_CA)
+    if (os.path.exists(cert_dir + "/" + CLIENT_CERT)):
+        context.load_verify_locations(cert_dir + "/" + CLIENT_CERT)
+        context.verify_flags |= ssl.VERIFY_X509_PARTIAL_CHAIN
+    context.verify_mode = ssl.CERT_REQUIRED
+    return context
+
+
+#Function that returns the parser of the server options
+def make_parser():
+    parser = argparse.ArgumentParser(description="Local HTTPS server for the HTTPS client")
+    parser.add_argument("--cert-dir", default=".",
+                        help="directory of the certificates made by generate_ssl_certs.sh")
+    parser.add_argument("--host", default="0.0.0.0", help="address to listen on")
+    parser.add_argument("--port", type=int, default=DEFAULT_PORT, help="port to listen on")
+    parser.add_argument("--size", type=int, default=0,
+                        help="length of the page of GET / and POST /, 0 for the bare page")
+    parser.add_argument("--delay-ms", type=int, default=0, help="latency added to every response")
+    parser.add_argument("--jitter-ms", type=int, default=0,
+                        help="random latency of up to this many ms added to every response")
+    parser.add_argument("--chunked", action="store_true",
+                        help="send the bodies with chunked transfer-encoding")
+    parser.add_argument("--chunk-size", type=int, default=1024, help="bytes per chunk")
+    parser.add_argument("--gzip", action="store_true",
+                        help="gzip the bodies for clients that send Accept-Encoding: gzip")
+    parser.add_argument("--close-after", type=int, default=0,
+                        help="close the connection after this many responses, 0 to keep it open")
+    parser.add_argument("--no-etag", dest="etag", action="store_false",
+                        help="send no ETag, so the client does not cache the responses")
+    parser.add_argument("--verbose", action="store_true", help="print every request")
+    return parser
+
+
+#Function that starts the server on a thread of its own and returns it
+def start_server(options):
+    server = TestServer((options.host, options.port), RequestHandler)
+    server.state = ServerState(options)
+    server.socket = make_context(options.cert_dir).wrap_socket(
+        server.socket, server_side=True, do_handshake_on_connect=False)
+    thread = threading.Thread(target=server.serve_forever, daemon=True)
+    thread.start()
+    return server
+
+
+#Main function. Execution starts here
+if __name__ == '__main__':
+
+    options = make_parser().parse_args()
+    server = start_server(options)
+    print("HTTPS server listening on port %d, press Ctrl+C to stop" % server.server_address[1])
+
+    try:
+        while True:
+            time.sleep(1)
+    except KeyboardInterrupt:
+        pass
+
+    server.shutdown()
+    print(json.dumps(server.state.snapshot(), indent=2))
@@ -0,0 +1,459 @@
+# Python script that runs the end-to-end benchmark of the HTTPS client against
+# the local server of https_test_server.py and writes the results as JSON.
+#
+# The server is started on this PC. Each scenario is a request script of the
+# HTTPS_SCRIPT menu option of the client, for example
+#
+#   GET /?size=4096&chunked=1 n=50 c=4
+#
+# The query parameters of the path shape the responses of the server, see
+# https_test_server.py. With --port, the script selects HTTPS_SCRIPT on the
+# UART of the kit, types the scenario, and reads the throughput and latency
+# that the client prints. With --host-build, the client built for Linux in
+# the host folder is started instead of using the kit, and its console is read
+# the same way, so that the benchmark runs without a kit, for example in CI.
+# Without either, the same scenarios are run by a Python client on this PC,
+# which checks the server and the network and gives a reference to compare
+# the kit with.
+#
+# Every scenario is written as one line of JSON, to the standard output or
+# appended to the --output file, so that runs can be compared over time.
+#
+# Usage:
+#   python run_benchmark.py [--cert-dir <dir>] [--port <serial-port>] [--baud <rate>]
+#                           [--host-build <binary>] [--output <file>]
+#                           [--scenario <name>] [--list]
+#
+# Example:
+#   python run_benchmark.py --cert-dir . --port /dev/ttyACM0 --output results.jsonl
+#   python run_benchmark.py --cert-dir . --host-build ../host/build/https_client_host
+#
+# Reading the UART needs the pyserial package. Set HTTPS_SERVER_HOST in
+# secure_http_client.h to the address of this PC before building the client,
+# and start the benchmark while the client shows its menu.
+#
+import re
+import ssl
+import sys
+import json
+import time
+import queue
+import argparse
+import threading
+import subprocess
+import http.client
+from datetime import datetime, timezone
+
+import https_test_server
+
+# Files made by generate_ssl_certs.sh for the client
+CLIENT_CERT = "mysecurehttpclient.crt"
+CLIENT_KEY = "mysecurehttpclient.key"
+
+# Menu option of the request script, HTTPS_SCRIPT in secure_http_client.h
+MENU_HTTPS_SCRIPT = 14
+
+# Longest script the client reads, HTTPS_SCRIPT_LINE_LENGTH in https_script.h
+SCRIPT_LINE_LENGTH = 255
+
+# Longest time a scenario may take before it is given up
+SCENARIO_TIMEOUT_S = 300
+
+# Scenarios of the benchmark: name and request script
+SCENARIOS = [
+    ("get_small",         "GET / n=50"),
+    ("get_pipelined",     "GET / n=100 c=4"),
+    ("get_16k",           "GET /?size=16384 n=20 c=2"),
+    ("get_16k_chunked",   "GET /?size=16384&chunked=1 n=20 c=2"),
+    ("get_16k_gzip",      "GET /?size=16384&gzip=1 n=20 c=2"),
+    ("get_latency_50ms",  "GET /?delay=50 n=20 c=4"),
+    ("get_close",         "GET /?close=1 n=10"),
+    ("post_1k",           "POST / size=1024 n=20 c=2"),
+    ("put_get_hello",     "PUT /myhellomessage size=64 n=10; GET /myhellomessage n=10"),
+]
+
+# Methods of a script
+METHODS = ("GET", "POST", "PUT", "HEAD")
+
+# Lines printed by https_script_print_result() on the kit
+RESULT_LINE = re.compile(r"^ (Step \d+|Total): (\d+) requests, (\d+) failed, (\d+) ms")
+BYTES_LINE = re.compile(r"^ Body bytes\s*: sent (\d+) received (\d+)")
+LATENCY_LINE = re.compile(
+    r"^ Latency \(us\)\s*: min (\d+) p50 (\d+) p90 (\d+) p99 (\d+) max (\d+)")
+ERROR_LINE = re.compile(r"(Error: .*|Failed to .*)")
+
+# Status codes from this one on count as failed requests, as on the kit
+FAILED_STATUS_CODE = 400
+
+
+#Function that splits a script into steps, as https_script_parse() on the kit
+def parse_script(script):
+    steps = []
+    for text in re.split(r"[;\n]", script):
+        words = text.split()
+        if (len(words) == 0):
+            continue
+        if ((len(words) < 2) or (words[0] not in METHODS) or (not words[1].startswith("/"))):
+            raise ValueError("step needs a method and a path: " + text)
+        step = {"method": words[0], "path": words[1], "size": 0, "n": 1, "c": 1, "delay": 0}
+        for word in words[2:]:
+            name, _, value = word.partition("=")
+            if ((name not in step) or (name in ("method", "path"))):
+                raise ValueError("bad option: " + word)
+            step[name] = int(value)
+        steps.append(step)
+    return steps
+
+
+#Function that returns the percentile of sorted samples by the nearest rank
+def percentile(samples, pct):
+    if (len(samples) == 0):
+        return 0
+    rank = max(1, (pct * len(samples) + 99) // 100)
+    return samples[rank - 1]
+
+
+#Function that returns the result of a step in the form printed by the kit
+def make_result(requests, failures, elapsed_ms, sent, received, latencies):
+    latencies = sorted(latencies)
+    return {
+        "requests": requests,
+        "failures": failures,
+        "elapsed_ms": elapsed_ms,
+        "requests_per_sec": round(requests * 1000.0 / elapsed_ms, 2) if (elapsed_ms > 0) else 0,
+        "bytes_sent": sent,
+        "bytes_received": received,
+        "latency_us": {
+            "min": latencies[0] if latencies else 0,
+            "p50": percentile(latencies, 50),
+            "p90": percentile(latencies, 90),
+            "p99": percentile(latencies, 99),
+            "max": latencies[-1] if latencies else 0,
+        },
+    }
+
+
+#Function that adds the results of the steps into a total
+def total_result(results):
+    total = {"requests": 0, "failures": 0, "elapsed_ms": 0, "bytes_sent": 0, "bytes_received": 0}
+    for result in results:
+        for name in total:
+            total[name] += result[name]
+    total["requests_per_sec"] = round(total["requests"] * 1000.0 / total["elapsed_ms"], 2) \
+        if (total["elapsed_ms"] > 0) else 0
+    total["latency_us"] = {
+        "min": min(r["latency_us"]["min"] for r in results),
+        "max": max(r["latency_us"]["max"] for r in results),
+    }
+    return total
+
+
+#Class of the Python client that runs the scripts on this PC
+class HostClient:
+    def __init__(self, cert_dir, host, port):
+        self.host = host
+        self.port = port
+        self.context = ssl.SSLContext(ssl.PROTOCOL_TLS_CLIENT)
+        self.context.load_cert_chain(cert_dir + "/" + CLIENT_CERT, cert_dir + "/" + CLIENT_KEY)
+        # generate_ssl_certs.sh gives the server certificate the subject of
+        # the root CA, which OpenSSL takes for a self-signed certificate. The
+        # Python client only generates load, so it does not verify the server;
+        # the server still requires the client certificate.
+        self.context.check_hostname = False
+        self.context.verify_mode = ssl.CERT_NONE
+
+    #Function that sends the requests of one worker of a step on its own connection
+    def worker(self, step, count, body, outcome):
+        connection = None
+        for _ in range(count):
+            if (connection is None):
+                connection = http.client.HTTPSConnection(self.host, self.port,
+                                                         context=self.context, timeout=10)
+            start = time.monotonic()
+            failed = True
+            received = 0
+            try:
+                headers = {"Content-Type": "text/plain"} if body else {}
+                connection.request(step["method"], step["path"], body=body or None,
+                                   headers=headers)
+                response = connection.getresponse()
+                received = len(response.read())
+                failed = (response.status >= FAILED_STATUS_CODE)
+                if (response.will_close):
+                    connection.close()
+                    connection = None
+            except (OSError, http.client.HTTPException):
+                if (connection is not None):
+                    connection.close()
+                connection = None
+            latency = int((time.monotonic() - start) * 1000000)
+            with outcome["lock"]:
+                outcome["latencies"].append(latency)
+                outcome["failures"] += int(failed)
+                outcome["received"] += received
+            if (step["delay"] > 0):
+                time.sleep(step["delay"] / 1000.0)
+        if (connection is not None):
+            connection.close()
+
+    #Function that runs one step with its concurrency spread over connections
+    def run_step(self, step):
+        body = b"0123456789abcdef" * (step["size"] // 16 + 1)
+        body = body[:step["size"]]
+        outcome = {"lock": threading.Lock(), "latencies": [], "failures": 0, "received": 0}
+        workers = []
+        share, extra = divmod(step["n"], step["c"])
+        start = time.monotonic()
+        for i in range(step["c"]):
+            count = share + (1 if (i < extra) else 0)
+            worker = threading.Thread(target=self.worker, args=(step, count, body, outcome))
+            worker.start()
+            workers.append(worker)
+        for worker in workers:
+            worker.join()
+        elapsed_ms = int((time.monotonic() - start) * 1000)
+        return make_result(step["n"], outcome["failures"], elapsed_ms, step["n"] * step["size"],
+                           outcome["received"], outcome["latencies"])
+
+    #Function that runs a script and returns the result of every step
+    def run(self, script):
+        return [self.run_step(step) for step in parse_script(script)], []
+
+
+#Class that runs the scripts on the kit through its UART
+class DeviceClient:
+    def __init__(self, port, baud):
+        import serial
+        self.serial = serial.Serial(port, baud, timeout=1)
+
+    #Function that sends a line to the console of the kit
+    def send(self, text):
+        self.serial.write((text + "\r\n").encode())
+        self.serial.flush()
+
+    #Function that drops the console output not read yet
+    def discard_input(self):
+        self.serial.reset_input_buffer()
+
+    #Function that reads the next line of the console, or None on a timeout
+    def read_line(self, deadline):
+        while (time.monotonic() < deadline):
+            line = self.serial.readline()
+            if (line):
+                return line.decode(errors="replace").rstrip("\r\n")
+        return None
+
+    #Function that runs a script and returns the result of every step and the errors
+    def run(self, script):
+        steps = len(parse_script(script))
+        deadline = time.monotonic() + SCENARIO_TIMEOUT_S
+        results = []
+        errors = []
+        result = None
+
+        self.discard_input()
+        self.send(str(MENU_HTTPS_SCRIPT))
+        while True:
+            line = self.read_line(deadline)
+            if (line is None):
+                raise TimeoutError("the kit did not ask for a script")
+            if ("Enter a script" in line):
+                break
+        self.send(script)
+
+        # The total follows the steps when there is more than one
+        while (len(results) < steps):
+            line = self.read_line(deadline)
+            if (line is None):
+                raise TimeoutError("the kit stopped after %d steps" % len(results))
+            match = RESULT_LINE.match(line)
+            if (match):
+                result = {"requests": int(match.group(2)), "failures": int(match.group(3)),
+                          "elapsed_ms": int(match.group(4))}
+                result["requests_per_sec"] = round(
+                    result["requests"] * 1000.0 / result["elapsed_ms"], 2) \
+                    if (result["elapsed_ms"] > 0) else 0
+                continue
+            match = BYTES_LINE.match(line)
+            if (match and (result is not None)):
+                result["bytes_sent"] = int(match.group(1))
+                result["bytes_received"] = int(match.group(2))
+                continue
+            match = LATENCY_LINE.match(line)
+            if (match and (result is not None)):
+                result["latency_us"] = dict(zip(("min", "p50", "p90", "p99", "max"),
+                                                (int(value) for value in match.groups())))
+                results.append(result)
+                result = None
+                continue
+            match = ERROR_LINE.search(line)
+            if (match):
+                errors.append(match.group(1))
+        return results, errors
+
+    #Function that releases the console
+    def close(self):
+        self.serial.close()
+
+
+#Class that runs the scripts on the client built for Linux, through its console
+class HostBuildClient(DeviceClient):
+    def __init__(self, binary, cert_dir):
+        self.process = subprocess.Popen([binary, "--cert-dir", cert_dir],
+                                        stdin=subprocess.PIPE, stdout=subprocess.PIPE)
+        self.lines = queue.Queue()
+        reader = threading.Thread(target=self.reader, daemon=True)
+        reader.start()
+
+    #Function that moves the console output of the client into the queue of lines
+    def reader(self):
+        for line in self.process.stdout:
+            self.lines.put(line.decode(errors="replace").rstrip("\r\n"))
+        self.lines.put(None)
+
+    #Function that sends a line to the console of the client
+    def send(self, text):
+        self.process.stdin.write((text + "\n").encode())
+        self.process.stdin.flush()
+
+    #Function that reads the next line of the console, or None on a timeout
+    def read_line(self, deadline):
+        try:
+            line = self.lines.get(timeout=max(0, deadline - time.monotonic()))
+        except queue.Empty:
+            return None
+        if (line is None):
+            raise OSError("the client exited with %s" % self.process.wait())
+        return line
+
+    #Function that drops the console output not read yet
+    def discard_input(self):
+        while (not self.lines.empty()):
+            if (self.lines.get() is None):
+                self.lines.put(None)
+                break
+
+    #Function that ends the client, which exits at the end of its input
+    def close(self):
+        self.process.stdin.close()
+        try:
+            self.process.wait(timeout=10)
+        except subprocess.TimeoutExpired:
+            self.process.kill()
+
+
+#Function that returns the commit of the working tree, if it is a git repository
+def git_commit():
+    try:
+        return subprocess.check_output(["git", "rev-parse", "--short", "HEAD"],
+                                       stderr=subprocess.DEVNULL).decode().strip()
+    except (OSError, subprocess.CalledProcessError):
+        return None
+
+
+#Function that returns the difference of two snapshots of the server counters
+def counter_delta(before, after):
+    delta = {}
+    for name, value in after.items():
+        if (isinstance(value, dict)):
+            delta[name] = {key: count - before[name].get(key, 0)
+                           for key, count in value.items()
+                           if (count != before[name].get(key, 0))}
+        else:
+            delta[name] = round(value - before[name], 3)
+    return delta
+
+
+#Function that returns the parser of the benchmark options
+def make_parser():
+    parser = argparse.ArgumentParser(description="End-to-end benchmark of the HTTPS client")
+    parser.add_argument("--cert-dir", default=".",
+                        help="directory of the certificates made by generate_ssl_certs.sh")
+    parser.add_argument("--server-port", type=int, default=https_test_server.DEFAULT_PORT,
+                        help="port of the local server, HTTPS_PORT of the client")
+    parser.add_argument("--port", help="serial port of the kit, the Python client is used without it")
+    parser.add_argument("--baud", type=int, default=115200, help="baud rate of the serial port")
+    parser.add_argument("--host-build",
+                        help="client built for Linux in the host folder, run instead of the kit")
+    parser.add_argument("--scenario", action="append",
+                        help="run only this scenario, may be given more than once")
+    parser.add_argument("--script", action="append",
+                        help="run this request script as a scenario of its own")
+    parser.add_argument("--repeat", type=int, default=1, help="number of runs of every scenario")
+    parser.add_argument("--output", help="file the results are appended to, one JSON line each")
+    parser.add_argument("--list", action="store_true", help="print the scenarios and exit")
+    return parser
+
+
+#Main function. Execution starts here
+if __name__ == '__main__':
+
+    options = make_parser().parse_args()
+    scenarios = SCENARIOS
+
+    if (options.list):
+        for name, script in SCENARIOS:
+            print("%-18s %s" % (name, script))
+        sys.exit(0)
+
+    if (options.scenario):
+        scenarios = [s for s in SCENARIOS if (s[0] in options.scenario)]
+    if (options.script):
+        scenarios = scenarios if options.scenario else []
+        scenarios += [("script_%d" % (i + 1), s) for i, s in enumerate(options.script)]
+
+    for name, script in scenarios:
+        parse_script(script)
+        if (len(script) > SCRIPT_LINE_LENGTH):
+            print("Scenario %s is longer than the client reads" % name, file=sys.stderr)
+            sys.exit(1)
+
+    server_options = https_test_server.make_parser().parse_args(
+        ["--cert-dir", options.cert_dir, "--port", str(options.server_port)])
+    server = https_test_server.start_server(server_options)
+
+    if (options.port):
+        client = DeviceClient(options.port, options.baud)
+        client_name = "device"
+    elif (options.host_build):
+        client = HostBuildClient(options.host_build, options.cert_dir)
+        client_name = "host_build"
+    else:
+        client = HostClient(options.cert_dir, "localhost", options.server_port)
+        client_name = "host"
+
+    output = open(options.output, "a") if options.output else sys.stdout
+    commit = git_commit()
+    failed = False
+
+    for run in range(options.repeat):
+        for name, script in scenarios:
+            before = server.state.snapshot()
+            record = {
+                "timestamp": datetime.now(timezone.utc).isoformat(timespec="seconds"),
+                "commit": commit,
+                "client": client_name,
+                "scenario": name,
+                "script": script,
+                "run": run + 1,
+            }
+            try:
+                steps, errors = client.run(script)
+                record["steps"] = steps
+                record["total"] = total_result(steps)
+                record["errors"] = errors
+                failed = failed or (record["total"]["failures"] > 0)
+            except (TimeoutError, OSError, ValueError) as error:
+                record["error"] = str(error)
+                failed = True
+            record["server"] = counter_delta(before, server.state.snapshot())
+            output.write(json.dumps(record) + "\n")
+            output.flush()
+            print("%-18s %s" % (name, ("%.2f requests/s, %d failed" % (
+                record["total"]["requests_per_sec"], record["total"]["failures"]))
+                if ("total" in record) else record["error"]), file=sys.stderr)
+
+    if (client_name != "host"):
+        client.close()
+    server.shutdown()
+    sys.exit(1 if failed else 0)
@@ -0,0 +1,160 @@
+/*******************************************************************************
+* File Name: crypto_offload_ipc.h
+*
+* Description: This file describes the offload service of the CM55 core
+* shared with the CM33: the layout of the shared memory block, the jobs that
+* the CM33 queues and the results that the CM55 returns. Jobs carry the
+* response bodies the CM55 processes.
+*
+* Related Document: See README.md
+********************************************************************************
+* Copyright 2024-2025, Cypress Semiconductor Corporation (an Infineon company) or
+* an affiliate of Cypress Semiconductor Corporation.  All rights reserved.
+*
+* This software, including source code, documentation and related
+* materials ("Software") is owned by Cypress Semiconductor Corporation
+* or one of its affiliates ("Cypress") and is protected by and subject to
+* worldwide patent protection (United States and foreign),
+* United States copyright laws and international treaty provisions.
+* Therefore, you may use this Software only as provided in the license
+* agreement accompanying the software package from which you
+* obtained this Software ("EULA").
+* If no EULA applies, Cypress hereby grants you a personal, non-exclusive,
+* non-transferable license to copy, modify, and compile the Software
+* source code solely for use in connection with Cypress's
+* integrated circuit products.  Any reproduction, modification, translation,
+* compilation, or representation of this Software except as specified
+* above is prohibited without the express written permission of Cypress.
+*
+* Disclaimer: THIS SOFTWARE IS PROVIDED AS-IS, WITH NO WARRANTY OF ANY KIND,
+* EXPRESS OR IMPLIED, INCLUDING, BUT NOT LIMITED TO, NONINFRINGEMENT, IMPLIED
+* WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE. Cypress
+* reserves the right to make changes to the Software without notice. Cypress
+* does not assume any liability arising out of the application or use of the
+* Software or any product or circuit described in the Software. Cypress does
+* not authorize its products for use in any products where a malfunction or
+* failure of the Cypress product may reasonably be expected to result in
+* significant property damage, injury or death ("High Risk Product"). By
+* including Cypress's product in a High Risk Product, the manufacturer
+* of such system or application assumes all risk of such use and in doing
+* so agrees to indemnify Cypress against all liability.
+*******************************************************************************/
+
+/*******************************************************************************
+* Include guard
+*******************************************************************************/
+#ifndef CRYPTO_OFFLOAD_IPC_H_
+#define CRYPTO_OFFLOAD_IPC_H_
+
+/*******************************************************************************
+* Header Files
+*******************************************************************************/
+#include "ipc_ring.h"
+#include "json_scan.h"
+
+/*******************************************************************************
+* Macros
+*******************************************************************************/
+
+/* Written to host_magic by the CM33 once the block is initialized, and to
+ * worker_magic by the CM55 once it serves jobs. A change of the block layout
+ * must change CRYPTO_OFFLOAD_VERSION.
+ */
+#define CRYPTO_OFFLOAD_MAGIC                     (0x43524F46UL)
+#define CRYPTO_OFFLOAD_VERSION                   (5UL)
+
+/* IPC channel whose notify event wakes the CM55 worker, and the IPC
+ * interrupt structure the event is sent to. The CM33 notifies after it
+ * queues a job, so the worker sleeps until there is work. Change them if
+ * the application uses this channel or structure for anything else.
+ */
+#define CRYPTO_OFFLOAD_IPC_CHANNEL               (CY_IPC_CHAN_USER)
+#define CRYPTO_OFFLOAD_IPC_INTR                  (CY_IPC_INTR_USER)
+
+/* Number of job and result slots. Powers of two. */
+#define CRYPTO_OFFLOAD_JOB_SLOTS                 (8U)
+#define CRYPTO_OFFLOAD_RESULT_SLOTS              (4U)
+
+/* Data carried by one job. A job slot is this plus a 32 byte header. */
+#define CRYPTO_OFFLOAD_JOB_DATA_LENGTH           (480U)
+
+/* Number of response bodies the CM55 processes at the same time. */
+#define CRYPTO_OFFLOAD_BODY_SESSIONS             (2U)
+
+/* flags of BODY_BEGIN: check the body as a JSON document, and inflate a
+ * body that arrives with a gzip or deflate Content-Encoding before any
+ * other processing.
+ */
+#define CRYPTO_OFFLOAD_BODY_FLAG_JSON            (0x01UL)
+#define CRYPTO_OFFLOAD_BODY_FLAG_GZIP            (0x02UL)
+#define CRYPTO_OFFLOAD_BODY_FLAG_DEFLATE         (0x04UL)
+
+/* status of a BODY_END result whose coded body did not inflate completely. */
+#define CRYPTO_OFFLOAD_STATUS_BAD_CODING         (2UL)
+
+/*******************************************************************************
+* Data Types
+*******************************************************************************/
+
+/* Operation of a job. */
+typedef enum
+{
+    CRYPTO_OFFLOAD_OP_BODY_BEGIN = 1,
+    CRYPTO_OFFLOAD_OP_BODY_DATA,
+    CRYPTO_OFFLOAD_OP_BODY_END,
+} crypto_offload_op_t;
+
+/* Job queued by the CM33. BODY_END produces a result.
+ * flags is given with BODY_BEGIN and selects how the body is processed.
+ * sequence numbers the jobs in the order they are queued.
+ */
+typedef struct
+{
+    uint32_t op;
+    uint32_t session;
+    uint32_t len;
+    uint32_t flags;
+    uint32_t sequence;
+    uint32_t reserved[3];
+    uint8_t data[CRYPTO_OFFLOAD_JOB_DATA_LENGTH];
+} crypto_offload_job_t;
+
+/* Result returned by the CM55. status is 0 on success. sequence is the one
+ * of the job that produced the result. decoded_len is the length of the body
+ * after inflating, or as received when it was not coded.
+ */
+typedef struct
+{
+    uint32_t session;
+    uint32_t status;
+    uint32_t op;
+    uint32_t sequence;
+    uint32_t decoded_len;
+    uint32_t reserved[3];
+    json_scan_summary_t json;
+} crypto_offload_result_t;
+
+/* Shared memory block. Both images define it as their only object in the
+ * shared memory section (CY_SECTION_SHAREDMEM), so it is placed at the same
+ * address on both cores; the magic and version guard against a mismatch.
+ */
+typedef struct
+{
+    volatile uint32_t host_magic;
+    volatile uint32_t host_version;
+    uint8_t host_pad[IPC_RING_CACHE_LINE - (2U * sizeof(uint32_t))];
+    volatile uint32_t worker_magic;
+    volatile uint32_t worker_version;
+    uint8_t worker_pad[IPC_RING_CACHE_LINE - (2U * sizeof(uint32_t))];
+
+    ipc_ring_t job_ring;
+    crypto_offload_job_t jobs[CRYPTO_OFFLOAD_JOB_SLOTS];
+
+    ipc_ring_t result_ring;
+    crypto_offload_result_t results[CRYPTO_OFFLOAD_RESULT_SLOTS];
+} crypto_offload_shm_t;
+
+#endif /* CRYPTO_OFFLOAD_IPC_H_ */
+
+
+/* [] END OF FILE */
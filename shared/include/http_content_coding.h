@@ -0,0 +1,175 @@
+/*******************************************************************************
+* File Name: http_content_coding.h
+*
+* Description: This file is the public interface of http_content_coding.c.
+*
+* Related Document: See README.md
+********************************************************************************
+* Copyright 2024-2025, Cypress Semiconductor Corporation (an Infineon company) or
+* an affiliate of Cypress Semiconductor Corporation.  All rights reserved.
+*
+* This software, including source code, documentation and related
+* materials ("Software") is owned by Cypress Semiconductor Corporation
+* or one of its affiliates ("Cypress") and is protected by and subject to
+* worldwide patent protection (United States and foreign),
+* United States copyright laws and international treaty provisions.
+* Therefore, you may use this Software only as provided in the license
+* agreement accompanying the software package from which you
+* obtained this Software ("EULA").
+* If no EULA applies, Cypress hereby grants you a personal, non-exclusive,
+* non-transferable license to copy, modify, and compile the Software
+* source code solely for use in connection with Cypress's
+* integrated circuit products.  Any reproduction, modification, translation,
+* compilation, or representation of this Software except as specified
+* above is prohibited without the express written permission of Cypress.
+*
+* Disclaimer: THIS SOFTWARE IS PROVIDED AS-IS, WITH NO WARRANTY OF ANY KIND,
+* EXPRESS OR IMPLIED, INCLUDING, BUT NOT LIMITED TO, NONINFRINGEMENT, IMPLIED
+* WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE. Cypress
+* reserves the right to make changes to the Software without notice. Cypress
+* does not assume any liability arising out of the application or use of the
+* Software or any product or circuit described in the Software. Cypress does
+* not authorize its products for use in any products where a malfunction or
+* failure of the Cypress product may reasonably be expected to result in
+* significant property damage, injury or death ("High Risk Product"). By
+* including Cypress's product in a High Risk Product, the manufacturer
+* of such system or application assumes all risk of such use and in doing
+* so agrees to indemnify Cypress against all liability.
+*******************************************************************************/
+
+/*******************************************************************************
+* Include guard
+*******************************************************************************/
+#ifndef HTTP_CONTENT_CODING_H_
+#define HTTP_CONTENT_CODING_H_
+
+/*******************************************************************************
+* Header Files
+*******************************************************************************/
+#include <stdint.h>
+#include <stdbool.h>
+#include "cy_result.h"
+
+/*******************************************************************************
+* Macros
+*******************************************************************************/
+
+/* Size of the history window of the inflater, as a power of two. Deflate
+ * refers back up to 32 KB, so streams from any server need 15. A smaller
+ * window saves RAM when the server is known to compress with one; a zlib
+ * stream that declares a larger window, or a gzip stream that refers back
+ * further, then fails to decode.
+ */
+#define HTTP_INFLATE_WINDOW_BITS                 (15U)
+#define HTTP_INFLATE_WINDOW_LENGTH    (1UL << HTTP_INFLATE_WINDOW_BITS)
+
+/* Value of Accept-Encoding sent by requests that ask for compression. */
+#define HTTP_ACCEPT_ENCODING_VALUE               "gzip, deflate"
+
+/* Size of the gzip header and trailer written by http_gzip_compress. */
+#define HTTP_GZIP_OVERHEAD                       (18U)
+
+/* Internal sizes of the Huffman decoding tables. */
+#define HTTP_INFLATE_MAX_CODE_BITS               (15U)
+#define HTTP_INFLATE_FAST_BITS                   (9U)
+#define HTTP_INFLATE_MAX_LITLEN_CODES            (288U)
+#define HTTP_INFLATE_MAX_DIST_CODES              (32U)
+
+/*******************************************************************************
+* Enumerations
+*******************************************************************************/
+
+/* Content codings understood by the client. */
+typedef enum
+{
+    HTTP_CODING_IDENTITY,
+    HTTP_CODING_GZIP,
+    HTTP_CODING_DEFLATE,
+    HTTP_CODING_UNSUPPORTED,
+} http_coding_t;
+
+/* Result of a call to http_inflate. */
+typedef enum
+{
+    HTTP_INFLATE_MORE,
+    HTTP_INFLATE_OUTPUT_FULL,
+    HTTP_INFLATE_DONE,
+    HTTP_INFLATE_ERROR,
+} http_inflate_status_t;
+
+/*******************************************************************************
+* Data Types
+*******************************************************************************/
+
+/* Canonical Huffman code. Codes of up to HTTP_INFLATE_FAST_BITS bits are
+ * decoded with one lookup in fast, longer ones from count and symbol.
+ */
+typedef struct
+{
+    uint16_t count[HTTP_INFLATE_MAX_CODE_BITS + 1U];
+    uint16_t symbol[HTTP_INFLATE_MAX_LITLEN_CODES];
+    uint16_t fast[1U << HTTP_INFLATE_FAST_BITS];
+} http_inflate_huffman_t;
+
+/* Streaming inflater. It decodes a gzip, zlib or raw deflate stream that
+ * arrives in pieces of any size into output buffers of any size, keeping
+ * only the history window between calls.
+ */
+typedef struct
+{
+    uint8_t state;
+    uint8_t wrapper;
+    uint8_t gzip_flags;
+    bool final_block;
+
+    /* Input bits not yet decoded, least significant first. */
+    uint64_t bit_buffer;
+    uint32_t bit_count;
+
+    /* Stored block length, match length or header bytes left to skip. */
+    uint32_t remaining;
+    uint32_t distance;
+
+    /* Dynamic block header being read. */
+    uint32_t num_litlen;
+    uint32_t num_dist;
+    uint32_t num_codelen;
+    uint32_t index;
+    uint8_t lengths[HTTP_INFLATE_MAX_LITLEN_CODES +
+                    HTTP_INFLATE_MAX_DIST_CODES];
+
+    /* CRC-32 (gzip) or Adler-32 (zlib) of the output so far. */
+    uint32_t check;
+    uint32_t total_out;
+
+    http_inflate_huffman_t litlen;
+    http_inflate_huffman_t dist;
+
+    /* Buffers of the current call. */
+    const uint8_t *next_in;
+    uint32_t avail_in;
+    uint8_t *next_out;
+    uint32_t avail_out;
+    uint8_t *check_start;
+
+    uint32_t window_pos;
+    uint8_t window[HTTP_INFLATE_WINDOW_LENGTH];
+} http_inflate_t;
+
+/*******************************************************************************
+* Function Prototypes
+*******************************************************************************/
+http_coding_t http_coding_parse(const char *value, uint32_t value_len);
+void http_inflate_init(http_inflate_t *inflater, http_coding_t coding);
+http_inflate_status_t http_inflate(http_inflate_t *inflater,
+                                   const uint8_t *in, uint32_t in_len,
+                                   uint32_t *consumed, uint8_t *out,
+                                   uint32_t out_len, uint32_t *produced);
+cy_rslt_t http_gzip_compress(const uint8_t *in, uint32_t in_len,
+                             uint8_t *out, uint32_t out_size,
+                             uint32_t *out_len);
+
+#endif /* HTTP_CONTENT_CODING_H_ */
+
+
+/* [] END OF FILE */
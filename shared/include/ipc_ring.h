@@ -0,0 +1,204 @@
+/*******************************************************************************
+* File Name: ipc_ring.h
+*
+* Description: This file contains a single-producer single-consumer ring of
+* fixed-size slots in memory shared by the CM33 and CM55 cores. Each index is
+* written by one core only and sits in its own cache line, so the data cache
+* of the CM55 can be maintained by cleaning what a core wrote and invalidating
+* what it is about to read.
+*
+* Related Document: See README.md
+********************************************************************************
+* Copyright 2024-2025, Cypress Semiconductor Corporation (an Infineon company) or
+* an affiliate of Cypress Semiconductor Corporation.  All rights reserved.
+*
+* This software, including source code, documentation and related
+* materials ("Software") is owned by Cypress Semiconductor Corporation
+* or one of its affiliates ("Cypress") and is protected by and subject to
+* worldwide patent protection (United States and foreign),
+* United States copyright laws and international treaty provisions.
+* Therefore, you may use this Software only as provided in the license
+* agreement accompanying the software package from which you
+* obtained this Software ("EULA").
+* If no EULA applies, Cypress hereby grants you a personal, non-exclusive,
+* non-transferable license to copy, modify, and compile the Software
+* source code solely for use in connection with Cypress's
+* integrated circuit products.  Any reproduction, modification, translation,
+* compilation, or representation of this Software except as specified
+* above is prohibited without the express written permission of Cypress.
+*
+* Disclaimer: THIS SOFTWARE IS PROVIDED AS-IS, WITH NO WARRANTY OF ANY KIND,
+* EXPRESS OR IMPLIED, INCLUDING, BUT NOT LIMITED TO, NONINFRINGEMENT, IMPLIED
+* WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE. Cypress
+* reserves the right to make changes to the Software without notice. Cypress
+* does not assume any liability arising out of the application or use of the
+* Software or any product or circuit described in the Software. Cypress does
+* not authorize its products for use in any products where a malfunction or
+* failure of the Cypress product may reasonably be expected to result in
+* significant property damage, injury or death ("High Risk Product"). By
+* including Cypress's product in a High Risk Product, the manufacturer
+* of such system or application assumes all risk of such use and in doing
+* so agrees to indemnify Cypress against all liability.
+*******************************************************************************/
+
+/*******************************************************************************
+* Include guard
+*******************************************************************************/
+#ifndef IPC_RING_H_
+#define IPC_RING_H_
+
+/*******************************************************************************
+* Header Files
+*******************************************************************************/
+#include <stdint.h>
+#include <stddef.h>
+#include "cy_device_headers.h"
+
+/*******************************************************************************
+* Macros
+*******************************************************************************/
+
+/* Data cache line size of the Cortex-M55. Shared structures are aligned to
+ * and padded to this size.
+ */
+#define IPC_RING_CACHE_LINE                      (32U)
+
+/* Rounds a size up to a whole number of cache lines. */
+#define IPC_RING_ALIGN_UP(size)                                                \
+    ((((size) + IPC_RING_CACHE_LINE - 1U) / IPC_RING_CACHE_LINE) *             \
+     IPC_RING_CACHE_LINE)
+
+/* Cache maintenance of shared memory. Only the core with a data cache has
+ * anything to do.
+ */
+#if defined(__DCACHE_PRESENT) && (__DCACHE_PRESENT == 1U)
+#define IPC_RING_CACHE_CLEAN(addr, size)                                       \
+    SCB_CleanDCache_by_Addr((void *)(addr), (int32_t)(size))
+#define IPC_RING_CACHE_INVALIDATE(addr, size)                                  \
+    SCB_InvalidateDCache_by_Addr((void *)(addr), (int32_t)(size))
+#else
+#define IPC_RING_CACHE_CLEAN(addr, size)         ((void)(addr), (void)(size))
+#define IPC_RING_CACHE_INVALIDATE(addr, size)    ((void)(addr), (void)(size))
+#endif
+
+/*******************************************************************************
+* Data Types
+*******************************************************************************/
+
+/* Indexes of a ring. head and slot_count are written by the producer and
+ * tail by the consumer. The indexes run freely and wrap at 2^32; slot_count
+ * must be a power of two.
+ */
+typedef struct
+{
+    volatile uint32_t head;
+    volatile uint32_t slot_count;
+    uint8_t head_pad[IPC_RING_CACHE_LINE - (2U * sizeof(uint32_t))];
+    volatile uint32_t tail;
+    uint8_t tail_pad[IPC_RING_CACHE_LINE - sizeof(uint32_t)];
+} ipc_ring_t;
+
+/*******************************************************************************
+* Function Definitions
+*******************************************************************************/
+
+/*******************************************************************************
+* Function Name: ipc_ring_init
+********************************************************************************
+* Summary:
+*  Empties the ring. Called by the producer before the consumer starts.
+*
+*******************************************************************************/
+static inline void ipc_ring_init(ipc_ring_t *ring, uint32_t slot_count)
+{
+    ring->head = 0U;
+    ring->tail = 0U;
+    ring->slot_count = slot_count;
+    __DMB();
+    IPC_RING_CACHE_CLEAN(ring, sizeof(*ring));
+}
+
+/*******************************************************************************
+* Function Name: ipc_ring_reserve
+********************************************************************************
+* Summary:
+*  Returns the next free slot for the producer to fill, or NULL if the ring
+*  is full.
+*
+*******************************************************************************/
+static inline void *ipc_ring_reserve(ipc_ring_t *ring, void *slots,
+                                     uint32_t slot_size)
+{
+    void *slot = NULL;
+
+    IPC_RING_CACHE_INVALIDATE(&ring->tail, IPC_RING_CACHE_LINE);
+
+    if ((ring->head - ring->tail) < ring->slot_count)
+    {
+        slot = (uint8_t *) slots +
+               ((ring->head & (ring->slot_count - 1U)) * slot_size);
+    }
+
+    return slot;
+}
+
+/*******************************************************************************
+* Function Name: ipc_ring_commit
+********************************************************************************
+* Summary:
+*  Publishes the slot returned by ipc_ring_reserve to the consumer.
+*
+*******************************************************************************/
+static inline void ipc_ring_commit(ipc_ring_t *ring, void *slot,
+                                   uint32_t slot_size)
+{
+    IPC_RING_CACHE_CLEAN(slot, slot_size);
+    __DMB();
+    ring->head = ring->head + 1U;
+    IPC_RING_CACHE_CLEAN(&ring->head, IPC_RING_CACHE_LINE);
+}
+
+/*******************************************************************************
+* Function Name: ipc_ring_peek
+********************************************************************************
+* Summary:
+*  Returns the oldest filled slot for the consumer, or NULL if the ring is
+*  empty.
+*
+*******************************************************************************/
+static inline void *ipc_ring_peek(ipc_ring_t *ring, void *slots,
+                                  uint32_t slot_size)
+{
+    void *slot = NULL;
+
+    IPC_RING_CACHE_INVALIDATE(&ring->head, IPC_RING_CACHE_LINE);
+
+    if (ring->head != ring->tail)
+    {
+        __DMB();
+        slot = (uint8_t *) slots +
+               ((ring->tail & (ring->slot_count - 1U)) * slot_size);
+        IPC_RING_CACHE_INVALIDATE(slot, slot_size);
+    }
+
+    return slot;
+}
+
+/*******************************************************************************
+* Function Name: ipc_ring_release
+********************************************************************************
+* Summary:
+*  Returns the slot returned by ipc_ring_peek to the producer.
+*
+*******************************************************************************/
+static inline void ipc_ring_release(ipc_ring_t *ring)
+{
+    __DMB();
+    ring->tail = ring->tail + 1U;
+    IPC_RING_CACHE_CLEAN(&ring->tail, IPC_RING_CACHE_LINE);
+}
+
+#endif /* IPC_RING_H_ */
+
+
+/* [] END OF FILE */
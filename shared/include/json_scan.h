@@ -0,0 +1,114 @@
+/*******************************************************************************
+* File Name: json_scan.h
+*
+* Description: This file is the public interface of json_scan.c.
+*
+* Related Document: See README.md
+********************************************************************************
+* Copyright 2024-2025, Cypress Semiconductor Corporation (an Infineon company) or
+* an affiliate of Cypress Semiconductor Corporation.  All rights reserved.
+*
+* This software, including source code, documentation and related
+* materials ("Software") is owned by Cypress Semiconductor Corporation
+* or one of its affiliates ("Cypress") and is protected by and subject to
+* worldwide patent protection (United States and foreign),
+* United States copyright laws and international treaty provisions.
+* Therefore, you may use this Software only as provided in the license
+* agreement accompanying the software package from which you
+* obtained this Software ("EULA").
+* If no EULA applies, Cypress hereby grants you a personal, non-exclusive,
+* non-transferable license to copy, modify, and compile the Software
+* source code solely for use in connection with Cypress's
+* integrated circuit products.  Any reproduction, modification, translation,
+* compilation, or representation of this Software except as specified
+* above is prohibited without the express written permission of Cypress.
+*
+* Disclaimer: THIS SOFTWARE IS PROVIDED AS-IS, WITH NO WARRANTY OF ANY KIND,
+* EXPRESS OR IMPLIED, INCLUDING, BUT NOT LIMITED TO, NONINFRINGEMENT, IMPLIED
+* WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE. Cypress
+* reserves the right to make changes to the Software without notice. Cypress
+* does not assume any liability arising out of the application or use of the
+* Software or any product or circuit described in the Software. Cypress does
+* not authorize its products for use in any products where a malfunction or
+* failure of the Cypress product may reasonably be expected to result in
+* significant property damage, injury or death ("High Risk Product"). By
+* including Cypress's product in a High Risk Product, the manufacturer
+* of such system or application assumes all risk of such use and in doing
+* so agrees to indemnify Cypress against all liability.
+*******************************************************************************/
+
+/*******************************************************************************
+* Include guard
+*******************************************************************************/
+#ifndef JSON_SCAN_H_
+#define JSON_SCAN_H_
+
+/*******************************************************************************
+* Header Files
+*******************************************************************************/
+#include <stdint.h>
+#include <stdbool.h>
+
+/*******************************************************************************
+* Macros
+*******************************************************************************/
+
+/* Deepest nesting of objects and arrays accepted. */
+#define JSON_SCAN_MAX_DEPTH                      (32U)
+
+/*******************************************************************************
+* Data Types
+*******************************************************************************/
+
+/* Result of scanning. */
+typedef enum
+{
+    JSON_SCAN_MORE,
+    JSON_SCAN_COMPLETE,
+    JSON_SCAN_INVALID,
+} json_scan_status_t;
+
+/* Structure of the scanned document. Fixed-size so that it can be returned
+ * through shared memory.
+ */
+typedef struct
+{
+    uint32_t status;
+    uint32_t bytes;
+    uint32_t error_offset;
+    uint32_t values;
+    uint32_t keys;
+    uint32_t objects;
+    uint32_t arrays;
+    uint32_t max_depth;
+} json_scan_summary_t;
+
+/* Incremental JSON scanner. It checks the syntax of a document that arrives
+ * in pieces of any size and counts its values, without building a tree or
+ * keeping any of the text.
+ */
+typedef struct
+{
+    uint8_t token;
+    uint8_t expect;
+    uint8_t depth;
+    uint8_t literal_pos;
+    uint8_t unicode_left;
+    bool in_key;
+    const char *literal;
+    uint32_t nesting;
+    json_scan_summary_t summary;
+} json_scan_t;
+
+/*******************************************************************************
+* Function Prototypes
+*******************************************************************************/
+void json_scan_init(json_scan_t *scan);
+json_scan_status_t json_scan_feed(json_scan_t *scan, const uint8_t *data,
+                                  uint32_t len);
+json_scan_status_t json_scan_finish(json_scan_t *scan);
+
+#endif /* JSON_SCAN_H_ */
+
+
+/* [] END OF FILE */
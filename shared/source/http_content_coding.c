@@ -0,0 +1,1590 @@
+/*******************************************************************************
+* File Name: http_content_coding.c
+*
+* Description: This file contains the content codings of HTTP bodies: a
+* streaming inflater for gzip and deflate encoded responses, which keeps only
+* its history window between pieces of the body, and a gzip compressor for
+* request bodies. The compressor emits one block with the fixed Huffman codes
+* of RFC 1951, which needs no code tables in the output and suits the short
+* text bodies of this application. It is built into both the CM33 and the
+* CM55 images; the CM55 inflates the bodies it processes (body_pipeline.c).
+*
+* Related Document: See README.md
+********************************************************************************
+* Copyright 2024-2025, Cypress Semiconductor Corporation (an Infineon company) or
+* an affiliate of Cypress Semiconductor Corporation.  All rights reserved.
+*
+* This software, including source code, documentation and related
+* materials ("Software") is owned by Cypress Semiconductor Corporation
+* or one of its affiliates ("Cypress") and is protected by and subject to
+* worldwide patent protection (United States and foreign),
+* United States copyright laws and international treaty provisions.
+* Therefore, you may use this Software only as provided in the license
+* agreement accompanying the software package from which you
+* obtained this Software ("EULA").
+* If no EULA applies, Cypress hereby grants you a personal, non-exclusive,
+* non-transferable license to copy, modify, and compile the Software
+* source code solely for use in connection with Cypress's
+* integrated circuit products.  Any reproduction, modification, translation,
+* compilation, or representation of this Software except as specified
+* above is prohibited without the express written permission of Cypress.
+*
+* Disclaimer: THIS SOFTWARE IS PROVIDED AS-IS, WITH NO WARRANTY OF ANY KIND,
+* EXPRESS OR IMPLIED, INCLUDING, BUT NOT LIMITED TO, NONINFRINGEMENT, IMPLIED
+* WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE. Cypress
+* reserves the right to make changes to the Software without notice. Cypress
+* does not assume any liability arising out of the application or use of the
+* Software or any product or circuit described in the Software. Cypress does
+* not authorize its products for use in any products where a malfunction or
+* failure of the Cypress product may reasonably be expected to result in
+* significant property damage, injury or death ("High Risk Product"). By
+* including Cypress's product in a High Risk Product, the manufacturer
+* of such system or application assumes all risk of such use and in doing
+* so agrees to indemnify Cypress against all liability.
+*******************************************************************************/
+
+/*******************************************************************************
+* Header Files
+*******************************************************************************/
+#include "http_content_coding.h"
+
+/* Standard C header files */
+#include <string.h>
+
+/*******************************************************************************
+* Macros
+*******************************************************************************/
+#define GZIP_ID1                                     (0x1FU)
+#define GZIP_ID2                                     (0x8BU)
+#define GZIP_CM_DEFLATE                              (8U)
+#define GZIP_HEADER_LENGTH                           (10U)
+#define GZIP_FLAG_HCRC                               (0x02U)
+#define GZIP_FLAG_EXTRA                              (0x04U)
+#define GZIP_FLAG_NAME                               (0x08U)
+#define GZIP_FLAG_COMMENT                            (0x10U)
+#define GZIP_FLAG_RESERVED                           (0xE0U)
+#define GZIP_OS_UNKNOWN                              (0xFFU)
+
+#define ZLIB_CM_DEFLATE                              (8U)
+#define ZLIB_CINFO_OFFSET                            (8U)
+#define ZLIB_FLAG_DICT                               (0x20U)
+#define ZLIB_HEADER_CHECK                            (31U)
+
+#define CRC32_INIT                                   (0xFFFFFFFFU)
+#define ADLER32_INIT                                 (1U)
+#define ADLER32_MOD                                  (65521U)
+
+#define WRAPPER_RAW                                  (0U)
+#define WRAPPER_ZLIB                                 (1U)
+#define WRAPPER_GZIP                                 (2U)
+
+/* The bit buffer is refilled up to more than this many bits, enough for a
+ * length and a distance code with their extra bits (48 bits).
+ */
+#define BIT_REFILL_LIMIT                             (56U)
+
+#define BLOCK_STORED                                 (0U)
+#define BLOCK_FIXED                                  (1U)
+#define BLOCK_DYNAMIC                                (2U)
+
+#define END_OF_BLOCK                                 (256U)
+#define FIRST_LENGTH_CODE                            (257U)
+#define LENGTH_CODES                                 (29U)
+#define DIST_CODES                                   (30U)
+#define MAX_LITLEN_CODES_USED                        (286U)
+#define CODELEN_CODES                                (19U)
+#define CODELEN_REPEAT_PREVIOUS                      (16U)
+#define CODELEN_REPEAT_ZERO_SHORT                    (17U)
+
+#define FIXED_LITLEN_8_BITS_END                      (144U)
+#define FIXED_LITLEN_9_BITS_END                      (256U)
+#define FIXED_LITLEN_7_BITS_END                      (280U)
+#define FIXED_DIST_BITS                              (5U)
+
+#define DECODE_NEED_BITS                             (-1)
+#define DECODE_BAD_CODE                              (-2)
+
+#define FAST_SYMBOL_MASK             ((1U << HTTP_INFLATE_FAST_BITS) - 1U)
+#define WINDOW_MASK                  (HTTP_INFLATE_WINDOW_LENGTH - 1U)
+
+#define MIN_MATCH                                    (3U)
+#define MAX_MATCH                                    (258U)
+
+/* Compressor history. Matches are searched up to DEFLATE_MAX_CHAIN earlier
+ * positions with the same hash, no further back than DEFLATE_WINDOW_LENGTH.
+ */
+#define DEFLATE_HASH_BITS                            (10U)
+#define DEFLATE_WINDOW_LENGTH                        (4096U)
+#define DEFLATE_MAX_CHAIN                            (16U)
+#define DEFLATE_HASH_MULTIPLIER                      (0x9E3779B1U)
+
+/*******************************************************************************
+* Enumerations
+*******************************************************************************/
+
+/* States of the inflater. */
+typedef enum
+{
+    INFLATE_STATE_GZIP_HEADER,
+    INFLATE_STATE_GZIP_FIELDS,
+    INFLATE_STATE_ZLIB_HEADER,
+    INFLATE_STATE_BLOCK_HEADER,
+    INFLATE_STATE_STORED_HEADER,
+    INFLATE_STATE_STORED_COPY,
+    INFLATE_STATE_DYNAMIC_HEADER,
+    INFLATE_STATE_CODELEN_LENGTHS,
+    INFLATE_STATE_CODE_LENGTHS,
+    INFLATE_STATE_CODES,
+    INFLATE_STATE_COPY,
+    INFLATE_STATE_TRAILER,
+    INFLATE_STATE_DONE,
+    INFLATE_STATE_ERROR,
+} inflate_state_t;
+
+/*******************************************************************************
+* Data Types
+*******************************************************************************/
+
+/* Output of the compressor. */
+typedef struct
+{
+    uint8_t *out;
+    uint32_t size;
+    uint32_t len;
+    uint32_t bits;
+    uint32_t bit_count;
+    bool overflow;
+} bit_writer_t;
+
+/*******************************************************************************
+* Global Variables
+********************************************************************************/
+static const uint16_t length_base[LENGTH_CODES] =
+{
+    3, 4, 5, 6, 7, 8, 9, 10, 11, 13, 15, 17, 19, 23, 27, 31,
+    35, 43, 51, 59, 67, 83, 99, 115, 131, 163, 195, 227, 258
+};
+
+static const uint8_t length_extra[LENGTH_CODES] =
+{
+    0, 0, 0, 0, 0, 0, 0, 0, 1, 1, 1, 1, 2, 2, 2, 2,
+    3, 3, 3, 3, 4, 4, 4, 4, 5, 5, 5, 5, 0
+};
+
+static const uint16_t dist_base[DIST_CODES] =
+{
+    1, 2, 3, 4, 5, 7, 9, 13, 17, 25, 33, 49, 65, 97, 129, 193,
+    257, 385, 513, 769, 1025, 1537, 2049, 3073, 4097, 6145,
+    8193, 12289, 16385, 24577
+};
+
+static const uint8_t dist_extra[DIST_CODES] =
+{
+    0, 0, 0, 0, 1, 1, 2, 2, 3, 3, 4, 4, 5, 5, 6, 6,
+    7, 7, 8, 8, 9, 9, 10, 10, 11, 11, 12, 12, 13, 13
+};
+
+/* Order in which the lengths of the code length code are sent. */
+static const uint8_t codelen_order[CODELEN_CODES] =
+{
+    16, 17, 18, 0, 8, 7, 9, 6, 10, 5, 11, 4, 12, 3, 13, 2, 14, 1, 15
+};
+
+/* CRC-32 of each 4 bit value, for a table of 64 bytes instead of 1 KB. */
+static const uint32_t crc32_nibble[16] =
+{
+    0x00000000U, 0x1DB71064U, 0x3B6E20C8U, 0x26D930ACU,
+    0x76DC4190U, 0x6B6B51F4U, 0x4DB26158U, 0x5005713CU,
+    0xEDB88320U, 0xF00F9344U, 0xD6D6A3E8U, 0xCB61B38CU,
+    0x9B64C2B0U, 0x86D3D2D4U, 0xA00AE278U, 0xBDBDF21CU
+};
+
+/* Match finder of the compressor. deflate_head holds the last position + 1
+ * of each hash, deflate_prev the distance from a position to the previous
+ * one with the same hash.
+ */
+static uint32_t deflate_head[1U << DEFLATE_HASH_BITS];
+static uint16_t deflate_prev[DEFLATE_WINDOW_LENGTH];
+
+/*******************************************************************************
+* Function Definitions
+*******************************************************************************/
+
+/*******************************************************************************
+* Function Name: to_lower
+********************************************************************************
+* Summary:
+*  Returns the lower case of an ASCII character.
+*
+*******************************************************************************/
+static char to_lower(char c)
+{
+    return ((c >= 'A') && (c <= 'Z')) ? (char)(c - 'A' + 'a') : c;
+}
+
+/*******************************************************************************
+* Function Name: token_equals
+********************************************************************************
+* Summary:
+*  Compares a token case-insensitively with a lower case string.
+*
+*******************************************************************************/
+static bool token_equals(const char *token, uint32_t len, const char *lower)
+{
+    uint32_t i;
+
+    for (i = 0U; (i < len) && ('\0' != lower[i]); i++)
+    {
+        if (to_lower(token[i]) != lower[i])
+        {
+            return false;
+        }
+    }
+
+    return ((i == len) && ('\0' == lower[i]));
+}
+
+/*******************************************************************************
+* Function Name: http_coding_parse
+********************************************************************************
+* Summary:
+*  Returns the content coding named by a Content-Encoding value. Only a
+*  single coding is supported; a list of codings is reported as
+*  HTTP_CODING_UNSUPPORTED.
+*
+* Parameters:
+*  value     - Header value, may be NULL if the header is absent
+*  value_len - Length of the value
+*
+* Return:
+*  http_coding_t: Coding of the body.
+*
+*******************************************************************************/
+http_coding_t http_coding_parse(const char *value, uint32_t value_len)
+{
+    http_coding_t coding = HTTP_CODING_UNSUPPORTED;
+
+    if (NULL == value)
+    {
+        return HTTP_CODING_IDENTITY;
+    }
+
+    while ((value_len > 0U) && ((' ' == *value) || ('\t' == *value)))
+    {
+        value++;
+        value_len--;
+    }
+
+    while ((value_len > 0U) &&
+           ((' ' == value[value_len - 1U]) || ('\t' == value[value_len - 1U])))
+    {
+        value_len--;
+    }
+
+    if ((0U == value_len) || token_equals(value, value_len, "identity"))
+    {
+        coding = HTTP_CODING_IDENTITY;
+    }
+    else if (token_equals(value, value_len, "gzip") ||
+             token_equals(value, value_len, "x-gzip"))
+    {
+        coding = HTTP_CODING_GZIP;
+    }
+    else if (token_equals(value, value_len, "deflate"))
+    {
+        coding = HTTP_CODING_DEFLATE;
+    }
+    else
+    {
+        /* Unknown coding or a list of codings. */
+    }
+
+    return coding;
+}
+
+/*******************************************************************************
+* Function Name: crc32_update
+********************************************************************************
+* Summary:
+*  Adds bytes to a CRC-32 (gzip) that was started with CRC32_INIT.
+*
+*******************************************************************************/
+static uint32_t crc32_update(uint32_t crc, const uint8_t *data, uint32_t len)
+{
+    for (uint32_t i = 0U; i < len; i++)
+    {
+        crc ^= data[i];
+        crc = (crc >> 4) ^ crc32_nibble[crc & 0x0FU];
+        crc = (crc >> 4) ^ crc32_nibble[crc & 0x0FU];
+    }
+
+    return crc;
+}
+
+/*******************************************************************************
+* Function Name: adler32_update
+********************************************************************************
+* Summary:
+*  Adds bytes to an Adler-32 (zlib) that was started with ADLER32_INIT.
+*
+*******************************************************************************/
+static uint32_t adler32_update(uint32_t adler, const uint8_t *data,
+                               uint32_t len)
+{
+    uint32_t a = adler & 0xFFFFU;
+    uint32_t b = adler >> 16;
+
+    for (uint32_t i = 0U; i < len; i++)
+    {
+        a += data[i];
+        a = (a >= ADLER32_MOD) ? (a - ADLER32_MOD) : a;
+        b += a;
+        b = (b >= ADLER32_MOD) ? (b - ADLER32_MOD) : b;
+    }
+
+    return (b << 16) | a;
+}
+
+/*******************************************************************************
+* Function Name: reverse_bits
+********************************************************************************
+* Summary:
+*  Reverses the order of the low len bits of a Huffman code. Deflate packs
+*  codes starting from their most significant bit.
+*
+*******************************************************************************/
+static uint32_t reverse_bits(uint32_t code, uint32_t len)
+{
+    uint32_t reversed = 0U;
+
+    for (uint32_t i = 0U; i < len; i++)
+    {
+        reversed = (reversed << 1) | (code & 1U);
+        code >>= 1;
+    }
+
+    return reversed;
+}
+
+/*******************************************************************************
+* Function Name: build_huffman
+********************************************************************************
+* Summary:
+*  Builds the decoding tables of a canonical Huffman code from the code
+*  length of each symbol.
+*
+* Return:
+*  bool: false if the lengths describe more codes than can exist.
+*
+*******************************************************************************/
+static bool build_huffman(http_inflate_huffman_t *huffman,
+                          const uint8_t *lengths, uint32_t count)
+{
+    uint16_t offsets[HTTP_INFLATE_MAX_CODE_BITS + 1U];
+    int32_t left = 1;
+    uint32_t code = 0U;
+    uint32_t index = 0U;
+
+    (void) memset(huffman->count, 0, sizeof(huffman->count));
+    (void) memset(huffman->fast, 0, sizeof(huffman->fast));
+
+    for (uint32_t i = 0U; i < count; i++)
+    {
+        huffman->count[lengths[i]]++;
+    }
+
+    for (uint32_t len = 1U; len <= HTTP_INFLATE_MAX_CODE_BITS; len++)
+    {
+        left = (left * 2) - (int32_t) huffman->count[len];
+
+        if (left < 0)
+        {
+            return false;
+        }
+    }
+
+    offsets[1] = 0U;
+    for (uint32_t len = 1U; len < HTTP_INFLATE_MAX_CODE_BITS; len++)
+    {
+        offsets[len + 1U] = offsets[len] + huffman->count[len];
+    }
+
+    for (uint32_t i = 0U; i < count; i++)
+    {
+        if (0U != lengths[i])
+        {
+            huffman->symbol[offsets[lengths[i]]++] = (uint16_t) i;
+        }
+    }
+
+    /* Codes are assigned in symbol order within each length, so the short
+     * ones can be listed in the lookup table from the sorted symbols.
+     */
+    for (uint32_t len = 1U; len <= HTTP_INFLATE_FAST_BITS; len++)
+    {
+        for (uint32_t i = 0U; i < huffman->count[len]; i++)
+        {
+            uint16_t entry = (uint16_t)((len << HTTP_INFLATE_FAST_BITS) |
+                                        huffman->symbol[index]);
+
+            for (uint32_t fill = reverse_bits(code, len);
+                 fill < (1U << HTTP_INFLATE_FAST_BITS); fill += (1U << len))
+            {
+                huffman->fast[fill] = entry;
+            }
+            index++;
+            code++;
+        }
+        code <<= 1;
+    }
+
+    return true;
+}
+
+/*******************************************************************************
+* Function Name: decode_symbol
+********************************************************************************
+* Summary:
+*  Decodes one symbol from a copy of the bit buffer. The copy is only
+*  advanced when the whole code is available.
+*
+* Parameters:
+*  huffman - Code to decode with
+*  bits    - Copy of the bit buffer
+*  avail   - Number of valid bits in the copy
+*
+* Return:
+*  int32_t: The symbol, DECODE_NEED_BITS if the code continues past the
+*  available bits, or DECODE_BAD_CODE if the bits match no code.
+*
+*******************************************************************************/
+static int32_t decode_symbol(const http_inflate_huffman_t *huffman,
+                             uint64_t *bits, uint32_t *avail)
+{
+    uint32_t entry = huffman->fast[*bits & FAST_SYMBOL_MASK];
+    uint32_t len = entry >> HTTP_INFLATE_FAST_BITS;
+    uint64_t walk = *bits;
+    int32_t code = 0;
+    int32_t first = 0;
+    int32_t index = 0;
+    int32_t count;
+
+    if (0U != entry)
+    {
+        if (len > *avail)
+        {
+            return DECODE_NEED_BITS;
+        }
+
+        *bits >>= len;
+        *avail -= len;
+
+        return (int32_t)(entry & FAST_SYMBOL_MASK);
+    }
+
+    for (len = 1U; len <= HTTP_INFLATE_MAX_CODE_BITS; len++)
+    {
+        if (len > *avail)
+        {
+            return DECODE_NEED_BITS;
+        }
+
+        code |= (int32_t)(walk & 1U);
+        walk >>= 1;
+        count = (int32_t) huffman->count[len];
+
+        if ((code - count) < first)
+        {
+            *bits = walk;
+            *avail -= len;
+
+            return (int32_t) huffman->symbol[index + (code - first)];
+        }
+
+        index += count;
+        first = (first + count) << 1;
+        code <<= 1;
+    }
+
+    return DECODE_BAD_CODE;
+}
+
+/*******************************************************************************
+* Function Name: take_bits
+********************************************************************************
+* Summary:
+*  Removes the low n bits (n <= 32) from a bit buffer and returns them.
+*
+*******************************************************************************/
+static uint32_t take_bits(uint64_t *bits, uint32_t *avail, uint32_t n)
+{
+    uint32_t value = (uint32_t)(*bits & ((1ULL << n) - 1U));
+
+    *bits >>= n;
+    *avail -= n;
+
+    return value;
+}
+
+/*******************************************************************************
+* Function Name: refill
+********************************************************************************
+* Summary:
+*  Moves input bytes into the bit buffer until it holds more than
+*  BIT_REFILL_LIMIT bits or the input runs out.
+*
+*******************************************************************************/
+static void refill(http_inflate_t *inflater)
+{
+    while ((inflater->bit_count <= BIT_REFILL_LIMIT) &&
+           (inflater->avail_in > 0U))
+    {
+        inflater->bit_buffer |= ((uint64_t) *inflater->next_in) <<
+                                inflater->bit_count;
+        inflater->bit_count += 8U;
+        inflater->next_in++;
+        inflater->avail_in--;
+    }
+}
+
+/*******************************************************************************
+* Function Name: put_byte
+********************************************************************************
+* Summary:
+*  Writes one decoded byte to the output and the history window.
+*
+*******************************************************************************/
+static void put_byte(http_inflate_t *inflater, uint8_t value)
+{
+    inflater->window[inflater->window_pos] = value;
+    inflater->window_pos = (inflater->window_pos + 1U) & WINDOW_MASK;
+    *inflater->next_out = value;
+    inflater->next_out++;
+    inflater->avail_out--;
+    inflater->total_out++;
+}
+
+/*******************************************************************************
+* Function Name: update_check
+********************************************************************************
+* Summary:
+*  Adds the output written since the last update to the checksum of the
+*  wrapper.
+*
+*******************************************************************************/
+static void update_check(http_inflate_t *inflater)
+{
+    uint32_t len = (uint32_t)(inflater->next_out - inflater->check_start);
+
+    if (WRAPPER_GZIP == inflater->wrapper)
+    {
+        inflater->check = crc32_update(inflater->check, inflater->check_start,
+                                       len);
+    }
+    else if (WRAPPER_ZLIB == inflater->wrapper)
+    {
+        inflater->check = adler32_update(inflater->check,
+                                         inflater->check_start, len);
+    }
+    else
+    {
+        /* Raw deflate has no checksum. */
+    }
+
+    inflater->check_start = inflater->next_out;
+}
+
+/*******************************************************************************
+* Function Name: end_block
+********************************************************************************
+* Summary:
+*  Moves on to the next block, or to the trailer after the last block.
+*
+*******************************************************************************/
+static void end_block(http_inflate_t *inflater)
+{
+    if (!inflater->final_block)
+    {
+        inflater->state = INFLATE_STATE_BLOCK_HEADER;
+    }
+    else
+    {
+        /* The trailer starts on a byte boundary. */
+        inflater->bit_buffer >>= (inflater->bit_count & 7U);
+        inflater->bit_count &= ~7U;
+        inflater->remaining = 0U;
+        inflater->state = (WRAPPER_RAW == inflater->wrapper) ?
+                INFLATE_STATE_DONE : INFLATE_STATE_TRAILER;
+    }
+}
+
+/*******************************************************************************
+* Function Name: build_fixed_codes
+********************************************************************************
+* Summary:
+*  Builds the fixed literal/length and distance codes of RFC 1951.
+*
+*******************************************************************************/
+static void build_fixed_codes(http_inflate_t *inflater)
+{
+    uint32_t i;
+
+    for (i = 0U; i < FIXED_LITLEN_8_BITS_END; i++)
+    {
+        inflater->lengths[i] = 8U;
+    }
+    for (; i < FIXED_LITLEN_9_BITS_END; i++)
+    {
+        inflater->lengths[i] = 9U;
+    }
+    for (; i < FIXED_LITLEN_7_BITS_END; i++)
+    {
+        inflater->lengths[i] = 7U;
+    }
+    for (; i < HTTP_INFLATE_MAX_LITLEN_CODES; i++)
+    {
+        inflater->lengths[i] = 8U;
+    }
+    (void) build_huffman(&inflater->litlen, inflater->lengths,
+                         HTTP_INFLATE_MAX_LITLEN_CODES);
+
+    (void) memset(inflater->lengths, FIXED_DIST_BITS,
+                  HTTP_INFLATE_MAX_DIST_CODES);
+    (void) build_huffman(&inflater->dist, inflater->lengths,
+                         HTTP_INFLATE_MAX_DIST_CODES);
+}
+
+/*******************************************************************************
+* Function Name: read_header
+********************************************************************************
+* Summary:
+*  Runs one step of the gzip or zlib header states.
+*
+* Return:
+*  bool: false if more input is needed.
+*
+*******************************************************************************/
+static bool read_header(http_inflate_t *inflater)
+{
+    uint32_t value;
+    uint32_t cmf;
+    uint32_t flg;
+
+    if (INFLATE_STATE_GZIP_HEADER == inflater->state)
+    {
+        if (inflater->bit_count < 8U)
+        {
+            return false;
+        }
+
+        value = take_bits(&inflater->bit_buffer, &inflater->bit_count, 8U);
+
+        if (((0U == inflater->remaining) && (GZIP_ID1 != value)) ||
+            ((1U == inflater->remaining) && (GZIP_ID2 != value)) ||
+            ((2U == inflater->remaining) && (GZIP_CM_DEFLATE != value)) ||
+            ((3U == inflater->remaining) &&
+             (0U != (value & GZIP_FLAG_RESERVED))))
+        {
+            inflater->state = INFLATE_STATE_ERROR;
+        }
+        else
+        {
+            if (3U == inflater->remaining)
+            {
+                inflater->gzip_flags = (uint8_t) value;
+            }
+
+            /* The time stamp, extra flags and OS bytes are ignored. */
+            inflater->remaining++;
+            if (GZIP_HEADER_LENGTH == inflater->remaining)
+            {
+                inflater->remaining = 0U;
+                inflater->state = INFLATE_STATE_GZIP_FIELDS;
+            }
+        }
+    }
+    else if (INFLATE_STATE_GZIP_FIELDS == inflater->state)
+    {
+        /* Optional fields are skipped one byte or one length at a time, in
+         * the order FEXTRA, FNAME, FCOMMENT, FHCRC.
+         */
+        if ((inflater->remaining > 0U) ||
+            ((0U == (inflater->gzip_flags & GZIP_FLAG_EXTRA)) &&
+             (0U != (inflater->gzip_flags &
+                     (GZIP_FLAG_NAME | GZIP_FLAG_COMMENT)))))
+        {
+            if (inflater->bit_count < 8U)
+            {
+                return false;
+            }
+
+            value = take_bits(&inflater->bit_buffer, &inflater->bit_count, 8U);
+
+            if (inflater->remaining > 0U)
+            {
+                inflater->remaining--;
+            }
+            else if ((0U == value) &&
+                     (0U != (inflater->gzip_flags & GZIP_FLAG_NAME)))
+            {
+                inflater->gzip_flags &= (uint8_t) ~GZIP_FLAG_NAME;
+            }
+            else if (0U == value)
+            {
+                inflater->gzip_flags &= (uint8_t) ~GZIP_FLAG_COMMENT;
+            }
+            else
+            {
+                /* Part of the file name or comment. */
+            }
+        }
+        else if (0U != (inflater->gzip_flags &
+                        (GZIP_FLAG_EXTRA | GZIP_FLAG_HCRC)))
+        {
+            if (inflater->bit_count < 16U)
+            {
+                return false;
+            }
+
+            value = take_bits(&inflater->bit_buffer, &inflater->bit_count, 16U);
+
+            if (0U != (inflater->gzip_flags & GZIP_FLAG_EXTRA))
+            {
+                inflater->gzip_flags &= (uint8_t) ~GZIP_FLAG_EXTRA;
+                inflater->remaining = value;
+            }
+            else
+            {
+                inflater->gzip_flags &= (uint8_t) ~GZIP_FLAG_HCRC;
+            }
+        }
+        else
+        {
+            inflater->check = CRC32_INIT;
+            inflater->state = INFLATE_STATE_BLOCK_HEADER;
+        }
+    }
+    else
+    {
+        if (inflater->bit_count < 16U)
+        {
+            return false;
+        }
+
+        /* Servers differ on whether "deflate" has the zlib header. A stream
+         * whose first two bytes are not a valid header is raw deflate.
+         */
+        cmf = (uint32_t)(inflater->bit_buffer & 0xFFU);
+        flg = (uint32_t)((inflater->bit_buffer >> 8) & 0xFFU);
+
+        if ((ZLIB_CM_DEFLATE == (cmf & 0x0FU)) &&
+            (0U == (((cmf << 8) | flg) % ZLIB_HEADER_CHECK)) &&
+            (0U == (flg & ZLIB_FLAG_DICT)) &&
+            (((cmf >> 4) + ZLIB_CINFO_OFFSET) <= HTTP_INFLATE_MAX_CODE_BITS))
+        {
+            (void) take_bits(&inflater->bit_buffer, &inflater->bit_count, 16U);
+            inflater->wrapper = WRAPPER_ZLIB;
+            inflater->check = ADLER32_INIT;
+
+            if (((cmf >> 4) + ZLIB_CINFO_OFFSET) > HTTP_INFLATE_WINDOW_BITS)
+            {
+                inflater->state = INFLATE_STATE_ERROR;
+            }
+            else
+            {
+                inflater->state = INFLATE_STATE_BLOCK_HEADER;
+            }
+        }
+        else
+        {
+            inflater->wrapper = WRAPPER_RAW;
+            inflater->state = INFLATE_STATE_BLOCK_HEADER;
+        }
+    }
+
+    return true;
+}
+
+/*******************************************************************************
+* Function Name: read_code_lengths
+********************************************************************************
+* Summary:
+*  Runs the states that read the code lengths of a dynamic block and builds
+*  its codes once all of them are read.
+*
+* Return:
+*  bool: false if more input is needed.
+*
+*******************************************************************************/
+static bool read_code_lengths(http_inflate_t *inflater)
+{
+    uint64_t bits;
+    uint32_t avail;
+    int32_t symbol;
+    uint32_t total = inflater->num_litlen + inflater->num_dist;
+    uint32_t repeat;
+    uint8_t value;
+
+    if (INFLATE_STATE_DYNAMIC_HEADER == inflater->state)
+    {
+        if (inflater->bit_count < 14U)
+        {
+            return false;
+        }
+
+        inflater->num_litlen = take_bits(&inflater->bit_buffer,
+                                         &inflater->bit_count, 5U) +
+                               FIRST_LENGTH_CODE;
+        inflater->num_dist = take_bits(&inflater->bit_buffer,
+                                       &inflater->bit_count, 5U) + 1U;
+        inflater->num_codelen = take_bits(&inflater->bit_buffer,
+                                          &inflater->bit_count, 4U) + 4U;
+        inflater->index = 0U;
+        (void) memset(inflater->lengths, 0, CODELEN_CODES);
+
+        inflater->state = ((inflater->num_litlen > MAX_LITLEN_CODES_USED) ||
+                           (inflater->num_dist > DIST_CODES)) ?
+                INFLATE_STATE_ERROR : INFLATE_STATE_CODELEN_LENGTHS;
+    }
+    else if (INFLATE_STATE_CODELEN_LENGTHS == inflater->state)
+    {
+        if (inflater->bit_count < 3U)
+        {
+            return false;
+        }
+
+        inflater->lengths[codelen_order[inflater->index]] = (uint8_t)
+                take_bits(&inflater->bit_buffer, &inflater->bit_count, 3U);
+        inflater->index++;
+
+        if (inflater->index == inflater->num_codelen)
+        {
+            /* The code length code is kept in the literal/length tables
+             * until the real code replaces it.
+             */
+            inflater->index = 0U;
+            inflater->state = build_huffman(&inflater->litlen,
+                                            inflater->lengths, CODELEN_CODES) ?
+                    INFLATE_STATE_CODE_LENGTHS : INFLATE_STATE_ERROR;
+        }
+    }
+    else if (inflater->index < total)
+    {
+        bits = inflater->bit_buffer;
+        avail = inflater->bit_count;
+        symbol = decode_symbol(&inflater->litlen, &bits, &avail);
+
+        if (DECODE_NEED_BITS == symbol)
+        {
+            return false;
+        }
+
+        if ((DECODE_BAD_CODE == symbol) ||
+            ((CODELEN_REPEAT_PREVIOUS == symbol) && (0U == inflater->index)))
+        {
+            inflater->state = INFLATE_STATE_ERROR;
+            return true;
+        }
+
+        if (symbol < (int32_t) CODELEN_REPEAT_PREVIOUS)
+        {
+            value = (uint8_t) symbol;
+            repeat = 1U;
+        }
+        else
+        {
+            /* 16: repeat the previous length 3-6 times, 17: 3-10 zeros,
+             * 18: 11-138 zeros.
+             */
+            uint32_t extra = (CODELEN_REPEAT_PREVIOUS == symbol) ? 2U :
+                    ((CODELEN_REPEAT_ZERO_SHORT == symbol) ? 3U : 7U);
+
+            if (avail < extra)
+            {
+                return false;
+            }
+
+            value = (CODELEN_REPEAT_PREVIOUS == symbol) ?
+                    inflater->lengths[inflater->index - 1U] : 0U;
+            repeat = take_bits(&bits, &avail, extra) +
+                    ((symbol > (int32_t) CODELEN_REPEAT_ZERO_SHORT) ? 11U : 3U);
+        }
+
+        if ((inflater->index + repeat) > total)
+        {
+            inflater->state = INFLATE_STATE_ERROR;
+            return true;
+        }
+
+        (void) memset(&inflater->lengths[inflater->index], value, repeat);
+        inflater->index += repeat;
+        inflater->bit_buffer = bits;
+        inflater->bit_count = avail;
+    }
+    else
+    {
+        inflater->state = ((0U != inflater->lengths[END_OF_BLOCK]) &&
+                build_huffman(&inflater->litlen, inflater->lengths,
+                              inflater->num_litlen) &&
+                build_huffman(&inflater->dist,
+                              &inflater->lengths[inflater->num_litlen],
+                              inflater->num_dist)) ?
+                INFLATE_STATE_CODES : INFLATE_STATE_ERROR;
+    }
+
+    return true;
+}
+
+/*******************************************************************************
+* Function Name: decode_codes
+********************************************************************************
+* Summary:
+*  Decodes literals and matches of a compressed block until the output is
+*  full, the input runs out or the block ends. A length and its distance
+*  are decoded together, so a match is never split between calls.
+*
+* Return:
+*  bool: false if more input or output space is needed.
+*
+*******************************************************************************/
+static bool decode_codes(http_inflate_t *inflater)
+{
+    uint64_t bits;
+    uint32_t avail;
+    int32_t symbol;
+    uint32_t length;
+    uint32_t distance;
+
+    while (INFLATE_STATE_CODES == inflater->state)
+    {
+        if (0U == inflater->avail_out)
+        {
+            return false;
+        }
+
+        refill(inflater);
+        bits = inflater->bit_buffer;
+        avail = inflater->bit_count;
+        symbol = decode_symbol(&inflater->litlen, &bits, &avail);
+
+        if (DECODE_NEED_BITS == symbol)
+        {
+            return false;
+        }
+
+        if (DECODE_BAD_CODE == symbol)
+        {
+            inflater->state = INFLATE_STATE_ERROR;
+        }
+        else if (symbol < (int32_t) END_OF_BLOCK)
+        {
+            put_byte(inflater, (uint8_t) symbol);
+        }
+        else if (END_OF_BLOCK == (uint32_t) symbol)
+        {
+            /* end_block aligns the committed bit buffer. */
+            inflater->bit_buffer = bits;
+            inflater->bit_count = avail;
+            end_block(inflater);
+            break;
+        }
+        else if ((uint32_t)(symbol - (int32_t) FIRST_LENGTH_CODE) >=
+                 LENGTH_CODES)
+        {
+            inflater->state = INFLATE_STATE_ERROR;
+        }
+        else
+        {
+            symbol -= (int32_t) FIRST_LENGTH_CODE;
+
+            if (avail < length_extra[symbol])
+            {
+                return false;
+            }
+            length = length_base[symbol] +
+                     take_bits(&bits, &avail, length_extra[symbol]);
+
+            symbol = decode_symbol(&inflater->dist, &bits, &avail);
+
+            if (DECODE_NEED_BITS == symbol)
+            {
+                return false;
+            }
+
+            if ((DECODE_BAD_CODE == symbol) || (symbol >= (int32_t) DIST_CODES))
+            {
+                inflater->state = INFLATE_STATE_ERROR;
+                return true;
+            }
+
+            if (avail < dist_extra[symbol])
+            {
+                return false;
+            }
+            distance = dist_base[symbol] +
+                       take_bits(&bits, &avail, dist_extra[symbol]);
+
+            if ((distance > inflater->total_out) ||
+                (distance > HTTP_INFLATE_WINDOW_LENGTH))
+            {
+                inflater->state = INFLATE_STATE_ERROR;
+                return true;
+            }
+
+            inflater->remaining = length;
+            inflater->distance = distance;
+            inflater->state = INFLATE_STATE_COPY;
+        }
+
+        inflater->bit_buffer = bits;
+        inflater->bit_count = avail;
+    }
+
+    return true;
+}
+
+/*******************************************************************************
+* Function Name: http_inflate_init
+********************************************************************************
+* Summary:
+*  Prepares an inflater for a new body.
+*
+* Parameters:
+*  inflater - Inflater
+*  coding   - HTTP_CODING_GZIP or HTTP_CODING_DEFLATE
+*
+*******************************************************************************/
+void http_inflate_init(http_inflate_t *inflater, http_coding_t coding)
+{
+    inflater->state = (HTTP_CODING_GZIP == coding) ?
+            INFLATE_STATE_GZIP_HEADER : INFLATE_STATE_ZLIB_HEADER;
+    inflater->wrapper = (HTTP_CODING_GZIP == coding) ?
+            WRAPPER_GZIP : WRAPPER_RAW;
+    inflater->gzip_flags = 0U;
+    inflater->final_block = false;
+    inflater->bit_buffer = 0U;
+    inflater->bit_count = 0U;
+    inflater->remaining = 0U;
+    inflater->check = 0U;
+    inflater->total_out = 0U;
+    inflater->window_pos = 0U;
+}
+
+/*******************************************************************************
+* Function Name: http_inflate
+********************************************************************************
+* Summary:
+*  Decodes the next piece of a compressed body. Decoding stops when the
+*  input is used up, the output is full or the stream ends; the caller then
+*  passes the rest of the input, a new output buffer or stops. Only the
+*  history window and a few bytes of input are kept between calls, so
+*  neither the compressed nor the decoded body has to fit in memory.
+*
+* Parameters:
+*  inflater - Inflater started with http_inflate_init
+*  in       - Compressed bytes
+*  in_len   - Number of compressed bytes
+*  consumed - Returns the number of bytes taken from in
+*  out      - Buffer for the decoded bytes
+*  out_len  - Size of out
+*  produced - Returns the number of bytes written to out
+*
+* Return:
+*  http_inflate_status_t: HTTP_INFLATE_MORE if all input was used,
+*  HTTP_INFLATE_OUTPUT_FULL if out is full, HTTP_INFLATE_DONE at the end of
+*  the stream after its checksum was verified, or HTTP_INFLATE_ERROR.
+*
+*******************************************************************************/
+http_inflate_status_t http_inflate(http_inflate_t *inflater,
+                                   const uint8_t *in, uint32_t in_len,
+                                   uint32_t *consumed, uint8_t *out,
+                                   uint32_t out_len, uint32_t *produced)
+{
+    http_inflate_status_t status;
+    bool progress = true;
+    uint32_t value;
+
+    inflater->next_in = in;
+    inflater->avail_in = in_len;
+    inflater->next_out = out;
+    inflater->avail_out = out_len;
+    inflater->check_start = out;
+
+    /* A step that cannot complete for lack of input or output space leaves
+     * its state unchanged and ends the call.
+     */
+    while (progress && (INFLATE_STATE_DONE != inflater->state) &&
+           (INFLATE_STATE_ERROR != inflater->state))
+    {
+        refill(inflater);
+
+        switch (inflater->state)
+        {
+            case INFLATE_STATE_GZIP_HEADER:
+            case INFLATE_STATE_GZIP_FIELDS:
+            case INFLATE_STATE_ZLIB_HEADER:
+            {
+                progress = read_header(inflater);
+                break;
+            }
+
+            case INFLATE_STATE_BLOCK_HEADER:
+            {
+                if (inflater->bit_count < 3U)
+                {
+                    progress = false;
+                    break;
+                }
+
+                inflater->final_block = (0U != take_bits(&inflater->bit_buffer,
+                        &inflater->bit_count, 1U));
+                value = take_bits(&inflater->bit_buffer, &inflater->bit_count,
+                                  2U);
+
+                if (BLOCK_STORED == value)
+                {
+                    /* LEN and NLEN start on a byte boundary. */
+                    inflater->bit_buffer >>= (inflater->bit_count & 7U);
+                    inflater->bit_count &= ~7U;
+                    inflater->state = INFLATE_STATE_STORED_HEADER;
+                }
+                else if (BLOCK_FIXED == value)
+                {
+                    build_fixed_codes(inflater);
+                    inflater->state = INFLATE_STATE_CODES;
+                }
+                else if (BLOCK_DYNAMIC == value)
+                {
+                    inflater->state = INFLATE_STATE_DYNAMIC_HEADER;
+                }
+                else
+                {
+                    inflater->state = INFLATE_STATE_ERROR;
+                }
+                break;
+            }
+
+            case INFLATE_STATE_STORED_HEADER:
+            {
+                if (inflater->bit_count < 32U)
+                {
+                    progress = false;
+                    break;
+                }
+
+                value = take_bits(&inflater->bit_buffer, &inflater->bit_count,
+                                  32U);
+                inflater->remaining = value & 0xFFFFU;
+                inflater->state = ((value >> 16) ==
+                                   (~value & 0xFFFFU)) ?
+                        INFLATE_STATE_STORED_COPY : INFLATE_STATE_ERROR;
+                break;
+            }
+
+            case INFLATE_STATE_STORED_COPY:
+            {
+                while ((inflater->remaining > 0U) &&
+                       (inflater->avail_out > 0U) &&
+                       (inflater->bit_count >= 8U))
+                {
+                    put_byte(inflater, (uint8_t) take_bits(
+                            &inflater->bit_buffer, &inflater->bit_count, 8U));
+                    inflater->remaining--;
+                    refill(inflater);
+                }
+
+                if (0U == inflater->remaining)
+                {
+                    end_block(inflater);
+                }
+                else
+                {
+                    progress = false;
+                }
+                break;
+            }
+
+            case INFLATE_STATE_DYNAMIC_HEADER:
+            case INFLATE_STATE_CODELEN_LENGTHS:
+            case INFLATE_STATE_CODE_LENGTHS:
+            {
+                progress = read_code_lengths(inflater);
+                break;
+            }
+
+            case INFLATE_STATE_CODES:
+            {
+                progress = decode_codes(inflater);
+                break;
+            }
+
+            case INFLATE_STATE_COPY:
+            {
+                while ((inflater->remaining > 0U) &&
+                       (inflater->avail_out > 0U))
+                {
+                    put_byte(inflater, inflater->window[
+                            (inflater->window_pos - inflater->distance) &
+                            WINDOW_MASK]);
+                    inflater->remaining--;
+                }
+
+                if (0U == inflater->remaining)
+                {
+                    inflater->state = INFLATE_STATE_CODES;
+                }
+                else
+                {
+                    progress = false;
+                }
+                break;
+            }
+
+            case INFLATE_STATE_TRAILER:
+            {
+                update_check(inflater);
+
+                if (inflater->bit_count < 32U)
+                {
+                    progress = false;
+                    break;
+                }
+
+                value = take_bits(&inflater->bit_buffer, &inflater->bit_count,
+                                  32U);
+
+                if (WRAPPER_ZLIB == inflater->wrapper)
+                {
+                    /* Adler-32 is stored most significant byte first. */
+                    value = ((value & 0x000000FFU) << 24) |
+                            ((value & 0x0000FF00U) << 8) |
+                            ((value & 0x00FF0000U) >> 8) |
+                            ((value & 0xFF000000U) >> 24);
+                    inflater->state = (value == inflater->check) ?
+                            INFLATE_STATE_DONE : INFLATE_STATE_ERROR;
+                }
+                else if (0U == inflater->remaining)
+                {
+                    /* gzip: CRC-32, then the length modulo 2^32. */
+                    inflater->remaining = 1U;
+                    inflater->state =
+                            (value == (inflater->check ^ CRC32_INIT)) ?
+                            INFLATE_STATE_TRAILER : INFLATE_STATE_ERROR;
+                }
+                else
+                {
+                    inflater->state = (value == inflater->total_out) ?
+                            INFLATE_STATE_DONE : INFLATE_STATE_ERROR;
+                }
+                break;
+            }
+
+            default:
+            {
+                inflater->state = INFLATE_STATE_ERROR;
+                break;
+            }
+        }
+    }
+
+    update_check(inflater);
+
+    if (INFLATE_STATE_DONE == inflater->state)
+    {
+        status = HTTP_INFLATE_DONE;
+    }
+    else if (INFLATE_STATE_ERROR == inflater->state)
+    {
+        status = HTTP_INFLATE_ERROR;
+    }
+    else if (0U == inflater->avail_out)
+    {
+        status = HTTP_INFLATE_OUTPUT_FULL;
+    }
+    else
+    {
+        status = HTTP_INFLATE_MORE;
+    }
+    *consumed = in_len - inflater->avail_in;
+    *produced = out_len - inflater->avail_out;
+
+    return status;
+}
+
+/*******************************************************************************
+* Function Name: put_bits
+********************************************************************************
+* Summary:
+*  Appends the low n bits (n <= 16) of a value to the compressed output,
+*  least significant first. Bytes that do not fit set the overflow flag.
+*
+*******************************************************************************/
+static void put_bits(bit_writer_t *writer, uint32_t value, uint32_t n)
+{
+    writer->bits |= value << writer->bit_count;
+    writer->bit_count += n;
+
+    while (writer->bit_count >= 8U)
+    {
+        if (writer->len < writer->size)
+        {
+            writer->out[writer->len] = (uint8_t) writer->bits;
+            writer->len++;
+        }
+        else
+        {
+            writer->overflow = true;
+        }
+
+        writer->bits >>= 8;
+        writer->bit_count -= 8U;
+    }
+}
+
+/*******************************************************************************
+* Function Name: put_fixed_symbol
+********************************************************************************
+* Summary:
+*  Appends the fixed Huffman code of a literal/length symbol.
+*
+*******************************************************************************/
+static void put_fixed_symbol(bit_writer_t *writer, uint32_t symbol)
+{
+    uint32_t code;
+    uint32_t len;
+
+    if (symbol < FIXED_LITLEN_8_BITS_END)
+    {
+        code = 0x30U + symbol;
+        len = 8U;
+    }
+    else if (symbol < FIXED_LITLEN_9_BITS_END)
+    {
+        code = 0x190U + (symbol - FIXED_LITLEN_8_BITS_END);
+        len = 9U;
+    }
+    else if (symbol < FIXED_LITLEN_7_BITS_END)
+    {
+        code = symbol - FIXED_LITLEN_9_BITS_END;
+        len = 7U;
+    }
+    else
+    {
+        code = 0xC0U + (symbol - FIXED_LITLEN_7_BITS_END);
+        len = 8U;
+    }
+
+    put_bits(writer, reverse_bits(code, len), len);
+}
+
+/*******************************************************************************
+* Function Name: put_match
+********************************************************************************
+* Summary:
+*  Appends a match of the given length and distance.
+*
+*******************************************************************************/
+static void put_match(bit_writer_t *writer, uint32_t length,
+                      uint32_t distance)
+{
+    uint32_t code = LENGTH_CODES - 1U;
+
+    while (length_base[code] > length)
+    {
+        code--;
+    }
+    put_fixed_symbol(writer, FIRST_LENGTH_CODE + code);
+    put_bits(writer, length - length_base[code], length_extra[code]);
+
+    code = DIST_CODES - 1U;
+    while (dist_base[code] > distance)
+    {
+        code--;
+    }
+    put_bits(writer, reverse_bits(code, FIXED_DIST_BITS), FIXED_DIST_BITS);
+    put_bits(writer, distance - dist_base[code], dist_extra[code]);
+}
+
+/*******************************************************************************
+* Function Name: hash3
+********************************************************************************
+* Summary:
+*  Hashes the three bytes at which a match would start.
+*
+*******************************************************************************/
+static uint32_t hash3(const uint8_t *data)
+{
+    uint32_t value = ((uint32_t) data[0] << 16) | ((uint32_t) data[1] << 8) |
+                     data[2];
+
+    return (value * DEFLATE_HASH_MULTIPLIER) >> (32U - DEFLATE_HASH_BITS);
+}
+
+/*******************************************************************************
+* Function Name: insert_position
+********************************************************************************
+* Summary:
+*  Adds a position of the input to the match finder.
+*
+*******************************************************************************/
+static void insert_position(const uint8_t *in, uint32_t pos)
+{
+    uint32_t hash = hash3(&in[pos]);
+    uint32_t previous = deflate_head[hash];
+
+    deflate_prev[pos & (DEFLATE_WINDOW_LENGTH - 1U)] =
+            ((0U != previous) &&
+             (((pos + 1U) - previous) <= DEFLATE_WINDOW_LENGTH)) ?
+            (uint16_t)((pos + 1U) - previous) : 0U;
+    deflate_head[hash] = pos + 1U;
+}
+
+/*******************************************************************************
+* Function Name: find_match
+********************************************************************************
+* Summary:
+*  Returns the longest earlier match of the bytes at pos, following at most
+*  DEFLATE_MAX_CHAIN earlier positions with the same hash.
+*
+*******************************************************************************/
+static uint32_t find_match(const uint8_t *in, uint32_t in_len, uint32_t pos,
+                           uint32_t *distance)
+{
+    uint32_t candidate = deflate_head[hash3(&in[pos])];
+    uint32_t max_len = ((in_len - pos) < MAX_MATCH) ? (in_len - pos) :
+                       MAX_MATCH;
+    uint32_t best = 0U;
+    uint32_t len;
+    uint16_t step;
+
+    for (uint32_t chain = 0U; (chain < DEFLATE_MAX_CHAIN) &&
+                              (0U != candidate); chain++)
+    {
+        candidate--;
+
+        if ((pos - candidate) > DEFLATE_WINDOW_LENGTH)
+        {
+            break;
+        }
+
+        len = 0U;
+        while ((len < max_len) && (in[candidate + len] == in[pos + len]))
+        {
+            len++;
+        }
+
+        if (len > best)
+        {
+            best = len;
+            *distance = pos - candidate;
+
+            if (len == max_len)
+            {
+                break;
+            }
+        }
+
+        step = deflate_prev[candidate & (DEFLATE_WINDOW_LENGTH - 1U)];
+        candidate = (0U != step) ? ((candidate + 1U) - step) : 0U;
+    }
+
+    return best;
+}
+
+/*******************************************************************************
+* Function Name: http_gzip_compress
+********************************************************************************
+* Summary:
+*  Compresses a request body into a gzip stream. The functions that keep the
+*  match finder are not reentrant; call them from one task.
+*
+* Parameters:
+*  in       - Body to compress
+*  in_len   - Length of the body
+*  out      - Buffer for the gzip stream
+*  out_size - Size of out. The stream is at most about 9/8 of in_len plus
+*             HTTP_GZIP_OVERHEAD bytes.
+*  out_len  - Returns the length of the gzip stream
+*
+* Return:
+*  cy_rslt_t: CY_RSLT_SUCCESS, or CY_RSLT_TYPE_ERROR if the stream does not
+*  fit in out.
+*
+*******************************************************************************/
+cy_rslt_t http_gzip_compress(const uint8_t *in, uint32_t in_len,
+                             uint8_t *out, uint32_t out_size,
+                             uint32_t *out_len)
+{
+    bit_writer_t writer =
+    {
+        .out = out, .size = out_size, .len = 0U,
+        .bits = 0U, .bit_count = 0U, .overflow = false
+    };
+    uint32_t crc = crc32_update(CRC32_INIT, in, in_len) ^ CRC32_INIT;
+    uint32_t pos = 0U;
+    uint32_t len;
+    uint32_t distance = 0U;
+    const uint8_t header[GZIP_HEADER_LENGTH] =
+    {
+        GZIP_ID1, GZIP_ID2, GZIP_CM_DEFLATE, 0U, 0U, 0U, 0U, 0U, 0U,
+        GZIP_OS_UNKNOWN
+    };
+
+    (void) memset(deflate_head, 0, sizeof(deflate_head));
+
+    for (uint32_t i = 0U; i < GZIP_HEADER_LENGTH; i++)
+    {
+        put_bits(&writer, header[i], 8U);
+    }
+
+    /* One final block with the fixed codes. */
+    put_bits(&writer, 1U, 1U);
+    put_bits(&writer, BLOCK_FIXED, 2U);
+
+    while ((pos < in_len) && !writer.overflow)
+    {
+        len = 0U;
+
+        if ((pos + MIN_MATCH) <= in_len)
+        {
+            len = find_match(in, in_len, pos, &distance);
+        }
+
+        if (len >= MIN_MATCH)
+        {
+            put_match(&writer, len, distance);
+        }
+        else
+        {
+            put_fixed_symbol(&writer, in[pos]);
+            len = 1U;
+        }
+
+        for (uint32_t i = 0U; i < len; i++)
+        {
+            if ((pos + MIN_MATCH) <= in_len)
+            {
+                insert_position(in, pos);
+            }
+            pos++;
+        }
+    }
+
+    put_fixed_symbol(&writer, END_OF_BLOCK);
+    put_bits(&writer, 0U, (8U - writer.bit_count) & 7U);
+
+    for (uint32_t i = 0U; i < 4U; i++)
+    {
+        put_bits(&writer, (crc >> (8U * i)) & 0xFFU, 8U);
+    }
+    for (uint32_t i = 0U; i < 4U; i++)
+    {
+        put_bits(&writer, (in_len >> (8U * i)) & 0xFFU, 8U);
+    }
+
+    *out_len = writer.len;
+
+    return writer.overflow ? CY_RSLT_TYPE_ERROR : CY_RSLT_SUCCESS;
+}
+
+/* [] END OF FILE */
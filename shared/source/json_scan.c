@@ -0,0 +1,414 @@
+/*******************************************************************************
+* File Name: json_scan.c
+*
+* Description: This file contains an incremental JSON scanner. It checks the
+* syntax of a document fed in pieces of any size, and counts its values, keys,
+* objects and arrays, in constant memory. It is built into both the CM33 and
+* the CM55 images.
+*
+* Related Document: See README.md
+********************************************************************************
+* Copyright 2024-2025, Cypress Semiconductor Corporation (an Infineon company) or
+* an affiliate of Cypress Semiconductor Corporation.  All rights reserved.
+*
+* This software, including source code, documentation and related
+* materials ("Software") is owned by Cypress Semiconductor Corporation
+* or one of its affiliates ("Cypress") and is protected by and subject to
+* worldwide patent protection (United States and foreign),
+* United States copyright laws and international treaty provisions.
+* Therefore, you may use this Software only as provided in the license
+* agreement accompanying the software package from which you
+* obtained this Software ("EULA").
+* If no EULA applies, Cypress hereby grants you a personal, non-exclusive,
+* non-transferable license to copy, modify, and compile the Software
+* source code solely for use in connection with Cypress's
+* integrated circuit products.  Any reproduction, modification, translation,
+* compilation, or representation of this Software except as specified
+* above is prohibited without the express written permission of Cypress.
+*
+* Disclaimer: THIS SOFTWARE IS PROVIDED AS-IS, WITH NO WARRANTY OF ANY KIND,
+* EXPRESS OR IMPLIED, INCLUDING, BUT NOT LIMITED TO, NONINFRINGEMENT, IMPLIED
+* WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE. Cypress
+* reserves the right to make changes to the Software without notice. Cypress
+* does not assume any liability arising out of the application or use of the
+* Software or any product or circuit described in the Software. Cypress does
+* not authorize its products for use in any products where a malfunction or
+* failure of the Cypress product may reasonably be expected to result in
+* significant property damage, injury or death ("High Risk Product"). By
+* including Cypress's product in a High Risk Product, the manufacturer
+* of such system or application assumes all risk of such use and in doing
+* so agrees to indemnify Cypress against all liability.
+*******************************************************************************/
+
+/*******************************************************************************
+* Header Files
+*******************************************************************************/
+#include "json_scan.h"
+
+/* Standard C header files */
+#include <stddef.h>
+#include <string.h>
+
+/*******************************************************************************
+* Macros
+*******************************************************************************/
+#define UNICODE_ESCAPE_DIGITS                        (4U)
+
+/* Token being read. */
+#define TOKEN_NONE                                   (0U)
+#define TOKEN_STRING                                 (1U)
+#define TOKEN_ESCAPE                                 (2U)
+#define TOKEN_UNICODE                                (3U)
+#define TOKEN_NUMBER                                 (4U)
+#define TOKEN_LITERAL                                (5U)
+
+/* What the grammar accepts next. */
+#define EXPECT_VALUE                                 (0U)
+#define EXPECT_VALUE_OR_CLOSE                        (1U)
+#define EXPECT_KEY                                   (2U)
+#define EXPECT_KEY_OR_CLOSE                          (3U)
+#define EXPECT_COLON                                 (4U)
+#define EXPECT_COMMA_OR_CLOSE                        (5U)
+#define EXPECT_END                                   (6U)
+
+/*******************************************************************************
+* Function Definitions
+*******************************************************************************/
+
+/*******************************************************************************
+* Function Name: in_object
+********************************************************************************
+* Summary:
+*  Checks whether the innermost open container is an object.
+*
+*******************************************************************************/
+static bool in_object(const json_scan_t *scan)
+{
+    return ((scan->depth > 0U) &&
+            (0U != (scan->nesting & (1UL << (scan->depth - 1U)))));
+}
+
+/*******************************************************************************
+* Function Name: expects_value
+********************************************************************************
+* Summary:
+*  Checks whether a value may start here.
+*
+*******************************************************************************/
+static bool expects_value(const json_scan_t *scan)
+{
+    return ((EXPECT_VALUE == scan->expect) ||
+            (EXPECT_VALUE_OR_CLOSE == scan->expect));
+}
+
+/*******************************************************************************
+* Function Name: value_done
+********************************************************************************
+* Summary:
+*  Records a complete value and moves on to what may follow it.
+*
+*******************************************************************************/
+static void value_done(json_scan_t *scan)
+{
+    scan->summary.values++;
+    scan->expect = (0U == scan->depth) ? EXPECT_END : EXPECT_COMMA_OR_CLOSE;
+}
+
+/*******************************************************************************
+* Function Name: open_container
+********************************************************************************
+* Summary:
+*  Handles '{' and '['.
+*
+*******************************************************************************/
+static bool open_container(json_scan_t *scan, bool object)
+{
+    bool valid = expects_value(scan) && (scan->depth < JSON_SCAN_MAX_DEPTH);
+
+    if (valid)
+    {
+        if (object)
+        {
+            scan->nesting |= (1UL << scan->depth);
+            scan->summary.objects++;
+            scan->expect = EXPECT_KEY_OR_CLOSE;
+        }
+        else
+        {
+            scan->nesting &= ~(1UL << scan->depth);
+            scan->summary.arrays++;
+            scan->expect = EXPECT_VALUE_OR_CLOSE;
+        }
+
+        scan->depth++;
+
+        if (scan->depth > scan->summary.max_depth)
+        {
+            scan->summary.max_depth = scan->depth;
+        }
+    }
+
+    return valid;
+}
+
+/*******************************************************************************
+* Function Name: close_container
+********************************************************************************
+* Summary:
+*  Handles '}' and ']'.
+*
+*******************************************************************************/
+static bool close_container(json_scan_t *scan, bool object)
+{
+    bool valid = (scan->depth > 0U) && (in_object(scan) == object) &&
+                 ((EXPECT_COMMA_OR_CLOSE == scan->expect) ||
+                  (object && (EXPECT_KEY_OR_CLOSE == scan->expect)) ||
+                  (!object && (EXPECT_VALUE_OR_CLOSE == scan->expect)));
+
+    if (valid)
+    {
+        scan->depth--;
+        value_done(scan);
+    }
+
+    return valid;
+}
+
+/*******************************************************************************
+* Function Name: scan_structure
+********************************************************************************
+* Summary:
+*  Handles a character outside of any token.
+*
+*******************************************************************************/
+static bool scan_structure(json_scan_t *scan, uint8_t c)
+{
+    bool valid = true;
+
+    switch (c)
+    {
+        case ' ':
+        case '\t':
+        case '\r':
+        case '\n':
+            break;
+        case '{':
+        case '[':
+            valid = open_container(scan, ('{' == c));
+            break;
+        case '}':
+        case ']':
+            valid = close_container(scan, ('}' == c));
+            break;
+        case '"':
+            scan->in_key = ((EXPECT_KEY == scan->expect) ||
+                            (EXPECT_KEY_OR_CLOSE == scan->expect));
+            valid = scan->in_key || expects_value(scan);
+            scan->token = TOKEN_STRING;
+            break;
+        case ':':
+            valid = (EXPECT_COLON == scan->expect);
+            scan->expect = EXPECT_VALUE;
+            break;
+        case ',':
+            valid = (EXPECT_COMMA_OR_CLOSE == scan->expect);
+            scan->expect = in_object(scan) ? EXPECT_KEY : EXPECT_VALUE;
+            break;
+        case 't':
+        case 'f':
+        case 'n':
+            valid = expects_value(scan);
+            scan->literal = ('t' == c) ? "true" :
+                            (('f' == c) ? "false" : "null");
+            scan->literal_pos = 1U;
+            scan->token = TOKEN_LITERAL;
+            break;
+        default:
+            valid = expects_value(scan) &&
+                    (('-' == c) || ((c >= '0') && (c <= '9')));
+            scan->token = TOKEN_NUMBER;
+            break;
+    }
+
+    return valid;
+}
+
+/*******************************************************************************
+* Function Name: json_scan_init
+********************************************************************************
+* Summary:
+*  Prepares the scanner for a new document.
+*
+*******************************************************************************/
+void json_scan_init(json_scan_t *scan)
+{
+    (void) memset(scan, 0, sizeof(*scan));
+    scan->token = TOKEN_NONE;
+    scan->expect = EXPECT_VALUE;
+    scan->summary.status = (uint32_t) JSON_SCAN_MORE;
+}
+
+/*******************************************************************************
+* Function Name: json_scan_feed
+********************************************************************************
+* Summary:
+*  Scans the next piece of the document.
+*
+* Parameters:
+*  scan - Scanner state
+*  data - Next bytes of the document
+*  len  - Number of bytes
+*
+* Return:
+*  json_scan_status_t: JSON_SCAN_INVALID as soon as a syntax error is found,
+*  JSON_SCAN_COMPLETE once a whole value was read, JSON_SCAN_MORE otherwise.
+*
+*******************************************************************************/
+json_scan_status_t json_scan_feed(json_scan_t *scan, const uint8_t *data,
+                                  uint32_t len)
+{
+    bool valid = true;
+    uint32_t i = 0U;
+
+    while (valid && (i < len) &&
+           ((uint32_t) JSON_SCAN_INVALID != scan->summary.status))
+    {
+        uint8_t c = data[i];
+        bool consumed = true;
+
+        switch (scan->token)
+        {
+            case TOKEN_STRING:
+                if ('"' == c)
+                {
+                    scan->token = TOKEN_NONE;
+
+                    if (scan->in_key)
+                    {
+                        scan->summary.keys++;
+                        scan->expect = EXPECT_COLON;
+                    }
+                    else
+                    {
+                        value_done(scan);
+                    }
+                }
+                else if ('\\' == c)
+                {
+                    scan->token = TOKEN_ESCAPE;
+                }
+                else
+                {
+                    valid = (c >= 0x20U);
+                }
+                break;
+            case TOKEN_ESCAPE:
+                if ('u' == c)
+                {
+                    scan->unicode_left = UNICODE_ESCAPE_DIGITS;
+                    scan->token = TOKEN_UNICODE;
+                }
+                else
+                {
+                    valid = (NULL != strchr("\"\\/bfnrt", c)) && ('\0' != c);
+                    scan->token = TOKEN_STRING;
+                }
+                break;
+            case TOKEN_UNICODE:
+                valid = (((c >= '0') && (c <= '9')) ||
+                         ((c >= 'a') && (c <= 'f')) ||
+                         ((c >= 'A') && (c <= 'F')));
+                if (0U == --scan->unicode_left)
+                {
+                    scan->token = TOKEN_STRING;
+                }
+                break;
+            case TOKEN_NUMBER:
+                if (((c >= '0') && (c <= '9')) || ('.' == c) || ('e' == c) ||
+                    ('E' == c) || ('+' == c) || ('-' == c))
+                {
+                    break;
+                }
+                /* The number ended; this character is scanned again. */
+                scan->token = TOKEN_NONE;
+                value_done(scan);
+                consumed = false;
+                break;
+            case TOKEN_LITERAL:
+                valid = ((char) c == scan->literal[scan->literal_pos]);
+                scan->literal_pos++;
+                if (valid && ('\0' == scan->literal[scan->literal_pos]))
+                {
+                    scan->token = TOKEN_NONE;
+                    value_done(scan);
+                }
+                break;
+            default:
+                valid = (EXPECT_END == scan->expect) ?
+                        ((' ' == c) || ('\t' == c) || ('\r' == c) ||
+                         ('\n' == c)) :
+                        scan_structure(scan, c);
+                break;
+        }
+
+        if (consumed && valid)
+        {
+            i++;
+            scan->summary.bytes++;
+        }
+    }
+
+    if (!valid)
+    {
+        scan->summary.status = (uint32_t) JSON_SCAN_INVALID;
+        scan->summary.error_offset = scan->summary.bytes;
+    }
+    else if ((EXPECT_END == scan->expect) && (TOKEN_NONE == scan->token))
+    {
+        scan->summary.status = (uint32_t) JSON_SCAN_COMPLETE;
+    }
+    else
+    {
+        /* More of the document is needed. */
+    }
+
+    return (json_scan_status_t) scan->summary.status;
+}
+
+/*******************************************************************************
+* Function Name: json_scan_finish
+********************************************************************************
+* Summary:
+*  Ends the document. A number at the end of the document is complete here.
+*
+* Return:
+*  json_scan_status_t: JSON_SCAN_COMPLETE if the document is valid JSON,
+*  JSON_SCAN_INVALID otherwise.
+*
+*******************************************************************************/
+json_scan_status_t json_scan_finish(json_scan_t *scan)
+{
+    if ((uint32_t) JSON_SCAN_INVALID != scan->summary.status)
+    {
+        if (TOKEN_NUMBER == scan->token)
+        {
+            scan->token = TOKEN_NONE;
+            value_done(scan);
+        }
+
+        if ((EXPECT_END == scan->expect) && (TOKEN_NONE == scan->token))
+        {
+            scan->summary.status = (uint32_t) JSON_SCAN_COMPLETE;
+        }
+        else
+        {
+            scan->summary.status = (uint32_t) JSON_SCAN_INVALID;
+            scan->summary.error_offset = scan->summary.bytes;
+        }
+    }
+
+    return (json_scan_status_t) scan->summary.status;
+}
+
+
+/* [] END OF FILE */